@@ -0,0 +1,199 @@
+#!/usr/bin/env python
+
+# fat_image.py
+# Description: Makes a FAT32 disk image holding the given files in its root directory, so the firmware's FAT32
+#              reader can be tried on the host (music_sim -d) without a card reader or root access.
+#              - The volume is laid out the way mkfs.vfat -F 32 lays out a whole device: 32 reserved sectors,
+#                the FS information sector in sector 1, a backup boot sector in sector 6, two FATs and the
+#                root directory in cluster 2. --mbr puts it in the first partition of a master boot record instead.
+#              - Files are stored under their 8.3 names in upper case, as mcopy does for names that fit.
+#              - --fragment, --gap and --deleted lay files and the directory out the way a well used card
+#                would, to exercise the cluster chain and directory walks.
+#              - The songs go on the card as the library written by sd_image.py (or music_sim -w), named
+#                SONGS.LIB, see song_stream.h.
+
+import argparse
+import os
+import struct
+import sys
+
+FAT_SECTOR_SIZE = 512
+FAT_RESERVED_SECTORS = 32
+FAT_NUM_FATS = 2
+FAT_FSINFO_SECTOR = 1
+FAT_BACKUP_BOOT_SECTOR = 6
+FAT_ROOT_CLUSTER = 2
+FAT_MIN_CLUSTERS = 65525                # Fewer clusters than this make a FAT16 volume
+FAT_END_OF_CHAIN = 0x0FFFFFFF
+FAT_DIR_ENTRY_SIZE = 32
+FAT_ATTR_VOLUME_ID = 0x08
+FAT_ATTR_ARCHIVE = 0x20
+FAT_ATTR_LONG_NAME = 0x0F
+FAT_DIR_DELETED = 0xE5
+MBR_PARTITION_START = 2048              # First sector of the partition, as fdisk places it
+MBR_TYPE_FAT32_LBA = 0x0C
+
+
+def short_name(file_name):
+    """Returns the 11 byte directory entry name of a file, or None if its name is not 8.3."""
+    base = os.path.basename(file_name).upper()
+    (name, dot, extension) = base.partition(".")
+    if not name or len(name) > 8 or len(extension) > 3 or "." in extension:
+        return None
+    return (name.ljust(8) + extension.ljust(3)).encode("ascii")
+
+
+class FatVolume:
+    def __init__(self, sectors, sectors_per_cluster):
+        self.spc = sectors_per_cluster
+        self.cluster_size = sectors_per_cluster * FAT_SECTOR_SIZE
+
+        # Grow the FAT until it covers every cluster left after it, as mkfs.vfat does
+        self.fat_sectors = 1
+        while True:
+            self.clusters = (sectors - FAT_RESERVED_SECTORS - (FAT_NUM_FATS * self.fat_sectors)) // sectors_per_cluster
+            needed = ((self.clusters + 2) * 4 + FAT_SECTOR_SIZE - 1) // FAT_SECTOR_SIZE
+            if needed <= self.fat_sectors:
+                break
+            self.fat_sectors = needed
+
+        if self.clusters < FAT_MIN_CLUSTERS:
+            print("Error: {} clusters is too few for FAT32, make the volume bigger.".format(self.clusters))
+            sys.exit(1)
+
+        self.sectors = sectors
+        self.data_start = FAT_RESERVED_SECTORS + (FAT_NUM_FATS * self.fat_sectors)
+        self.fat = [0] * (self.clusters + 2)
+        self.fat[0] = 0x0FFFFFF8
+        self.fat[1] = FAT_END_OF_CHAIN
+        self.data = {}
+        self.next_cluster = FAT_ROOT_CLUSTER
+
+    def allocate(self, count, fragment, gap):
+        """Allocates a chain of count clusters, leaving gap clusters free after every fragment clusters."""
+        chain = []
+        while len(chain) < count:
+            if fragment and chain and len(chain) % fragment == 0:
+                self.next_cluster += gap
+            if self.next_cluster >= self.clusters + 2:
+                print("Error: the files do not fit on the volume.")
+                sys.exit(1)
+            chain.append(self.next_cluster)
+            self.next_cluster += 1
+
+        for (i, cluster) in enumerate(chain):
+            self.fat[cluster] = chain[i + 1] if i + 1 < len(chain) else FAT_END_OF_CHAIN
+        return chain
+
+    def write_chain(self, chain, data):
+        for (i, cluster) in enumerate(chain):
+            self.data[cluster] = data[i * self.cluster_size:(i + 1) * self.cluster_size]
+
+    def image(self, hidden_sectors, label):
+        boot = bytearray(FAT_SECTOR_SIZE)
+        boot[0:3] = b"\xEB\x58\x90"
+        boot[3:11] = b"mkfs.fat"
+        struct.pack_into("<HBHBHHBHHHII", boot, 11, FAT_SECTOR_SIZE, self.spc, FAT_RESERVED_SECTORS, FAT_NUM_FATS,
+                         0, 0, 0xF8, 0, 32, 64, hidden_sectors, self.sectors)
+        struct.pack_into("<IHHIHH", boot, 36, self.fat_sectors, 0, 0, FAT_ROOT_CLUSTER, FAT_FSINFO_SECTOR,
+                         FAT_BACKUP_BOOT_SECTOR)
+        struct.pack_into("<BBBI", boot, 64, 0x80, 0, 0x29, 0x1234ABCD)
+        boot[71:82] = label
+        boot[82:90] = b"FAT32   "
+        boot[510:512] = b"\x55\xAA"
+
+        used = sum(1 for entry in self.fat[2:] if entry != 0)
+        fsinfo = bytearray(FAT_SECTOR_SIZE)
+        struct.pack_into("<I", fsinfo, 0, 0x41615252)
+        struct.pack_into("<III", fsinfo, 484, 0x61417272, self.clusters - used, self.next_cluster)
+        struct.pack_into("<I", fsinfo, 508, 0xAA550000)
+
+        volume = bytearray(self.data_start * FAT_SECTOR_SIZE)
+        for (sector, data) in ((0, boot), (FAT_FSINFO_SECTOR, fsinfo),
+                               (FAT_BACKUP_BOOT_SECTOR, boot), (FAT_BACKUP_BOOT_SECTOR + 1, fsinfo)):
+            volume[sector * FAT_SECTOR_SIZE:(sector + 1) * FAT_SECTOR_SIZE] = data
+
+        fat = struct.pack("<{}I".format(len(self.fat)), *self.fat)
+        for copy in range(FAT_NUM_FATS):
+            offset = (FAT_RESERVED_SECTORS + (copy * self.fat_sectors)) * FAT_SECTOR_SIZE
+            volume[offset:offset + len(fat)] = fat
+
+        # Clusters are written in order; the rest of the volume is left empty
+        last = max(self.data) if self.data else FAT_ROOT_CLUSTER
+        clusters = bytearray((last - 1) * self.cluster_size)
+        for (cluster, data) in self.data.items():
+            offset = (cluster - 2) * self.cluster_size
+            clusters[offset:offset + len(data)] = data
+        return volume + clusters
+
+
+parser = argparse.ArgumentParser()
+parser.add_argument("image", help="Disk image file to write")
+parser.add_argument("files", nargs="+", help="Files to put in the root directory, under their names in upper case")
+parser.add_argument("--size", type=int, default=64, help="Size of the volume in MiB (default: 64)")
+parser.add_argument("--cluster", type=int, default=1, choices=[1, 2, 4, 8, 16, 32, 64, 128],
+                    help="Sectors per cluster (default: 1, as mkfs.vfat makes up to 260 MiB)")
+parser.add_argument("--mbr", action="store_true", help="Put the volume in a partition of a master boot record")
+parser.add_argument("--fragment", type=int, default=0, help="Leave free clusters after every this many clusters of each file")
+parser.add_argument("--gap", type=int, default=1, help="Free clusters left by --fragment (default: 1)")
+parser.add_argument("--deleted", type=int, default=0,
+                    help="Deleted files, each with a long name entry, to put in the directory before the files")
+args = parser.parse_args()
+
+volume = FatVolume((args.size * 1024 * 1024) // FAT_SECTOR_SIZE, args.cluster)
+label = b"EIESONGS   "
+
+# Directory entries: the volume label, deleted long name files, then the files
+entries = bytearray(label + bytearray([FAT_ATTR_VOLUME_ID]) + bytearray(20))
+for deleted in range(args.deleted):
+    long_name = bytearray(FAT_DIR_ENTRY_SIZE)
+    long_name[0] = FAT_DIR_DELETED
+    long_name[11] = FAT_ATTR_LONG_NAME
+    short = bytearray("~OLD{:04d}TXT".format(deleted).encode("ascii"))
+    short[0] = FAT_DIR_DELETED
+    entries += long_name + short + bytearray([FAT_ATTR_ARCHIVE]) + bytearray(20)
+
+files = []
+for file_name in args.files:
+    name = short_name(file_name)
+    if name is None:
+        print("Error: {} is not an 8.3 name.".format(os.path.basename(file_name)))
+        sys.exit(1)
+    with open(file_name, "rb") as in_file:
+        files.append((name, in_file.read()))
+    entries += bytearray(FAT_DIR_ENTRY_SIZE)
+
+# Root directory first, then each file
+directory_chain = volume.allocate((len(entries) + volume.cluster_size) // volume.cluster_size, args.fragment, args.gap)
+offset = FAT_DIR_ENTRY_SIZE * (1 + (2 * args.deleted))
+for (name, data) in files:
+    chain = volume.allocate(max(1, (len(data) + volume.cluster_size - 1) // volume.cluster_size), args.fragment, args.gap)
+    if not data:
+        volume.fat[chain[0]] = 0
+        chain = [0]
+    volume.write_chain(chain, data)
+    struct.pack_into("<11sB8xHHHHI", entries, offset, name, FAT_ATTR_ARCHIVE, chain[0] >> 16, 0, 0,
+                     chain[0] & 0xFFFF, len(data))
+    print("{}: {} bytes, clusters {} - {} in {} runs".format(name[0:8].decode().strip() + "." + name[8:].decode().strip(),
+          len(data), chain[0], chain[-1], 1 + sum(1 for (a, b) in zip(chain, chain[1:]) if b != a + 1)))
+    offset += FAT_DIR_ENTRY_SIZE
+
+# The directory ends with an empty entry, which the allocation above left room for
+entries += bytearray(len(directory_chain) * volume.cluster_size - len(entries))
+volume.write_chain(directory_chain, entries)
+
+image = volume.image(MBR_PARTITION_START if args.mbr else 0, label)
+out = open(args.image, "wb")
+if args.mbr:
+    mbr = bytearray(MBR_PARTITION_START * FAT_SECTOR_SIZE)
+    struct.pack_into("<B3sB3sII", mbr, 446, 0, b"\xFE\xFF\xFF", MBR_TYPE_FAT32_LBA, b"\xFE\xFF\xFF",
+                     MBR_PARTITION_START, volume.sectors)
+    mbr[510:512] = b"\x55\xAA"
+    out.write(mbr)
+out.write(image)
+out.truncate((MBR_PARTITION_START if args.mbr else 0) * FAT_SECTOR_SIZE + volume.sectors * FAT_SECTOR_SIZE)
+out.close()
+
+print("{} written: FAT32, {} clusters of {} bytes, FATs of {} sectors{}.".format(
+      args.image, volume.clusters, volume.cluster_size, volume.fat_sectors,
+      ", partition at sector {}".format(MBR_PARTITION_START) if args.mbr else ""))
@@ -4,20 +4,69 @@
 # Description: Takes 2 input MIDI track files and generates code for the EiE firmware.
 #              - 2 input MIDI files (ideally each containing a single track) for 2 buzzers on the EiE board.
 #              - If an input is left blank, a "NO" note will be generated for that buzzer.
-#              - Notes are translated into frequencies.
-#              - Note times are re-calculated into milliseconds.
+#              - Notes are kept as MIDI note numbers (shifted if requested), 0 is a silent note.
+#              - Note times are re-calculated into milliseconds through the file's tempo map.
+#              - Notes are packed into a compact byte stream that the firmware decodes one note at a time.
+#              - Repeated runs of notes are stored once in a phrase table and played from a playlist per buzzer.
+#              - Each voice gets a seek table, one note every few seconds, so the firmware can start a song part way.
 # By: Ivan Chow
 # March 9, 2018
 
 import argparse
 import os
+import struct
+import sys
 import mido
 from mido import MidiFile, MidiTrack
 
 LOW_NOTE_FREQ_THRESHOLD = 100
 
-# Parses the given MIDI file and returns a list of notes (in frequency) and note durations (in milliseconds)
+# PWM peripheral clock on the EiE board (CPRE_CLCK = 48 MHz / 8), must match eief1-pcb-01.h
+PWM_CLOCK_HZ = 6000000
+
+# Largest value the 16-bit PWM channel period register can hold
+PWM_PERIOD_MAX = 65535
+
+# Longest note duration the firmware can hold (u16)
+NOTE_DURATION_MAX_MS = 65535
+
+# Parsed notes are held in lists of ( MIDI note number, duration in ms ) with 0 as the silent note
+SILENT_NOTE = 0
+
+# Shortest run of notes worth storing as a shared phrase, shorter runs cost more in table entries than they save
+MIN_PHRASE_NOTES = 4
+
+# Number of earlier places a run of notes is compared against when looking for a repeat
+MAX_PHRASE_CANDIDATES = 64
+
+# Tempo in us/beat until a file's first tempo message (120 beats per minute)
+DEFAULT_MIDI_TEMPO = 500000
+
+# Phrase offsets, sizes and repeat counts are u16 in the firmware
+PHRASE_FIELD_MAX = 65535
+
+# Size in bytes of one phrase table entry and one playlist entry in the firmware
+PHRASE_ENTRY_SIZE = 4
+PLAYLIST_ENTRY_SIZE = 4
+
+# Song time in ms between a voice's seek points, and the size in bytes of one seek point in the firmware
+# Seeking decodes at most this much of every voice, a few dozen notes, so a finer table is not worth its flash
+SEEK_INTERVAL_MS = 4000
+SEEK_POINT_SIZE = 12
+
+# SD card song file layout, must match song_stream.h
+SD_SECTOR_SIZE = 512
+SD_SONG_MAGIC = b"EIESONG1"
+SD_SONG_VOICES_INDEX = 8
+SD_SONG_TEXT_SIZE = 64
+SD_SONG_TITLE_INDEX = 16
+SD_SONG_ARTIST_INDEX = SD_SONG_TITLE_INDEX + SD_SONG_TEXT_SIZE
+SD_SONG_VOICE_INDEX = SD_SONG_ARTIST_INDEX + SD_SONG_TEXT_SIZE
+
+# Parses the given MIDI file and returns a list of notes (MIDI note numbers) and note durations (in milliseconds)
 # If MIDI file is not specified, returns an empty list
+# Every message is timed from the start of its track through the file's tempo map, and only that absolute time is
+# rounded to the nearest ms, so rounding never builds up over the song and tempo changes are followed.
 def parse_notes_and_duration(input_mid_file, note_shift):
     # No input file
     if input_mid_file is None:
@@ -26,42 +75,87 @@ def parse_notes_and_duration(input_mid_file, note_shift):
     # Open MIDI file and get some of its information
     in_mid = MidiFile(input_mid_file)
     ticks_per_beat = in_mid.ticks_per_beat
-    tempo = find_tempo(in_mid)
+    tempo_map = get_tempo_map(in_mid)
 
     notes_list = []
 
-    # Parse messages
-    for i, track in enumerate(in_mid.tracks):
+    for track_notes in get_track_note_messages(in_mid, note_shift):
+        # Each track is played after the previous one, timed from its own start
+        prev_time_ms = 0
+
+        for (time_ticks, note_val) in track_notes:
+            time_ms = int(round(midi_ticks_to_exact_ms(time_ticks, ticks_per_beat, tempo_map)))
+            notes_list.append( (note_val, time_ms - prev_time_ms) )
+            prev_time_ms = time_ms
+
+    return notes_list
+
+# Returns the note messages of every track as lists of ( absolute time in ticks, MIDI note number )
+# Note numbers are shifted, "note off" and 0 velocity "note on" messages are silent notes
+def get_track_note_messages(midi_file, note_shift):
+    tracks = []
+
+    for track in midi_file.tracks:
+        track_notes = []
+        time_ticks = 0
+
         for msg in track:
-            # Convert message to dictionary type
-            msg_dict = msg.dict()
+            # Every message's delta time counts, including the ones that are not notes
+            time_ticks += msg.time
 
-            # Look for "note on" or "note off" messages
-            if msg.type is 'note_on':
-                # Look for delta time for this message, convert to ms
-                delta_time_ticks = int(msg_dict['time'])
-                delta_time_ms = midi_ticks_to_ms(delta_time_ticks, ticks_per_beat, tempo)
+            if msg.type == 'note_on' and msg.velocity != 0:
+                # Shift the note number, frequencies are looked up from it on the board
+                track_notes.append( (time_ticks, msg.note + note_shift) )
+            elif msg.type == 'note_on' or msg.type == 'note_off':
+                track_notes.append( (time_ticks, SILENT_NOTE) )
 
-                # 0 velocity is the same as "note off"
-                if int(msg_dict['velocity']) is 0:
-                    notes_list.append( (0, delta_time_ms) )
-                else:
-                    # Convert note message number into frequency
-                    note_val = int(msg_dict['note'])
-                    note_freq = midi_note_to_freq(note_val, note_shift)
+        tracks.append(track_notes)
 
-                    notes_list.append( (note_freq, delta_time_ms) )
+    return tracks
 
-            elif msg.type is 'note_off':
-                # Look for delta time for this message, convert to ms
-                delta_time_ticks = int(msg_dict['time'])
-                delta_time_ms = midi_ticks_to_ms(delta_time_ticks, ticks_per_beat, tempo)
+# Returns the tempo map of the file as a list of ( absolute time in ticks, tempo in us/beat ), in time order
+# Tempo messages from every track apply to the whole file. Until the first one the MIDI default tempo applies.
+def get_tempo_map(midi_file):
+    tempo_map = []
 
-                notes_list.append( (0, delta_time_ms) )
+    for track in midi_file.tracks:
+        time_ticks = 0
 
-    return notes_list
+        for msg in track:
+            time_ticks += msg.time
+
+            if msg.type == 'set_tempo':
+                tempo_map.append( (time_ticks, msg.tempo) )
+
+    # Stable sort, so a later tempo message at the same tick wins
+    tempo_map.sort(key=lambda change: change[0])
+
+    if not tempo_map or tempo_map[0][0] != 0:
+        tempo_map.insert(0, (0, DEFAULT_MIDI_TEMPO))
+
+    return tempo_map
+
+# Converts an absolute time in ticks into milliseconds, following every tempo change up to that time
+# Not rounded, so callers round once on the absolute time instead of on every delta
+def midi_ticks_to_exact_ms(ticks, ticks_per_beat, tempo_map):
+    t_us = 0.0
+    prev_ticks = 0
+    tempo = tempo_map[0][1]
+
+    for (change_ticks, change_tempo) in tempo_map:
+        if change_ticks >= ticks:
+            break
+
+        t_us += float(change_ticks - prev_ticks) * tempo / ticks_per_beat
+        prev_ticks = change_ticks
+        tempo = change_tempo
 
-# A fairly inefficient way to get the first tempo message of the entire MIDI file
+    t_us += float(ticks - prev_ticks) * tempo / ticks_per_beat
+
+    return t_us / 1000.0
+
+# The first tempo message of the entire MIDI file, which was the only tempo before tempo maps were followed
+# Only used to report how far the old conversion drifted
 def find_tempo(midi_file):
     for i, track in enumerate(midi_file.tracks):
         for msg in track:
@@ -70,6 +164,8 @@ def find_tempo(midi_file):
             if 'tempo' in msg_dict:
                 return msg_dict['tempo']
 
+    return DEFAULT_MIDI_TEMPO
+
 # Converts the number of ticks into milliseconds based on the given tempo (in us/beat) and ticks per beat
 # Rounded to the nearest integer
 # A = Number of ticks, B = ticks per beat, C = tempo (us/beat)
@@ -78,20 +174,34 @@ def find_tempo(midi_file):
 # t_ms = A ticks x ------- x ------ x -------
 #                  B ticks    beat    1000 us
 #
+# This is how every note delta used to be converted. Only used to report how far that drifted.
 def midi_ticks_to_ms(ticks, ticks_per_beat, tempo):
     t_ms = ( ticks * ( 1.0 / ticks_per_beat ) * ( tempo ) ) / 1000.0
     return int(round(t_ms))
 
 # Converts a MIDI note value into frequency
 # Rounded to the nearest integer
+# Must match the note frequency table in songs.h
 # Reference: https://newt.phys.unsw.edu.au/jw/notes.html
-def midi_note_to_freq(m, note_shift):
-    freq = ( 2**( ( (m + note_shift) - 69 ) / 12.0 ) ) * 440
+def midi_note_to_freq(m):
+    if m == SILENT_NOTE:
+        return 0
+
+    freq = ( 2**( ( m - 69 ) / 12.0 ) ) * 440
     return int(round(freq))
 
+# Converts a note frequency into the PWM channel period written to the buzzer
+# Uses integer division so the result matches PWMAudioSetFrequency() exactly
+# A frequency of 0 is a silent note and stays 0
+def freq_to_pwm_period(freq):
+    if freq == 0:
+        return 0
+
+    return PWM_CLOCK_HZ // freq
+
 # Generates code with the given input information
 # Takes in the song number, song title and artist strings, and list of notes and corresponding durations for each buzzer
-def generate_code(song_num, song_title, song_artist, notes_right, notes_left):
+def generate_code(song_num, song_title, song_artist, voice_notes):
     file_name = "song" + str(song_num) + ".h"
     out = open(file_name, 'w')
 
@@ -105,54 +215,108 @@ def generate_code(song_num, song_title, song_artist, notes_right, notes_left):
 
     out.write("/* Song #{} */\n".format(song_num))
 
-    # Check lengths of each song based on delta note times
-    right_duration = get_note_array_duration_ms(notes_right)
-    left_duration = get_note_array_duration_ms(notes_left)
-    right_buzzer_pad_duration_ms = 1000
-    left_buzzer_pad_duration_ms = 1000
+    voice_events = get_padded_voice_events(voice_notes)
 
-    # If the right buzzer finishes early, pad the end array so it syncs up with the left buzzer
-    if(right_duration < left_duration):
-        right_buzzer_pad_duration_ms = right_buzzer_pad_duration_ms + (left_duration - right_duration)
-        
-        # uint16 max
-        if right_buzzer_pad_duration_ms > 65535:
-            right_buzzer_pad_duration_ms = 65535
+    # All voices share one phrase table so repeats across voices are only stored once
+    (phrase_bytes, phrases, playlists) = compress_song(voice_events)
 
-    # Same idea if the left buzzer finishes early
-    if(left_duration < right_duration):
-        left_buzzer_pad_duration_ms = left_buzzer_pad_duration_ms + (right_duration - left_duration)
-        
-        # uint16 max
-        if left_buzzer_pad_duration_ms > 65535:
-            left_buzzer_pad_duration_ms = 65535
+    out.write("static const u8 song{}_phrase_events[] = ".format(song_num))
+    write_bytes_to_formatted_array(out, phrase_bytes)
 
-    # Generate notes array for right buzzer
-    out.write("static const u16 song{}_note_right[] = ".format(song_num))
-    num_notes = write_notes_to_formatted_array(out, notes_right)
-    print("\nRight buzzer: {} notes.".format(num_notes))
+    out.write("static const PhraseType song{}_phrases[] = ".format(song_num))
+    write_structs_to_formatted_array(out, phrases)
 
-    out.write("static const u16 song{}_note_duration_right[] = ".format(song_num))
-    num_notes = write_notes_duration_to_formatted_array(out, notes_right, right_buzzer_pad_duration_ms)
-    print("Right buzzer: {} note durations.".format(num_notes))
+    song_prefix_str = "song" + str(song_num)
+    voice_names = []
+    for (voice, playlist) in enumerate(playlists):
+        voice_names.append("{}_playlist_voice{}".format(song_prefix_str, voice))
+        out.write("static const PhraseRefType {}[] = ".format(voice_names[-1]))
+        write_structs_to_formatted_array(out, playlist)
+
+    # Every voice is padded to the same length, which is the length of the song
+    seek_names = []
+    seek_tables = []
+    song_length = 0
+    for (voice, playlist) in enumerate(playlists):
+        (seek_points, voice_length) = get_seek_points(phrase_bytes, phrases, playlist)
+        song_length = max(song_length, voice_length)
+        seek_names.append("{}_seek_voice{}".format(song_prefix_str, voice))
+        seek_tables.append(seek_points)
+        out.write("static const SeekPointType {}[] = ".format(seek_names[-1]))
+        write_structs_to_formatted_array(out, seek_points)
+
+    # Voice n plays on buzzer n % 2, so voices 0 and 1 are the right and left buzzers
+    out.write("\nstatic const VoiceType {}_voices[] = {{ ".format(song_prefix_str))
+    out.write(", ".join(["{{ {}, sizeof( {} ) / sizeof( {}[0] ), {}, sizeof( {} ) / sizeof( {}[0] ) }}".format(name, name, name, seek, seek, seek)
+                         for (name, seek) in zip(voice_names, seek_names)]))
+    out.write(" };\n")
 
-    # Generate notes array for left buzzer
-    out.write("static const u16 song{}_note_left[] = ".format(song_num))
-    num_notes = write_notes_to_formatted_array(out, notes_left)
-    print("Left buzzer: {} notes.".format(num_notes))
+    unpacked_size = sum([get_unpacked_size(events) for events in voice_events])
+    compressed_size = get_compressed_size(phrase_bytes, phrases, playlists)
 
-    out.write("static const u16 song{}_note_duration_left[] = ".format(song_num))
-    num_notes = write_notes_duration_to_formatted_array(out, notes_left, left_buzzer_pad_duration_ms)
-    print("Left buzzer: {} note durations.".format(num_notes))
+    print("")
+    for (voice, events) in enumerate(voice_events):
+        print("Voice {} (buzzer {}): {} notes in {} playlist entries.".format(voice, (voice % 2) + 1, len(events), len(playlists[voice])))
+    print("{} phrases, {} bytes of notes. {} bytes total vs. {} bytes as u16 arrays ({:.1f}x smaller).".format(len(phrases), len(phrase_bytes), compressed_size, unpacked_size, float(unpacked_size) / compressed_size))
+    print("{} ms long, {} seek points in {} bytes.".format(song_length, sum([len(table) for table in seek_tables]), sum([len(table) for table in seek_tables]) * SEEK_POINT_SIZE))
 
     # Generate information structure for this song
-    song_prefix_str = "song" + str(song_num)
     out.write("\nstatic const SongInfoType {} = {{ \"{}\", \"{}\", ".format(song_prefix_str, song_title, song_artist))
-    out.write("{}_note_right, {}_note_duration_right, sizeof( {}_note_right ) / sizeof( {}_note_right[0] ), ". format(song_prefix_str, song_prefix_str, song_prefix_str, song_prefix_str))
-    out.write("{}_note_left, {}_note_duration_left, sizeof( {}_note_left ) / sizeof( {}_note_left[0] ) }};\n".format(song_prefix_str, song_prefix_str, song_prefix_str, song_prefix_str))
+    out.write("{}_phrase_events, {}_phrases, ".format(song_prefix_str, song_prefix_str))
+    out.write("{}_voices, sizeof( {}_voices ) / sizeof( {}_voices[0] ), {} }};\n".format(song_prefix_str, song_prefix_str, song_prefix_str, song_length))
+
+    out.close()
 
+# Writes a song file for the SD card, in the layout song_stream.c reads (see song_stream.h)
+# One header sector, then each voice's packed note events starting on a new sector
+# Song files are put together into a card image by sd_image.py
+def generate_sd_song(file_name, song_title, song_artist, voice_notes):
+    voice_bytes = [pack_note_events(events) for events in get_padded_voice_events(voice_notes)]
+
+    header = bytearray(SD_SECTOR_SIZE)
+    header[0:len(SD_SONG_MAGIC)] = SD_SONG_MAGIC
+    header[SD_SONG_VOICES_INDEX] = len(voice_bytes)
+    for (index, text) in [(SD_SONG_TITLE_INDEX, song_title), (SD_SONG_ARTIST_INDEX, song_artist)]:
+        text = bytearray(text.encode('ascii', 'replace'))[:SD_SONG_TEXT_SIZE - 1]
+        header[index:index + len(text)] = text
+
+    body = bytearray()
+    for (voice, events) in enumerate(voice_bytes):
+        first_sector = 1 + (len(body) // SD_SECTOR_SIZE)
+        struct.pack_into("<II", header, SD_SONG_VOICE_INDEX + (voice * 8), first_sector, len(events))
+
+        body.extend(events)
+        body.extend(bytearray(-len(body) % SD_SECTOR_SIZE))
+
+    out = open(file_name, 'wb')
+    out.write(header)
+    out.write(body)
     out.close()
 
+    print("")
+    for (voice, events) in enumerate(voice_bytes):
+        print("Voice {} (buzzer {}): {} bytes of notes.".format(voice, (voice % 2) + 1, len(events)))
+    print("{} written, {} sectors.".format(file_name, 1 + (len(body) // SD_SECTOR_SIZE)))
+
+# Pads the end of every voice so they all finish together, with one second of silence after the song
+# Returns each voice's note events
+def get_padded_voice_events(voice_notes):
+    # Check lengths of each voice based on delta note times
+    voice_durations = [get_note_array_duration_ms(notes) for notes in voice_notes]
+    song_duration = max(voice_durations)
+
+    voice_events = []
+    for (notes, duration) in zip(voice_notes, voice_durations):
+        pad_duration_ms = 1000 + (song_duration - duration)
+
+        # uint16 max
+        if pad_duration_ms > 65535:
+            pad_duration_ms = 65535
+
+        voice_events.append(get_note_events(notes, pad_duration_ms))
+
+    return voice_events
+
 # Counts the duration of the given notes list based on its delta ticks in milliseconds
 def get_note_array_duration_ms(list):
     duration_ms = 0
@@ -163,55 +327,334 @@ def get_note_array_duration_ms(list):
 
     return duration_ms
 
-# Converts list into formatted C-array for notes
-# Handles padding the first element in array with "NO" note to align delta ticks properly
-# Returns number of notes detected from list and written
-def write_notes_to_formatted_array(out, list):
-    # Pad beginning with 0 to align delta ticks
-    out.write("{ 0")
+# Pairs each note in the list with how long it plays for
+# Each MIDI delta time is the time before its own message, so every note plays for the next message's delta time.
+# A silent note is padded at the beginning and the last note plays for the end padding duration.
+def get_note_events(notes_list, end_padding_duration):
+    notes = [SILENT_NOTE] + [item[0] for item in notes_list]
+    durations = [item[1] for item in notes_list] + [end_padding_duration]
 
-    # Start at 1 to account for note pad at the beginning
-    notes_counter = 1
+    return list(zip(notes, durations))
 
-    for item in list:
-        note = item[0]
-        notes_counter += 1
+# Drops notes that are never heard (0 ms) and folds back-to-back silent notes into one
+def merge_note_events(events):
+    merged = []
+
+    for (note, duration) in events:
+        if duration == 0:
+            continue
+
+        if duration > NOTE_DURATION_MAX_MS:
+            duration = NOTE_DURATION_MAX_MS
+
+        if note < 0 or note > 127:
+            print("Warning! Note {} is out of the MIDI range and will be played as a silent note.".format(note))
+            note = SILENT_NOTE
 
-        # Limit how many notes can be on a line
-        if((notes_counter % 1000) == 0):
-            out.write(",\n")
-            out.write("{}".format(note))
+        # Extend the previous silent note instead of starting a new one
+        if note == SILENT_NOTE and merged and merged[-1][0] == SILENT_NOTE and (merged[-1][1] + duration) <= NOTE_DURATION_MAX_MS:
+            merged[-1] = (SILENT_NOTE, merged[-1][1] + duration)
         else:
-            out.write(", {}".format(note))
+            merged.append( (note, duration) )
+
+    # Nothing to play, stay silent
+    if not merged:
+        merged.append( (SILENT_NOTE, NOTE_DURATION_MAX_MS) )
+
+    return merged
+
+# Packs one ( note, duration ) event into the bytes played by the firmware
+# The MIDI note number byte (0 for silence) is followed by the duration in milliseconds as a
+# variable-length number: 7 bits per byte, most significant bits first, top bit set on all but the last byte.
+def pack_note_event(note, duration):
+    packed = [note]
+
+    # Duration, most significant 7 bits first
+    duration_bytes = [duration & 0x7F]
+    duration >>= 7
+
+    while duration > 0:
+        duration_bytes.insert(0, (duration & 0x7F) | 0x80)
+        duration >>= 7
+
+    packed.extend(duration_bytes)
+
+    return packed
+
+# Packs a list of ( note, duration ) events into one byte stream, without looking for repeats
+def pack_note_events(events):
+    packed = []
+
+    for (note, duration) in merge_note_events(events):
+        packed.extend(pack_note_event(note, duration))
+
+    return packed
+
+# Finds repeated runs of notes across all the given buzzers' events
+# Every note is either stored in the phrase table the first time it is seen, or played from a run of
+# notes already stored there. Returns the packed phrase table bytes, the list of phrases as
+# ( byte offset, byte size ) and one playlist of ( phrase index, repeat count ) per buzzer.
+def compress_song(voices):
+    table_events = []       # Notes stored in the phrase table, in order
+    table_offsets = [0]     # Byte offset of each stored note, plus the end of the table
+    table_bytes = []
+    runs_index = {}         # First MIN_PHRASE_NOTES notes of a run -> where that run starts in the table
+    phrases = []
+    phrase_ids = {}
+    playlists = []
+
+    # Returns the index of the phrase covering the given stored notes, adding it if it is new
+    def get_phrase(first_note, num_notes):
+        offset = table_offsets[first_note]
+        size = table_offsets[first_note + num_notes] - offset
+
+        if (offset, size) not in phrase_ids:
+            phrase_ids[(offset, size)] = len(phrases)
+            phrases.append( (offset, size) )
+
+        return phrase_ids[(offset, size)]
+
+    # Plays a phrase next, as a repeat of the last playlist entry when it is the same phrase
+    def add_to_playlist(playlist, phrase):
+        if playlist and playlist[-1][0] == phrase and playlist[-1][1] < PHRASE_FIELD_MAX:
+            playlist[-1] = (phrase, playlist[-1][1] + 1)
+        else:
+            playlist.append( (phrase, 1) )
+
+    for events in voices:
+        events = merge_note_events(events)
+        playlist = []
+        new_notes_start = None
+        i = 0
+
+        while i < len(events):
+            # Look for the longest run already in the table that matches the upcoming notes
+            match_start = 0
+            match_length = 0
+            key = tuple(events[i:i + MIN_PHRASE_NOTES])
+
+            for start in runs_index.get(key, [])[-MAX_PHRASE_CANDIDATES:]:
+                length = 0
+
+                while (start + length) < len(table_events) and (i + length) < len(events) and table_events[start + length] == events[i + length]:
+                    length += 1
+
+                if length > match_length:
+                    match_start = start
+                    match_length = length
+
+            if match_length >= MIN_PHRASE_NOTES:
+                # Notes stored just before this one are played as their own phrase
+                if new_notes_start is not None:
+                    add_to_playlist(playlist, get_phrase(new_notes_start, len(table_events) - new_notes_start))
+                    new_notes_start = None
+
+                add_to_playlist(playlist, get_phrase(match_start, match_length))
+                i += match_length
+            else:
+                # Store the note in the table
+                if new_notes_start is None:
+                    new_notes_start = len(table_events)
+
+                table_events.append(events[i])
+                table_bytes.extend(pack_note_event(events[i][0], events[i][1]))
+                table_offsets.append(len(table_bytes))
+
+                if len(table_events) >= MIN_PHRASE_NOTES:
+                    run_start = len(table_events) - MIN_PHRASE_NOTES
+                    runs_index.setdefault(tuple(table_events[run_start:]), []).append(run_start)
+
+                i += 1
+
+        if new_notes_start is not None:
+            add_to_playlist(playlist, get_phrase(new_notes_start, len(table_events) - new_notes_start))
+
+        playlists.append(playlist)
+
+    if len(table_bytes) > PHRASE_FIELD_MAX:
+        print("Warning! Phrase table is {} bytes, more than the {} bytes a phrase offset can reach.".format(len(table_bytes), PHRASE_FIELD_MAX))
+
+    return (table_bytes, phrases, playlists)
+
+# Returns the ( byte offset, duration ) of every note event packed in the given bytes, see pack_note_event()
+def unpack_note_durations(packed, offset, size):
+    events = []
+    end = offset + size
+
+    while offset < end:
+        event_offset = offset
+        offset += 1
+        duration = 0
+
+        while True:
+            duration = (duration << 7) | (packed[offset] & 0x7F)
+            offset += 1
+            if (packed[offset - 1] & 0x80) == 0:
+                break
+
+        events.append( (event_offset, duration) )
+
+    return events
+
+# Walks a voice's playlist and picks the notes the firmware can seek to: the note playing at the start of the
+# song and about every SEEK_INTERVAL_MS after it, as ( position in ms, playlist index, repeats left, offset of the
+# note event in the phrase table ). A note long enough to cover several intervals is only picked once.
+# Returns the seek points and the length of the voice in ms
+def get_seek_points(phrase_bytes, phrases, playlist):
+    seek_points = []
+    next_seek_time = 0
+    position = 0
+
+    for (playlist_index, (phrase, repeat)) in enumerate(playlist):
+        (offset, size) = phrases[phrase]
+        events = unpack_note_durations(phrase_bytes, offset, size)
+
+        for repeats_left in range(repeat - 1, -1, -1):
+            for (event_offset, duration) in events:
+                if (position + duration) > next_seek_time:
+                    seek_points.append( (position, playlist_index, repeats_left, event_offset) )
+
+                    while next_seek_time < (position + duration):
+                        next_seek_time += SEEK_INTERVAL_MS
+
+                position += duration
+
+    return (seek_points, position)
+
+# Size in bytes of a compressed song in the firmware
+def get_compressed_size(phrase_bytes, phrases, playlists):
+    size = len(phrase_bytes) + (len(phrases) * PHRASE_ENTRY_SIZE)
+
+    for playlist in playlists:
+        size += len(playlist) * PLAYLIST_ENTRY_SIZE
+
+    return size
+
+# Size in bytes of the same events stored the original way, as parallel u16 frequency and duration arrays
+def get_unpacked_size(events):
+    return len(events) * 4
+
+# Converts list into formatted C-array of bytes
+# Returns number of bytes written
+def write_bytes_to_formatted_array(out, list):
+    out.write("{ ")
+
+    bytes_counter = 0
+
+    for value in list:
+        if bytes_counter != 0:
+            out.write(", ")
+
+        bytes_counter += 1
+
+        # Limit how many bytes can be on a line
+        if((bytes_counter % 1000) == 0):
+            out.write("\n")
+
+        out.write("{}".format(value))
 
     out.write(" };\n")
 
-    return notes_counter
+    return bytes_counter
 
-# Converts list into formatted C-array for note durations
-# Handles padding the last element in array with a short duration to align delta ticks properly
-# Returns number of notes detected from list and written
-def write_notes_duration_to_formatted_array(out, list, end_padding_duration):
+# Converts list of tuples into formatted C-array of structures
+def write_structs_to_formatted_array(out, list):
     out.write("{ ")
 
-    # Start at 1 to account for note duration pad at the end
-    notes_counter = 1
+    structs_counter = 0
 
-    for item in list:
-        note_dur = item[1]
-        notes_counter += 1
+    for fields in list:
+        if structs_counter != 0:
+            out.write(", ")
 
-        # Limit how many notes can be on a line
-        if((notes_counter % 1000) == 0):
+        structs_counter += 1
+
+        # Limit how many structures can be on a line
+        if((structs_counter % 250) == 0):
             out.write("\n")
-            out.write("{}, ".format(note_dur))
-        else:
-            out.write("{}, ".format(note_dur))
 
-    # Pad ending with a short duration to align delta ticks
-    out.write("{} }};\n".format(end_padding_duration))
+        out.write("{{ {} }}".format(", ".join([str(field) for field in fields])))
+
+    out.write(" };\n")
+
+    return structs_counter
+
+# Prints the size of every MIDI file in the given folder, stored the original way, packed and with repeats compressed
+# Each file is sized as if it were played on a single buzzer with no note shift
+def print_size_report(midi_folder):
+    total_unpacked = 0
+    total_packed = 0
+    total_compressed = 0
+
+    print("\n{:<80} {:>8} {:>10} {:>8} {:>8} {:>7}".format("MIDI file", "Notes", "u16 arrays", "Packed", "Phrases", "Ratio"))
+
+    for root, dirs, files in sorted(os.walk(midi_folder)):
+        for file_name in sorted(files):
+            if not file_name.lower().endswith(".mid"):
+                continue
+
+            events = get_note_events(parse_notes_and_duration(os.path.join(root, file_name), 0), 1000)
+            unpacked_size = get_unpacked_size(events)
+            packed_size = len(pack_note_events(events))
+            (phrase_bytes, phrases, playlists) = compress_song([events])
+            compressed_size = get_compressed_size(phrase_bytes, phrases, playlists)
+
+            total_unpacked += unpacked_size
+            total_packed += packed_size
+            total_compressed += compressed_size
+
+            print("{:<80} {:>8} {:>10} {:>8} {:>8} {:>6.1f}x".format(file_name, len(events), unpacked_size, packed_size, compressed_size, float(unpacked_size) / compressed_size))
+
+    if total_compressed != 0:
+        print("{:<80} {:>8} {:>10} {:>8} {:>8} {:>6.1f}x".format("Total", "", total_unpacked, total_packed, total_compressed, float(total_unpacked) / total_compressed))
+
+# Prints, for every MIDI file in the given folder, how far note times drift from an exact rendering of the file
+# The old conversion used the first tempo only, rounded every note delta and dropped the delta of other messages
+# Drift is the largest difference between a note's time and its exact time through the tempo map, in ms
+def print_drift_report(midi_folder):
+    worst_old_drift = 0.0
+    worst_new_drift = 0.0
+
+    print("\n{:<80} {:>6} {:>8} {:>14} {:>14}".format("MIDI file", "Tempos", "Notes", "Old drift (ms)", "New drift (ms)"))
 
-    return notes_counter
+    for root, dirs, files in sorted(os.walk(midi_folder)):
+        for file_name in sorted(files):
+            if not file_name.lower().endswith(".mid"):
+                continue
+
+            in_mid = MidiFile(os.path.join(root, file_name))
+            ticks_per_beat = in_mid.ticks_per_beat
+            tempo_map = get_tempo_map(in_mid)
+            first_tempo = find_tempo(in_mid)
+
+            num_notes = 0
+            old_drift = 0.0
+            new_drift = 0.0
+
+            for track in in_mid.tracks:
+                time_ticks = 0
+                old_time_ms = 0
+
+                for msg in track:
+                    time_ticks += msg.time
+
+                    if msg.type != 'note_on' and msg.type != 'note_off':
+                        continue
+
+                    exact_time_ms = midi_ticks_to_exact_ms(time_ticks, ticks_per_beat, tempo_map)
+                    old_time_ms += midi_ticks_to_ms(msg.time, ticks_per_beat, first_tempo)
+                    new_time_ms = int(round(exact_time_ms))
+
+                    num_notes += 1
+                    old_drift = max(old_drift, abs(old_time_ms - exact_time_ms))
+                    new_drift = max(new_drift, abs(new_time_ms - exact_time_ms))
+
+            worst_old_drift = max(worst_old_drift, old_drift)
+            worst_new_drift = max(worst_new_drift, new_drift)
+
+            print("{:<80} {:>6} {:>8} {:>14.1f} {:>14.1f}".format(file_name, len(tempo_map), num_notes, old_drift, new_drift))
+
+    print("{:<80} {:>6} {:>8} {:>14.1f} {:>14.1f}".format("Worst", "", "", worst_old_drift, worst_new_drift))
 
 # Checks and prints the lowest and highest note frequency in the list
 # Prints a warning if frequency falls below the threshold
@@ -225,53 +668,89 @@ def check_note_frequencies(notes_list, buzzer_id):
 
     for item in notes_list:
         # Ignore intended silent notes
-        if(item[0] == 0):
+        if(item[0] == SILENT_NOTE):
             continue
 
-        if(item[0] < min):
-            min = item[0]
+        freq = midi_note_to_freq(item[0])
+
+        if(freq < min):
+            min = freq
 
-        if(item[0] > max):
-            max = item[0]
+        if(freq > max):
+            max = freq
 
     print("Buzzer {}: Min. Frequency (Not incl. silent notes) = {} Hz. | Max. Frequency = {} Hz.".format(buzzer_id, min, max))
 
     if(min < LOW_NOTE_FREQ_THRESHOLD):
         print("Warning! Buzzer {} lowest non-zero frequency is below the {} Hz threshold. Note may not play properly.".format(buzzer_id, LOW_NOTE_FREQ_THRESHOLD))
 
+    if(freq_to_pwm_period(min) > PWM_PERIOD_MAX):
+        print("Warning! Buzzer {} lowest non-zero frequency needs a PWM period larger than {}. Note will not play properly.".format(buzzer_id, PWM_PERIOD_MAX))
+
 
 # Parse arguments
 parser = argparse.ArgumentParser()
 parser.add_argument("-b1", help="Input MIDI track file to be played on buzzer 1 (right buzzer) of the EiE board")
 parser.add_argument("-b2", help="Input MIDI track file to be played on buzzer 2 (left buzzer) of the EiE board")
+parser.add_argument("-b3", help="Optional extra MIDI track arpeggiated with buzzer 1 (right buzzer)")
+parser.add_argument("-b4", help="Optional extra MIDI track arpeggiated with buzzer 2 (left buzzer)")
 parser.add_argument("-n1", type=int, default=0, help="Shift MIDI track note for buzzer 1 (right buzzer). Inputs can be 0, 1, 2, -1, etc.")
 parser.add_argument("-n2", type=int, default=0, help="Shift MIDI track note for buzzer 2 (left buzzer). Inputs can be 0, 1, 2, -1, etc.")
+parser.add_argument("-n3", type=int, default=0, help="Shift MIDI track note for the -b3 track")
+parser.add_argument("-n4", type=int, default=0, help="Shift MIDI track note for the -b4 track")
+parser.add_argument("-report", help="Print the original and packed size of every MIDI file in this folder, then exit")
+parser.add_argument("-sd", help="Write the song to this file for the SD card instead of generating code")
+parser.add_argument("-drift", help="Print how far note times drift from an exact rendering for every MIDI file in this folder, then exit")
 args = parser.parse_args()
 
+if args.report is not None:
+    print_size_report(args.report)
+    sys.exit(0)
+
+if args.drift is not None:
+    print_drift_report(args.drift)
+    sys.exit(0)
+
 if args.b1 is not None:
     print("\nParsing: {} for buzzer 1 (right buzzer) with note offset {}".format(args.b1, args.n1))
 else:
     print("\nParsing: Nothing for buzzer 1. It will not play anything.")
 
 if args.b2 is not None:
-    print("Parsing: {} for buzzer 2 (left buzzer) with note offset {}\n".format(args.b2, args.n2))
+    print("Parsing: {} for buzzer 2 (left buzzer) with note offset {}".format(args.b2, args.n2))
 else:
-    print("Parsing: Nothing for buzzer 2. It will not play anything.\n")
+    print("Parsing: Nothing for buzzer 2. It will not play anything.")
+
+# Extra voices are optional and share the buzzers with voices 1 and 2 (voice 3 plays on buzzer 1, voice 4 on buzzer 2)
+extra_voices = [(args.b3, args.n3), (args.b4, args.n4)]
+if args.b4 is not None and args.b3 is None:
+    print("Error: -b4 needs -b3 so that it lands on buzzer 2.")
+    sys.exit(1)
+
+for (voice, (file_name, note_offset)) in enumerate(extra_voices):
+    if file_name is not None:
+        print("Parsing: {} for voice {} (arpeggiated on buzzer {}) with note offset {}".format(file_name, voice + 3, voice + 1, note_offset))
+print("")
 
 # Parse the MIDI files for notes and corresponding durations into a list
 # If an input is not specified, it will return an empty list
-notes_list_right = parse_notes_and_duration(args.b1, args.n1)
-notes_list_left = parse_notes_and_duration(args.b2, args.n2)
+voice_notes = [parse_notes_and_duration(args.b1, args.n1), parse_notes_and_duration(args.b2, args.n2)]
+for (file_name, note_offset) in extra_voices:
+    if file_name is not None:
+        voice_notes.append(parse_notes_and_duration(file_name, note_offset))
 
 # Check to make sure notes are not below a certain frequency - found that the EiE board struggles with playing frequencies below 100 Hz.
-check_note_frequencies(notes_list_right, 1)
-check_note_frequencies(notes_list_left, 2)
+for (voice, notes) in enumerate(voice_notes):
+    check_note_frequencies(notes, (voice % 2) + 1)
 
 # Prompt user to enter song information for generating code variables
 song_title = raw_input("\nEnter the song title: ")
 song_artist = raw_input("Enter the song artist: ")
-song_number = int(input("Enter the song number (for generating code variables): "))
 
-generate_code(song_number, song_title, song_artist, notes_list_right, notes_list_left)
+if args.sd is not None:
+    generate_sd_song(args.sd, song_title, song_artist, voice_notes)
+else:
+    song_number = int(input("Enter the song number (for generating code variables): "))
+    generate_code(song_number, song_title, song_artist, voice_notes)
 
 print("\nDone.")
\ No newline at end of file
@@ -15,17 +15,14 @@ def parse_midi(mid_file, set_tempo):
     in_mid = MidiFile(mid_file)
     in_mid_basename = os.path.splitext(mid_file)[0]
 
-    base_tempo = 0
-    
     if(set_tempo == 0):
-        # Find the tempo of the MIDI file
-        # Note: This is not ideal because there could be changes in tempo during the song
-        #       However, this is to try giving tracks without the tempo messages consistency with other tracks that do
-        base_tempo = find_tempo(in_mid)
+        # Find every tempo change of the MIDI file
+        # This gives tracks without the tempo messages the same timing as the tracks that do, for the whole song
+        tempo_map = find_tempo_map(in_mid)
+        print('Using the {} tempo change(s) of the file for tracks without a tempo message.\n'.format(len(tempo_map)))
     else:
-        base_tempo = set_tempo
-        
-    print('Using {} us/beat as tempo for tracks without a tempo message.\n'.format(base_tempo))
+        tempo_map = [(0, set_tempo)]
+        print('Using {} us/beat as tempo for tracks without a tempo message.\n'.format(set_tempo))
 
     # Iterate through each track in file
     for i, in_track in enumerate(in_mid.tracks):
@@ -37,16 +34,16 @@ def parse_midi(mid_file, set_tempo):
         # Make ticks per beat consistent
         out_mid.ticks_per_beat = in_mid.ticks_per_beat
 
-        # Check if this current track has a tempo message in it
-        # This is so original tracks that don't have a tempo message gets one
-        if not has_tempo(in_track):
-            out_track.append(MetaMessage('set_tempo', tempo=base_tempo))
-
         print('Track {}: {}'.format(i, in_track.name))
 
-        # Directly copy input track into output track
-        for msg in in_track:
-            out_track.append(msg)
+        # Check if this current track has a tempo message in it
+        # This is so original tracks that don't have a tempo message get them
+        if not has_tempo(in_track):
+            out_track.extend(add_tempo_map(in_track, tempo_map))
+        else:
+            # Directly copy input track into output track
+            for msg in in_track:
+                out_track.append(msg)
 
         out_mid_file_name = in_mid_basename + "_track" + str(i) + "_" + in_track.name + ".mid"
 
@@ -55,18 +52,49 @@ def parse_midi(mid_file, set_tempo):
         except IOError:
             print("Could not save file: " + out_mid_file_name)
 
-# A fairly inefficient way to get the latest tempo message of the file.
-def find_tempo(midi_file):
-    tempo = 0
-    
+# Gets every tempo message of the file as a list of (absolute time in ticks, tempo in us/beat), in time order
+# Files without any tempo message get the MIDI default of 500000 us/beat (120 beats per minute)
+def find_tempo_map(midi_file):
+    tempo_map = []
+
     for i, track in enumerate(midi_file.tracks):
+        time_ticks = 0
+
         for msg in track:
-            msg_dict = msg.dict()
+            time_ticks += msg.time
+
+            if msg.type == 'set_tempo':
+                tempo_map.append( (time_ticks, msg.tempo) )
+
+    tempo_map.sort(key=lambda change: change[0])
+
+    if not tempo_map:
+        tempo_map.append( (0, 500000) )
+
+    return tempo_map
+
+# Returns the messages of the track with a tempo message inserted at the time of every change in the tempo map
+# Delta times are adjusted so every original message keeps its absolute time
+def add_tempo_map(track, tempo_map):
+    out_msgs = []
+    time_ticks = 0
+    prev_time_ticks = 0
+    tempo_index = 0
+
+    for msg in track:
+        time_ticks += msg.time
+
+        # Tempo changes come before any other message at the same time
+        while tempo_index < len(tempo_map) and tempo_map[tempo_index][0] <= time_ticks:
+            (tempo_ticks, tempo) = tempo_map[tempo_index]
+            out_msgs.append(MetaMessage('set_tempo', tempo=tempo, time=tempo_ticks - prev_time_ticks))
+            prev_time_ticks = tempo_ticks
+            tempo_index += 1
+
+        out_msgs.append(msg.copy(time=time_ticks - prev_time_ticks))
+        prev_time_ticks = time_ticks
 
-            if 'tempo' in msg_dict:
-                tempo = msg_dict['tempo']
-                
-    return tempo
+    return out_msgs
 
 # A fairly inefficient way to check if a track already has a tempo message in it
 def has_tempo(track):
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# sd_image.py
+# Description: Puts song files written by midi_code_gen.py -sd together into a disk image for the SD card.
+#              - The library header goes in the first sector, then the song index (each song's first sector and
+#                where its title and artist are in the strings), the strings, and each song in the given order.
+#              - The image is written to the card raw (e.g. with dd), or copied to a FAT32 card as SONGS.LIB.
+#              - The layout must match song_stream.h.
+
+import argparse
+import struct
+import sys
+
+SD_SECTOR_SIZE = 512
+SD_LIBRARY_MAGIC = b"EIESLIB2"
+SD_SONG_MAGIC = b"EIESONG1"
+SD_LIBRARY_COUNT_INDEX = 8
+SD_LIBRARY_RECORDS_INDEX = 12
+SD_LIBRARY_STRINGS_INDEX = 16
+SD_RECORD_SIZE = 16
+SD_SONG_TITLE_INDEX = 16
+SD_SONG_ARTIST_INDEX = 80
+SD_TEXT_SIZE = 64
+
+# Must match SONG_STREAM_MAX_SONGS
+SD_MAX_SONGS = 65000
+
+
+def sectors(size):
+    return (size + SD_SECTOR_SIZE - 1) // SD_SECTOR_SIZE
+
+
+def add_string(strings, text):
+    """Adds a 0-terminated title or artist to the strings without crossing a sector boundary, returns its offset."""
+    if (len(strings) % SD_SECTOR_SIZE) + len(text) + 1 > SD_SECTOR_SIZE:
+        strings.extend(bytearray(SD_SECTOR_SIZE - (len(strings) % SD_SECTOR_SIZE)))
+    offset = len(strings)
+    strings.extend(text + b"\0")
+    return offset
+
+parser = argparse.ArgumentParser()
+parser.add_argument("image", help="Disk image file to write")
+parser.add_argument("songs", nargs="+", help="Song files from midi_code_gen.py -sd, in the order they are played")
+args = parser.parse_args()
+
+if len(args.songs) > SD_MAX_SONGS:
+    print("Error: at most {} songs fit on the card.".format(SD_MAX_SONGS))
+    sys.exit(1)
+
+records = bytearray(sectors(len(args.songs) * SD_RECORD_SIZE) * SD_SECTOR_SIZE)
+strings = bytearray()
+songs = bytearray()
+song_sectors = []
+for (song, file_name) in enumerate(args.songs):
+    song_file = open(file_name, 'rb')
+    data = bytearray(song_file.read())
+    song_file.close()
+
+    if data[0:len(SD_SONG_MAGIC)] != SD_SONG_MAGIC or len(data) % SD_SECTOR_SIZE != 0:
+        print("Error: {} is not a song file from midi_code_gen.py -sd.".format(file_name))
+        sys.exit(1)
+
+    # The title and artist are copied from the song header into the strings
+    title = bytes(data[SD_SONG_TITLE_INDEX:SD_SONG_TITLE_INDEX + SD_TEXT_SIZE - 1]).split(b"\0")[0]
+    artist = bytes(data[SD_SONG_ARTIST_INDEX:SD_SONG_ARTIST_INDEX + SD_TEXT_SIZE - 1]).split(b"\0")[0]
+    song_sectors.append(len(songs) // SD_SECTOR_SIZE)
+    struct.pack_into("<xxxxII", records, song * SD_RECORD_SIZE, add_string(strings, title), add_string(strings, artist))
+    songs.extend(data)
+    print("Song {}: {}, {} sectors".format(song + 1, file_name, len(data) // SD_SECTOR_SIZE))
+
+# Songs are found by their first sector, counted from the library header
+records_sector = 1
+strings_sector = records_sector + (len(records) // SD_SECTOR_SIZE)
+songs_sector = strings_sector + sectors(len(strings))
+for (song, song_sector) in enumerate(song_sectors):
+    struct.pack_into("<I", records, song * SD_RECORD_SIZE, songs_sector + song_sector)
+strings.extend(bytearray(sectors(len(strings)) * SD_SECTOR_SIZE - len(strings)))
+
+library = bytearray(SD_SECTOR_SIZE)
+library[0:len(SD_LIBRARY_MAGIC)] = SD_LIBRARY_MAGIC
+struct.pack_into("<HxxII", library, SD_LIBRARY_COUNT_INDEX, len(args.songs), records_sector, strings_sector)
+
+out = open(args.image, 'wb')
+out.write(library)
+out.write(records)
+out.write(strings)
+out.write(songs)
+out.close()
+
+print("{} written, {} sectors.".format(args.image, songs_sector + (len(songs) // SD_SECTOR_SIZE)))
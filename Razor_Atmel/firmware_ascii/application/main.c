@@ -68,10 +68,12 @@ void main(void)
   AntInitialize();
   AntApiInitialize();
   SdCardInitialize();
+  FatInitialize();
 
   /* Application initialization */
   AntChannelInitialize();
   LcdControlInitialize();
+  SongStreamInitialize();
   MusicPlayerInitialize();
 
   /* Exit initialization */
@@ -97,10 +99,12 @@ void main(void)
     AntRunActiveState();
     AntApiRunActiveState();
     SdCardRunActiveState();
+    FatRunActiveState();
 
     /* Applications */
     AntChannelRunActiveState();
     LcdControlRunActiveState();
+    SongStreamRunActiveState();
     MusicPlayerRunActiveState();
 
     /* System sleep*/
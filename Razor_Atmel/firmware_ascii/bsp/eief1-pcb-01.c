@@ -318,30 +318,51 @@ Requires:
   - CPRE_CLCK is the clock frequency for the PWM peripheral
 
 Promises:
-  - The frequency and duty cycle values for the requested channel are calculated
-    and then latched to their respective update registers (CPRDUPDR, CDTYUPDR)
+  - The channel period for the requested frequency is calculated and passed
+    to PWMAudioSetPeriod() which latches the period and duty cycle
   - If the channel is not valid, nothing happens
 */
 void PWMAudioSetFrequency(u32 u32Channel_, u16 u16Frequency_)
 {
-  u32 u32ChannelPeriod;
-  
-  u32ChannelPeriod = CPRE_CLCK / u16Frequency_;
+  PWMAudioSetPeriod(u32Channel_, CPRE_CLCK / u16Frequency_);
   
+} /* end PWMAudioSetFrequency() */
+
+
+/*----------------------------------------------------------------------------
+Function: PWMAudioSetPeriod
+
+Description:
+Configures the PWM peripheral with a channel period that has already been
+calculated, so no division is needed.  Safe to call from an interrupt.
+
+Requires:
+  - u32Channel_ is the channel of interest - either BUZZER1 or BUZZER2
+  - u32Period_ is the channel period in CPRE_CLCK cycles (CPRE_CLCK / frequency)
+    and must fit in the 16-bit period register
+
+Promises:
+  - The period and 50% duty cycle values for the requested channel are latched
+    to their respective update registers (CPRDUPDR, CDTYUPDR) if the channel
+    is running, or written directly (CPRDR, CDTYR) if it is not
+  - If the channel is not valid, nothing happens
+*/
+void PWMAudioSetPeriod(u32 u32Channel_, u32 u32Period_)
+{
   if(u32Channel_ == BUZZER1)
   {
     /* Set different registers depending on if PWM is already running */
     if (AT91C_BASE_PWMC->PWMC_SR & AT91C_PWMC_CHID0)
     {
       /* Beeper is already running, so use update registers */
-      AT91C_BASE_PWMC_CH0->PWMC_CPRDUPDR = u32ChannelPeriod;   
-      AT91C_BASE_PWMC_CH0->PWMC_CDTYUPDR = u32ChannelPeriod >> 1; 
+      AT91C_BASE_PWMC_CH0->PWMC_CPRDUPDR = u32Period_;   
+      AT91C_BASE_PWMC_CH0->PWMC_CDTYUPDR = u32Period_ >> 1; 
     }
     else
     {
       /* Beeper is off, so use direct registers */
-      AT91C_BASE_PWMC_CH0->PWMC_CPRDR = u32ChannelPeriod;
-      AT91C_BASE_PWMC_CH0->PWMC_CDTYR = u32ChannelPeriod >> 1;
+      AT91C_BASE_PWMC_CH0->PWMC_CPRDR = u32Period_;
+      AT91C_BASE_PWMC_CH0->PWMC_CDTYR = u32Period_ >> 1;
     }
   }
   
@@ -351,18 +372,18 @@ void PWMAudioSetFrequency(u32 u32Channel_, u16 u16Frequency_)
     if (AT91C_BASE_PWMC->PWMC_SR & AT91C_PWMC_CHID1)
     {
       /* Beeper is already running, so use update registers */
-      AT91C_BASE_PWMC_CH1->PWMC_CPRDUPDR = u32ChannelPeriod;   
-      AT91C_BASE_PWMC_CH1->PWMC_CDTYUPDR = u32ChannelPeriod >> 1; 
+      AT91C_BASE_PWMC_CH1->PWMC_CPRDUPDR = u32Period_;   
+      AT91C_BASE_PWMC_CH1->PWMC_CDTYUPDR = u32Period_ >> 1; 
     }
     else
     {
       /* Beeper is off, so use direct registers */
-      AT91C_BASE_PWMC_CH1->PWMC_CPRDR = u32ChannelPeriod;
-      AT91C_BASE_PWMC_CH1->PWMC_CDTYR = u32ChannelPeriod >> 1;
+      AT91C_BASE_PWMC_CH1->PWMC_CPRDR = u32Period_;
+      AT91C_BASE_PWMC_CH1->PWMC_CDTYR = u32Period_ >> 1;
     }
   }
   
-} /* end PWMAudioSetFrequency() */
+} /* end PWMAudioSetPeriod() */
 
 
 /*----------------------------------------------------------------------------
@@ -58,6 +58,7 @@ Should be 6000 for 48MHz CCLK. */
 /* Public Functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
 void PWMAudioSetFrequency(u32 u32Channel_, u16 u16Frequency_);
+void PWMAudioSetPeriod(u32 u32Channel_, u32 u32Period_);
 void PWMAudioOn(u32 u32Channel_);
 void PWMAudioOff(u32 u32Channel_);
 
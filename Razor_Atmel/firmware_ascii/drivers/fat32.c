@@ -0,0 +1,1050 @@
+/**********************************************************************************************************************
+File: fat32.c
+
+Description:
+Read-only FAT32 file system on top of the SD card task, so files can be opened by name on a card formatted
+on a PC.  The card may hold a FAT32 volume on its own (as mkfs.vfat makes on a whole device) or in the first
+FAT32 partition of a master boot record.  Only 512 byte sectors and 8.3 names are supported; long file names
+are skipped.  One file is open at a time.
+
+Whatever this task has read is kept where it is cheap to keep:
+  - The last FAT_CACHE_SECTORS sectors of the FAT, so walking a cluster chain reads each FAT sector once.
+  - The last FAT_DIR_CACHE_SIZE directory entries seen, so opening a file again, or another file whose entry
+    was read on the way, needs no directory reads.
+  - The open file's whole cluster chain as runs of consecutive clusters, built when the file is opened.
+    Finding where a sector of the file is on the card never reads the card after that.
+
+API
+Client applications may use the following functions to access this driver:
+
+FatGetStatus() - returns a variable of type FatStatusType which may have the following value:
+  FAT_IDLE: no file is open.
+  FAT_OPENING: a file is being looked up.  This task is reading the card.
+  FAT_FILE_OPEN: the file asked for is open.
+  FAT_NOT_FOUND: there is no such file.
+  FAT_NO_VOLUME: the card does not have a FAT32 file system.
+  FAT_ERROR: the file system is damaged, the file is split into more than FAT_MAX_EXTENTS pieces or the card failed.
+
+bool FatOpen(const char* pcPath_) - starts opening a file.  pcPath_ is a path from the root directory with
+'/' between directory names, e.g. "SONGS.LIB" or "MUSIC/SONGS.LIB", matched without regard to case.  The file
+system is mounted first if it has not been since the card went in.  Returns FALSE if a file is being opened
+already or the path is too long.  Wait until the status is no longer FAT_OPENING.  The client must not read the
+card itself until then, since this task borrows every sector the SD card task reads.
+
+void FatClose(void) - forgets the open file.
+
+u32 FatGetFileSize(void) - returns the size in bytes of the open file.
+
+bool FatGetCardSector(u32 u32FileSector_, u32* pu32CardSector_) - finds the card sector holding sector
+u32FileSector_ of the open file (counted from 0) for the client to read with SdReadBlock().  Returns FALSE if
+no file is open or the sector is past the end of the file.  Never reads the card.
+
+u32 FatGetSectorReads(void) - returns the number of sectors this task has read from the card since startup.
+
+
+------------------------------------------------------------------------------------------------------------------------
+DISCLAIMER: THIS CODE IS PROVIDED WITHOUT ANY WARRANTY OR GUARANTEES.  USERS MAY
+USE THIS CODE FOR DEVELOPMENT AND EXAMPLE PURPOSES ONLY.  ENGENUICS TECHNOLOGIES
+INCORPORATED IS NOT RESPONSIBLE FOR ANY ERRORS, OMISSIONS, OR DAMAGES THAT COULD
+RESULT FROM USING THIS FIRMWARE IN WHOLE OR IN PART.
+
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+extern volatile u32 G_u32SystemFlags;                  /* From main.c */
+extern volatile u32 G_u32ApplicationFlags;             /* From main.c */
+
+extern volatile u32 G_u32SystemTime1ms;                /* From board-specific source file */
+extern volatile u32 G_u32SystemTime1s;                 /* From board-specific source file */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "Fat_" and be declared as static.
+***********************************************************************************************************************/
+static fnCode_type Fat_pfStateMachine;               /* The FAT state machine function pointer */
+static FatStatusType Fat_eStatus;                    /* Status reported to the client */
+
+/* Volume */
+static bool Fat_bMounted;                            /* The boot sector of the card has been read */
+static u32 Fat_u32FatStart;                          /* Card sector of the first FAT */
+static u32 Fat_u32DataStart;                         /* Card sector of cluster FAT_FIRST_CLUSTER */
+static u32 Fat_u32Clusters;                          /* Data clusters in the volume */
+static u32 Fat_u32RootCluster;                       /* First cluster of the root directory */
+static u8 Fat_u8SectorsPerCluster;
+
+/* Caches */
+static u8 Fat_aau8FatCache[FAT_CACHE_SECTORS][FAT_SECTOR_SIZE]; /* Copies of FAT sectors */
+static u32 Fat_au32FatCacheSector[FAT_CACHE_SECTORS];  /* Card sector in each, FAT_NO_SECTOR when empty */
+static u8 Fat_u8FatCacheNext;                        /* Entry the next FAT sector read replaces */
+static u32 Fat_u32FatSectorNeeded;                   /* FAT sector FatNextCluster() did not find */
+static fnCode_type Fat_pfFatReadReturnState;         /* State that goes on once that sector is cached */
+static FatDirEntryType Fat_asDirCache[FAT_DIR_CACHE_SIZE]; /* Directory entries seen */
+static u8 Fat_u8DirCacheNext;                        /* Entry the next directory entry seen replaces */
+
+/* File being opened */
+static char Fat_acPath[FAT_MAX_PATH_SIZE];           /* Path given to FatOpen() */
+static u8 Fat_u8PathIndex;                           /* Start of the next name in the path */
+static u8 Fat_au8Name[FAT_NAME_SIZE];                /* Name being looked for, as stored in a directory */
+static bool Fat_bLastName;                           /* The name is the file's own, not a directory on the way */
+static u32 Fat_u32Directory;                         /* First cluster of the directory being looked in */
+static u32 Fat_u32DirCluster;                        /* Cluster of it being read */
+static u8 Fat_u8DirSector;                           /* Sector of that cluster being read */
+
+/* Open file */
+static u32 Fat_u32FileSize;
+static FatExtentType Fat_asExtents[FAT_MAX_EXTENTS]; /* The file's cluster chain in runs of consecutive clusters */
+static u8 Fat_u8Extents;
+static u32 Fat_u32ChainClusters;                     /* Clusters of the chain found so far */
+static u32 Fat_u32ChainEnd;                          /* Last cluster found so far */
+
+/* Sector reads */
+static u32 Fat_u32ReadSector;                        /* Card sector being read */
+static u8* Fat_pu8ReadData;                          /* Sector lent by the SD card task once it has been read */
+static fnCode_type Fat_pfReadDoneState;              /* State to go to once the sector is in */
+static bool Fat_bReadStarted;                        /* The SD card task has accepted the read */
+static u32 Fat_u32SectorReads;                       /* Sectors read since startup */
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatGetStatus
+
+Description:
+Reports the status of the file asked for with FatOpen().
+
+Requires:
+  -
+
+Promises:
+  - Returns Fat_eStatus
+*/
+FatStatusType FatGetStatus(void)
+{
+  return Fat_eStatus;
+
+} /* end FatGetStatus() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatOpen
+
+Description:
+Starts opening a file by its path from the root directory.
+
+Requires:
+  - pcPath_ is a 0-terminated path of 8.3 names separated by '/'
+  - The client does not read the card while the status is FAT_OPENING
+
+Promises:
+  - If no file is being opened and the path fits, any open file is closed, the status is FAT_OPENING and
+    TRUE is returned.  The state machine looks the file up from its next pass.
+  - Else returns FALSE
+*/
+bool FatOpen(const char* pcPath_)
+{
+  if( (Fat_eStatus == FAT_OPENING) || (strlen(pcPath_) >= FAT_MAX_PATH_SIZE) )
+  {
+    return FALSE;
+  }
+
+  strcpy(Fat_acPath, pcPath_);
+  Fat_u8Extents = 0;
+  Fat_u32FileSize = 0;
+  Fat_eStatus = FAT_OPENING;
+
+  return TRUE;
+
+} /* end FatOpen() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatClose
+
+Description:
+Closes the open file.
+
+Requires:
+  -
+
+Promises:
+  - Unless a file is being opened, no file is open and the status is FAT_IDLE
+*/
+void FatClose(void)
+{
+  if(Fat_eStatus != FAT_OPENING)
+  {
+    Fat_u8Extents = 0;
+    Fat_u32FileSize = 0;
+    Fat_eStatus = FAT_IDLE;
+  }
+
+} /* end FatClose() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatGetFileSize
+
+Description:
+Returns the size of the open file.
+
+Requires:
+  -
+
+Promises:
+  - Returns the file's size in bytes, 0 if no file is open
+*/
+u32 FatGetFileSize(void)
+{
+  return Fat_u32FileSize;
+
+} /* end FatGetFileSize() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatGetCardSector
+
+Description:
+Finds where a sector of the open file is on the card from the cluster chain cached when it was opened.
+
+Requires:
+  -
+
+Promises:
+  - If a file is open and u32FileSector_ is in it, *pu32CardSector_ is the card sector holding it and TRUE
+    is returned
+  - Else returns FALSE
+*/
+bool FatGetCardSector(u32 u32FileSector_, u32* pu32CardSector_)
+{
+  u32 u32Cluster;
+
+  if( (Fat_eStatus != FAT_FILE_OPEN) || (u32FileSector_ >= (Fat_u32FileSize + FAT_SECTOR_SIZE - 1) / FAT_SECTOR_SIZE) )
+  {
+    return FALSE;
+  }
+
+  /* Count clusters into the file through the runs the chain is made of */
+  u32Cluster = u32FileSector_ / Fat_u8SectorsPerCluster;
+  for(u8 i = 0; i < Fat_u8Extents; i++)
+  {
+    if(u32Cluster < Fat_asExtents[i].u32Clusters)
+    {
+      *pu32CardSector_ = FatClusterToSector(Fat_asExtents[i].u32FirstCluster + u32Cluster) +
+                         (u32FileSector_ % Fat_u8SectorsPerCluster);
+      return TRUE;
+    }
+
+    u32Cluster -= Fat_asExtents[i].u32Clusters;
+  }
+
+  return FALSE;
+
+} /* end FatGetCardSector() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatGetSectorReads
+
+Description:
+Returns the number of sectors this task has read from the card.
+
+Requires:
+  -
+
+Promises:
+  - Returns Fat_u32SectorReads
+*/
+u32 FatGetSectorReads(void)
+{
+  return Fat_u32SectorReads;
+
+} /* end FatGetSectorReads() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FatInitialize
+
+Description:
+Initializes the FAT task.  Nothing is read until a file is opened.
+
+Requires:
+  -
+
+Promises:
+  - No volume mounted, caches empty and no file open
+*/
+void FatInitialize(void)
+{
+  Fat_u32SectorReads = 0;
+  Fat_eStatus = FAT_IDLE;
+  FatUnmount();
+
+  Fat_pfStateMachine = FatSM_Idle;
+
+} /* end FatInitialize() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function FatRunActiveState()
+
+Description:
+Selects and runs one iteration of the current state in the state machine.
+All state machines have a TOTAL of 1ms to execute, so on average n state machines
+may take 1ms / n to execute.
+
+Requires:
+  - State machine function pointer points at current state
+
+Promises:
+  - Calls the function to pointed by the state machine function pointer
+*/
+void FatRunActiveState(void)
+{
+  Fat_pfStateMachine();
+
+} /* end FatRunActiveState */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatReadSector
+
+Description:
+Starts reading a card sector.  The state machine moves on to pfDoneState_ once the sector is in Fat_pu8ReadData,
+which pfDoneState_ must give back to the SD card task.
+
+Requires:
+  -
+
+Promises:
+  - The state machine reads u32Sector_ from its next pass
+*/
+static void FatReadSector(u32 u32Sector_, fnCode_type pfDoneState_)
+{
+  Fat_u32ReadSector = u32Sector_;
+  Fat_pu8ReadData = NULL;
+  Fat_pfReadDoneState = pfDoneState_;
+  Fat_bReadStarted = FALSE;
+
+  Fat_pfStateMachine = FatSM_ReadSector;
+
+} /* end FatReadSector() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatIsCardReady
+
+Description:
+Checks the card is still there.  A card that has gone or failed takes the volume with it.
+
+Requires:
+  -
+
+Promises:
+  - Returns TRUE if the card can be read
+  - Else the volume is unmounted, a file being opened fails with FAT_ERROR, an open file is closed, the state
+    machine is idle and FALSE is returned
+*/
+static bool FatIsCardReady(void)
+{
+  SdCardStateType eCardState = SdGetStatus();
+
+  if( (eCardState == SD_NO_CARD) || (eCardState == SD_CARD_ERROR) )
+  {
+    if(Fat_bMounted || (Fat_eStatus == FAT_OPENING))
+    {
+      FatUnmount();
+      Fat_eStatus = (Fat_eStatus == FAT_OPENING) ? FAT_ERROR : FAT_IDLE;
+    }
+
+    Fat_pfStateMachine = FatSM_Idle;
+    return FALSE;
+  }
+
+  return TRUE;
+
+} /* end FatIsCardReady() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatUnmount
+
+Description:
+Forgets the volume and everything cached from it.
+
+Requires:
+  -
+
+Promises:
+  - Fat_bMounted is FALSE, the caches are empty and there is no open file
+*/
+static void FatUnmount(void)
+{
+  Fat_bMounted = FALSE;
+  Fat_u8Extents = 0;
+  Fat_u32FileSize = 0;
+
+  for(u8 i = 0; i < FAT_CACHE_SECTORS; i++)
+  {
+    Fat_au32FatCacheSector[i] = FAT_NO_SECTOR;
+  }
+  Fat_u8FatCacheNext = 0;
+
+  memset(Fat_asDirCache, 0, sizeof(Fat_asDirCache));
+  Fat_u8DirCacheNext = 0;
+
+} /* end FatUnmount() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatFinishOpen
+
+Description:
+Ends FatOpen() with the status given.
+
+Requires:
+  - No sector is borrowed
+
+Promises:
+  - Fat_eStatus is eStatus_ and the state machine is idle; the file is forgotten unless it is open
+*/
+static void FatFinishOpen(FatStatusType eStatus_)
+{
+  if(eStatus_ != FAT_FILE_OPEN)
+  {
+    Fat_u8Extents = 0;
+    Fat_u32FileSize = 0;
+  }
+
+  Fat_eStatus = eStatus_;
+  Fat_pfStateMachine = FatSM_Idle;
+
+} /* end FatFinishOpen() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatNextPathName
+
+Description:
+Takes the next name off the path and puts it in the form it has in a directory entry: 8 characters of name and
+3 of extension, upper case and padded with spaces.
+
+Requires:
+  - Fat_u8PathIndex is the start of a name in Fat_acPath
+
+Promises:
+  - If the name is a valid 8.3 name, Fat_au8Name holds it, Fat_bLastName is set if nothing follows it,
+    Fat_u8PathIndex is past it and TRUE is returned
+  - Else returns FALSE
+*/
+static bool FatNextPathName(void)
+{
+  u8 u8Length = 0;
+  u8 u8Limit = 8;
+  char cCharacter;
+
+  memset(Fat_au8Name, ' ', FAT_NAME_SIZE);
+
+  while( (Fat_acPath[Fat_u8PathIndex] != '\0') && (Fat_acPath[Fat_u8PathIndex] != '/') )
+  {
+    cCharacter = Fat_acPath[Fat_u8PathIndex++];
+
+    if( (cCharacter == '.') && (u8Limit == 8) && (u8Length != 0) )
+    {
+      /* The extension goes in the last 3 characters */
+      u8Length = 8;
+      u8Limit = FAT_NAME_SIZE;
+      continue;
+    }
+
+    if( (u8Length == u8Limit) || (cCharacter == '.') )
+    {
+      return FALSE;
+    }
+
+    if( (cCharacter >= 'a') && (cCharacter <= 'z') )
+    {
+      cCharacter -= 'a' - 'A';
+    }
+    Fat_au8Name[u8Length++] = (u8)cCharacter;
+  }
+
+  Fat_bLastName = (Fat_acPath[Fat_u8PathIndex] == '\0');
+  if(!Fat_bLastName)
+  {
+    Fat_u8PathIndex++;
+  }
+
+  return (u8Length != 0);
+
+} /* end FatNextPathName() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatClusterToSector
+
+Description:
+Returns the card sector a data cluster starts at.
+
+Requires:
+  - The volume is mounted and u32Cluster_ is a data cluster
+
+Promises:
+  - Returns the card sector of the first sector of u32Cluster_
+*/
+static u32 FatClusterToSector(u32 u32Cluster_)
+{
+  return Fat_u32DataStart + ((u32Cluster_ - FAT_FIRST_CLUSTER) * Fat_u8SectorsPerCluster);
+
+} /* end FatClusterToSector() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatFindCachedFatSector
+
+Description:
+Looks for a FAT sector in the cache.
+
+Requires:
+  -
+
+Promises:
+  - Returns the cached copy of card sector u32Sector_, or NULL if it is not cached
+*/
+static u8* FatFindCachedFatSector(u32 u32Sector_)
+{
+  for(u8 i = 0; i < FAT_CACHE_SECTORS; i++)
+  {
+    if(Fat_au32FatCacheSector[i] == u32Sector_)
+    {
+      return Fat_aau8FatCache[i];
+    }
+  }
+
+  return NULL;
+
+} /* end FatFindCachedFatSector() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatNextCluster
+
+Description:
+Looks up the cluster that follows u32Cluster_ in its chain, if the FAT sector holding its entry is cached.
+
+Requires:
+  - The volume is mounted and u32Cluster_ is a data cluster
+
+Promises:
+  - If the FAT sector is cached, *pu32Next_ is the FAT entry of u32Cluster_ and TRUE is returned
+  - Else Fat_u32FatSectorNeeded is the FAT sector to read and FALSE is returned
+*/
+static bool FatNextCluster(u32 u32Cluster_, u32* pu32Next_)
+{
+  u32 u32Sector = Fat_u32FatStart + (u32Cluster_ / (FAT_SECTOR_SIZE / 4));
+  u8* pu8FatSector = FatFindCachedFatSector(u32Sector);
+
+  if(pu8FatSector == NULL)
+  {
+    Fat_u32FatSectorNeeded = u32Sector;
+    return FALSE;
+  }
+
+  *pu32Next_ = FatReadU32(&pu8FatSector[(u32Cluster_ % (FAT_SECTOR_SIZE / 4)) * 4]) & FAT_ENTRY_MASK;
+  return TRUE;
+
+} /* end FatNextCluster() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatCacheDirEntry
+
+Description:
+Keeps a directory entry from the directory being read, replacing the oldest entry kept.
+
+Requires:
+  - pu8Entry_ points to a used 8.3 entry of the directory starting at Fat_u32Directory
+
+Promises:
+  - Returns the cached entry
+*/
+static FatDirEntryType* FatCacheDirEntry(const u8* pu8Entry_)
+{
+  FatDirEntryType* psEntry = &Fat_asDirCache[Fat_u8DirCacheNext];
+
+  Fat_u8DirCacheNext = (Fat_u8DirCacheNext + 1) % FAT_DIR_CACHE_SIZE;
+
+  psEntry->u32Directory = Fat_u32Directory;
+  memcpy(psEntry->au8Name, pu8Entry_, FAT_NAME_SIZE);
+  psEntry->u8Attributes = pu8Entry_[FAT_DIR_ATTRIBUTES];
+  psEntry->u32FirstCluster = (FatReadU16(&pu8Entry_[FAT_DIR_CLUSTER_HIGH]) << 16) | FatReadU16(&pu8Entry_[FAT_DIR_CLUSTER_LOW]);
+  psEntry->u32Size = FatReadU32(&pu8Entry_[FAT_DIR_FILE_SIZE]);
+
+  return psEntry;
+
+} /* end FatCacheDirEntry() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatFindCachedDirEntry
+
+Description:
+Looks for the name being opened in the cached entries of the directory being looked in.
+
+Requires:
+  -
+
+Promises:
+  - Returns the cached entry, or NULL if it has not been seen
+*/
+static FatDirEntryType* FatFindCachedDirEntry(void)
+{
+  for(u8 i = 0; i < FAT_DIR_CACHE_SIZE; i++)
+  {
+    if( (Fat_asDirCache[i].u32Directory == Fat_u32Directory) &&
+        (memcmp(Fat_asDirCache[i].au8Name, Fat_au8Name, FAT_NAME_SIZE) == 0) )
+    {
+      return &Fat_asDirCache[i];
+    }
+  }
+
+  return NULL;
+
+} /* end FatFindCachedDirEntry() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatFoundEntry
+
+Description:
+Carries on once the directory entry of the name being looked for has been found: into the directory it names,
+or onto the file's cluster chain.
+
+Requires:
+  - psEntry_ is the entry of Fat_au8Name in Fat_u32Directory
+  - No sector is borrowed
+
+Promises:
+  - The state machine looks for the next name of the path, walks the file's cluster chain or finishes the open
+*/
+static void FatFoundEntry(FatDirEntryType* psEntry_)
+{
+  bool bDirectory = (psEntry_->u8Attributes & FAT_ATTR_DIRECTORY) ? TRUE : FALSE;
+
+  /* Directories lead on to the next name and the last name must be a file */
+  if(bDirectory == Fat_bLastName)
+  {
+    FatFinishOpen(FAT_NOT_FOUND);
+    return;
+  }
+
+  if(bDirectory)
+  {
+    /* ".." of a directory in the root holds cluster 0 */
+    Fat_u32Directory = (psEntry_->u32FirstCluster == 0) ? Fat_u32RootCluster : psEntry_->u32FirstCluster;
+    Fat_pfStateMachine = FatNextPathName() ? FatSM_FindName : FatSM_Idle;
+    if(Fat_pfStateMachine == FatSM_Idle)
+    {
+      FatFinishOpen(FAT_NOT_FOUND);
+    }
+    return;
+  }
+
+  Fat_u32FileSize = psEntry_->u32Size;
+  if(Fat_u32FileSize == 0)
+  {
+    FatFinishOpen(FAT_FILE_OPEN);
+    return;
+  }
+
+  if( (psEntry_->u32FirstCluster < FAT_FIRST_CLUSTER) || (psEntry_->u32FirstCluster >= Fat_u32Clusters + FAT_FIRST_CLUSTER) )
+  {
+    FatFinishOpen(FAT_ERROR);
+    return;
+  }
+
+  Fat_asExtents[0].u32FirstCluster = psEntry_->u32FirstCluster;
+  Fat_asExtents[0].u32Clusters = 1;
+  Fat_u8Extents = 1;
+  Fat_u32ChainClusters = 1;
+  Fat_u32ChainEnd = psEntry_->u32FirstCluster;
+  Fat_pfStateMachine = FatSM_WalkChain;
+
+} /* end FatFoundEntry() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: FatReadU16 / FatReadU32
+
+Description:
+Read little-endian numbers out of a sector.
+
+Requires:
+  -
+
+Promises:
+  - Returns the number at pu8Bytes_
+*/
+static u32 FatReadU16(const u8* pu8Bytes_)
+{
+  return (u32)pu8Bytes_[0] | ((u32)pu8Bytes_[1] << 8);
+
+} /* end FatReadU16() */
+
+static u32 FatReadU32(const u8* pu8Bytes_)
+{
+  return (u32)pu8Bytes_[0] | ((u32)pu8Bytes_[1] << 8) | ((u32)pu8Bytes_[2] << 16) | ((u32)pu8Bytes_[3] << 24);
+
+} /* end FatReadU32() */
+
+
+/**********************************************************************************************************************
+State Machine Function Definitions
+**********************************************************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Wait for a file to be opened.  The volume is mounted the first time. */
+static void FatSM_Idle(void)
+{
+  if( !FatIsCardReady() || (Fat_eStatus != FAT_OPENING) )
+  {
+    return;
+  }
+
+  if(!Fat_bMounted)
+  {
+    Fat_pfStateMachine = FatSM_Mount;
+    return;
+  }
+
+  /* Start from the root directory */
+  Fat_u8PathIndex = 0;
+  Fat_u32Directory = Fat_u32RootCluster;
+  if(FatNextPathName())
+  {
+    Fat_pfStateMachine = FatSM_FindName;
+  }
+  else
+  {
+    FatFinishOpen(FAT_NOT_FOUND);
+  }
+
+} /* end FatSM_Idle() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Read a sector.  The SD card task only takes a read when it is idle and has a free read buffer, and holds the
+data until it is borrowed. */
+static void FatSM_ReadSector(void)
+{
+  if( !FatIsCardReady() )
+  {
+    return;
+  }
+
+  if(!Fat_bReadStarted)
+  {
+    Fat_bReadStarted = SdReadBlock(Fat_u32ReadSector);
+    if(Fat_bReadStarted)
+    {
+      Fat_u32SectorReads++;
+    }
+  }
+  else
+  {
+    Fat_pu8ReadData = SdBorrowReadData();
+    if(Fat_pu8ReadData != NULL)
+    {
+      Fat_pfStateMachine = Fat_pfReadDoneState;
+    }
+  }
+
+} /* end FatSM_ReadSector() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Read the first sector of the card: a FAT32 boot sector or a master boot record */
+static void FatSM_Mount(void)
+{
+  FatReadSector(0, FatSM_BootSectorRead);
+
+} /* end FatSM_Mount() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Check the sector read for a FAT32 boot sector and take the volume's layout from it.  A master boot record
+in sector 0 leads to the boot sector of its first FAT32 partition. */
+static void FatSM_BootSectorRead(void)
+{
+  u8* pu8Sector = Fat_pu8ReadData;
+  u8* pu8Partition;
+  u8 u8SectorsPerCluster = pu8Sector[FAT_BPB_SECTORS_PER_CLUS];
+  u32 u32FatSize = FatReadU32(&pu8Sector[FAT_BPB_FAT_SIZE_32]);
+  u32 u32BootSector = Fat_u32ReadSector;
+  u32 u32Partition = 0;
+  FatStatusType eStatus = FAT_NO_VOLUME;
+
+  if( (pu8Sector[FAT_SIGNATURE_INDEX] == 0x55) && (pu8Sector[FAT_SIGNATURE_INDEX + 1] == 0xAA) )
+  {
+    /* A FAT32 boot sector has no root directory entries or 16-bit FAT size, and clusters a power of 2 sectors */
+    if( (FatReadU16(&pu8Sector[FAT_BPB_BYTES_PER_SECTOR]) == FAT_SECTOR_SIZE) && (u8SectorsPerCluster != 0) &&
+        ((u8SectorsPerCluster & (u8SectorsPerCluster - 1)) == 0) && (pu8Sector[FAT_BPB_NUM_FATS] != 0) &&
+        (FatReadU16(&pu8Sector[FAT_BPB_ROOT_ENTRIES]) == 0) && (FatReadU16(&pu8Sector[FAT_BPB_FAT_SIZE_16]) == 0) &&
+        (u32FatSize != 0) )
+    {
+      Fat_u8SectorsPerCluster = u8SectorsPerCluster;
+      Fat_u32FatStart = u32BootSector + FatReadU16(&pu8Sector[FAT_BPB_RESERVED_SECTORS]);
+      Fat_u32DataStart = Fat_u32FatStart + (pu8Sector[FAT_BPB_NUM_FATS] * u32FatSize);
+      Fat_u32Clusters = (FatReadU32(&pu8Sector[FAT_BPB_TOTAL_SECTORS_32]) - (Fat_u32DataStart - u32BootSector)) /
+                        u8SectorsPerCluster;
+      Fat_u32RootCluster = FatReadU32(&pu8Sector[FAT_BPB_ROOT_CLUSTER]);
+
+      /* The FAT must have room for every cluster */
+      if( (Fat_u32Clusters + FAT_FIRST_CLUSTER <= u32FatSize * (FAT_SECTOR_SIZE / 4)) &&
+          (Fat_u32RootCluster >= FAT_FIRST_CLUSTER) && (Fat_u32RootCluster < Fat_u32Clusters + FAT_FIRST_CLUSTER) )
+      {
+        Fat_bMounted = TRUE;
+        eStatus = FAT_OPENING;
+      }
+      else
+      {
+        eStatus = FAT_ERROR;
+      }
+    }
+    else if(u32BootSector == 0)
+    {
+      /* Look through the partition table for the first FAT32 partition */
+      for(u8 i = 0; i < 4; i++)
+      {
+        pu8Partition = &pu8Sector[FAT_MBR_PARTITION_INDEX + (i * 16)];
+        if( (pu8Partition[FAT_MBR_TYPE_OFFSET] == FAT_MBR_TYPE_FAT32_CHS) ||
+            (pu8Partition[FAT_MBR_TYPE_OFFSET] == FAT_MBR_TYPE_FAT32_LBA) )
+        {
+          u32Partition = FatReadU32(&pu8Partition[FAT_MBR_LBA_OFFSET]);
+          break;
+        }
+      }
+    }
+  }
+
+  SdReleaseReadData(pu8Sector);
+
+  if(u32Partition != 0)
+  {
+    FatReadSector(u32Partition, FatSM_BootSectorRead);
+  }
+  else if(eStatus == FAT_OPENING)
+  {
+    /* Go on to open the file */
+    Fat_pfStateMachine = FatSM_Idle;
+  }
+  else
+  {
+    FatFinishOpen(eStatus);
+  }
+
+} /* end FatSM_BootSectorRead() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Look for the next name of the path in the directory it is in: among the entries already seen first, else
+by reading the directory from its start */
+static void FatSM_FindName(void)
+{
+  FatDirEntryType* psEntry = FatFindCachedDirEntry();
+
+  if(psEntry != NULL)
+  {
+    FatFoundEntry(psEntry);
+    return;
+  }
+
+  Fat_u32DirCluster = Fat_u32Directory;
+  Fat_u8DirSector = 0;
+  FatReadSector(FatClusterToSector(Fat_u32DirCluster), FatSM_DirSectorRead);
+
+} /* end FatSM_FindName() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Look through the directory sector read.  Every entry seen is cached. */
+static void FatSM_DirSectorRead(void)
+{
+  u8* pu8Entry;
+  FatDirEntryType* psEntry;
+  FatDirEntryType* psFound = NULL;
+  bool bEnd = FALSE;
+
+  for(u16 u16Offset = 0; u16Offset < FAT_SECTOR_SIZE; u16Offset += FAT_DIR_ENTRY_SIZE)
+  {
+    pu8Entry = &Fat_pu8ReadData[u16Offset];
+
+    if(pu8Entry[0] == FAT_DIR_END)
+    {
+      bEnd = TRUE;
+      break;
+    }
+
+    /* Skip deleted entries, long name pieces and the volume label */
+    if( (pu8Entry[0] == FAT_DIR_DELETED) ||
+        ((pu8Entry[FAT_DIR_ATTRIBUTES] & FAT_ATTR_LONG_NAME) == FAT_ATTR_LONG_NAME) ||
+        (pu8Entry[FAT_DIR_ATTRIBUTES] & FAT_ATTR_VOLUME_ID) )
+    {
+      continue;
+    }
+
+    psEntry = FatCacheDirEntry(pu8Entry);
+    if(memcmp(psEntry->au8Name, Fat_au8Name, FAT_NAME_SIZE) == 0)
+    {
+      psFound = psEntry;
+      break;
+    }
+  }
+
+  SdReleaseReadData(Fat_pu8ReadData);
+
+  if(psFound != NULL)
+  {
+    FatFoundEntry(psFound);
+  }
+  else if(bEnd)
+  {
+    FatFinishOpen(FAT_NOT_FOUND);
+  }
+  else if(++Fat_u8DirSector < Fat_u8SectorsPerCluster)
+  {
+    FatReadSector(FatClusterToSector(Fat_u32DirCluster) + Fat_u8DirSector, FatSM_DirSectorRead);
+  }
+  else
+  {
+    Fat_pfStateMachine = FatSM_NextDirCluster;
+  }
+
+} /* end FatSM_DirSectorRead() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Go on to the next cluster of the directory being read */
+static void FatSM_NextDirCluster(void)
+{
+  u32 u32Next;
+
+  if(!FatNextCluster(Fat_u32DirCluster, &u32Next))
+  {
+    Fat_pfFatReadReturnState = FatSM_NextDirCluster;
+    FatReadSector(Fat_u32FatSectorNeeded, FatSM_FatSectorRead);
+    return;
+  }
+
+  if(u32Next >= FAT_END_OF_CHAIN)
+  {
+    FatFinishOpen(FAT_NOT_FOUND);
+  }
+  else if( (u32Next < FAT_FIRST_CLUSTER) || (u32Next >= Fat_u32Clusters + FAT_FIRST_CLUSTER) )
+  {
+    FatFinishOpen(FAT_ERROR);
+  }
+  else
+  {
+    Fat_u32DirCluster = u32Next;
+    Fat_u8DirSector = 0;
+    FatReadSector(FatClusterToSector(Fat_u32DirCluster), FatSM_DirSectorRead);
+  }
+
+} /* end FatSM_NextDirCluster() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Follow the open file's cluster chain to the end of the file, keeping it as runs of consecutive clusters.
+Every FAT entry in a cached sector is looked up in the same pass; a FAT sector that is not cached is read first. */
+static void FatSM_WalkChain(void)
+{
+  u32 u32FileClusters = (Fat_u32FileSize + (Fat_u8SectorsPerCluster * FAT_SECTOR_SIZE) - 1) /
+                        (Fat_u8SectorsPerCluster * FAT_SECTOR_SIZE);
+  u32 u32Next;
+
+  while(Fat_u32ChainClusters < u32FileClusters)
+  {
+    if(!FatNextCluster(Fat_u32ChainEnd, &u32Next))
+    {
+      Fat_pfFatReadReturnState = FatSM_WalkChain;
+      FatReadSector(Fat_u32FatSectorNeeded, FatSM_FatSectorRead);
+      return;
+    }
+
+    /* The chain must not end or leave the volume before the file does */
+    if( (u32Next < FAT_FIRST_CLUSTER) || (u32Next >= Fat_u32Clusters + FAT_FIRST_CLUSTER) )
+    {
+      FatFinishOpen(FAT_ERROR);
+      return;
+    }
+
+    if(u32Next == Fat_u32ChainEnd + 1)
+    {
+      Fat_asExtents[Fat_u8Extents - 1].u32Clusters++;
+    }
+    else if(Fat_u8Extents < FAT_MAX_EXTENTS)
+    {
+      Fat_asExtents[Fat_u8Extents].u32FirstCluster = u32Next;
+      Fat_asExtents[Fat_u8Extents].u32Clusters = 1;
+      Fat_u8Extents++;
+    }
+    else
+    {
+      /* Too fragmented to keep */
+      FatFinishOpen(FAT_ERROR);
+      return;
+    }
+
+    Fat_u32ChainEnd = u32Next;
+    Fat_u32ChainClusters++;
+  }
+
+  FatFinishOpen(FAT_FILE_OPEN);
+
+} /* end FatSM_WalkChain() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Keep the FAT sector read in place of the oldest one cached and go back to what needed it */
+static void FatSM_FatSectorRead(void)
+{
+  memcpy(Fat_aau8FatCache[Fat_u8FatCacheNext], Fat_pu8ReadData, FAT_SECTOR_SIZE);
+  Fat_au32FatCacheSector[Fat_u8FatCacheNext] = Fat_u32ReadSector;
+  Fat_u8FatCacheNext = (Fat_u8FatCacheNext + 1) % FAT_CACHE_SECTORS;
+
+  SdReleaseReadData(Fat_pu8ReadData);
+  Fat_pfStateMachine = Fat_pfFatReadReturnState;
+
+} /* end FatSM_FatSectorRead() */
+
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,138 @@
+/**********************************************************************************************************************
+File: fat32.h
+
+Description:
+Header file for fat32.c
+**********************************************************************************************************************/
+
+#ifndef __FAT32_H
+#define __FAT32_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+typedef enum {FAT_IDLE, FAT_OPENING, FAT_FILE_OPEN, FAT_NOT_FOUND, FAT_NO_VOLUME, FAT_ERROR} FatStatusType;
+
+/* A run of consecutive clusters in the open file's cluster chain */
+typedef struct
+{
+  u32 u32FirstCluster;                      /* First cluster of the run */
+  u32 u32Clusters;                          /* Clusters in the run */
+} FatExtentType;
+
+/* A directory entry that has been read from the card */
+typedef struct
+{
+  u32 u32Directory;                         /* First cluster of the directory the entry is in, 0 when unused */
+  u8 au8Name[11];                           /* 8.3 name as stored: space padded, no dot (FAT_NAME_SIZE) */
+  u8 u8Attributes;
+  u32 u32FirstCluster;
+  u32 u32Size;
+} FatDirEntryType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+#define FAT_SECTOR_SIZE           (u16)512             /* Only 512 byte sectors are supported, as on SD cards */
+#define FAT_CACHE_SECTORS         (u8)2                /* FAT sectors kept in RAM */
+#define FAT_DIR_CACHE_SIZE        (u8)8                /* Directory entries kept in RAM */
+#define FAT_MAX_EXTENTS           (u8)16               /* Runs of clusters a file can be split into */
+#define FAT_NAME_SIZE             (u8)11               /* 8.3 name without the dot */
+#define FAT_NO_SECTOR             (u32)0xFFFFFFFF      /* Tag of an empty FAT cache entry */
+
+/* Master boot record */
+#define FAT_MBR_PARTITION_INDEX   (u16)446             /* First partition entry */
+#define FAT_MBR_TYPE_OFFSET       (u8)4                /* Partition type within an entry */
+#define FAT_MBR_LBA_OFFSET        (u8)8                /* First sector of the partition within an entry */
+#define FAT_MBR_TYPE_FAT32_CHS    (u8)0x0B
+#define FAT_MBR_TYPE_FAT32_LBA    (u8)0x0C
+#define FAT_SIGNATURE_INDEX       (u16)510             /* 0x55 0xAA ends both the MBR and the boot sector */
+
+/* Boot sector (BIOS parameter block) */
+#define FAT_BPB_BYTES_PER_SECTOR  (u16)11
+#define FAT_BPB_SECTORS_PER_CLUS  (u16)13
+#define FAT_BPB_RESERVED_SECTORS  (u16)14
+#define FAT_BPB_NUM_FATS          (u16)16
+#define FAT_BPB_ROOT_ENTRIES      (u16)17              /* 0 on FAT32 */
+#define FAT_BPB_FAT_SIZE_16       (u16)22              /* 0 on FAT32 */
+#define FAT_BPB_TOTAL_SECTORS_32  (u16)32
+#define FAT_BPB_FAT_SIZE_32       (u16)36
+#define FAT_BPB_ROOT_CLUSTER      (u16)44
+
+/* FAT entries */
+#define FAT_ENTRY_MASK            (u32)0x0FFFFFFF      /* Top 4 bits of a FAT32 entry are reserved */
+#define FAT_BAD_CLUSTER           (u32)0x0FFFFFF7
+#define FAT_END_OF_CHAIN          (u32)0x0FFFFFF8      /* This and above end a cluster chain */
+#define FAT_FIRST_CLUSTER         (u32)2               /* Number of the first data cluster */
+
+/* Directory entries */
+#define FAT_DIR_ENTRY_SIZE        (u8)32
+#define FAT_DIR_ATTRIBUTES        (u8)11
+#define FAT_DIR_CLUSTER_HIGH      (u8)20
+#define FAT_DIR_CLUSTER_LOW       (u8)26
+#define FAT_DIR_FILE_SIZE         (u8)28
+#define FAT_DIR_END               (u8)0x00             /* First name byte of the entry after the last one */
+#define FAT_DIR_DELETED           (u8)0xE5             /* First name byte of a deleted entry */
+#define FAT_ATTR_VOLUME_ID        (u8)0x08
+#define FAT_ATTR_DIRECTORY        (u8)0x10
+#define FAT_ATTR_LONG_NAME        (u8)0x0F             /* Long file name pieces, which are skipped */
+
+#define FAT_MAX_PATH_SIZE         (u8)64               /* Longest path FatOpen() takes, including the terminating 0 */
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+FatStatusType FatGetStatus(void);
+bool FatOpen(const char* pcPath_);
+void FatClose(void);
+u32 FatGetFileSize(void);
+bool FatGetCardSector(u32 u32FileSector_, u32* pu32CardSector_);
+u32 FatGetSectorReads(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void FatInitialize(void);
+void FatRunActiveState(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+static void FatReadSector(u32 u32Sector_, fnCode_type pfDoneState_);
+static bool FatIsCardReady(void);
+static void FatUnmount(void);
+static void FatFinishOpen(FatStatusType eStatus_);
+static bool FatNextPathName(void);
+static u32 FatClusterToSector(u32 u32Cluster_);
+static u8* FatFindCachedFatSector(u32 u32Sector_);
+static bool FatNextCluster(u32 u32Cluster_, u32* pu32Next_);
+static FatDirEntryType* FatCacheDirEntry(const u8* pu8Entry_);
+static FatDirEntryType* FatFindCachedDirEntry(void);
+static void FatFoundEntry(FatDirEntryType* psEntry_);
+static u32 FatReadU16(const u8* pu8Bytes_);
+static u32 FatReadU32(const u8* pu8Bytes_);
+
+
+/***********************************************************************************************************************
+State Machine Declarations
+***********************************************************************************************************************/
+static void FatSM_Idle(void);
+static void FatSM_ReadSector(void);
+static void FatSM_Mount(void);
+static void FatSM_BootSectorRead(void);
+static void FatSM_FindName(void);
+static void FatSM_DirSectorRead(void);
+static void FatSM_NextDirCluster(void);
+static void FatSM_WalkChain(void);
+static void FatSM_FatSectorRead(void);
+
+
+#endif /* __FAT32_H */
@@ -17,7 +17,11 @@ Line #      Left most address             Last printed char           Right most
 ------------------------------------------------------------------------------------------------------------------------
 API
 void LcdInitialize(void)
-Initializes the LCD task and manually sends a message to the LCD.
+Takes the LCD out of reset and starts the LCD task, which brings the LCD up from the
+main loop without blocking: it shows the welcome message for LCD_INIT_MSG_DISP_TIME,
+clears the screen and then sets _LCD_FLAGS_READY in G_u32LcdFlags.  Nothing may be
+sent to the LCD before that flag is set.  _APPLICATION_FLAGS_LCD is set straight
+away, since the task has started by the time SystemStatusReport() runs.
 This function must be run during the startup section of main.
 e.g.
 LcdInitialize();
@@ -36,17 +40,57 @@ LCD_DISPLAY_BLINK			OR with LCD_DISPLAY_CMD to turn cursor blink on
 e.g. Turn display on with a solid (non-blinking) cursor
 LCDCommand(LCD_DISPLAY_CMD | LCD_DISPLAY_ON | LCD_DISPLAY_CURSOR);
 
-void LCDMessage(u8 u8Address_, u8 *u8Message_)
-Sends a text message to the LCD to be printed at the address specified.
+LCD_CLEAR_CMD and LCD_HOME_CMD take LCD_CLEAR_DELAY to carry out, and the LCD ignores
+anything sent to it meanwhile.
+
+u32 LCDMessage(u8 u8Address_, u8 *u8Message_)
+Sends a text message to the LCD to be printed at the address specified.  Returns
+the TWI message token, or 0 if the TWI queue was full and nothing was sent.
 e.g.
 u8 au8Message[] = "Hello world!";
 LCDMessage(LINE1_START_ADDR, au8Message);
 
-void LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_)
+u32 LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_)
 Clears a number of chars starting from the address specified.  This function does not span rows.
+Returns the TWI message token as LCDMessage() does.
 e.g. Clear "world!" from the screen after the above example.
 LCDClearChars(LINE1_START_ADDR + 5, 6);
 
+LCDMessage() and LCDClearChars() send the cursor command and the characters in one
+TWI transaction.  To change several places on the screen at once, build a batch
+and send it as one transaction, which costs one slave address and one message
+slot instead of one per change.
+
+bool LCDBatchCommand(u8 u8Command_)
+bool LCDBatchData(u8* pu8Data_, u8 u8Size_)
+bool LCDBatchMessage(u8 u8Address_, u8 *u8Message_)
+Add a command, data bytes (e.g. a CGRAM character pattern) or a message at an
+address to the batch.  Each returns FALSE and adds nothing if the batch would go
+over LCD_MAX_BATCH_SIZE command and data bytes.  LCD_CLEAR_CMD and LCD_HOME_CMD
+take much longer than the other commands, so they must be the last byte in a batch.
+
+u32 LCDBatchSend(void)
+Queues the batch as one message and empties it.  Returns the TWI message token,
+or 0 if the batch was empty or the TWI queue was full.
+e.g. Change a word on each line in one message
+u8 au8Play[] = "Play ";
+u8 au8Time[] = "1:05";
+LCDBatchMessage(LINE1_START_ADDR, au8Play);
+LCDBatchMessage(LINE2_END_ADDR - 3, au8Time);
+LCDBatchSend();
+
+Custom characters are written to CGRAM with LCD_CGRAM_CMD and LCDBatchData(), and
+shown with character codes LCD_CGRAM_CHAR_CODE to LCD_CGRAM_CHAR_CODE + 7.  The LCD
+is left in instruction table 0 once it is up, where LCD_CGRAM_CMD sets the CGRAM
+address.
+e.g. Make custom character 2 a solid block and show it at the end of line 2
+u8 au8Block[LCD_CGRAM_CHAR_SIZE] = {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F};
+u8 au8Show[] = {LCD_CGRAM_CHAR_CODE + 2, '\0'};
+LCDBatchCommand(LCD_CGRAM_CMD | (2 * LCD_CGRAM_CHAR_SIZE));
+LCDBatchData(au8Block, LCD_CGRAM_CHAR_SIZE);
+LCDBatchMessage(LINE2_END_ADDR, au8Show);
+LCDBatchSend();
+
 ***********************************************************************************************************************/
 
 #include "configuration.h"
@@ -57,6 +101,7 @@ Global variable definitions with scope across entire project.
 All Global variable names shall start with "G_<type>Lcd"
 ***********************************************************************************************************************/
 /* New variables */
+volatile u32 G_u32LcdFlags;                            /* Flag bits for LCD-related information */
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -75,6 +120,13 @@ Variable names shall start with "Lcd_" and be declared as static.
 static fnCode_type Lcd_StateMachine;
 
 static u32 Lcd_u32Timer;
+static u32 Lcd_u32MessageToken;                        /* Start-up message being sent */
+static u32 Lcd_u32StepDelay;                           /* Time in ms the LCD needs after that message */
+static fnCode_type Lcd_pfNextStep;                     /* State that sends the next start-up message */
+
+static u8 Lcd_au8BatchBytes[LCD_MAX_BATCH_SIZE];       /* Command and data bytes waiting for LCDBatchSend() */
+static u8 Lcd_au8BatchControl[LCD_MAX_BATCH_SIZE];     /* LCD_CONTROL_COMMAND or LCD_CONTROL_DATA for each byte */
+static u8 Lcd_u8BatchSize;                             /* Bytes in the batch */
 
 
 /***********************************************************************************************************************
@@ -95,6 +147,8 @@ Requires:
 	- u8Command_ is an acceptable command value for the LCD as taken from the
     "LCD Commands" list in lcd_nhd_c0220biz.h header file.  The command must
     be complete and include any optional bits.
+  - Nothing is sent to the LCD for LCD_CLEAR_DELAY after LCD_CLEAR_CMD or
+    LCD_HOME_CMD
 
 Promises:
   - The command is queued and will be sent to the LCD at the next
@@ -110,12 +164,6 @@ void LCDCommand(u8 u8Command_)
   /* Queue the command to the IC application */
   TWI0WriteData(LCD_ADDRESS, sizeof(au8LCDWriteCommand), &au8LCDWriteCommand[0], STOP);
 
-  /* Add a delay during initialization to let the command send properly */
-  if(G_u32SystemFlags & _SYSTEM_INITIALIZING )
-  {
-    for(u32 i = 0; i < 100000; i++);
-  }
-
 } /* end LCDCommand() */
 
 /*------------------------------------------------------------------------------
@@ -133,27 +181,28 @@ Requires:
     be erased first
 
 Promises:
-  - Message to set cursor address in the LCD is queued, then message data
-    is queued to the LCD to be displayed.
+  - One message that sets the cursor address in the LCD and then writes the
+    message data is queued to the LCD to be displayed.
+  - Returns the message token, or 0 if the TWI queue was full
 */
-void LCDMessage(u8 u8Address_, u8 *u8Message_)
+u32 LCDMessage(u8 u8Address_, u8 *u8Message_)
 {
   u8 u8Index;
   static u8 au8LCDMessage[LCD_MESSAGE_OVERHEAD_SIZE + LCD_MAX_MESSAGE_SIZE] =
-                           {LCD_CONTROL_DATA};
+                           {LCD_CONTROL_COMMAND | LCD_CONTROL_CONTINUE, LCD_ADDRESS_CMD, LCD_CONTROL_DATA};
 
-  /* Set the cursor to the correct address */
-  LCDCommand(LCD_ADDRESS_CMD | u8Address_);
+  /* Set the cursor to the correct address in the same transaction as the characters */
+  au8LCDMessage[1] = LCD_ADDRESS_CMD | u8Address_;
 
   /* Fill the message */
-  u8Index = 1;
+  u8Index = LCD_MESSAGE_OVERHEAD_SIZE;
   while(*u8Message_ != '\0')
   {
     au8LCDMessage[u8Index++] = *u8Message_++;
   }
 
   /* Queue the message */
-  TWI0WriteData(LCD_ADDRESS, u8Index, au8LCDMessage, STOP);
+  return( TWI0WriteData(LCD_ADDRESS, u8Index, au8LCDMessage, STOP) );
 
 } /* end LCDMessage() */
 
@@ -172,95 +221,204 @@ Requires:
     the cursor to go past the available data RAM.
 
 Promises:
-  - Message to set cursor address in the LCD is queued, then message data
-    consisting of all ' ' characters is queued to the LCD to be displayed.
+  - One message that sets the cursor address in the LCD and then writes
+    all ' ' characters is queued to the LCD to be displayed.
+  - Returns the message token, or 0 if the TWI queue was full
 */
-void LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_)
+u32 LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_)
 {
   u8 u8Index;
-  static u8 au8LCDMessage[LCD_MESSAGE_OVERHEAD_SIZE + LCD_MAX_MESSAGE_SIZE] =  {LCD_CONTROL_DATA};
+  static u8 au8LCDMessage[LCD_MESSAGE_OVERHEAD_SIZE + LCD_MAX_MESSAGE_SIZE] =
+                           {LCD_CONTROL_COMMAND | LCD_CONTROL_CONTINUE, LCD_ADDRESS_CMD, LCD_CONTROL_DATA};
 
-  /* Set the cursor to the correct address */
-  LCDCommand(LCD_ADDRESS_CMD | u8Address_);
+  /* Set the cursor to the correct address in the same transaction as the characters */
+  au8LCDMessage[1] = LCD_ADDRESS_CMD | u8Address_;
 
   /* Fill the message characters with ' ' */
   for(u8Index = 0; u8Index < u8CharactersToClear_; u8Index++)
   {
-    au8LCDMessage[u8Index + 1] = ' ';
+    au8LCDMessage[u8Index + LCD_MESSAGE_OVERHEAD_SIZE] = ' ';
   }
 
   /* Queue the message */
-  TWI0WriteData(LCD_ADDRESS, u8CharactersToClear_ + 1, au8LCDMessage, STOP);
+  return( TWI0WriteData(LCD_ADDRESS, u8CharactersToClear_ + LCD_MESSAGE_OVERHEAD_SIZE, au8LCDMessage, STOP) );
 
 } /* end LCDClearChars() */
 
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Protected Functions */
-/*--------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------------------------
+Function: LCDBatchCommand
+
+Description:
+Adds a command to the batch that LCDBatchSend() sends.
+
+Requires:
+  - u8Command_ is a complete command from the "LCD Commands" list in the header
+  - LCD_CLEAR_CMD and LCD_HOME_CMD are only added last, just before LCDBatchSend()
+
+Promises:
+  - Returns TRUE and adds the command to the batch if there is room
+  - Returns FALSE and leaves the batch unchanged if it is full
+*/
+bool LCDBatchCommand(u8 u8Command_)
+{
+  return( LcdBatchAdd(LCD_CONTROL_COMMAND, &u8Command_, 1) );
+
+} /* end LCDBatchCommand() */
+
 
 /*------------------------------------------------------------------------------
-Function: LcdInitialize
+Function: LCDBatchData
 
 Description:
-Initializes the LCD task and manually sends a message to the LCD
+Adds data bytes to the batch that LCDBatchSend() sends.  They are written to DDRAM
+or CGRAM at the address the last address command set.
 
 Requires:
-  -
+  - pu8Data_ points to u8Size_ bytes
 
 Promises:
-  - LCD task Setup and LCD functions can now be called
+  - Returns TRUE and adds the bytes to the batch if there is room for all of them
+  - Returns FALSE and leaves the batch unchanged if there is not
 */
-void LcdInitialize(void)
+bool LCDBatchData(u8* pu8Data_, u8 u8Size_)
+{
+  return( LcdBatchAdd(LCD_CONTROL_DATA, pu8Data_, u8Size_) );
+
+} /* end LCDBatchData() */
+
+
+/*------------------------------------------------------------------------------
+Function: LCDBatchMessage
+
+Description:
+Adds a text message at the address specified to the batch that LCDBatchSend()
+sends, as LCDMessage() would send it on its own.
+
+Requires:
+  - u8Message_ is a pointer to a NULL-terminated C-string
+  - The message to display is no more than (40 - the selected display location)
+    characters in length
+
+Promises:
+  - Returns TRUE and adds the cursor command and the characters to the batch if
+    there is room for all of them
+  - Returns FALSE and leaves the batch unchanged if there is not
+*/
+bool LCDBatchMessage(u8 u8Address_, u8 *u8Message_)
 {
-  u8 au8Commands[] =
+  u8 u8Length = 0;
+
+  while(u8Message_[u8Length] != '\0')
   {
-    LCD_FUNCTION_CMD, LCD_FUNCTION2_CMD, LCD_BIAS_CMD,
-    LCD_CONTRAST_CMD, LCD_DISPLAY_SET_CMD, LCD_FOLLOWER_CMD
-  };
-                 /* "012345567890123456789" */
-  u8 au8Welcome[] = "ANT Music Controller ";
-  u8 au8Author[]  = "By: Ivan Chow        ";
+    u8Length++;
+  }
 
-  /* Add firmware version to LCD message */
-  snprintf((char*)&au8Author[15], 20, "v%d.%d", VERSION_MAJOR, VERSION_MINOR);
+  if( (Lcd_u8BatchSize + 1 + u8Length) > LCD_MAX_BATCH_SIZE )
+  {
+    return(FALSE);
+  }
 
-  /* State to Idle */
-  Lcd_StateMachine = LcdSM_Idle;
+  LCDBatchCommand(LCD_ADDRESS_CMD | u8Address_);
+  return( LcdBatchAdd(LCD_CONTROL_DATA, u8Message_, u8Length) );
 
-  /* Turn on LCD wait 40 ms for it to setup */
-  AT91C_BASE_PIOB->PIO_SODR = PB_09_LCD_RST;
-  Lcd_u32Timer = G_u32SystemTime1ms;
-  while( !IsTimeUp(&Lcd_u32Timer, LCD_STARTUP_DELAY) );
+} /* end LCDBatchMessage() */
 
-  /* Send Control Command */
-  TWI0WriteByte(LCD_ADDRESS, LCD_CONTROL_COMMAND, NO_STOP);
 
-  /* Send Control Commands */
-  TWI0WriteData(LCD_ADDRESS, NUM_CONTROL_CMD, &au8Commands[0], NO_STOP);
+/*------------------------------------------------------------------------------
+Function: LCDBatchSend
 
-  /* Wait for 200 ms */
-  Lcd_u32Timer = G_u32SystemTime1ms;
-  while( !IsTimeUp(&Lcd_u32Timer, LCD_CONTROL_COMMAND_DELAY) );
+Description:
+Queues everything added to the batch as one TWI message.  Every byte before the
+last run of commands or data goes with its own control byte that has the Co bit
+set, so another control byte follows it; the last run shares one control byte
+with Co clear.
+
+Requires:
+  - Nothing is added to the batch from an interrupt
+
+Promises:
+  - Returns the TWI message token and empties the batch
+  - Returns 0 if the batch was empty, or if the TWI queue was full in which
+    case the batch is emptied without being sent
+*/
+u32 LCDBatchSend(void)
+{
+  static u8 au8Transfer[(2 * LCD_MAX_BATCH_SIZE) + 1];
+  u8 u8Index;
+  u8 u8RunStart;
+  u8 u8Size = 0;
+  u32 u32Token;
+
+  if(Lcd_u8BatchSize == 0)
+  {
+    return(0);
+  }
+
+  /* Find the last run of bytes of the same kind */
+  u8RunStart = Lcd_u8BatchSize - 1;
+  while( (u8RunStart > 0) &&
+         (Lcd_au8BatchControl[u8RunStart - 1] == Lcd_au8BatchControl[Lcd_u8BatchSize - 1]) )
+  {
+    u8RunStart--;
+  }
 
-  /* Send Final Command to turn it on */
-  TWI0WriteByte(LCD_ADDRESS, LCD_DISPLAY_CMD | LCD_DISPLAY_ON, STOP);
+  /* Each byte before it is paired with its control byte */
+  for(u8Index = 0; u8Index < u8RunStart; u8Index++)
+  {
+    au8Transfer[u8Size++] = Lcd_au8BatchControl[u8Index] | LCD_CONTROL_CONTINUE;
+    au8Transfer[u8Size++] = Lcd_au8BatchBytes[u8Index];
+  }
+
+  /* Then the last run follows a single control byte */
+  au8Transfer[u8Size++] = Lcd_au8BatchControl[u8RunStart];
+  for(u8Index = u8RunStart; u8Index < Lcd_u8BatchSize; u8Index++)
+  {
+    au8Transfer[u8Size++] = Lcd_au8BatchBytes[u8Index];
+  }
+
+  Lcd_u8BatchSize = 0;
+  u32Token = TWI0WriteData(LCD_ADDRESS, u8Size, au8Transfer, STOP);
+
+  return(u32Token);
+
+} /* end LCDBatchSend() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+Function: LcdInitialize
+
+Description:
+Takes the LCD out of reset and starts the LCD task.  The LCD needs LCD_STARTUP_DELAY
+before it takes commands and LCD_CONTROL_COMMAND_DELAY after them, so its start-up
+is run by the state machine from the main loop instead of waiting here.
+
+Requires:
+  -
+
+Promises:
+  - LCD task Setup: _APPLICATION_FLAGS_LCD is set, the LCD is brought up by
+    LcdRunActiveState() and _LCD_FLAGS_READY is set once LCD functions can be called
+*/
+void LcdInitialize(void)
+{
+  /* Turn on LCD, it needs 40 ms to setup */
+  AT91C_BASE_PIOB->PIO_SODR = PB_09_LCD_RST;
+  Lcd_u32Timer = G_u32SystemTime1ms;
 
   /* Blacklight - White */
   LedOn(LCD_RED);
   LedOn(LCD_GREEN);
   LedOn(LCD_BLUE);
 
-  /* First line on LCD */
-  TWI0WriteByte(LCD_ADDRESS, LCD_CONTROL_DATA, NO_STOP);
-  TWI0WriteData(LCD_ADDRESS, 20, &au8Welcome[0], STOP);
-
-  /* Second line on LCD */
-  /* Use the API for simplicity at this point... */
-  LCDMessage(LINE2_START_ADDR, au8Author);
-
-  Lcd_u32Timer = G_u32SystemTime1ms;
+  /* The task is running, the LCD itself is ready when _LCD_FLAGS_READY is set */
+  G_u32LcdFlags = 0;
   G_u32ApplicationFlags |= _APPLICATION_FLAGS_LCD;
+  Lcd_StateMachine = LcdSM_PowerUp;
 
 } /* end LcdInitialize */
 
@@ -286,10 +444,219 @@ void LcdRunActiveState(void)
 } /* end LcdRunActiveState */
 
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------
+Function: LcdBatchAdd
+
+Description:
+Adds bytes of one kind to the batch.
+
+Requires:
+  - u8Control_ is LCD_CONTROL_COMMAND or LCD_CONTROL_DATA
+  - pu8Bytes_ points to u8Size_ bytes
+
+Promises:
+  - Returns TRUE and appends the bytes if they all fit in the batch
+  - Returns FALSE and leaves the batch unchanged if they do not
+*/
+static bool LcdBatchAdd(u8 u8Control_, u8* pu8Bytes_, u8 u8Size_)
+{
+  if( (Lcd_u8BatchSize + u8Size_) > LCD_MAX_BATCH_SIZE )
+  {
+    return(FALSE);
+  }
+
+  for(u8 i = 0; i < u8Size_; i++)
+  {
+    Lcd_au8BatchControl[Lcd_u8BatchSize] = u8Control_;
+    Lcd_au8BatchBytes[Lcd_u8BatchSize++] = pu8Bytes_[i];
+  }
+
+  return(TRUE);
+
+} /* end LcdBatchAdd() */
+
+
+/*------------------------------------------------------------------------------
+Function: LcdStartupNext
+
+Description:
+Waits for a start-up message to be sent and for the LCD to carry it out, then moves
+on to the next step.
+
+Requires:
+  - u32Token_ is the token of the message just queued, or 0 if it could not be
+  - u32Delay_ is the time in ms the LCD needs after the message
+
+Promises:
+  - If the message was queued, LcdSM_WaitStartup() runs until it has been sent and
+    u32Delay_ has passed, then pfNextStep_ runs
+  - If not, the current state is kept so it queues the message again next time
+*/
+static void LcdStartupNext(u32 u32Token_, u32 u32Delay_, fnCode_type pfNextStep_)
+{
+  if(u32Token_ != 0)
+  {
+    Lcd_u32MessageToken = u32Token_;
+    Lcd_u32StepDelay = u32Delay_;
+    Lcd_pfNextStep = pfNextStep_;
+    Lcd_StateMachine = LcdSM_WaitStartup;
+  }
+
+} /* end LcdStartupNext() */
+
+
 /***********************************************************************************************************************
 State Machine Function Declarations
 ***********************************************************************************************************************/
 
+/*------------------------------------------------------------------------------
+Function: LcdSM_PowerUp
+
+Description:
+Waits for the LCD to come out of reset, then sends the initialization commands.
+
+Requires:
+  - Lcd_u32Timer is the time the LCD was taken out of reset
+
+Promises:
+  - After LCD_STARTUP_DELAY, the initialization commands are queued as one
+    message and the LCD is given LCD_CONTROL_COMMAND_DELAY to carry them out
+*/
+void LcdSM_PowerUp(void)
+{
+  static u8 au8Commands[] =
+  {
+    LCD_CONTROL_COMMAND,
+    LCD_FUNCTION_CMD, LCD_FUNCTION2_CMD, LCD_BIAS_CMD,
+    LCD_CONTRAST_CMD, LCD_DISPLAY_SET_CMD, LCD_FOLLOWER_CMD
+  };
+
+  if( IsTimeUp(&Lcd_u32Timer, LCD_STARTUP_DELAY) )
+  {
+    LcdStartupNext(TWI0WriteData(LCD_ADDRESS, sizeof(au8Commands), au8Commands, STOP),
+                   LCD_CONTROL_COMMAND_DELAY, LcdSM_DisplayOn);
+  }
+
+} /* end LcdSM_PowerUp() */
+
+
+/*------------------------------------------------------------------------------
+Function: LcdSM_WaitStartup
+
+Description:
+Waits for the current start-up message to be sent, then for the time the LCD needs
+to carry it out.
+
+Requires:
+  - Lcd_u32MessageToken, Lcd_u32StepDelay and Lcd_pfNextStep are set by
+    LcdStartupNext()
+
+Promises:
+  - Once the message is no longer waiting or sending, Lcd_u32Timer is set
+  - Lcd_pfNextStep is next once Lcd_u32StepDelay has passed since then.  A
+    message the LCD did not take is not sent again: the rest of the system
+    carries on without the display.
+*/
+void LcdSM_WaitStartup(void)
+{
+  MessageStateType eStatus;
+
+  if(Lcd_u32MessageToken != 0)
+  {
+    eStatus = QueryMessageStatus(Lcd_u32MessageToken);
+    if( (eStatus != WAITING) && (eStatus != SENDING) )
+    {
+      Lcd_u32MessageToken = 0;
+      Lcd_u32Timer = G_u32SystemTime1ms;
+    }
+  }
+  else if( IsTimeUp(&Lcd_u32Timer, Lcd_u32StepDelay) )
+  {
+    Lcd_StateMachine = Lcd_pfNextStep;
+  }
+
+} /* end LcdSM_WaitStartup() */
+
+
+/*------------------------------------------------------------------------------
+Function: LcdSM_DisplayOn
+
+Description:
+Turns the display on with the welcome message.
+
+Requires:
+  - The LCD has carried out the initialization commands
+
+Promises:
+  - The function set back to instruction table 0 (for LCD_CGRAM_CMD), the display
+    on command and both lines of the welcome message are queued as one message
+    and left on the screen for LCD_INIT_MSG_DISP_TIME
+*/
+void LcdSM_DisplayOn(void)
+{
+                 /* "01234567890123456789" */
+  u8 au8Welcome[] = "ANT Music Controller";
+  u8 au8Author[]  = "By: Ivan Chow        ";
+
+  /* Add firmware version to LCD message */
+  snprintf((char*)&au8Author[15], 20, "v%d.%d", VERSION_MAJOR, VERSION_MINOR);
+
+  LCDBatchCommand(LCD_FUNCTION_CMD);
+  LCDBatchCommand(LCD_DISPLAY_CMD | LCD_DISPLAY_ON);
+  LCDBatchMessage(LINE1_START_ADDR, au8Welcome);
+  LCDBatchMessage(LINE2_START_ADDR, au8Author);
+  LcdStartupNext(LCDBatchSend(), LCD_INIT_MSG_DISP_TIME, LcdSM_ClearWelcome);
+
+} /* end LcdSM_DisplayOn() */
+
+
+/*------------------------------------------------------------------------------
+Function: LcdSM_ClearWelcome
+
+Description:
+Clears the welcome message off the screen.
+
+Requires:
+  - The welcome message has been shown
+
+Promises:
+  - LCD_CLEAR_CMD is queued and the LCD is given LCD_CLEAR_DELAY to carry it out
+    before the LCD is ready
+*/
+void LcdSM_ClearWelcome(void)
+{
+  static u8 au8ClearCommand[] = {LCD_CONTROL_COMMAND, LCD_CLEAR_CMD};
+
+  LcdStartupNext(TWI0WriteData(LCD_ADDRESS, sizeof(au8ClearCommand), au8ClearCommand, STOP),
+                 LCD_CLEAR_DELAY, LcdSM_Ready);
+
+} /* end LcdSM_ClearWelcome() */
+
+
+/*------------------------------------------------------------------------------
+Function: LcdSM_Ready
+
+Description:
+Lets the rest of the system use the LCD.
+
+Requires:
+  - The screen has been cleared
+
+Promises:
+  - _LCD_FLAGS_READY is set and the state machine is Idle
+*/
+void LcdSM_Ready(void)
+{
+  G_u32LcdFlags |= _LCD_FLAGS_READY;
+  Lcd_StateMachine = LcdSM_Idle;
+
+} /* end LcdSM_Ready() */
+
+
 /*------------------------------------------------------------------------------
 Function: LcdSM_Idle
 
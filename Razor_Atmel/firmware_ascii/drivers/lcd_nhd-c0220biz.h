@@ -23,20 +23,26 @@ RESULT FROM USING THIS FIRMWARE IN WHOLE OR IN PART.
 #define _LCD_FLAGS_MESSAGE_IN_QUEUE       (u32)0x00000001      /* There is an LCD message in the MessageSenderQueue */
 #define _LCD_FLAGS_SM_MANUAL              (u32)0x00000004      /* Run the LCD SM in manual mode */
 #define _LCD_FLAGS_UPDATE_IN_PROGRESS     (u32)0x00000008      /* LCD update is currently in progress */
+#define _LCD_FLAGS_READY                  (u32)0x00000010      /* Start-up is done and LCD functions can be called */
 
 #define LCD_CONTROL_COMMAND               (u8)0x00             /* Control byte to LCD command is coming */
 #define LCD_CONTROL_DATA                  (u8)0x40             /* Control byte to LCD command is coming */
+#define LCD_CONTROL_CONTINUE              (u8)0x80             /* OR with a control byte: only one byte follows, then
+                                                                  another control byte (Co bit) */
 
 #define LCD_STARTUP_DELAY                 (u8)40               /* Time in ms to wait for LCD startup */
 #define LCD_CONTROL_COMMAND_DELAY         (u8)200              /* Time in ms to wait for LCD Command Instructions */
-#define LCD_INIT_MSG_DISP_TIME            (u32)1000
+#define LCD_CLEAR_DELAY                   (u8)2                /* Time in ms to wait for LCD_CLEAR_CMD or LCD_HOME_CMD */
+#define LCD_INIT_MSG_DISP_TIME            (u32)1000            /* Time in ms the welcome message is shown at startup */
 
-#define LCD_MESSAGE_OVERHEAD_SIZE         (u8)1                /* Number of header bytes for an LCD message */
+#define LCD_MESSAGE_OVERHEAD_SIZE         (u8)3                /* Number of header bytes for an LCD message */
 #define LCD_MAX_LINE_DISPLAY_SIZE         (u8)20               /* Maximum message length displayable on a single line */ 
 #define LCD_MAX_MESSAGE_SIZE              (u8)40               /* Maximum message length on a single line of the 
                                                                   display assuming message starts at far left of screen
                                                                   Only 20 characters can be displayed and remaining characters 
                                                                   will be off the screen but still in LCD RAM */
+#define LCD_MAX_BATCH_SIZE                (u8)48               /* Command and data bytes in one batch: a line of
+                                                                  LCD RAM and its cursor command, with room to spare */
 /*------------------------------------------------------------------------------
 Operational Notes:
 RS and R/W lines are controlled to enable various states:
@@ -85,6 +91,13 @@ space can be used for scrolling displays.
 #define		LCD_SHIFT_DISPLAY		(u8)0x08		/* Set to operate on dislay, clear for cursor */
 #define		LCD_SHIFT_RIGHT			(u8)0x04		/* Set to shift right, clear to shift left */
 
+#define   LCD_CGRAM_CMD       (u8)0x40    /* Root literal to set the CGRAM address, in instruction table 0 only */
+                                          /* Bottom 6 bits are address: custom character * LCD_CGRAM_CHAR_SIZE + row */
+#define   LCD_CGRAM_CHARS     (u8)8       /* Number of custom characters in CGRAM */
+#define   LCD_CGRAM_CHAR_SIZE (u8)8       /* Rows in a custom character, 5 pixels each with bit 4 on the left */
+#define   LCD_CGRAM_CHAR_CODE (u8)0x08    /* Character code of custom character 0.  Codes 0x00 - 0x07 show the same
+                                             characters, but 0x00 would end a message */
+
 #define		LCD_ADDRESS_CMD			(u8)0x80		/* Root literal to set the cursor position */
 																			    /* Bottom 6 bits are address (0x00-0x27 and 0x40-0x67) */
 #define		LINE1_START_ADDR		(u8)0x00 		/* Constant for defining cursor location for LINE1 */
@@ -102,8 +115,12 @@ space can be used for scrolling displays.
 /* Public functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
 void LCDCommand(u8 u8Command_);
-void LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_);
-void LCDMessage(u8 u8Address_, u8 *u8Message_);
+u32 LCDClearChars(u8 u8Address_, u8 u8CharactersToClear_);
+u32 LCDMessage(u8 u8Address_, u8 *u8Message_);
+bool LCDBatchCommand(u8 u8Command_);
+bool LCDBatchData(u8* pu8Data_, u8 u8Size_);
+bool LCDBatchMessage(u8 u8Address_, u8 *u8Message_);
+u32 LCDBatchSend(void);
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -115,11 +132,18 @@ void LcdRunActiveState(void);
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Private functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
+static bool LcdBatchAdd(u8 u8Control_, u8* pu8Bytes_, u8 u8Size_);
+static void LcdStartupNext(u32 u32Token_, u32 u32Delay_, fnCode_type pfNextStep_);
 
 
 /***********************************************************************************************************************
 State Machine Declarations
 ***********************************************************************************************************************/
+void LcdSM_PowerUp(void);
+void LcdSM_WaitStartup(void);
+void LcdSM_DisplayOn(void);
+void LcdSM_ClearWelcome(void);
+void LcdSM_Ready(void);
 void LcdSM_Idle(void);
 
   
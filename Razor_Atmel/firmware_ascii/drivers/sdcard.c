@@ -20,9 +20,34 @@ bool SdReadBlock(u32 u32SectorAddress_) - initiates read of one 512 byte block o
 Returns TRUE if the card is available and can start reading. 
 User must use SdGetStatus() and wait until the card status is SD_DATA_READY which means the read is done.
 
-bool SdWriteBlock(u32 u32BlockAddress_) - not yet implemented
+bool SdReadBlocks(u32 u32SectorAddress_, u32 u32NumBlocks_, fnSdBlockCallback_type pfBlockCallback_) - 
+initiates a read of u32NumBlocks_ consecutive blocks with one READ_MULTIPLE_BLOCK command.  Returns TRUE if 
+the card is available and can start reading.  pfBlockCallback_ is called with each block as it arrives; the
+card status is SD_READING until the last block is in and then goes straight back to SD_IDLE.  This saves the
+command, response and SSP request of every block after the first, so use it to read anything contiguous.
 
-bool SdGetReadData(u8* pu8Destination_) - transfers the read data to the client.  The card state will return to SD_IDLE.
+bool SdWriteBlock(u32 u32BlockAddress_, u8* pu8Data_) - queues the 512 bytes at pu8Data_ to be written to the block
+and returns straight away; the data is copied, so the client's buffer is free again as soon as this returns.
+Returns FALSE if there is no card or the write queue is full.  Queued blocks are written whenever the card is
+SD_IDLE, with the card status SD_WRITING while it is busy with them, and blocks queued at consecutive addresses
+go together in one WRITE_MULTIPLE_BLOCK.  The card programs the last block of each write while other tasks run
+and is only waited on when it is next needed.  The copies go into the read buffers, so they count against the
+buffers a client can borrow until they have been written.
+
+u8 SdGetWritesPending(void) - returns the number of queued blocks the card has not yet taken.  0 means every
+block written has reached the card.
+
+u32 SdGetWriteErrors(void) - returns the number of blocks that could not be written: rejected by the card
+more than SD_WRITE_RETRIES times or still queued when the card was removed or failed.
+
+bool SdGetReadData(u8* pu8Destination_) - copies the read data to the client.  The card state will return to SD_IDLE.
+
+u8* SdBorrowReadData(void) - lends the client the buffer the sector was read into instead of copying it, or returns
+NULL if no data is ready.  The card state returns to SD_IDLE and the next read goes into another buffer, so the
+client may keep several sectors while more are read.  Every borrowed buffer must be given back with 
+SdReleaseReadData(pu8Data_); once there are no free buffers SdReadBlock() returns FALSE.  All buffers are taken
+back when the card is initialized again, so a client must drop any it holds when the status goes to SD_NO_CARD or
+SD_CARD_ERROR.
 
 
 **********************************************************************************************************************/
@@ -62,13 +87,33 @@ static fnCode_type SD_pfWaitReturnState;           /* The saved state to return
 static SspConfigurationType SD_sSspConfig;         /* Configuration information for SSP peripheral */
 static SspPeripheralType* SD_Ssp;                  /* Pointer to SSP peripheral object */
 
-static u8 SD_au8RxBuffer[SDCARD_RX_BUFFER_SIZE];   /* Space for incoming bytes from the SD card */
+static u8 SD_au8CommandRxBuffer[SD_COMMAND_RX_BUFFER_SIZE];          /* Incoming bytes while the card is initialized */
+static u8 SD_aau8ReadBuffers[SD_READ_BUFFERS][SD_READ_BUFFER_SIZE];  /* Ring of sector buffers the SSP reads straight into */
+static u8 *SD_pu8RxBuffer;                         /* Buffer the SSP is receiving into: command buffer or a read buffer */
+static u32 SD_u32ReadBuffersInUse;                 /* Bit n set while read buffer n is being filled, waiting or lent */
+static u8 SD_u8ReadBuffer;                         /* Read buffer of the current read */
+static u8 SD_u8NextReadBuffer;                     /* Where the search for a free read buffer starts */
+static SdWriteType SD_asWriteQueue[SD_WRITE_QUEUE_SIZE]; /* Blocks waiting to be written, oldest at SD_u8WriteQueueHead */
+static u8 SD_u8WriteQueueHead;                     /* Block being written or to be written next */
+static u8 SD_u8WritesQueued;                       /* Blocks in the write queue */
+static u8 SD_u8WriteRunLeft;                       /* Blocks left in the current CMD24 or CMD25 write, 0 when none */
+static bool SD_bWriteMultiple;                     /* The current write is a CMD25 */
+static u8 SD_u8WriteRetries;                       /* Times the block at the head of the queue may still be sent again */
+static u16 SD_u16WriteBytesQueued;                 /* Bytes of the block being written handed to the SSP so far */
+static u32 SD_u32WriteErrors;                      /* Blocks that could not be written */
+static bool SD_bCardBusy;                          /* The card may still be programming the last block written */
 static u8 *SD_pu8RxBufferNextByte;                 /* Pointer to next spot in RxBuffer to write a byte */
 //static u8 *SD_pu8RxBufferParser;                   /* Pointer to loop through the Rx buffer to read bytes */
 
 static u32 SD_u32Timeout;                          /* Timeout counter used across states */
 static u32 SD_u32CurrentMsgToken;                  /* Token of message currently being sent */
 static u32 SD_u32Address;                          /* Current read/write sector address */
+static u32 SD_u32BlocksLeft;                       /* Blocks still to come in a multiple block read */
+static u32 SD_u32BlockIndex;                       /* Block of the multiple block read now being received */
+static fnSdBlockCallback_type SD_pfBlockCallback;  /* Client callback for a multiple block read, NULL for single block */
+static bool SD_bTokenWithBlock;                    /* The block being read was requested together with its start token */
+static bool SD_bRestartRead;                       /* A multiple block read is being stopped to be started again */
+static bool SD_bCardKeepsUp;                       /* The card has had every block ready by the time it was read */
 
 static u8 SD_au8CardInMessage[]    = "SD card inserted\n\r";
 static u8 SD_au8SspRequestFailed[] = "SdCard denied SSP\n\r";
@@ -85,12 +130,18 @@ static u8 SD_au8CardError5[]       = "NO_SD_TOKEN\n\r";
 static u8 SD_au8CMD0[]   = {SD_HOST_CMD | SD_CMD0,  0, 0, 0, 0, SD_CMD0_CRC};
 static u8 SD_au8CMD8[]   = {SD_HOST_CMD | SD_CMD8,  0, 0, SD_VHS_VALUE, SD_CHECK_PATTERN, SD_CMD8_CRC};
 static u8 SD_au8CMD16[]  = {SD_HOST_CMD | SD_CMD16, 0, 0, 0x02, 0x00, SD_NO_CRC};
+static u8 SD_au8CMD12[]  = {SD_HOST_CMD | SD_CMD12, 0, 0, 0, 0, SD_NO_CRC};
 static u8 SD_au8CMD17[]  = {SD_HOST_CMD | SD_CMD17, 0, 0, 0, 0, SD_NO_CRC};
+static u8 SD_au8CMD18[]  = {SD_HOST_CMD | SD_CMD18, 0, 0, 0, 0, SD_NO_CRC};
+static u8 SD_au8CMD24[]  = {SD_HOST_CMD | SD_CMD24, 0, 0, 0, 0, SD_NO_CRC};
+static u8 SD_au8CMD25[]  = {SD_HOST_CMD | SD_CMD25, 0, 0, 0, 0, SD_NO_CRC};
 static u8 SD_au8CMD55[]  = {SD_HOST_CMD | SD_CMD55, 0, 0, 0 ,0, SD_NO_CRC};
 static u8 SD_au8CMD58[]  = {SD_HOST_CMD | SD_CMD58, 0, 0, 0 ,0, SD_NO_CRC};
 
 static u8 SD_au8ACMD41[] = {SD_HOST_CMD | SD_ACMD41,0, 0, 0, 0, SD_NO_CRC};
 
+static u8 SD_au8StopTran[] = {TOKEN_STOP_BLOCK_MULT, SD_NOT_BUSY};  /* Stop token and the byte before the card goes busy */
+
 
 /**********************************************************************************************************************
 Function Definitions
@@ -169,11 +220,12 @@ Requires:
   - u32SectorAddress_ is a valid SD card address
 
 Promises:
-  - If the card is currently SD_IDLE, initiates the read, changes card state to "SD_READING" and returns TRUE.
+  - If the card is currently SD_IDLE and a read buffer is free, initiates the read, changes card state 
+    to "SD_READING" and returns TRUE.
 */
 bool SdReadBlock(u32 u32SectorAddress_)
 {
-  if(SD_CardState == SD_IDLE)
+  if( (SD_CardState == SD_IDLE) && SdClaimReadBuffer(&SD_u8ReadBuffer) )
   {
     /* Capture the card address of interest with adjustment for byte-accessed cards as required */
     SD_u32Address = u32SectorAddress_;
@@ -183,6 +235,7 @@ bool SdReadBlock(u32 u32SectorAddress_)
     }
     
     /* Update the card state which will trigger the start of the read sequence */
+    SD_pfBlockCallback = NULL;
     SD_CardState = SD_READING;
     return TRUE;
   }
@@ -192,52 +245,173 @@ bool SdReadBlock(u32 u32SectorAddress_)
 } /* end SdReadBlock() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SdReadBlocks
+
+Description:
+Reads u32NumBlocks_ consecutive blocks starting at the sector address provided, handing each one to
+pfBlockCallback_ as soon as it has been received.  The card streams the blocks one after the other after a
+single CMD18, so each block after the first only costs its start token and data transfer.
+Addresses are converted for byte-addressable cards the same as SdReadBlock().
+
+Requires:
+  - _SD_TYPE_SD1, _SD_TYPE_SD2, _SD_CARD_HC are correctly set/clear to indicate card type.
+  - u32SectorAddress_ through u32SectorAddress_ + u32NumBlocks_ - 1 are valid SD card addresses
+  - pfBlockCallback_ copies or uses the data before returning; it is called from the SD card task
+
+Promises:
+  - If the card is currently SD_IDLE, initiates the read, changes card state to "SD_READING" and returns TRUE.
+    Card state returns to SD_IDLE once the last block has been passed to pfBlockCallback_, or SD_CARD_ERROR
+    if the read fails part way.
+  - Returns FALSE without reading if the card is busy, u32NumBlocks_ is 0, there is no callback or no read
+    buffer is free.  The blocks all go through one read buffer, which is free again when the read is done.
+*/
+bool SdReadBlocks(u32 u32SectorAddress_, u32 u32NumBlocks_, fnSdBlockCallback_type pfBlockCallback_)
+{
+  if( (SD_CardState == SD_IDLE) && (u32NumBlocks_ != 0) && (pfBlockCallback_ != NULL) && SdClaimReadBuffer(&SD_u8ReadBuffer) )
+  {
+    /* Capture the card address of interest with adjustment for byte-accessed cards as required */
+    SD_u32Address = u32SectorAddress_;
+    if( !(SD_u32Flags & _SD_CARD_HC) )
+    {
+      SD_u32Address *= 512;
+    }
+    
+    SD_u32BlocksLeft = u32NumBlocks_;
+    SD_u32BlockIndex = 0;
+    SD_bRestartRead = FALSE;
+    SD_bCardKeepsUp = TRUE;
+    SD_pfBlockCallback = pfBlockCallback_;
+    
+    /* Update the card state which will trigger the start of the read sequence */
+    SD_CardState = SD_READING;
+    return TRUE;
+  }
+  
+  return FALSE;
+  
+} /* end SdReadBlocks() */
+
+
 /*----------------------------------------------------------------------------------------------------------------------
 Function: SdWriteBlock
 
 Description:
-Writes a block at the address provided.
+Queues a block to be written at the sector address provided.  The data is copied into a free read buffer
+already framed as a write packet, so the SSP sends it from there without another copy being made here.
+Byte-addressable cards are automatically converted the same as SdReadBlock().
+
+Requires:
+  - _SD_TYPE_SD1, _SD_TYPE_SD2, _SD_CARD_HC are correctly set/clear to indicate card type.
+  - u32BlockAddress_ is a valid SD card address
+  - pu8Data_ points to the 512 bytes to write
+
+Promises:
+  - If the card is initialized and there is room in the write queue and a free read buffer, the block is
+    queued and TRUE is returned.  It is written once the card is SD_IDLE.
+  - Else returns FALSE
+*/
+bool SdWriteBlock(u32 u32BlockAddress_, u8* pu8Data_)
+{
+  u8 u8Buffer;
+  u8* pu8Packet;
+  SdWriteType* psWrite;
+
+  if( (SD_CardState == SD_NO_CARD) || (SD_CardState == SD_CARD_ERROR) ||
+      (SD_u8WritesQueued == SD_WRITE_QUEUE_SIZE) || !SdClaimReadBuffer(&u8Buffer) )
+  {
+    return FALSE;
+  }
+
+  /* Frame the block: the token is filled in when it is sent and the checksum is not checked in SPI mode */
+  pu8Packet = SD_aau8ReadBuffers[u8Buffer];
+  pu8Packet[0] = SD_NOT_BUSY;
+  memcpy(&pu8Packet[SD_WRITE_DATA_INDEX], pu8Data_, 512);
+  pu8Packet[SD_WRITE_DATA_INDEX + 512] = SD_NOT_BUSY;
+  pu8Packet[SD_WRITE_DATA_INDEX + 513] = SD_NOT_BUSY;
+
+  psWrite = &SD_asWriteQueue[(SD_u8WriteQueueHead + SD_u8WritesQueued) % SD_WRITE_QUEUE_SIZE];
+  psWrite->u32Address = u32BlockAddress_;
+  if( !(SD_u32Flags & _SD_CARD_HC) )
+  {
+    psWrite->u32Address *= 512;
+  }
+  psWrite->u8Buffer = u8Buffer;
+
+  if(SD_u8WritesQueued == 0)
+  {
+    SD_u8WriteRetries = SD_WRITE_RETRIES;
+  }
+  SD_u8WritesQueued++;
+  
+  return TRUE;
+    
+} /* end SdWriteBlock() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SdGetWritesPending
+
+Description:
+Returns the number of blocks in the write queue.
 
 Requires:
   - 
 
 Promises:
+  - Returns the number of blocks queued by SdWriteBlock() that the card has not accepted yet
+*/
+u8 SdGetWritesPending(void)
+{
+  return SD_u8WritesQueued;
+    
+} /* end SdGetWritesPending() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SdGetWriteErrors
+
+Description:
+Returns the number of blocks that could not be written since startup.
+
+Requires:
   - 
+
+Promises:
+  - Returns SD_u32WriteErrors
 */
-bool SdWriteBlock(u32 u32BlockAddress_)
+u32 SdGetWriteErrors(void)
 {
-  return FALSE;
+  return SD_u32WriteErrors;
     
-} /* end SdWriteBlock() */
+} /* end SdGetWriteErrors() */
 
 
 /*----------------------------------------------------------------------------------------------------------------------
 Function: SdGetReadData
 
 Description:
-Transfers the data that was just read from the card.
+Copies the data that was just read from the card.  Clients that can work on the sector where it is
+should use SdBorrowReadData() instead and save the copy.
 
 Requires:
   - pu8Destination points to the start of a 512 byte buffer where the data will be read.
-  - The 512 bytes of data that was just read is at SD_au8RxBuffer[0] thru SD_au8RxBuffer[511] -
+  - The 512 bytes of data that was just read is at the start of read buffer SD_u8ReadBuffer -
     this will set SD_CardState to SD_DATA_READY.
 
 Promises:
-  - if SD_CardState = SD_DATA_READY, loads 512 bytes to pu8Destination_ and returns TRUE
+  - if SD_CardState = SD_DATA_READY, loads 512 bytes to pu8Destination_, frees the read buffer and returns TRUE
   - else returns FALSE
 */
 bool SdGetReadData(u8* pu8Destination_)
 {
+  u8* pu8Data = SdBorrowReadData();
+
   /* To ensure data integrity, card state must be SD_DATA_READY */
-  if(SD_CardState == SD_DATA_READY)
+  if(pu8Data != NULL)
   {
-    SD_CardState = SD_IDLE;
-
-    for(u16 i = 0; i < 512; i++)
-    {
-      *pu8Destination_ = SD_au8RxBuffer[i];
-      pu8Destination_++;
-    }
+    memcpy(pu8Destination_, pu8Data, 512);
+    SdReleaseReadData(pu8Data);
     
     return TRUE;
   }
@@ -250,6 +424,60 @@ bool SdGetReadData(u8* pu8Destination_)
 } /* end SdGetReadData() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SdBorrowReadData
+
+Description:
+Lends the client the read buffer holding the sector that was just read from the card.
+
+Requires:
+  - The 512 bytes of data that was just read is at the start of read buffer SD_u8ReadBuffer -
+    this will set SD_CardState to SD_DATA_READY.
+
+Promises:
+  - if SD_CardState = SD_DATA_READY, returns a pointer to the 512 bytes and sets SD_CardState to SD_IDLE.
+    The buffer stays the client's until it is passed to SdReleaseReadData() or the card is initialized again.
+  - else returns NULL
+*/
+u8* SdBorrowReadData(void)
+{
+  if(SD_CardState == SD_DATA_READY)
+  {
+    SD_CardState = SD_IDLE;
+    return SD_aau8ReadBuffers[SD_u8ReadBuffer];
+  }
+  
+  return NULL;
+    
+} /* end SdBorrowReadData() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SdReleaseReadData
+
+Description:
+Gives a buffer from SdBorrowReadData() back to the read ring.
+
+Requires:
+  - pu8Data_ was returned by SdBorrowReadData() since the card was last initialized
+
+Promises:
+  - The read buffer is free for another read; pointers that are not a lent buffer are ignored
+*/
+void SdReleaseReadData(u8* pu8Data_)
+{
+  for(u8 i = 0; i < SD_READ_BUFFERS; i++)
+  {
+    if(pu8Data_ == SD_aau8ReadBuffers[i])
+    {
+      SD_u32ReadBuffersInUse &= ~((u32)1 << i);
+      return;
+    }
+  }
+    
+} /* end SdReleaseReadData() */
+
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Protected Functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -272,18 +500,26 @@ void SdCardInitialize(void)
   u8 au8SdCardStartedMsg[] = "SdCard task ready\n\r";
 
   /* Reset the receive buffer to dummies for a known starting state */
-  memset(SD_au8RxBuffer, SSP_DUMMY_BYTE, SDCARD_RX_BUFFER_SIZE);
+  memset(SD_au8CommandRxBuffer, SSP_DUMMY_BYTE, SD_COMMAND_RX_BUFFER_SIZE);
 
   /* Initailze startup values and the command array */
-  SD_pu8RxBufferNextByte = &SD_au8RxBuffer[0];
+  SD_pu8RxBuffer = SD_au8CommandRxBuffer;
+  SD_pu8RxBufferNextByte = &SD_au8CommandRxBuffer[0];
+  SD_u32ReadBuffersInUse = 0;
+  SD_u8NextReadBuffer = 0;
+  SD_u8WriteQueueHead = 0;
+  SD_u8WritesQueued = 0;
+  SD_u8WriteRunLeft = 0;
+  SD_u32WriteErrors = 0;
+  SD_bCardBusy = FALSE;
 
   /* Configure the SSP resource to be used for the SD Card application */
   SD_sSspConfig.SspPeripheral      = SD_SSP;
   SD_sSspConfig.pCsGpioAddress     = SD_BASE_PORT;
   SD_sSspConfig.u32CsPin           = SD_CS_PIN;
-  SD_sSspConfig.pu8RxBufferAddress = SD_au8RxBuffer;
+  SD_sSspConfig.pu8RxBufferAddress = SD_au8CommandRxBuffer;
   SD_sSspConfig.ppu8RxNextByte     = &SD_pu8RxBufferNextByte;
-  SD_sSspConfig.u16RxBufferSize    = SDCARD_RX_BUFFER_SIZE;
+  SD_sSspConfig.u16RxBufferSize    = SD_COMMAND_RX_BUFFER_SIZE;
   SD_sSspConfig.eBitOrder          = MSB_FIRST;
   SD_sSspConfig.eSspMode           = SPI_MASTER_MANUAL_CS;
   
@@ -372,6 +608,213 @@ void SdCommand(u8* pau8Command_)
 } /* end SdCommand() */
 
 
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdReadCommand
+
+Description:
+Sends the read command for SD_u32Address: CMD17 for a single block, or CMD18 if a client callback is set for a 
+multiple block read.  Both take the same address and have the same response.
+
+Requires:
+  - SD_Ssp has been requested
+  - SD_u32Address is the card address of the (next) block to read
+  - SD_pfBlockCallback is NULL for a single block read
+
+Promises:
+  - The command is queued with SdCommand() and the response goes to SdCardSM_ResponseCMD17
+*/
+static void SdReadCommand(void)
+{
+  u8* pu8ReadCommand = (SD_pfBlockCallback == NULL) ? SD_au8CMD17 : SD_au8CMD18;
+
+  /* Parse out the bytes of the address into the command array */
+  pu8ReadCommand[1] = (u8)(SD_u32Address >> 24);
+  pu8ReadCommand[2] = (u8)(SD_u32Address >> 16);
+  pu8ReadCommand[3] = (u8)(SD_u32Address >> 8);
+  pu8ReadCommand[4] = (u8)SD_u32Address;
+
+  SD_bTokenWithBlock = FALSE;
+  SdCommand(pu8ReadCommand);
+  SD_pfWaitReturnState = SdCardSM_ResponseCMD17;
+
+} /* end SdReadCommand() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdClaimReadBuffer
+
+Description:
+Finds a free buffer in the read ring for the next read.  The search starts after the last buffer claimed so
+the buffers are used in turn.
+
+Requires:
+  -
+
+Promises:
+  - If a read buffer is free, marks it in use, sets *pu8Buffer_ to it and returns TRUE
+  - Else returns FALSE
+*/
+static bool SdClaimReadBuffer(u8* pu8Buffer_)
+{
+  u8 u8Buffer = SD_u8NextReadBuffer;
+
+  for(u8 i = 0; i < SD_READ_BUFFERS; i++)
+  {
+    if( !(SD_u32ReadBuffersInUse & ((u32)1 << u8Buffer)) )
+    {
+      SD_u32ReadBuffersInUse |= ((u32)1 << u8Buffer);
+      *pu8Buffer_ = u8Buffer;
+      SD_u8NextReadBuffer = (u8Buffer + 1) % SD_READ_BUFFERS;
+      return TRUE;
+    }
+
+    u8Buffer = (u8Buffer + 1) % SD_READ_BUFFERS;
+  }
+
+  return FALSE;
+
+} /* end SdClaimReadBuffer() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdUseReadBuffer
+
+Description:
+Points the SSP configuration at the read buffer of the current read so the data is received straight into it.
+The SSP takes the receive buffer when it is requested, so this must be called before SspRequest().
+
+Requires:
+  - SD_u8ReadBuffer was claimed for the read
+
+Promises:
+  - SD_pu8RxBuffer and SD_sSspConfig receive buffer set to read buffer SD_u8ReadBuffer
+*/
+static void SdUseReadBuffer(void)
+{
+  SD_pu8RxBuffer = SD_aau8ReadBuffers[SD_u8ReadBuffer];
+  SD_pu8RxBufferNextByte = SD_pu8RxBuffer;
+  SD_sSspConfig.pu8RxBufferAddress = SD_pu8RxBuffer;
+  SD_sSspConfig.u16RxBufferSize    = SD_READ_BUFFER_SIZE;
+
+} /* end SdUseReadBuffer() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdUseCommandBuffer
+
+Description:
+Points the SSP configuration at the small command buffer, for initialization and writes which only ever 
+receive a few bytes at a time.  Must be called before SspRequest().
+
+Requires:
+  -
+
+Promises:
+  - SD_pu8RxBuffer and SD_sSspConfig receive buffer set to SD_au8CommandRxBuffer
+*/
+static void SdUseCommandBuffer(void)
+{
+  SD_pu8RxBuffer = SD_au8CommandRxBuffer;
+  SD_pu8RxBufferNextByte = SD_pu8RxBuffer;
+  SD_sSspConfig.pu8RxBufferAddress = SD_pu8RxBuffer;
+  SD_sSspConfig.u16RxBufferSize    = SD_COMMAND_RX_BUFFER_SIZE;
+
+} /* end SdUseCommandBuffer() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdWriteCommand
+
+Description:
+Starts writing the blocks at the head of the write queue.  Blocks queued at consecutive addresses are written
+with one CMD25 so the card can take them one after the other; a lone block uses CMD24.
+
+Requires:
+  - SD_Ssp has been requested
+  - At least one block is queued
+
+Promises:
+  - SD_u8WriteRunLeft and SD_bWriteMultiple set for the blocks that will be written
+  - The command is queued with SdCommand() and the response goes to SdCardSM_ResponseCMD24
+*/
+static void SdWriteCommand(void)
+{
+  u8* pu8WriteCommand;
+  u32 u32Address = SD_asWriteQueue[SD_u8WriteQueueHead].u32Address;
+  u32 u32Step = (SD_u32Flags & _SD_CARD_HC) ? 1 : 512;
+
+  /* Count the blocks that follow on from the first */
+  SD_u8WriteRunLeft = 1;
+  while( (SD_u8WriteRunLeft < SD_u8WritesQueued) && 
+         (SD_asWriteQueue[(SD_u8WriteQueueHead + SD_u8WriteRunLeft) % SD_WRITE_QUEUE_SIZE].u32Address == 
+          u32Address + (SD_u8WriteRunLeft * u32Step)) )
+  {
+    SD_u8WriteRunLeft++;
+  }
+
+  SD_bWriteMultiple = (SD_u8WriteRunLeft > 1);
+  pu8WriteCommand = SD_bWriteMultiple ? SD_au8CMD25 : SD_au8CMD24;
+
+  /* Parse out the bytes of the address into the command array */
+  pu8WriteCommand[1] = (u8)(u32Address >> 24);
+  pu8WriteCommand[2] = (u8)(u32Address >> 16);
+  pu8WriteCommand[3] = (u8)(u32Address >> 8);
+  pu8WriteCommand[4] = (u8)u32Address;
+
+  SdCommand(pu8WriteCommand);
+  SD_pfWaitReturnState = SdCardSM_ResponseCMD24;
+
+} /* end SdWriteCommand() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdDropWrite
+
+Description:
+Takes the block at the head of the write queue off the queue and frees its buffer.
+
+Requires:
+  - At least one block is queued
+
+Promises:
+  - The next block is at the head of the queue with SD_WRITE_RETRIES retries
+*/
+static void SdDropWrite(void)
+{
+  SD_u32ReadBuffersInUse &= ~((u32)1 << SD_asWriteQueue[SD_u8WriteQueueHead].u8Buffer);
+  SD_u8WriteQueueHead = (SD_u8WriteQueueHead + 1) % SD_WRITE_QUEUE_SIZE;
+  SD_u8WritesQueued--;
+  SD_u8WriteRetries = SD_WRITE_RETRIES;
+
+} /* end SdDropWrite() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SdEndWriteRun
+
+Description:
+Lets go of the card after a write.  The card is left to program the last block on its own and is only polled
+until it is done when the next command needs it, so nothing waits on it in the meantime.
+
+Requires:
+  - The last block of the write has been sent, and for a CMD25 the stop token too
+
+Promises:
+  - SSP released, SD_bCardBusy set and the card back to SD_IDLE
+*/
+static void SdEndWriteRun(void)
+{
+  SspDeAssertCS(SD_Ssp);
+  SspRelease(SD_Ssp);
+
+  SD_bCardBusy = TRUE;
+  SD_u8WriteRunLeft = 0;
+  SD_CardState = SD_IDLE;
+  SD_pfStateMachine = SdCardSM_ReadyIdle;
+
+} /* end SdEndWriteRun() */
+
+
 /*--------------------------------------------------------------------------------------------------------------------
 Function: CheckTimeout
 
@@ -454,6 +897,15 @@ static void SdCardSM_IdleNoCard(void)
 
   if( SdIsCardInserted() )
   {
+    /* A new card starts with every read buffer free: clients dropped what they held when the card went.
+    Blocks still waiting to be written are lost. */
+    SD_u32ReadBuffersInUse = 0;
+    SD_u32WriteErrors += SD_u8WritesQueued;
+    SD_u8WritesQueued = 0;
+    SD_u8WriteRunLeft = 0;
+    SD_bCardBusy = FALSE;
+    SdUseCommandBuffer();
+
     /* Request the SSP resource to talk to the card */
     SD_Ssp = SspRequest(&SD_sSspConfig);
     if(SD_Ssp == NULL)
@@ -513,7 +965,7 @@ static void SdCardSM_ResponseCMD0(void)
   SspDeAssertCS(SD_Ssp);
 
   /* Process the received byte */
-  if(SD_au8RxBuffer[0] == SD_STATUS_IDLE)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_IDLE)
   {
     /* Card is in Idle state, so issue CMD8 */
     SdCommand(&SD_au8CMD8[0]);
@@ -538,7 +990,7 @@ static void SdCardSM_ResponseCMD0(void)
 static void SdCardSM_ResponseCMD8(void)
 {
   /* Check the response byte (response R1) */
-  if(SD_au8RxBuffer[0] == SD_STATUS_IDLE)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_IDLE)
   {
     /* Command is good which means the card is at least SDv2 so we can read 4 more bytes of the CMD8 response. */
     SD_u32Flags |= _SD_TYPE_SD2;
@@ -586,10 +1038,10 @@ static void SdCardSM_ReadCMD8(void)
     
     /* Process the four response bytes (only the last two matter) */
     //SD_pu8RxBufferParser = ;
-    if(SD_au8RxBuffer[SD_CMD8_INDEX_VHS] == SD_VHS_VALUE)
+    if(SD_pu8RxBuffer[SD_CMD8_INDEX_VHS] == SD_VHS_VALUE)
     {
       //AdvanceSD_pu8RxBufferParser(1);
-      if(SD_au8RxBuffer[SD_CMD8_INDEX_CHECK] == SD_CHECK_PATTERN)
+      if(SD_pu8RxBuffer[SD_CMD8_INDEX_CHECK] == SD_CHECK_PATTERN)
       {
         /* Card supports VCC 2.7 - 3.6V so we're good to go */
         /* Next we need to send CMD55 so we can send ACMD41 */
@@ -621,7 +1073,7 @@ static void SdCardSM_ResponseCMD55(void)
   SspDeAssertCS(SD_Ssp);
 
   /* Process the received byte from CMD55 */
-  if(SD_au8RxBuffer[0] == SD_STATUS_IDLE)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_IDLE)
   {
     /* Card is ready for ACMD41 to configure Host Capacity Support (HCS) bit */
     if(SD_u32Flags & _SD_TYPE_SD2)
@@ -653,7 +1105,7 @@ static void SdCardSM_ResponseACMD41(void)
   SspDeAssertCS(SD_Ssp);
 
   /* Process the received byte based on card type */
-  if(SD_au8RxBuffer[0] == SD_STATUS_READY)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_READY)
   {
     /* Card is ready for next command */
     if(SD_u32Flags & _SD_TYPE_SD2)
@@ -691,7 +1143,7 @@ static void SdCardSM_ResponseACMD41(void)
 static void SdCardSM_ResponseCMD58(void)
 {
   /* Check the response byte (response R1) */
-  if(SD_au8RxBuffer[0] == SD_STATUS_READY)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_READY)
   {
     /* Command is good so we can read 4 more bytes of the CMD58 response */
     /* CS is still asserted since we are reading data */
@@ -724,7 +1176,7 @@ static void SdCardSM_ResponseCMD58(void)
 static void SdCardSM_ResponseCMD16(void)
 {
   /* Check the response byte (response R1) */
-  if(SD_au8RxBuffer[0] == SD_STATUS_READY)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_READY)
   {
     /* Success! Card is ready for read/write operations.  We can release the SSP resource for now. */
     SspDeAssertCS(SD_Ssp);
@@ -760,7 +1212,7 @@ static void SdCardSM_ReadCMD58(void)
 
     /* Determine card capacity */
     SD_u32Flags &= ~_SD_CARD_HC;
-    if(SD_au8RxBuffer[0] & _SD_OCR_CCS_BIT)
+    if(SD_pu8RxBuffer[0] & _SD_OCR_CCS_BIT)
     {
       SD_u32Flags |= _SD_CARD_HC;
       
@@ -867,7 +1319,7 @@ static void SdCardSM_WaitCommand(void)
 
 /*-------------------------------------------------------------------------------------------------------------------*/
 /* Kill time waiting for a response read to finish; the first byte from all completed commands
-is response R1 which has BIT7 clear.  This response will be at SD_au8RxBuffer[0].
+is response R1 which has BIT7 clear.  This response will be at SD_pu8RxBuffer[0].
      
 REQUIRES: 
   - SD_pfWaitReturnState points to the function that should be accessed next.
@@ -884,7 +1336,7 @@ static void SdCardSM_WaitResponse(void)
   if(SspQueryReceiveStatus(SD_Ssp) == SSP_RX_COMPLETE)
   {
     /* If no response but retries left, queue another read */
-    if( (SD_au8RxBuffer[0] & BIT7) && (u8Retries != 0) )
+    if( (SD_pu8RxBuffer[0] & BIT7) && (u8Retries != 0) )
     {
       u8Retries--;
       
@@ -947,10 +1399,25 @@ static void SdCardSM_ReadyIdle(void)
   }
   else
   {
-    /* Look for a request to read or write file data */
+    /* Look for a request to read file data, then for queued writes: reads go first since a client is
+    waiting on them, and writes are only started while no client has data waiting to be collected */
+    if( (SD_CardState == SD_IDLE) && (SD_u8WritesQueued != 0) )
+    {
+      SD_CardState = SD_WRITING;
+    }
+    
     if( (SD_CardState == SD_WRITING) || (SD_CardState == SD_READING) )
     {
-      /* Request the SSP resource to talk to the card */
+      /* Request the SSP resource to talk to the card, receiving reads straight into the read buffer */
+      if(SD_CardState == SD_READING)
+      {
+        SdUseReadBuffer();
+      }
+      else
+      {
+        SdUseCommandBuffer();
+      }
+      
       SD_Ssp = SspRequest(&SD_sSspConfig);
       if(SD_Ssp == NULL)
       {
@@ -960,38 +1427,54 @@ static void SdCardSM_ReadyIdle(void)
         SD_pfWaitReturnState = SdCardSM_ReadyIdle;
         SD_pfStateMachine = SdCardSM_WaitSSP;
       }
-      else
+      else if(SD_bCardBusy)
       {
-        /* Got SSP, so start read or write */
-        if(SD_CardState == SD_WRITING)
+        /* Let the card finish programming the last block written before giving it a command */
+        SspAssertCS(SD_Ssp);
+        if(SspReadByte(SD_Ssp))
         {
-          /* Not yet implemented */
-          SD_pfStateMachine = SdCardSM_ReadyIdle;
-          SD_CardState = SD_IDLE;
+          SD_u32Timeout = G_u32SystemTime1ms;
+          SD_pfWaitReturnState = SdCardSM_StartTransfer;
+          SD_pfStateMachine = SdCardSM_WaitNotBusy;
         }
         else
         {
-          /* Parse out the bytes of the address into the command array */
-          SD_au8CMD17[1] = (u8)(SD_u32Address >> 24);
-          SD_au8CMD17[2] = (u8)(SD_u32Address >> 16);
-          SD_au8CMD17[3] = (u8)(SD_u32Address >> 8);
-          SD_au8CMD17[4] = (u8)SD_u32Address;
-          
-          SdCommand(&SD_au8CMD17[0]);
-          SD_pfWaitReturnState = SdCardSM_ResponseCMD17;
+          /* SSP read error - we'll just abort */
+          SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+          SD_pfStateMachine = SdCardSM_Error;
         }
       }
+      else
+      {
+        SdCardSM_StartTransfer();
+      }
     }
   }
 } /* end SdCardSM_ReadyIdle() */
      
 
 /*-------------------------------------------------------------------------------------------------------------------*/
-/* Start read sequence */
+/* SSP is ready and the card is not busy: send the read or write command */
+static void SdCardSM_StartTransfer(void)          
+{
+  if(SD_CardState == SD_WRITING)
+  {
+    SdWriteCommand();
+  }
+  else
+  {
+    SdReadCommand();
+  }
+
+} /* end SdCardSM_StartTransfer() */
+     
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Start read sequence (response to CMD17 or CMD18) */
 static void SdCardSM_ResponseCMD17(void)
 {
   /* Check the response byte (response R1) */
-  if(SD_au8RxBuffer[0] == SD_STATUS_READY)
+  if(SD_pu8RxBuffer[0] == SD_STATUS_READY)
   {
     /* Queue a read looking to get TOKEN_START_BLOCK back from the card */
     //SD_u32CurrentMsgToken = SspReadByte(SD_Ssp);
@@ -1029,16 +1512,17 @@ static void SdCardSM_WaitStartToken(void)
   if(SspQueryReceiveStatus(SD_Ssp) == SSP_RX_COMPLETE)
   {
     /* Check the response byte */
-    if(SD_au8RxBuffer[0] == TOKEN_START_BLOCK)
+    if(SD_pu8RxBuffer[0] == TOKEN_START_BLOCK)
     {
       /* Set the RxBuffer pointers to the start of the RxBuffer so the sector data occupies the beginning */
-      //SD_pu8RxBufferNextByte = &SD_au8RxBuffer[0];
-      //SD_pu8RxBufferParser   = &SD_au8RxBuffer[0];
+      //SD_pu8RxBufferNextByte = &SD_pu8RxBuffer[0];
+      //SD_pu8RxBufferParser   = &SD_pu8RxBuffer[0];
       
       /* Queue a read for the entire sector plus two checksum bytes */
       /* CS is still asserted since we are reading data */
-      if(SspReadData(SD_Ssp, 514))
+      if(SspReadData(SD_Ssp, SD_BLOCK_READ_SIZE))
       {
+        SD_bTokenWithBlock = FALSE;
         SD_pfStateMachine = SdCardSM_DataTransfer;
       }
       else
@@ -1081,16 +1565,63 @@ static void SdCardSM_DataTransfer(void)
   /* Check if the SSP peripheral is finished with the data request */
   if(SspQueryReceiveStatus(SD_Ssp) == SSP_RX_COMPLETE)
   {
-    SD_CardState = SD_DATA_READY;
+    /* Single block read: the data waits in RxBuffer for the client */
+    if(SD_pfBlockCallback == NULL)
+    {
+      SD_CardState = SD_DATA_READY;
 
-    SspDeAssertCS(SD_Ssp);
-    SspRelease(SD_Ssp);
+      SspDeAssertCS(SD_Ssp);
+      SspRelease(SD_Ssp);
 
-    /* Reset the RxBuffer pointers to the start of the RxBuffer */
-    //SD_pu8RxBufferNextByte = &SD_au8RxBuffer[0];
-    //SD_pu8RxBufferParser   = &SD_au8RxBuffer[0];
+      /* Reset the RxBuffer pointers to the start of the RxBuffer */
+      //SD_pu8RxBufferNextByte = &SD_pu8RxBuffer[0];
+      //SD_pu8RxBufferParser   = &SD_pu8RxBuffer[0];
 
-    SD_pfStateMachine = SdCardSM_ReadyIdle;
+      SD_pfStateMachine = SdCardSM_ReadyIdle;
+    }
+    /* Multiple block read: pass the block on and keep CS and the SSP for the next one */
+    else
+    {
+      if( SD_bTokenWithBlock && (SD_pu8RxBuffer[0] != TOKEN_START_BLOCK) )
+      {
+        SdCardMissedToken();
+      }
+      else
+      {
+        SD_pfBlockCallback(SD_u32BlockIndex, &SD_pu8RxBuffer[SD_bTokenWithBlock ? 1 : 0]);
+        SD_u32BlockIndex++;
+        SD_u32BlocksLeft--;
+        SD_u32Address += (SD_u32Flags & _SD_CARD_HC) ? 1 : 512;
+
+        if(SD_u32BlocksLeft != 0)
+        {
+          /* The card has usually had the next block ready for a while by now, so read its start token
+          with it to save a pass per block.  SdCardMissedToken() sorts it out if it was not ready, and
+          after that the token is polled for first like the first block. */
+          SD_bTokenWithBlock = SD_bCardKeepsUp;
+          if(SspReadData(SD_Ssp, SD_bCardKeepsUp ? SD_NEXT_BLOCK_READ_SIZE : 1))
+          {
+            SD_u32Timeout = G_u32SystemTime1ms;
+            if(!SD_bCardKeepsUp)
+            {
+              SD_pfStateMachine = SdCardSM_WaitStartToken;
+            }
+          }
+          else
+          {
+            /* SSP read error - we'll just abort */
+            SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+            SD_pfStateMachine = SdCardSM_Error;
+          }
+        }
+        else
+        {
+          /* That was the last block, so stop the card streaming any more */
+          SdCommand(&SD_au8CMD12[0]);
+          SD_pfWaitReturnState = SdCardSM_ResponseCMD12;
+        }
+      }
+    }
   }
 
   /* Monitor time */
@@ -1103,6 +1634,332 @@ static void SdCardSM_DataTransfer(void)
 } /* end SdCardSM_DataTransfer() */
 
 
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* A multiple block read asked for the next block with its start token before the card had it ready.
+If the card was still getting ready, nothing has been missed and the token can be polled for as usual.  If the
+token arrived part way through, the start of the block is gone: stop the card and read again from this block. */
+static void SdCardMissedToken(void)
+{
+  SD_bCardKeepsUp = FALSE;
+
+  for(u16 i = 0; i < SD_NEXT_BLOCK_READ_SIZE; i++)
+  {
+    if(SD_pu8RxBuffer[i] != SD_NOT_BUSY)
+    {
+      SD_bRestartRead = TRUE;
+      SdCommand(&SD_au8CMD12[0]);
+      SD_pfWaitReturnState = SdCardSM_ResponseCMD12;
+      return;
+    }
+  }
+
+  if(SspReadByte(SD_Ssp))
+  {
+    SD_u32Timeout = G_u32SystemTime1ms;
+    SD_pfStateMachine = SdCardSM_WaitStartToken;
+  }
+  else
+  {
+    /* SSP read error - we'll just abort */
+    SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+    SD_pfStateMachine = SdCardSM_Error;
+  }
+
+} /* end SdCardMissedToken() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* End of a multiple block read.  CMD12 has an R1b response: the card may send one more byte of data before
+the response and then hold its output low while it stops, so the response is not checked and the state
+machine just waits for the card to come out of busy. */
+static void SdCardSM_ResponseCMD12(void)
+{
+  if(SspReadByte(SD_Ssp))
+  {
+    SD_u32Timeout = G_u32SystemTime1ms;
+    SD_pfWaitReturnState = SdCardSM_ReadStopped;
+    SD_pfStateMachine = SdCardSM_WaitNotBusy;
+  }
+  else
+  {
+    /* SSP read error - we'll just abort */
+    SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+    SD_pfStateMachine = SdCardSM_Error;
+  }
+
+} /* end SdCardSM_ResponseCMD12() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Poll the card until it is no longer busy, then carry on in SD_pfWaitReturnState */
+static void SdCardSM_WaitNotBusy(void)
+{
+  if(SspQueryReceiveStatus(SD_Ssp) == SSP_RX_COMPLETE)
+  {
+    if(SD_pu8RxBuffer[0] == SD_NOT_BUSY)
+    {
+      /* The timeout starts over for the state that follows */
+      SD_bCardBusy = FALSE;
+      SD_u32Timeout = G_u32SystemTime1ms;
+      SD_pfStateMachine = SD_pfWaitReturnState;
+    }
+    else if( !SspReadByte(SD_Ssp) )
+    {
+      /* SSP read error - we'll just abort */
+      SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+      SD_pfStateMachine = SdCardSM_Error;
+    }
+  }
+
+  /* Monitor time */
+  if(IsTimeUp(&SD_u32Timeout, SD_BUSY_TIMEOUT_MS))
+  {
+    SD_u8ErrorCode = SD_ERROR_TIMEOUT;
+    SD_pfStateMachine = SdCardSM_FailedDataTransfer;
+  }
+
+} /* end SdCardSM_WaitNotBusy() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* A multiple block read has been stopped: read again from the block that was missed, or release the card */
+static void SdCardSM_ReadStopped(void)
+{
+  if(SD_bRestartRead)
+  {
+    /* Pick the multiple block read up again at the block that was missed */
+    SD_bRestartRead = FALSE;
+    SspDeAssertCS(SD_Ssp);
+    SdReadCommand();
+  }
+  else
+  {
+    SspDeAssertCS(SD_Ssp);
+    SspRelease(SD_Ssp);
+
+    SD_u32ReadBuffersInUse &= ~((u32)1 << SD_u8ReadBuffer);
+    SD_pfBlockCallback = NULL;
+    SD_CardState = SD_IDLE;
+    SD_pfStateMachine = SdCardSM_ReadyIdle;
+  }
+
+} /* end SdCardSM_ReadStopped() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Start write sequence (response to CMD24 or CMD25) */
+static void SdCardSM_ResponseCMD24(void)
+{
+  /* Check the response byte (response R1) */
+  if(SD_pu8RxBuffer[0] == SD_STATUS_READY)
+  {
+    SD_u16WriteBytesQueued = 0;
+    SD_u32Timeout = G_u32SystemTime1ms;
+    SD_pfStateMachine = SdCardSM_WriteData;
+  }
+  else
+  {
+    /* Incorrect response from the SD card, so abort */
+    SD_u8ErrorCode = SD_ERROR_BAD_RESPONSE;
+    SD_pfStateMachine = SdCardSM_FailedDataTransfer;
+  }
+
+} /* end SdCardSM_ResponseCMD24() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Send the block at the head of the write queue.  The packet is handed to the SSP a message at a time so it 
+never needs more than the free message slots, and whatever did not fit is queued on the next pass. */
+static void SdCardSM_WriteData(void)
+{
+  u8* pu8Packet = SD_aau8ReadBuffers[SD_asWriteQueue[SD_u8WriteQueueHead].u8Buffer];
+  u16 u16Size;
+  u32 u32Token;
+
+  if(SD_u16WriteBytesQueued == 0)
+  {
+    pu8Packet[SD_WRITE_TOKEN_INDEX] = SD_bWriteMultiple ? TOKEN_START_BLOCK_MULT : TOKEN_START_BLOCK;
+  }
+
+  while(SD_u16WriteBytesQueued < SD_WRITE_PACKET_SIZE)
+  {
+    u16Size = SD_WRITE_PACKET_SIZE - SD_u16WriteBytesQueued;
+    if(u16Size > MAX_TX_MESSAGE_LENGTH)
+    {
+      u16Size = MAX_TX_MESSAGE_LENGTH;
+    }
+
+    u32Token = SspWriteData(SD_Ssp, u16Size, &pu8Packet[SD_u16WriteBytesQueued]);
+    if(u32Token == 0)
+    {
+      break;
+    }
+
+    SD_u32CurrentMsgToken = u32Token;
+    SD_u16WriteBytesQueued += u16Size;
+  }
+
+  /* Once the whole packet is out, the card answers with its data response */
+  if( (SD_u16WriteBytesQueued == SD_WRITE_PACKET_SIZE) && (QueryMessageStatus(SD_u32CurrentMsgToken) == COMPLETE) )
+  {
+    if(SspReadByte(SD_Ssp))
+    {
+      SD_u32Timeout = G_u32SystemTime1ms;
+      SD_pfStateMachine = SdCardSM_WaitDataResponse;
+    }
+    else
+    {
+      /* SSP read error - we'll just abort */
+      SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+      SD_pfStateMachine = SdCardSM_Error;
+    }
+  }
+
+  /* Monitor time */
+  if(IsTimeUp(&SD_u32Timeout, SD_SECTOR_READ_TIMEOUT_MS))
+  {
+    SD_u8ErrorCode = SD_ERROR_TIMEOUT;
+    SD_pfStateMachine = SdCardSM_FailedDataTransfer;
+  }
+
+} /* end SdCardSM_WriteData() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Wait for the card's data response to the block just written */
+static void SdCardSM_WaitDataResponse(void)
+{
+  if(SspQueryReceiveStatus(SD_Ssp) == SSP_RX_COMPLETE)
+  {
+    /* The response may take a byte to come */
+    if(SD_pu8RxBuffer[0] == SD_NOT_BUSY)
+    {
+      if( !SspReadByte(SD_Ssp) )
+      {
+        /* SSP read error - we'll just abort */
+        SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+        SD_pfStateMachine = SdCardSM_Error;
+      }
+    }
+    else
+    {
+      SdWriteDataResponse();
+      return;
+    }
+  }
+
+  /* Monitor time */
+  if(IsTimeUp(&SD_u32Timeout, SD_RESPONSE_TIMEOUT))
+  {
+    SD_u8ErrorCode = SD_ERROR_TIMEOUT;
+    SD_pfStateMachine = SdCardSM_FailedDataTransfer;
+  }
+
+} /* end SdCardSM_WaitDataResponse() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Act on the data response to the block just written.  An accepted block leaves the queue and the next block of a
+CMD25 follows once the card is no longer busy.  A rejected block ends the write and is sent again with a new
+command, up to SD_WRITE_RETRIES times. */
+static void SdWriteDataResponse(void)
+{
+  bool bRunDone;
+  u32 u32NextAddress;
+
+  if( (SD_pu8RxBuffer[0] & SD_DATA_RESPONSE_MASK) == SD_DATA_ACCEPTED )
+  {
+    u32NextAddress = SD_asWriteQueue[SD_u8WriteQueueHead].u32Address + ((SD_u32Flags & _SD_CARD_HC) ? 1 : 512);
+    SdDropWrite();
+    SD_u8WriteRunLeft--;
+
+    /* A block queued since the CMD25 went out can still join it if it follows on */
+    if( SD_bWriteMultiple && (SD_u8WriteRunLeft == 0) && (SD_u8WritesQueued != 0) &&
+        (SD_asWriteQueue[SD_u8WriteQueueHead].u32Address == u32NextAddress) )
+    {
+      SD_u8WriteRunLeft = 1;
+    }
+    bRunDone = (SD_u8WriteRunLeft == 0);
+  }
+  else
+  {
+    if(SD_u8WriteRetries == 0)
+    {
+      SD_u32WriteErrors++;
+      SdDropWrite();
+    }
+    else
+    {
+      SD_u8WriteRetries--;
+    }
+    bRunDone = TRUE;
+  }
+
+  if(!bRunDone)
+  {
+    /* The next block can go once the card has programmed this one */
+    if(SspReadByte(SD_Ssp))
+    {
+      SD_u32Timeout = G_u32SystemTime1ms;
+      SD_u16WriteBytesQueued = 0;
+      SD_pfWaitReturnState = SdCardSM_WriteData;
+      SD_pfStateMachine = SdCardSM_WaitNotBusy;
+    }
+    else
+    {
+      /* SSP read error - we'll just abort */
+      SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+      SD_pfStateMachine = SdCardSM_Error;
+    }
+  }
+  else if(SD_bWriteMultiple)
+  {
+    /* The stop token goes once the card is ready for it, and the card is busy again after it */
+    if(SspReadByte(SD_Ssp))
+    {
+      SD_u32Timeout = G_u32SystemTime1ms;
+      SD_u32CurrentMsgToken = 0;
+      SD_pfWaitReturnState = SdCardSM_WriteStop;
+      SD_pfStateMachine = SdCardSM_WaitNotBusy;
+    }
+    else
+    {
+      /* SSP read error - we'll just abort */
+      SD_u8ErrorCode = SD_ERROR_NO_TOKEN;
+      SD_pfStateMachine = SdCardSM_Error;
+    }
+  }
+  else
+  {
+    SdEndWriteRun();
+  }
+
+} /* end SdWriteDataResponse() */
+
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* End a CMD25 with the stop token.  The card programs the last block after this while other tasks run. */
+static void SdCardSM_WriteStop(void)
+{
+  if(SD_u32CurrentMsgToken == 0)
+  {
+    SD_u32CurrentMsgToken = SspWriteData(SD_Ssp, sizeof(SD_au8StopTran), SD_au8StopTran);
+  }
+  else if(QueryMessageStatus(SD_u32CurrentMsgToken) == COMPLETE)
+  {
+    SdEndWriteRun();
+  }
+
+  /* Monitor time */
+  if(IsTimeUp(&SD_u32Timeout, SD_WAIT_TIME))
+  {
+    SD_u8ErrorCode = SD_ERROR_TIMEOUT;
+    SD_pfStateMachine = SdCardSM_FailedDataTransfer;
+  }
+
+} /* end SdCardSM_WriteStop() */
+
+
 /*-------------------------------------------------------------------------------------------------------------------*/
 /* Handle a failed data transfer */
 static void SdCardSM_FailedDataTransfer(void)
@@ -1113,7 +1970,9 @@ static void SdCardSM_FailedDataTransfer(void)
   //FlushSdRxBuffer();
   SD_CardState = SD_CARD_ERROR;
   
+  /* Start the card over, which also takes back the read buffers */
   SD_u32Timeout = G_u32SystemTime1ms;
+  SD_pfWaitReturnState = SdCardSM_IdleNoCard;
   SD_pfStateMachine = SdCardSM_WaitSSP;
   
 } /* end SdCardSM_FailedDataTransfer() */
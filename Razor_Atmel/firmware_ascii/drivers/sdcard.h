@@ -15,6 +15,17 @@ Type Definitions
 **********************************************************************************************************************/
 typedef enum {SD_NO_CARD, SD_CARD_ERROR, SD_IDLE, SD_READING, SD_DATA_READY, SD_WRITING} SdCardStateType;
 
+/* Called by SdReadBlocks() for each block as it arrives: u32Block_ counts from 0 in the range being read
+and pu8Data_ points to the block's 512 bytes, which are only valid until the callback returns */
+typedef void(*fnSdBlockCallback_type)(u32 u32Block_, u8* pu8Data_);
+
+/* One block in the write queue */
+typedef struct
+{
+  u32 u32Address;                           /* Card address of the block, already adjusted for byte-addressed cards */
+  u8 u8Buffer;                              /* Read buffer holding the block's write packet */
+} SdWriteType;
+
 
 /**********************************************************************************************************************
 Constants / Definitions
@@ -35,7 +46,22 @@ Constants / Definitions
 #define SD_CLEAR_CARD_TYPE_BITS  ~(_SD_CARD_HC | _SD_TYPE_MMC | _SD_TYPE_SD1 | _SD_TYPE_SD2 |_SD_TYPE_BLOCK)
 #define _SD_TYPE_SDC		          (_SD_TYPE_SD1 | _SD_TYPE_SD2)	
 
-#define SDCARD_RX_BUFFER_SIZE     (u32)548             /* Size of buffer for incoming SD data */
+#define SD_COMMAND_RX_BUFFER_SIZE (u16)20              /* Size of buffer for command responses during initialization (SD_WAKEUP_BYTES) */
+/* The read ring is sized for a 4-voice song streamed from the card, which keeps two borrowed sectors per voice and
+so can hold all SD_READ_BUFFERS at once.  SdWriteBlock() copies each block into a free read buffer, so while such a
+song plays it can return FALSE, as can SdReadBlock() and SdReadBlocks(), until the song releases a sector it has played. */
+#define SD_READ_BUFFERS           (u8)8                /* Sector buffers in the read ring that can be filled or lent to clients */
+#define SD_READ_BUFFER_SIZE       (u16)516             /* Start token, sector and checksum of one block, rounded up to a word */
+#define SD_BLOCK_READ_SIZE        (u16)514             /* Sector plus two checksum bytes */
+#define SD_NEXT_BLOCK_READ_SIZE   (u16)515             /* Start token, sector and checksum of the next block of a multiple block read */
+
+#define SD_WRITE_QUEUE_SIZE       (u8)4                /* Blocks that can wait to be written */
+#define SD_WRITE_PACKET_SIZE      (u16)516             /* Gap byte, start token, sector and checksum of a block being written: fits a read buffer */
+#define SD_WRITE_TOKEN_INDEX      (u16)1               /* Index of the start token in a write packet */
+#define SD_WRITE_DATA_INDEX       (u16)2               /* Index of the sector in a write packet */
+#define SD_WRITE_RETRIES          (u8)2                /* Times a block the card rejects is sent again before it is dropped */
+#define SD_DATA_RESPONSE_MASK     (u8)0x1F             /* Bits of the data response token that hold the status */
+#define SD_DATA_ACCEPTED          (u8)0x05             /* Data response status when the card has taken the block */
 
 #define SD_RESPONSE_TIMEOUT       (u32)100             /* Time in ms for the SD card to respond to a command */
 #define SD_WAIT_TIME              (u32)1000            /* Time in ms for waiting for SD stuff to occur */
@@ -48,6 +74,7 @@ Constants / Definitions
 #define SD_READ_TOKEN_MS		      (u32)(200)
 #define SD_INIT_TIMEOUT_MS		    (u32)(1000)
 #define SD_SECTOR_READ_TIMEOUT_MS	(u32)(1000)
+#define SD_BUSY_TIMEOUT_MS        (u32)(500)           /* Time for the card to finish being busy after CMD12 or a write */
 #define SD_ERASE_TIMEOUT_MS	      (u32)(30000)
 
 
@@ -85,6 +112,8 @@ Constants / Definitions
 
 #define _SD_OCR_CCS_BIT           (u8)0x40      /* Bit in OCR register that indicates card capacity (high == high capacity) */
 
+#define SD_NOT_BUSY               (u8)0xFF      /* Card holds its output low while it is busy */
+
 #define SD_R1_LEN	                (u8)(1)
 #define SD_R2_LEN	                (u8)(2)
 #define SD_R3_LEN	                (u8)(SD_R1_LEN + 4)	// 4-byte OCR
@@ -135,8 +164,13 @@ Constants / Definitions
 /*--------------------------------------------------------------------------------------------------------------------*/
 SdCardStateType SdGetStatus(void);
 bool SdReadBlock(u32 u32BlockAddress_);
-bool SdWriteBlock(u32 u32BlockAddress_);             
+bool SdReadBlocks(u32 u32BlockAddress_, u32 u32NumBlocks_, fnSdBlockCallback_type pfBlockCallback_);
+bool SdWriteBlock(u32 u32BlockAddress_, u8* pu8Data_);
+u8 SdGetWritesPending(void);
+u32 SdGetWriteErrors(void);
 bool SdGetReadData(u8* pu8Destination_);
+u8* SdBorrowReadData(void);
+void SdReleaseReadData(u8* pu8Data_);
 void CheckTimeout(u32 u32Time_);
 
 
@@ -153,6 +187,14 @@ bool SdIsCardInserted(void);
 /* Private functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
 static void SdCommand(u8* pau8Command_);
+static void SdReadCommand(void);
+static bool SdClaimReadBuffer(u8* pu8Buffer_);
+static void SdUseReadBuffer(void);
+static void SdUseCommandBuffer(void);
+static void SdWriteCommand(void);
+static void SdDropWrite(void);
+static void SdEndWriteRun(void);
+static void SdWriteDataResponse(void);
 //static void AdvanceSD_pu8RxBufferParser(u32 u32NumBytes_);
 //static void FlushSdRxBuffer(void);
 
@@ -179,6 +221,15 @@ static void SdCardSM_ReadyIdle(void);
 static void SdCardSM_ResponseCMD17(void);
 static void SdCardSM_WaitStartToken(void);          
 static void SdCardSM_DataTransfer(void);
+static void SdCardMissedToken(void);
+static void SdCardSM_ResponseCMD12(void);
+static void SdCardSM_WaitNotBusy(void);
+static void SdCardSM_ReadStopped(void);
+static void SdCardSM_StartTransfer(void);
+static void SdCardSM_ResponseCMD24(void);
+static void SdCardSM_WriteData(void);
+static void SdCardSM_WaitDataResponse(void);
+static void SdCardSM_WriteStop(void);
 static void SdCardSM_FailedDataTransfer(void);
 
 //static void SdCardSM_WaitReady(void);
@@ -12,6 +12,9 @@ Public functions:
 
   - void AntChannelRunActiveState(void)
       Runs current task state. Should only be called once in main loop.
+
+  - AntChannelConnectionType AntChannelGetConnection(void)
+      Returns whether the channel is closed, open and searching for a master, or receiving data from one
 **********************************************************************************************************************/
 
 #include "configuration.h"
@@ -58,7 +61,11 @@ typedef enum
   ANT_MESSAGE_INDEX_MAGIC_NUMBER = 0,
   ANT_MESSAGE_INDEX_PLAY_PAUSE,
   ANT_MESSAGE_INDEX_PREV_SONG,
-  ANT_MESSAGE_INDEX_NEXT_SONG
+  ANT_MESSAGE_INDEX_NEXT_SONG,
+  ANT_MESSAGE_INDEX_TEMPO,            /* Tempo in ANT_TEMPO_STEP_PERCENT steps, 0 if the master does not set the tempo */
+  ANT_MESSAGE_INDEX_SKIP_BACK,
+  ANT_MESSAGE_INDEX_SKIP_FORWARD,
+  ANT_MESSAGE_INDEX_LED_DISPLAY       /* Switches the LEDs between the pitch and spectrum displays */
 } AntMessageIndexType;
 
 /***********************************************************************************************************************
@@ -69,11 +76,18 @@ static fnCode_type AntChannel_StateMachine;     /* The state machine function po
 static AntAssignChannelInfoType channel_info;   /* Structure holding ANT channel configuration information */
 static u32 ant_channel_initial_delay_timer = 0;
 static u32 ant_channel_open_timer = 0;
+static bool ant_master_found = FALSE;           /* Set once data has been received on the open channel */
 
 /* Sequence numbers for keeping master and slave device messages in sync */
 static u8 ant_msg_play_pause_sequence_number;
 static u8 ant_msg_prev_song_sequence_number;
 static u8 ant_msg_next_song_sequence_number;
+static u8 ant_msg_skip_back_sequence_number;
+static u8 ant_msg_skip_forward_sequence_number;
+static u8 ant_msg_led_display_sequence_number;
+
+/* Last tempo received, the music player's tempo is only set when it changes */
+static u8 ant_msg_tempo;
 
 /* Acknowledge message payload */
 /* It will be a sequence of alternating magic numbers */
@@ -161,17 +175,39 @@ void AntChannelRunActiveState(void)
   AntChannel_StateMachine();
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: AntChannelGetConnection
+
+Description:
+  Returns what the RED LED shows: ANT_CHANNEL_SEARCHING while the channel is open but no master has sent data
+  (slow blink), ANT_CHANNEL_CONNECTED once one has (solid) and ANT_CHANNEL_CLOSED otherwise (off, or the error blink).
+*/
+AntChannelConnectionType AntChannelGetConnection(void)
+{
+  if( AntChannel_StateMachine != AntChannelSM_ChannelOpen )
+  {
+    return ANT_CHANNEL_CLOSED;
+  }
+
+  return ant_master_found ? ANT_CHANNEL_CONNECTED : ANT_CHANNEL_SEARCHING;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Private functions                                                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Resets ANT message sequence numbers back to 0. */
+/* The last tempo is forgotten too, so a master that reconnects sets its tempo again. */
 static void ResetSequenceNumbers(void)
 {
   ant_msg_play_pause_sequence_number = 0;
   ant_msg_prev_song_sequence_number = 0;
   ant_msg_next_song_sequence_number = 0;
+  ant_msg_skip_back_sequence_number = 0;
+  ant_msg_skip_forward_sequence_number = 0;
+  ant_msg_led_display_sequence_number = 0;
+  ant_msg_tempo = 0;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -205,6 +241,35 @@ static void ProcessAntMessage(void)
     MusicPlayerNextSong();
   }
 
+  // Check if there is a new message to skip back in the song
+  if( ant_msg_skip_back_sequence_number != G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_SKIP_BACK] )
+  {
+    ant_msg_skip_back_sequence_number = G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_SKIP_BACK];
+    MusicPlayerSkipBack();
+  }
+
+  // Check if there is a new message to skip forward in the song
+  if( ant_msg_skip_forward_sequence_number != G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_SKIP_FORWARD] )
+  {
+    ant_msg_skip_forward_sequence_number = G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_SKIP_FORWARD];
+    MusicPlayerSkipForward();
+  }
+
+  // Check if there is a new message to switch the LED display
+  if( ant_msg_led_display_sequence_number != G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_LED_DISPLAY] )
+  {
+    ant_msg_led_display_sequence_number = G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_LED_DISPLAY];
+    MusicPlayerSetLedDisplay( ( MusicPlayerGetLedDisplay() == MUSIC_LED_SPECTRUM ) ? MUSIC_LED_PITCH : MUSIC_LED_SPECTRUM );
+  }
+
+  // Check if there is a new tempo
+  if( ( G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_TEMPO] != 0 ) &&
+      ( ant_msg_tempo != G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_TEMPO] ) )
+  {
+    ant_msg_tempo = G_au8AntApiCurrentMessageBytes[ANT_MESSAGE_INDEX_TEMPO];
+    MusicPlayerSetTempo( ant_msg_tempo * ANT_TEMPO_STEP_PERCENT );
+  }
+
   char byte_string[50];
 
   AntMessageBytesToString( byte_string, 50 );
@@ -271,6 +336,7 @@ static void AntChannelSM_WaitChannelOpen(void)
 
     // Slow blinking LED indicates channel open, but no master broadcast received
     LedBlink( RED, LED_1HZ );
+    ant_master_found = FALSE;
     AntChannel_StateMachine = AntChannelSM_ChannelOpen;
   }
 
@@ -309,6 +375,7 @@ static void AntChannelSM_ChannelOpen(void)
 
       // Show solid LED to indicate channel is formed and we received data
       LedOn( RED );
+      ant_master_found = TRUE;
     }
   }
 }
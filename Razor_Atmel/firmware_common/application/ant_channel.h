@@ -11,11 +11,22 @@ Date: February 12, 2018
 /**********************************************************************************************************************
 Type Definitions
 **********************************************************************************************************************/
+/* State of the ANT channel, as the RED LED shows it */
+typedef enum
+{
+  ANT_CHANNEL_CLOSED = 0,         /* Not open yet, being reopened, or failed to configure */
+  ANT_CHANNEL_SEARCHING,          /* Open, but no data from a master yet */
+  ANT_CHANNEL_CONNECTED           /* Open and receiving data from a master */
+} AntChannelConnectionType;
 
 
 /**********************************************************************************************************************
 Constants / Definitions
 **********************************************************************************************************************/
+/* The tempo byte of a master's message counts in steps of this many percent, so 25 plays the song as written
+and 0 leaves the tempo alone. A byte reaches 1020%, past the player's own range: MusicPlayerSetTempo() is the
+one place the tempo is clamped, to 25 - 400%. */
+#define ANT_TEMPO_STEP_PERCENT          (u16)4
 
 
 /**********************************************************************************************************************
@@ -23,5 +34,6 @@ Function Declarations
 **********************************************************************************************************************/
 void AntChannelInitialize(void);
 void AntChannelRunActiveState(void);
+AntChannelConnectionType AntChannelGetConnection(void);
 
 #endif /* __ANT_CHANNEL_H */
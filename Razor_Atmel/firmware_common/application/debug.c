@@ -126,9 +126,9 @@ with the function name to call for the corresponding command: */
 DebugCommandType Debug_au8Commands[DEBUG_COMMANDS] = { {DEBUG_CMD_NAME00, DebugCommandPrepareList},
                                                        {DEBUG_CMD_NAME01, DebugCommandLedTestToggle},
                                                        {DEBUG_CMD_NAME02, DebugCommandSysTimeToggle},
-                                                       {DEBUG_CMD_NAME03, DebugCommandDummy},
-                                                       {DEBUG_CMD_NAME04, DebugCommandDummy},
-                                                       {DEBUG_CMD_NAME05, DebugCommandDummy},
+                                                       {DEBUG_CMD_NAME03, DebugCommandTempoFaster},
+                                                       {DEBUG_CMD_NAME04, DebugCommandTempoSlower},
+                                                       {DEBUG_CMD_NAME05, DebugCommandTempoNormal},
                                                        {DEBUG_CMD_NAME06, DebugCommandDummy},
                                                        {DEBUG_CMD_NAME07, DebugCommandDummy} 
                                                      };
@@ -803,6 +803,75 @@ static void DebugCommandSysTimeToggle(void)
   
 } /* end DebugCommandSysTimeToggle() */
 
+#ifdef EIE1 /* EIE1 only commands */
+/*----------------------------------------------------------------------------------------------------------------------
+Function: DebugCommandTempoFaster
+
+Description:
+Speeds the music player up by DEBUG_TEMPO_STEP percent and prints the new tempo.
+*/
+static void DebugCommandTempoFaster(void)
+{
+  MusicPlayerSetTempo(MusicPlayerGetTempo() + DEBUG_TEMPO_STEP);
+  DebugPrintTempo();
+  
+} /* end DebugCommandTempoFaster() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: DebugCommandTempoSlower
+
+Description:
+Slows the music player down by DEBUG_TEMPO_STEP percent and prints the new tempo.
+The music player clamps the tempo, so it never goes below its minimum.
+*/
+static void DebugCommandTempoSlower(void)
+{
+  u16 u16Tempo = MusicPlayerGetTempo();
+  
+  if(u16Tempo > DEBUG_TEMPO_STEP)
+  {
+    u16Tempo -= DEBUG_TEMPO_STEP;
+  }
+  
+  MusicPlayerSetTempo(u16Tempo);
+  DebugPrintTempo();
+  
+} /* end DebugCommandTempoSlower() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: DebugCommandTempoNormal
+
+Description:
+Puts the music player back to the songs' own tempo and prints it.
+*/
+static void DebugCommandTempoNormal(void)
+{
+  MusicPlayerSetTempo(DEBUG_TEMPO_NORMAL);
+  DebugPrintTempo();
+  
+} /* end DebugCommandTempoNormal() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: DebugPrintTempo
+
+Description:
+Prints the music player's tempo in percent.
+*/
+static void DebugPrintTempo(void)
+{
+  u8 au8TempoMessage[] = "\n\rMusic tempo ";
+  u8 au8PercentMessage[] = "%\n\r";
+  
+  DebugPrintf(au8TempoMessage);
+  DebugPrintNumber(MusicPlayerGetTempo());
+  DebugPrintf(au8PercentMessage);
+  
+} /* end DebugPrintTempo() */
+#endif /* EIE1 only commands */
+
 #ifdef MPGL2 /* MPGL2 only tests */
 /*----------------------------------------------------------------------------------------------------------------------
 Function: DebugCommandCaptouchValuesToggle
@@ -32,6 +32,11 @@ File: debug.h
 
 #define MAX_TASK_NAME_SIZE             (u8)10               /* Maximum string size for task name reported in SystemStatusReport */
 
+#ifdef EIE1
+#define DEBUG_TEMPO_STEP               (u16)5               /* Music tempo change in percent for each faster / slower command */
+#define DEBUG_TEMPO_NORMAL             (u16)100             /* Music tempo in percent that plays songs as written */
+#endif /* EIE1 */
+
 /**********************************************************************************************************************
 Type Definitions
 **********************************************************************************************************************/
@@ -58,9 +63,9 @@ typedef struct
 #define DEBUG_CMD_NAME00        "Show debug command list         "  /* Command 0: List all commands */
 #define DEBUG_CMD_NAME01        "Toggle LED test                 "  /* Command 1: Test that allows characters to toggle LEDs */
 #define DEBUG_CMD_NAME02        "Toggle system timing warning    "  /* Command 2: Prints message if system tick has advanced more than 1 between main loop sleeps (i.e. tasks are taking too long) */
-#define DEBUG_CMD_NAME03        "Dummy3                          "  /* Command 3: */
-#define DEBUG_CMD_NAME04        "Dummy4                          "  /* Command 4: */
-#define DEBUG_CMD_NAME05        "Dummy5                          "  /* Command 5: */
+#define DEBUG_CMD_NAME03        "Music tempo faster              "  /* Command 3: Speeds the music player up by DEBUG_TEMPO_STEP percent */
+#define DEBUG_CMD_NAME04        "Music tempo slower              "  /* Command 4: Slows the music player down by DEBUG_TEMPO_STEP percent */
+#define DEBUG_CMD_NAME05        "Music tempo normal              "  /* Command 5: Plays songs at their own tempo again */
 #define DEBUG_CMD_NAME06        "Dummy6                          "  /* Command 6: */
 #define DEBUG_CMD_NAME07        "Dummy7                          "  /* Command 7: */
 #endif /* EIE1 */
@@ -125,6 +130,10 @@ static void DebugLedTestCharacter(u8 u8Char_);
 static void DebugCommandSysTimeToggle(void);
 
 #ifdef EIE1 /* EIE1-specific debug functions */
+static void DebugCommandTempoFaster(void);
+static void DebugCommandTempoSlower(void);
+static void DebugCommandTempoNormal(void);
+static void DebugPrintTempo(void);
 #endif /* EIE1 */
 
 #ifdef MPGL2 /* MPGL2-specific debug functions  */
@@ -15,32 +15,75 @@ Public functions:
 **********************************************************************************************************************/
 
 #include "configuration.h"
-#include <stdio.h>
 
 /***********************************************************************************************************************
 Constants / Definitions
 ***********************************************************************************************************************/
-#define TITLE_BUFFER_SIZE               100
+#define TITLE_BUFFER_SIZE               100   // Longest title shown, with the gap after it
+#define TITLE_SCROLL_GAP                5     // Spaces between the end of a scrolling title and its start coming round
 #define LCD_SCROLL_UPDATE_TIME_MS       200
 #define LCD_NEW_TITLE_FREEZE_DELAY_MS   1000
+#define LCD_LINES                       2
+#define LCD_RUN_MERGE_GAP               4     // Unchanged characters cheaper to send again than a new message: slave address,
+                                              // cursor command and the two control bytes
+
+// Line 2 shows the status between the button labels: "P mm:ss<<bbbb>>mm:ssA", with P the play/pause icon,
+// the elapsed time, the progress bar, the song's length and the ANT icon
+#define LCD_STATUS_LINE                 1
+#define LCD_STATUS_PLAY_COLUMN          0
+#define LCD_STATUS_ELAPSED_COLUMN       1
+#define LCD_STATUS_BAR_COLUMN           8
+#define LCD_STATUS_LENGTH_COLUMN        14
+#define LCD_STATUS_ANT_COLUMN           19
+#define LCD_STATUS_TIME_SIZE            5     // "mm:ss", with a space for minutes under 10
+#define LCD_PROGRESS_CELLS              4     // Characters in the progress bar
+#define LCD_PROGRESS_CELL_STEPS         5     // Pixel columns in a character, each one step of the bar
+#define LCD_PROGRESS_STEPS              ( LCD_PROGRESS_CELLS * LCD_PROGRESS_CELL_STEPS )
+
+// Glyphs in CGRAM are tracked so that each is only uploaded when it is needed and not already there
+#define GLYPH_NONE                      (u8)0xFF
+#define GLYPH_BIT( GLYPH )              ( (u16)1 << ( GLYPH ) )
 
 /***********************************************************************************************************************
 Existing variables (defined in other files -- should all contain the "extern" keyword)
 ***********************************************************************************************************************/
+extern volatile u32 G_u32LcdFlags;             /* From lcd_nhd-c0220biz.c */
 extern volatile u32 G_u32SystemTime1ms;         /* From board-specific source file */
 extern volatile u32 G_u32SystemTime1s;          /* From board-specific source file */
 
 /***********************************************************************************************************************
 Type Definitions
 ***********************************************************************************************************************/
+/* Custom characters the status line is drawn with. At most five are shown at once: the play/pause icon, the ANT */
+/* icon and three kinds of progress bar cell (full, the partial one and empty), so they fit in CGRAM together. */
+typedef enum
+{
+  GLYPH_PLAY = 0,
+  GLYPH_PAUSE,
+  GLYPH_ANT_SEARCHING,
+  GLYPH_ANT_CONNECTED,
+  GLYPH_BAR_0,                          /* Progress bar cell with none of its columns filled, */
+  GLYPH_BAR_1,                          /* ... */
+  GLYPH_BAR_2,
+  GLYPH_BAR_3,
+  GLYPH_BAR_4,
+  GLYPH_BAR_5,                          /* ... up to all five */
+  GLYPH_COUNT
+} LcdGlyphType;
+
 /* Holds information about what is displayed on the LCD screen */
 typedef struct
 {
-  char title_buffer[TITLE_BUFFER_SIZE]; /* Holds the current song and artist string in a buffer for display */
-  u8   title_size;                      /* Holds the size of the string stored in the title buffer */
+  u8   title_buffer[TITLE_BUFFER_SIZE + LCD_MAX_LINE_DISPLAY_SIZE]; /* The current song and artist, then its first */
+                                        /* line's worth again, so the window at any start index is one slice */
+  u8   title_size;                      /* Holds the size of the title in the title buffer, before it repeats */
   u8   title_display_start_index;       /* Start index of title string to display on LCD screen */
   u32  title_scroll_timer;              /* Holds a timer for when to update the scrolling title on LCD screen */
   u32  title_freeze_delay;              /* Holds a timer to briefly "freeze" the title when a song is changed */
+  u32  status_position;                 /* Song position in ms as written when the status line was last drawn */
+  u32  status_length;                   /* Length of the song in ms as written, 0 if it is not known */
+  bool status_paused;                   /* The song was paused */
+  AntChannelConnectionType status_ant;  /* State of the ANT channel */
 } LcdStateType;
 
 /***********************************************************************************************************************
@@ -48,19 +91,52 @@ Global variable definitions with scope limited to this local application.
 ***********************************************************************************************************************/
 static fnCode_type LcdControl_StateMachine;   /* The state machine function pointer */
 
-static u8 lcd_button_banner[LCD_MAX_LINE_DISPLAY_SIZE] = "||>   <<    >>     ";
+// Labels of buttons 1 and 2; button 0 is labelled by the play/pause icon
+static u8 lcd_button_banner[LCD_MAX_LINE_DISPLAY_SIZE + 1] = "      <<    >>      ";
+static const u8 lcd_line_address[LCD_LINES] = { LINE1_START_ADDR, LINE2_START_ADDR };
+
+// What each line of the LCD shows, so that only the characters that change are sent to it
+static u8 lcd_shown[LCD_LINES][LCD_MAX_LINE_DISPLAY_SIZE];
 
-static u8 current_song_index;   /* Current song index */
+// Rows of each glyph, 5 pixels each with bit 4 on the left
+static const u8 glyph_patterns[GLYPH_COUNT][LCD_CGRAM_CHAR_SIZE] =
+{
+  { 0x10, 0x18, 0x1C, 0x1E, 0x1C, 0x18, 0x10, 0x00 },   /* GLYPH_PLAY */
+  { 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x00 },   /* GLYPH_PAUSE */
+  { 0x00, 0x00, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x00 },   /* GLYPH_ANT_SEARCHING: the mast */
+  { 0x11, 0x15, 0x15, 0x0E, 0x04, 0x04, 0x04, 0x00 },   /* GLYPH_ANT_CONNECTED: the mast with waves */
+  { 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00 },   /* GLYPH_BAR_0 */
+  { 0x00, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x00 },   /* GLYPH_BAR_1 */
+  { 0x00, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x00 },   /* GLYPH_BAR_2 */
+  { 0x00, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x00 },   /* GLYPH_BAR_3 */
+  { 0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x00 },   /* GLYPH_BAR_4 */
+  { 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00 }    /* GLYPH_BAR_5 */
+};
+
+// Glyph cache: what each custom character holds and when it was last needed
+static u8 glyph_slots[LCD_CGRAM_CHARS];         /* Glyph in each custom character, GLYPH_NONE if not loaded */
+static u32 glyph_slot_used[LCD_CGRAM_CHARS];    /* Time each was last needed, the oldest is replaced first */
+
+static u16 current_song_index;  /* Index of the song chosen on the player */
+static bool title_pending;      /* Set until that song's title and artist have been fetched */
+static bool status_pending;     /* Set until the status line has all been queued to the LCD */
 static LcdStateType lcd_state;
 
 /***********************************************************************************************************************
 Local functions
 ***********************************************************************************************************************/
-static void SetNewTitleString(void);
+static void SetNewTitleString(const char* title, const char* artist);
+static bool ShowLcdLine(u8 line, const u8* text);
+static bool ReadStatus(void);
+static bool ShowStatusLine(void);
+static bool LoadGlyphs(u16 needed);
+static u8 GetGlyphCode(u8 glyph);
+static void FormatTime(u8* text, u32 time_ms);
 
 /***********************************************************************************************************************
 State Machine Declarations
 ***********************************************************************************************************************/
+static void LcdControlSM_WaitLcd(void);
 static void LcdControlSM_DisplayInfo(void);
 
 /**********************************************************************************************************************
@@ -79,19 +155,16 @@ Description:
 */
 void LcdControlInitialize(void)
 {
-  // Clear the screen to begin
-  LCDCommand( LCD_CLEAR_CMD );
+  // The LCD driver clears the screen once it is up, with nothing in CGRAM that the glyph cache knows of
+  memset( lcd_shown, ' ', sizeof( lcd_shown ) );
+  memset( glyph_slots, GLYPH_NONE, sizeof( glyph_slots ) );
 
   // Invalidate the current song index to begin
   current_song_index = -1;
+  title_pending = FALSE;
+  status_pending = FALSE;
 
-  // Begin timer for scrolling LCD feature
-  lcd_state.title_scroll_timer = G_u32SystemTime1ms;
-
-  // Display the button banner on LCD
-  LCDMessage( LINE2_START_ADDR, lcd_button_banner );
-
-  LcdControl_StateMachine = LcdControlSM_DisplayInfo;
+  LcdControl_StateMachine = LcdControlSM_WaitLcd;
 }
 
 
@@ -112,61 +185,348 @@ void LcdControlRunActiveState(void)
 /* Private functions                                                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------*/
 /*-------------------------------------------------------------------------------------------------------------------*/
-/* Resets the LCD screen title buffer with the current song title and artist string */
+/* Resets the LCD screen title buffer with the given song title and artist string, in one pass */
 /* Also resets variables to start LCD scrolling from beginning */
-static void SetNewTitleString(void)
+static void SetNewTitleString(const char* title, const char* artist)
 {
+  const char* parts[] = { title, " - ", artist };
+  u8* buffer = lcd_state.title_buffer;
   u8 buf_index = 0;
+  u8 padded_size;
+
+  // Store the current song and artist as "title - artist", cut short if it is too long to scroll
+  for( u8 i = 0; i < ( sizeof( parts ) / sizeof( parts[0] ) ); i++ )
+  {
+    for( const char* c = parts[i]; ( *c != '\0' ) && ( buf_index < ( TITLE_BUFFER_SIZE - TITLE_SCROLL_GAP ) ); c++ )
+    {
+      buffer[buf_index++] = *c;
+    }
+  }
+
+  // If string is larger than LCD size, pad end with a gap for a scrolling effect.
+  // If string is smaller than LCD size, pad end with spaces until it fills the display.
+  padded_size = ( buf_index > LCD_MAX_LINE_DISPLAY_SIZE ) ? ( buf_index + TITLE_SCROLL_GAP ) : LCD_MAX_LINE_DISPLAY_SIZE;
+  memset( &buffer[buf_index], ' ', padded_size - buf_index );
 
-  // Clear title buffer
-  memset( lcd_state.title_buffer, 0, sizeof( lcd_state.title_buffer ) );
+  // Repeat the start after the end, so that a window that wraps around is still one slice of the buffer
+  memcpy( &buffer[padded_size], buffer, LCD_MAX_LINE_DISPLAY_SIZE );
 
-  // Store the current song and artist as a string in the title buffer
-  buf_index += snprintf( lcd_state.title_buffer, TITLE_BUFFER_SIZE, "%s - %s", MusicPlayerGetCurrentSongTitle(), MusicPlayerGetCurrentSongArtist() );
+  // Update variables for tracking which part of the string to show on LCD
+  lcd_state.title_size = padded_size;
+  lcd_state.title_display_start_index = 0;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Shows LCD_MAX_LINE_DISPLAY_SIZE characters of text on a line of the LCD (0 or 1). Only the characters that */
+/* differ from what the LCD shows are sent, as one LCDMessage() for each run of them. Runs that are */
+/* LCD_RUN_MERGE_GAP or fewer characters apart are sent as one. Returns FALSE if the TWI queue was full, and the */
+/* characters that did not go are sent next time. */
+static bool ShowLcdLine(u8 line, const u8* text)
+{
+  u8* shown = lcd_shown[line];
+  u8 run[LCD_MAX_LINE_DISPLAY_SIZE + 1];
+  u8 run_end;
 
-  // If string is larger than LCD size, pad end with fixed number of spaces for a scrolling effect
-  if( buf_index > LCD_MAX_LINE_DISPLAY_SIZE )
+  for( u8 i = 0; i < LCD_MAX_LINE_DISPLAY_SIZE; i++ )
   {
-    u8 space_pad[] = "     ";
-    buf_index += snprintf( &lcd_state.title_buffer[buf_index], TITLE_BUFFER_SIZE, "%s", space_pad );
+    if( text[i] == shown[i] )
+    {
+      continue;
+    }
+
+    // Extend the run to the last change that is close enough to the one before it
+    run_end = i + 1;
+    for( u8 j = run_end; ( j < LCD_MAX_LINE_DISPLAY_SIZE ) && ( ( j - run_end ) <= LCD_RUN_MERGE_GAP ); j++ )
+    {
+      if( text[j] != shown[j] )
+      {
+        run_end = j + 1;
+      }
+    }
+
+    memcpy( run, &text[i], run_end - i );
+    run[run_end - i] = '\0';
+
+    // Only what was queued is on its way to the LCD
+    if( LCDMessage( lcd_line_address[line] + i, run ) == 0 )
+    {
+      return FALSE;
+    }
+
+    memcpy( &shown[i], &text[i], run_end - i );
+    i = run_end;
   }
-  // If string is smaller than LCD size, pad end with spaces until it fills the display
-  else
+
+  return TRUE;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Reads what the status line shows from the player and the ANT channel. Returns TRUE if it has changed since the */
+/* status line was last drawn: the elapsed time moves on a second, the song changes, or play/pause or ANT change. */
+static bool ReadStatus(void)
+{
+  u32 position = MusicPlayerGetPositionMs();
+  u32 length = MusicPlayerGetLengthMs();
+  bool paused = MusicPlayerIsPaused();
+  AntChannelConnectionType ant = AntChannelGetConnection();
+  bool changed;
+
+  changed = ( ( position / 1000 ) != ( lcd_state.status_position / 1000 ) ) || ( length != lcd_state.status_length ) ||
+            ( paused != lcd_state.status_paused ) || ( ant != lcd_state.status_ant );
+
+  lcd_state.status_position = position;
+  lcd_state.status_length = length;
+  lcd_state.status_paused = paused;
+  lcd_state.status_ant = ant;
+
+  return changed;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Draws the status line from what ReadStatus() read. Glyphs that are not in CGRAM are uploaded first, in one batch, */
+/* then only the characters that changed are sent, so a new second costs one message and a new glyph one more. */
+/* Returns FALSE if the TWI queue was full, so it has to be drawn again. */
+static bool ShowStatusLine(void)
+{
+  u8 status[LCD_MAX_LINE_DISPLAY_SIZE];
+  u8 play_glyph = lcd_state.status_paused ? GLYPH_PAUSE : GLYPH_PLAY;
+  u8 ant_glyph = GLYPH_NONE;
+  u8 bar_glyphs[LCD_PROGRESS_CELLS];
+  u16 needed = GLYPH_BIT( play_glyph );
+  u32 steps;
+  bool loaded;
+
+  if( lcd_state.status_ant == ANT_CHANNEL_SEARCHING )
+  {
+    ant_glyph = GLYPH_ANT_SEARCHING;
+  }
+  else if( lcd_state.status_ant == ANT_CHANNEL_CONNECTED )
   {
-    u8 num_space_pads = LCD_MAX_LINE_DISPLAY_SIZE - buf_index;
+    ant_glyph = GLYPH_ANT_CONNECTED;
+  }
+
+  if( ant_glyph != GLYPH_NONE )
+  {
+    needed |= GLYPH_BIT( ant_glyph );
+  }
+
+  // Each cell of the progress bar fills one column at a time
+  if( lcd_state.status_length != 0 )
+  {
+    steps = ( lcd_state.status_position * LCD_PROGRESS_STEPS ) / lcd_state.status_length;
+
+    for( u8 i = 0; i < LCD_PROGRESS_CELLS; i++ )
+    {
+      if( steps >= LCD_PROGRESS_CELL_STEPS )
+      {
+        bar_glyphs[i] = GLYPH_BAR_5;
+        steps -= LCD_PROGRESS_CELL_STEPS;
+      }
+      else
+      {
+        bar_glyphs[i] = GLYPH_BAR_0 + steps;
+        steps = 0;
+      }
 
-    for( u8 i = 0; i < num_space_pads; i++ )
+      needed |= GLYPH_BIT( bar_glyphs[i] );
+    }
+  }
+
+  loaded = LoadGlyphs( needed );
+
+  // Lay the status out between the button labels
+  memcpy( status, lcd_button_banner, LCD_MAX_LINE_DISPLAY_SIZE );
+  status[LCD_STATUS_PLAY_COLUMN] = GetGlyphCode( play_glyph );
+  FormatTime( &status[LCD_STATUS_ELAPSED_COLUMN], lcd_state.status_position );
+
+  // A song on the SD card has no bar or length, as its length is not known
+  if( lcd_state.status_length != 0 )
+  {
+    for( u8 i = 0; i < LCD_PROGRESS_CELLS; i++ )
     {
-      buf_index += snprintf( &lcd_state.title_buffer[buf_index], TITLE_BUFFER_SIZE, "%s", " " );
+      status[LCD_STATUS_BAR_COLUMN + i] = GetGlyphCode( bar_glyphs[i] );
     }
+
+    FormatTime( &status[LCD_STATUS_LENGTH_COLUMN], lcd_state.status_length );
   }
 
-  // Update variables for tracking which part of the string to show on LCD
-  lcd_state.title_size = buf_index;
-  lcd_state.title_display_start_index = 0;
+  if( ant_glyph != GLYPH_NONE )
+  {
+    status[LCD_STATUS_ANT_COLUMN] = GetGlyphCode( ant_glyph );
+  }
+
+  // Glyphs that did not reach CGRAM are shown as spaces until they do
+  return ShowLcdLine( LCD_STATUS_LINE, status ) && loaded;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Makes sure every glyph in needed (one GLYPH_BIT() each) is in CGRAM. A glyph that is not replaces one that is not */
+/* needed, the one needed longest ago first, and all of them go to the LCD in one batch. At most five glyphs are */
+/* needed at once, which with their CGRAM address commands fit in LCD_MAX_BATCH_SIZE. Returns FALSE if the TWI */
+/* queue was full. */
+static bool LoadGlyphs(u16 needed)
+{
+  u16 missing = needed;
+  u8 loaded_slots = 0;
+  u8 slot;
+
+  // Glyphs already in CGRAM are kept
+  for( u8 i = 0; i < LCD_CGRAM_CHARS; i++ )
+  {
+    if( ( glyph_slots[i] != GLYPH_NONE ) && ( needed & GLYPH_BIT( glyph_slots[i] ) ) )
+    {
+      missing &= ~GLYPH_BIT( glyph_slots[i] );
+      glyph_slot_used[i] = G_u32SystemTime1ms;
+    }
+  }
+
+  for( u8 glyph = 0; missing != 0; glyph++ )
+  {
+    if( !( missing & GLYPH_BIT( glyph ) ) )
+    {
+      continue;
+    }
+
+    missing &= ~GLYPH_BIT( glyph );
+
+    // An empty custom character, else the one that has gone unneeded the longest
+    slot = 0;
+    for( u8 i = 0; i < LCD_CGRAM_CHARS; i++ )
+    {
+      if( glyph_slots[i] == GLYPH_NONE )
+      {
+        slot = i;
+        break;
+      }
+
+      if( !( needed & GLYPH_BIT( glyph_slots[i] ) ) &&
+          ( ( needed & GLYPH_BIT( glyph_slots[slot] ) ) ||
+            ( ( G_u32SystemTime1ms - glyph_slot_used[i] ) > ( G_u32SystemTime1ms - glyph_slot_used[slot] ) ) ) )
+      {
+        slot = i;
+      }
+    }
+
+    glyph_slots[slot] = glyph;
+    glyph_slot_used[slot] = G_u32SystemTime1ms;
+    loaded_slots |= ( 1 << slot );
+
+    LCDBatchCommand( LCD_CGRAM_CMD | ( slot * LCD_CGRAM_CHAR_SIZE ) );
+    LCDBatchData( (u8*)glyph_patterns[glyph], LCD_CGRAM_CHAR_SIZE );
+  }
+
+  // If the TWI queue was full, the glyphs never reached CGRAM and are uploaded next time
+  if( ( loaded_slots != 0 ) && ( LCDBatchSend() == 0 ) )
+  {
+    for( u8 i = 0; i < LCD_CGRAM_CHARS; i++ )
+    {
+      if( loaded_slots & ( 1 << i ) )
+      {
+        glyph_slots[i] = GLYPH_NONE;
+      }
+    }
+
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Returns the character code that shows a glyph, or a space if it is not in CGRAM */
+static u8 GetGlyphCode(u8 glyph)
+{
+  for( u8 i = 0; i < LCD_CGRAM_CHARS; i++ )
+  {
+    if( glyph_slots[i] == glyph )
+    {
+      return LCD_CGRAM_CHAR_CODE + i;
+    }
+  }
+
+  return ' ';
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Writes a time in ms as LCD_STATUS_TIME_SIZE characters of "mm:ss", with a space for minutes under 10. Times of */
+/* 100 minutes and over show as 99:59. */
+static void FormatTime(u8* text, u32 time_ms)
+{
+  u32 seconds = time_ms / 1000;
+  u32 minutes = seconds / 60;
+
+  if( minutes > 99 )
+  {
+    minutes = 99;
+    seconds = 59;
+  }
+  else
+  {
+    seconds %= 60;
+  }
+
+  text[0] = ( minutes >= 10 ) ? ( '0' + ( minutes / 10 ) ) : ' ';
+  text[1] = '0' + ( minutes % 10 );
+  text[2] = ':';
+  text[3] = '0' + ( seconds / 10 );
+  text[4] = '0' + ( seconds % 10 );
 }
 
 /**********************************************************************************************************************
 State Machine Function Definitions
 **********************************************************************************************************************/
 
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Waits for the LCD driver to bring the LCD up, then shows the status line */
+static void LcdControlSM_WaitLcd(void)
+{
+  if( G_u32LcdFlags & _LCD_FLAGS_READY )
+  {
+    // Begin timer for scrolling LCD feature
+    lcd_state.title_scroll_timer = G_u32SystemTime1ms;
+
+    // Display the status and button labels on LCD
+    ReadStatus();
+    status_pending = !ShowStatusLine();
+
+    LcdControl_StateMachine = LcdControlSM_DisplayInfo;
+  }
+}
+
 /*-------------------------------------------------------------------------------------------------------------------*/
 /* Displays current information, such a song name, play/pause status, ANT status, etc. */
 static void LcdControlSM_DisplayInfo(void)
 {
-  // If the song has changed, we need to change the title being displayed
-  if( current_song_index != MusicPlayerGetCurrentSongIndex() )
+  const char* title;
+  const char* artist;
+
+  // If the song has changed, we need to change the title being displayed. It is shown as soon as a song
+  // on the SD card has been chosen, from the card's index, without waiting for the song to load.
+  if( current_song_index != MusicPlayerGetSelectedSongIndex() )
   {
     // Keep track of current song index
-    current_song_index = MusicPlayerGetCurrentSongIndex();
+    current_song_index = MusicPlayerGetSelectedSongIndex();
+    title_pending = TRUE;
+  }
+
+  if( title_pending && MusicPlayerGetSongInfo( current_song_index, &title, &artist ) )
+  {
+    title_pending = FALSE;
 
     // Set a new title string to show on LCD screen
-    SetNewTitleString();
+    SetNewTitleString( title, artist );
 
     // Add a slight delay here
     lcd_state.title_freeze_delay = G_u32SystemTime1ms;
   }
 
+  // Redraw the status line once a second while playing, and as soon as anything else on it changes, or until
+  // it has all been queued
+  if( ReadStatus() || status_pending )
+  {
+    status_pending = !ShowStatusLine();
+  }
+
   // Display the title on LCD
   if( IsTimeUp( &lcd_state.title_scroll_timer, LCD_SCROLL_UPDATE_TIME_MS ) )
   {
@@ -175,26 +535,12 @@ static void LcdControlSM_DisplayInfo(void)
     // Fit the whole title on LCD
     if( lcd_state.title_size <= LCD_MAX_LINE_DISPLAY_SIZE )
     {
-      LCDMessage( LINE1_START_ADDR, (u8*)lcd_state.title_buffer );
+      ShowLcdLine( 0, lcd_state.title_buffer );
     }
-    // Otherwise, scroll the title
+    // Otherwise, scroll the title: the characters bounded by the size of the LCD are one slice of the buffer
     else
     {
-      u8 temp_buffer[LCD_MAX_LINE_DISPLAY_SIZE];
-      u8 display_index = lcd_state.title_display_start_index;
-
-      // Display the characters of the title bounded by the size of the LCD
-      for( u8 i = 0; i < LCD_MAX_LINE_DISPLAY_SIZE; i++ )
-      {
-        temp_buffer[i] = lcd_state.title_buffer[display_index];
-
-        if( ++display_index >= lcd_state.title_size )
-        {
-          display_index = 0;
-        }
-      }
-
-      LCDMessage( LINE1_START_ADDR, temp_buffer );
+      ShowLcdLine( 0, &lcd_state.title_buffer[lcd_state.title_display_start_index] );
 
       // "Freeze" the title on LCD briefly so it doesn't scroll off too fast on a song change
       if( !IsTimeUp( &lcd_state.title_freeze_delay, LCD_NEW_TITLE_FREEZE_DELAY_MS ) )
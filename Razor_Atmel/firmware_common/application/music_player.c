@@ -1,6 +1,7 @@
 /**********************************************************************************************************************
 File: music_player.c
 Description: Module that is responsible for controlling the buzzers for playing music.
+             Songs come from song_list in songs.h, followed by any songs in the SD card's library (song_stream.c).
 Author: Ivan Chow
 Date: February 9, 2018
 ------------------------------------------------------------------------------------------------------------------------
@@ -13,9 +14,16 @@ Public functions:
   - void MusicPlayerRunActiveState(void)
       Runs current task state. Should only be called once in main loop.
 
-  - u8 MusicPlayerGetCurrentSongIndex(void)
+  - u16 MusicPlayerGetCurrentSongIndex(void)
       Returns the index of the song currently playing
 
+  - u16 MusicPlayerGetSelectedSongIndex(void)
+      Returns the index of the song chosen last: the one being loaded from the SD card, else the one playing
+
+  - bool MusicPlayerGetSongInfo(u16 index, const char** title, const char** artist)
+      Gets any song's title and artist without playing it. Songs on the SD card return FALSE until they have
+      been read from the card's index; keep calling until it returns TRUE.
+
   - const char* MusicPlayerGetCurrentSongTitle(void)
       Returns a pointer to the title string of the song currently playing
 
@@ -30,6 +38,38 @@ Public functions:
 
   - void MusicPlayerNextSong(void)
       Plays the next song in the list
+
+  - bool MusicPlayerSeekMs(u32 position)
+      Moves the song in flash that is playing or paused to a position in ms as written, from the start of the song.
+      Returns FALSE, leaving the song where it was, for a song on the SD card or a position past the end.
+
+  - u32 MusicPlayerGetPositionMs(void)
+      Returns how far into the current song the player is, in ms as written
+
+  - u32 MusicPlayerGetLengthMs(void)
+      Returns the length of the current song in ms as written, or 0 for a song on the SD card, whose length
+      is not known until it has played through
+
+  - bool MusicPlayerIsPaused(void)
+      Returns TRUE while the song is paused
+
+  - void MusicPlayerSkipForward(void)
+  - void MusicPlayerSkipBack(void)
+      Seeks SKIP_STEP_MS forward or back in the current song. Skipping past the end plays the next song.
+
+  - void MusicPlayerSetTempo(u16 tempo)
+      Sets the playback tempo in percent of the song's own tempo (100 = as written), clamped to TEMPO_MIN - TEMPO_MAX.
+      Takes effect immediately, including on the notes already playing.
+
+  - u16 MusicPlayerGetTempo(void)
+      Returns the playback tempo in percent
+
+  - void MusicPlayerSetLedDisplay(MusicLedDisplayType display)
+      Chooses what the LEDs show: MUSIC_LED_PITCH lights one LED for the average pitch of both buzzers,
+      MUSIC_LED_SPECTRUM lights each buzzer's note on the LED of its half octave, fading out after the note starts.
+
+  - MusicLedDisplayType MusicPlayerGetLedDisplay(void)
+      Returns what the LEDs show
 **********************************************************************************************************************/
 
 #include "configuration.h"
@@ -38,18 +78,42 @@ Public functions:
 /***********************************************************************************************************************
 Constants / Definitions
 ***********************************************************************************************************************/
-#define LED_WHITE_FREQ_THRESHOLD    200
-#define LED_PURPLE_FREQ_THRESHOLD   400
-#define LED_BLUE_FREQ_THRESHOLD     600
-#define LED_CYAN_FREQ_THRESHOLD     800
-#define LED_GREEN_FREQ_THRESHOLD    1000
-#define LED_YELLOW_FREQ_THRESHOLD   1500
-#define LED_ORANGE_FREQ_THRESHOLD   2000
+#define LED_FREQ_SUM_STEP           (u16)200        /* Frequency sums are looked up in led_freq_sum_table in steps of this many Hz */
+#define LED_FREQ_SUM_STEPS          (u16)15         /* Sums of this many steps and up all light the last LED in the table */
+#define NO_LED                      (u8)0xFF        /* Neither buzzer is playing, so no LED is lit */
+#define LED_SPECTRUM_FADE_STEP_MS   (u16)20         /* The spectrum display's LEDs drop one PWM level this often after a note starts */
+
+/* Set to 1 to fire note edges from the TC1 interrupt instead of the 1ms super loop, here or for the whole build */
+#ifndef MUSIC_PLAYER_TIMER_SEQUENCER
+#define MUSIC_PLAYER_TIMER_SEQUENCER  0
+#endif
+
+#define NUM_BUZZERS                 (u8)2           /* Buzzer 0 is the right buzzer (BUZZER1), buzzer 1 is the left buzzer (BUZZER2) */
+#define ARPEGGIO_STEP_MS            (u32)20         /* Time each voice gets on a shared buzzer before it moves on to the next voice */
+
+#define NOTE_EVENT_BUFFER_SIZE      (u8)8           /* Number of note edges in each half of the timer interrupt's double buffer */
+#define NOTE_TIMER_TICKS_PER_MS     (u32)375        /* TC1 runs from TIMER_CLOCK4 (MCK/128 = 2.67us / tick) */
+#define NOTE_TIMER_MAX_TICKS        (u32)0xFFFF     /* Largest delay the 16-bit TC1 RC register can hold */
+
+#define TEMPO_NORMAL                (u16)100        /* Tempo in percent that plays songs as written */
+#define TEMPO_MIN                   (u16)25
+#define TEMPO_MAX                   (u16)400
+#define TEMPO_BUTTON_STEP           (u16)10         /* Button 3 speeds up by this much per press... */
+#define TEMPO_BUTTON_MIN            (u16)50         /* ...wrapping around to this after TEMPO_BUTTON_MAX */
+#define TEMPO_BUTTON_MAX            (u16)150
+#define TEMPO_SCALE_SHIFT           (u8)12          /* Durations are scaled by tempo_scale / 4096 */
+#define TEMPO_REBASE_MS             (u32)60000      /* Song time after which the tempo origin is moved up to keep the scaling within 32 bits */
+
+#define SKIP_STEP_MS                (u32)5000       /* Song time skipped forward or back at a time */
+#define SKIP_HOLD_MS                (u32)500        /* Holding button 1 or 2 this long skips back or forward instead of changing song... */
+#define SKIP_REPEAT_MS              (u32)250        /* ...and skips again this often while it is held */
+#define NO_SONG_BUTTON              (u32)0xFFFFFFFF /* Neither button 1 nor button 2 is held */
 
 /***********************************************************************************************************************
 Macros
 ***********************************************************************************************************************/
 #define LED_ON( LED )               LedPWM( LED, LED_PWM_5 )
+#define IS_STREAMED_SONG( INDEX )   ( ( INDEX ) >= SONG_LIST_SIZE )   /* Songs after the ones in flash are read from the SD card */
 
 /***********************************************************************************************************************
 Existing variables (defined in other files -- should all contain the "extern" keyword)
@@ -58,37 +122,207 @@ extern volatile u32 G_u32SystemTime1ms;         /* From board-specific source fi
 extern volatile u32 G_u32SystemTime1s;          /* From board-specific source file */
 
 /***********************************************************************************************************************
-Global variable definitions with scope limited to this local application.
+Type Definitions
 ***********************************************************************************************************************/
-static fnCode_type MusicPlayer_StateMachine;    /* The state machine function pointer */
+/* A note edge buffered for the timer interrupt to play */
+typedef struct
+{
+  u32 delay_ticks;                /* TC1 ticks from the previous note edge until this one */
+  u32 position;                   /* Song position of this note edge, in ms as written */
+  u32 tempo_scale;                /* Tempo scale the song plays at from the previous note edge up to this one */
+  u16 periods[NUM_BUZZERS];       /* PWM channel period for each buzzer, 0 for a rest */
+  u8  notes[NUM_BUZZERS];         /* MIDI note to play on each buzzer */
+  u8  buzzers_changed;            /* Bit n is set when buzzer n changes note */
+} NoteEventType;
+
+/* Where a voice is in its song's playlist */
+typedef struct
+{
+  const PhraseRefType* playlist;  /* Playlist being played */
+  u16 playlist_size;              /* Number of entries in the playlist */
+  u16 playlist_index;             /* Playlist entry being played */
+  u16 repeats_left;               /* Times the phrase is still to be played after this one */
+  u16 phrase_offset;              /* Offset of the next note event in phrase_events */
+  u16 phrase_end;                 /* Offset just past the end of the phrase being played */
+} SongCursorType;
+
+/* How a note shows on the spectrum display */
+typedef struct
+{
+  u8 led;                         /* LED of the note's half octave, NO_LED for notes the buzzers cannot play */
+  u8 level;                       /* LedRateType the LED starts at before it fades */
+} NoteLedType;
 
-/* Index of song currently playing from song_list */
-static u8 song_index = 0;
+/* A voice of the song being played */
+typedef struct
+{
+  SongCursorType cursor;          /* Position in the voice's playlist */
+  u32 note_start_time;            /* Time when the current note started */
+  u32 note_duration;              /* Duration of the current note in ms at the current tempo */
+  u32 note_end_position;          /* Song position where the current note ends, in ms as written */
+  u8  note;                       /* MIDI note the voice is playing */
+} VoiceStateType;
 
-/* Right buzzer variables */
-static u32 buzzer_right_timer = 0;
-static u16 current_note_duration_right = 0;
-static u32 note_right_index = 0;
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+***********************************************************************************************************************/
+static fnCode_type MusicPlayer_StateMachine;    /* The state machine function pointer */
 
-/* Left buzzer variables */
-static u32 buzzer_left_timer = 0;
-static u16 current_note_duration_left = 0;
-static u32 note_left_index = 0;
+/* Index of song currently playing from song_list, or from the SD card after the end of song_list */
+static u16 song_index = 0;
+static u16 loading_song_index = 0;        /* Song being loaded from the SD card, played once it is ready */
+
+/* Voice variables */
+static VoiceStateType voices[MAX_VOICES];
+static u8 num_voices = 0;
+static u32 arpeggio_timer = 0;            /* Time of the last arpeggio step */
+static u8 arpeggio_step = 0;              /* Counts arpeggio steps to rotate shared buzzers between their voices */
+
+/* Buzzer variables */
+static const u32 buzzer_channels[NUM_BUZZERS] = { BUZZER1, BUZZER2 };
+static u8 buzzer_notes[NUM_BUZZERS];      /* Note playing (or queued to play) on each buzzer */
+
+/* Note scheduler variables */
+static u32 next_note_edge_time = 0;       /* Time when the next voice changes note or the next arpeggio step is due */
+static u32 note_edge_timer = 0;           /* Time when the note scheduler last ran */
+static u32 time_to_next_note_edge = 0;    /* Time in ms from note_edge_timer until the next note edge */
+static u32 pause_start_time = 0;          /* Time when the song was paused */
+
+/* Tempo variables
+   Song positions (ms as written) become times by scaling their distance from the tempo origin, so the
+   voices stay on the same edges at any tempo instead of each drifting by its own rounding */
+static u16 tempo = TEMPO_NORMAL;          /* Tempo in percent */
+static u32 tempo_scale = ( 1 << TEMPO_SCALE_SHIFT );  /* Note duration multiplier, ( 100 / tempo ) << TEMPO_SCALE_SHIFT */
+static u32 tempo_origin_time = 0;         /* Time when the song was at tempo_origin_position */
+static u32 tempo_origin_position = 0;     /* Song position where the current tempo took effect, or was last rebased */
+
+/* LED variables
+   Each LED lights for a band of the two notes' average frequency. Every band edge, doubled, is a multiple
+   of LED_FREQ_SUM_STEP, so the sum of the two frequencies (twice a lone note's) indexes the band directly:
+   average   0 -  199 Hz  WHITE        800 -  999 Hz  GREEN
+           200 -  399 Hz  PURPLE      1000 - 1499 Hz  YELLOW
+           400 -  599 Hz  BLUE        1500 Hz and up  ORANGE
+           600 -  799 Hz  CYAN
+   The red LED is left alone, it shows the ANT channel status */
+static const u8 led_freq_sum_table[LED_FREQ_SUM_STEPS + 1] =
+{
+  WHITE, WHITE, PURPLE, PURPLE, BLUE, BLUE, CYAN, CYAN,
+  GREEN, GREEN, YELLOW, YELLOW, YELLOW, YELLOW, YELLOW, ORANGE
+};
+static u8 lit_led = NO_LED;               /* LED lit by FlashLed(), the only one it has to turn off */
+
+/* Spectrum display of each MIDI note: half octaves from C3 (WHITE) up to C6 and above (ORANGE), with notes below
+   C3 on WHITE. The buzzers get louder towards their resonance a few kHz up, so the LED starts brighter for
+   higher notes, from LED_PWM_50 at C3 up to LED_PWM_100 at C6, and fades out from there in LedUpdate() */
+static const NoteLedType note_led_table[NUM_MIDI_NOTES] =
+{
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },
+  { NO_LED, LED_PWM_0 },   { NO_LED, LED_PWM_0 },   { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_50 },
+  { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_50 },
+  { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_50 },   { WHITE, LED_PWM_55 },   { WHITE, LED_PWM_55 },
+  { WHITE, LED_PWM_55 },   { WHITE, LED_PWM_55 },   { PURPLE, LED_PWM_60 },  { PURPLE, LED_PWM_60 },
+  { PURPLE, LED_PWM_60 },  { PURPLE, LED_PWM_65 },  { PURPLE, LED_PWM_65 },  { PURPLE, LED_PWM_65 },
+  { BLUE, LED_PWM_65 },    { BLUE, LED_PWM_70 },    { BLUE, LED_PWM_70 },    { BLUE, LED_PWM_70 },
+  { BLUE, LED_PWM_70 },    { BLUE, LED_PWM_75 },    { CYAN, LED_PWM_75 },    { CYAN, LED_PWM_75 },
+  { CYAN, LED_PWM_80 },    { CYAN, LED_PWM_80 },    { CYAN, LED_PWM_80 },    { CYAN, LED_PWM_80 },
+  { GREEN, LED_PWM_85 },   { GREEN, LED_PWM_85 },   { GREEN, LED_PWM_85 },   { GREEN, LED_PWM_90 },
+  { GREEN, LED_PWM_90 },   { GREEN, LED_PWM_90 },   { YELLOW, LED_PWM_90 },  { YELLOW, LED_PWM_95 },
+  { YELLOW, LED_PWM_95 },  { YELLOW, LED_PWM_95 },  { YELLOW, LED_PWM_95 },  { YELLOW, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 },
+  { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }, { ORANGE, LED_PWM_100 }
+};
+static MusicLedDisplayType led_display = MUSIC_LED_PITCH;
+static u8 spectrum_notes[NUM_BUZZERS];    /* Note last shown for each buzzer on the spectrum display */
+
+/* Song button variables */
+static u32 song_button = NO_SONG_BUTTON;  /* Button 1 or 2 from when it is pressed until it is released */
+static u32 song_button_timer = 0;         /* Time when it was pressed, then when it last skipped */
+static bool song_button_skipped = FALSE;  /* Set once it has been held long enough to skip, so releasing it does not change song */
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+/* Timer sequencer variables */
+/* The TC1 interrupt plays one buffer of precomputed note edges while the main loop refills the other */
+static NoteEventType note_event_buffers[2][NOTE_EVENT_BUFFER_SIZE];
+static volatile u8 note_event_count[2] = {0, 0};  /* Events in each buffer, 0 when the buffer is free to be refilled */
+static volatile u8 note_event_play_buffer = 0;    /* Buffer being played by the interrupt */
+static volatile u8 note_event_play_index = 0;     /* Next event to be played in that buffer */
+static u8 note_event_fill_buffer = 0;             /* Next buffer to be filled by the main loop */
+static volatile u32 note_event_ticks_remaining;   /* Ticks left before the next event when its delay exceeds 16 bits */
+static volatile u8 sequencer_notes[NUM_BUZZERS];  /* Last note played on each buzzer by the interrupt */
+static volatile u16 sequencer_periods[NUM_BUZZERS]; /* Last PWM period played on each buzzer by the interrupt */
+static volatile u32 sequencer_edge_count = 0;     /* Incremented by the interrupt on every note edge */
+static volatile bool sequencer_underrun = TRUE;   /* Set when the interrupt is out of queued events and must be restarted */
+static u32 sequencer_time = 0;                    /* Time of the last queued event */
+static volatile u32 sequencer_position = 0;       /* Song position of the last event played by the interrupt */
+static volatile u32 sequencer_position_time = 0;  /* Time when the interrupt played it, moved on by pauses */
+static volatile u32 sequencer_tempo_scale = ( 1 << TEMPO_SCALE_SHIFT ); /* Tempo scale up to the next event */
+static u32 sequencer_edges_shown = 0;             /* Number of note edges already shown on the LEDs */
+static u16 sequencer_pause_ticks = 0;             /* Ticks left in the current timer period when paused */
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
 
 /***********************************************************************************************************************
 Local functions
 ***********************************************************************************************************************/
+#if( !MUSIC_PLAYER_TIMER_SEQUENCER )
 static void PlayNote(void);
+#endif /* !MUSIC_PLAYER_TIMER_SEQUENCER */
+static void StartSongCursor(SongCursorType* cursor, const PhraseRefType* playlist, u16 playlist_size);
+static u16 DecodeNextNote(const SongInfoType* song, SongCursorType* cursor, u8* note);
+static const SeekPointType* FindSeekPoint(const VoiceType* voice, u32 position);
+static void SeekVoice(const SongInfoType* song, u8 voice_index, u32 position);
+static void AdvanceVoices(u32 edge_time);
+static u32 GetNextNoteEdgeTime(void);
+static u32 GetTempoTime(u32 position);
+static u8 GetBuzzerNote(u8 buzzer);
+#if( !MUSIC_PLAYER_TIMER_SEQUENCER )
+static void ScheduleNextNoteEdge(void);
+#endif /* !MUSIC_PLAYER_TIMER_SEQUENCER */
+static void SetBuzzerPeriod(u32 buzzer, u16 period);
 static void ResetBuzzerVariables(void);
+static void PauseSong(void);
+static void ResumeSong(void);
 static void PreviousSong(void);
 static void NextSong(void);
+static void StartSong(u16 index);
+static u16 GetSongCount(void);
+static bool IsSeekable(void);
+static void HandleSongButtons(void);
+static void StepTempo(void);
+static void ShowNotesOnLeds(u8 note_right, u8 note_left);
 static void FlashLed(u16 note_freq_right, u16 note_freq_left);
+static void FlashSpectrumLeds(u8 note_right, u8 note_left);
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+static void FillNoteEvents(void);
+static void StartSequencer(void);
+static void LoadNextEventDelay(void);
+static void MusicPlayerTimerCallback(void);
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
 
 /***********************************************************************************************************************
 State Machine Declarations
 ***********************************************************************************************************************/
 static void MusicPlayerSM_Play(void);
 static void MusicPlayerSM_Pause(void);
+static void MusicPlayerSM_Load(void);
 
 /***********************************************************************************************************************
 Function Definitions
@@ -106,8 +340,12 @@ Description:
 */
 void MusicPlayerInitialize(void)
 {
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  TimerAssignCallback( TIMER_CHANNEL1, MusicPlayerTimerCallback );
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
   ResetBuzzerVariables();
-  MusicPlayer_StateMachine = MusicPlayerSM_Pause;
+  PauseSong();
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -129,11 +367,49 @@ Function: MusicPlayerGetCurrentSongIndex
 Description:
   Returns the current song index.
 */
-u8 MusicPlayerGetCurrentSongIndex(void)
+u16 MusicPlayerGetCurrentSongIndex(void)
 {
   return song_index;
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerGetSelectedSongIndex
+
+Description:
+  Returns the index of the song last chosen, which is still loading if it is on the SD card.
+*/
+u16 MusicPlayerGetSelectedSongIndex(void)
+{
+  return ( MusicPlayer_StateMachine == MusicPlayerSM_Load ) ? loading_song_index : song_index;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerGetSongInfo
+
+Description:
+  Gets the title and artist of any song. Songs in flash are always ready. For a song on the SD card, the first
+  call asks song_stream.c to read them from the card's index, and it returns TRUE once they are in.
+*/
+bool MusicPlayerGetSongInfo(u16 index, const char** title, const char** artist)
+{
+  if( !IS_STREAMED_SONG( index ) )
+  {
+    *title = song_list[index]->title;
+    *artist = song_list[index]->artist;
+    return TRUE;
+  }
+
+  if( !SongStreamIsInfoReady( index - SONG_LIST_SIZE ) )
+  {
+    SongStreamRequestInfo( index - SONG_LIST_SIZE );
+    return FALSE;
+  }
+
+  *title = SongStreamGetInfoTitle();
+  *artist = SongStreamGetInfoArtist();
+  return TRUE;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Function: MusicPlayerGetCurrentSongTitle
 
@@ -142,6 +418,11 @@ Description:
 */
 const char* MusicPlayerGetCurrentSongTitle(void)
 {
+  if( IS_STREAMED_SONG( song_index ) )
+  {
+    return SongStreamGetTitle();
+  }
+
   return song_list[song_index]->title;
 }
 
@@ -153,6 +434,11 @@ Description:
 */
 const char* MusicPlayerGetCurrentSongArtist(void)
 {
+  if( IS_STREAMED_SONG( song_index ) )
+  {
+    return SongStreamGetArtist();
+  }
+
   return song_list[song_index]->artist;
 }
 
@@ -167,11 +453,11 @@ void MusicPlayerTogglePlayPause(void)
   // Use state machine function pointer to determine if we're playing or paused
   if( MusicPlayer_StateMachine == MusicPlayerSM_Play )
   {
-    MusicPlayer_StateMachine = MusicPlayerSM_Pause;
+    PauseSong();
   }
   else if( MusicPlayer_StateMachine == MusicPlayerSM_Pause )
   {
-    MusicPlayer_StateMachine = MusicPlayerSM_Play;
+    ResumeSong();
   }
 }
 
@@ -197,267 +483,1329 @@ void MusicPlayerNextSong(void)
   NextSong();
 }
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Private functions                                                                                                  */
-/*--------------------------------------------------------------------------------------------------------------------*/
-
 /*----------------------------------------------------------------------------------------------------------------------
-Function: PlayNote
+Function: MusicPlayerSeekMs
 
 Description:
-  Runs the algorithm that determines which note to play on each buzzer and for how long.
+  Starts the current song over from a position in ms as written. Every voice binary searches its seek points
+  for the last one at or before the position, then decodes on from there to the note playing at the position,
+  so the cost does not grow with how far into the song the position is. The arpeggio carries on in step too,
+  so the song sounds the same as if it had played up to the position. A paused song stays paused.
 */
-static void PlayNote(void)
+bool MusicPlayerSeekMs(u32 position)
 {
-  // Play right buzzer tone
-  PWMAudioSetFrequency( BUZZER1, song_list[song_index]->note_right[note_right_index] );
-  PWMAudioOn( BUZZER1 );
+  const SongInfoType* song;
+
+  if( !IsSeekable() || ( position >= song_list[song_index]->length ) )
+  {
+    return FALSE;
+  }
+
+  // Start from silence, as a new song does, then move every voice on to its note at the position
+  song = song_list[song_index];
+  ResetBuzzerVariables();
 
-  // Play left buzzer tone
-  PWMAudioSetFrequency( BUZZER2, song_list[song_index]->note_left[note_left_index] );
-  PWMAudioOn( BUZZER2 );
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    SeekVoice( song, i, position );
+  }
 
-  // Right buzzer timer
-  if( IsTimeUp( &buzzer_right_timer, current_note_duration_right ) )
+  tempo_origin_position = position;
+  for( u8 i = 0; i < num_voices; i++ )
   {
-    // Advance to next note
-    if( ++note_right_index >= song_list[song_index]->num_notes_right )
-    {
-      note_right_index = 0;
-    }
+    voices[i].note_duration = GetTempoTime( voices[i].note_end_position ) - voices[i].note_start_time;
+  }
 
-    // LED control
-    FlashLed( song_list[song_index]->note_right[note_right_index], song_list[song_index]->note_left[note_left_index] );
+  arpeggio_step = (u8)( position / ARPEGGIO_STEP_MS );
+  arpeggio_timer = G_u32SystemTime1ms - ( position % ARPEGGIO_STEP_MS );
 
-    buzzer_right_timer = G_u32SystemTime1ms;
-    current_note_duration_right = song_list[song_index]->note_duration_right[note_right_index];
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  sequencer_position = position;
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+  // A paused song resumes from here, not from when it was paused
+  if( MusicPlayer_StateMachine == MusicPlayerSM_Pause )
+  {
+    pause_start_time = G_u32SystemTime1ms;
   }
 
-  // Left buzzer timer
-  if( IsTimeUp( &buzzer_left_timer, current_note_duration_left ) )
+  return TRUE;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerGetPositionMs
+
+Description:
+  Returns the current song's position in ms as written, which is where the tempo origin has got to by now.
+  Songs in flash start over at the end, so their position does too.
+*/
+u32 MusicPlayerGetPositionMs(void)
+{
+  u32 time = ( MusicPlayer_StateMachine == MusicPlayerSM_Pause ) ? pause_start_time : G_u32SystemTime1ms;
+  u32 position;
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  u32 edge_time;
+  u32 scale;
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+  // Song on the SD card has not started yet
+  if( MusicPlayer_StateMachine == MusicPlayerSM_Load )
   {
-    // Advance to next note
-    if( ++note_left_index >= song_list[song_index]->num_notes_left )
-    {
-      note_left_index = 0;
-    }
+    return 0;
+  }
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  // The tempo origin runs ahead with the note edges queued for the interrupt, so go on from the last edge it
+  // played instead, at the tempo the next one was queued at. Read again if the interrupt plays one in between.
+  do
+  {
+    position = sequencer_position;
+    edge_time = sequencer_position_time;
+    scale = sequencer_tempo_scale;
+  } while( position != sequencer_position );
 
-    // LED control
-    FlashLed( song_list[song_index]->note_right[note_right_index], song_list[song_index]->note_left[note_left_index] );
+  // Song stands still while the interrupt waits for more edges
+  if( !sequencer_underrun && ( (s32)( time - edge_time ) > 0 ) )
+  {
+    position += ( ( time - edge_time ) << TEMPO_SCALE_SHIFT ) / scale;
+  }
+#else
+  position = tempo_origin_position + ( ( ( time - tempo_origin_time ) << TEMPO_SCALE_SHIFT ) / tempo_scale );
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
 
-    buzzer_left_timer = G_u32SystemTime1ms;
-    current_note_duration_left = song_list[song_index]->note_duration_left[note_left_index];
+  if( !IS_STREAMED_SONG( song_index ) )
+  {
+    position %= song_list[song_index]->length;
   }
+
+  return position;
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: ResetBuzzerVariables
+Function: MusicPlayerGetLengthMs
 
 Description:
-  Resets variables for the buzzer.
-  Called when a song is switched, or on initialization.
+  Returns the current song's length in ms as written, where its voices all start over. Only songs in flash
+  have it in their song info; a song on the SD card returns 0.
 */
-static void ResetBuzzerVariables(void)
+u32 MusicPlayerGetLengthMs(void)
 {
-  buzzer_right_timer = G_u32SystemTime1ms;
-  note_right_index = -1;
-  current_note_duration_right = 0;
+  if( IS_STREAMED_SONG( song_index ) )
+  {
+    return 0;
+  }
 
-  buzzer_left_timer = G_u32SystemTime1ms;
-  note_left_index = -1;
-  current_note_duration_left = 0;
+  return song_list[song_index]->length;
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: PreviousSong
+Function: MusicPlayerIsPaused
 
 Description:
-  Handles the case of playing the song previous to the current song.
-  Changes song index, resets variables, and automatically play the song
+  Returns TRUE while the song is paused. A song being loaded from the SD card counts as playing, since it
+  starts as soon as it is ready.
 */
-static void PreviousSong(void)
+bool MusicPlayerIsPaused(void)
 {
-  // If currently playing first song of the list, wrap back around to end of list
-  if( song_index == 0 )
+  return ( MusicPlayer_StateMachine == MusicPlayerSM_Pause );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerSkipForward
+
+Description:
+  Skips SKIP_STEP_MS forward in the current song, or on to the next song if that is past the end.
+*/
+void MusicPlayerSkipForward(void)
+{
+  u32 position;
+
+  if( !IsSeekable() )
   {
-    song_index = SONG_LIST_SIZE - 1;
+    return;
   }
-  else
+
+  position = MusicPlayerGetPositionMs() + SKIP_STEP_MS;
+
+  if( !MusicPlayerSeekMs( position ) )
   {
-    song_index--;
+    NextSong();
   }
+}
 
-  // Reset relevant variables
-  ResetBuzzerVariables();
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerSkipBack
 
-  // Automatically move to new state
-  MusicPlayer_StateMachine = MusicPlayerSM_Play;
+Description:
+  Skips SKIP_STEP_MS back in the current song, or to its start.
+*/
+void MusicPlayerSkipBack(void)
+{
+  u32 position = MusicPlayerGetPositionMs();
+
+  MusicPlayerSeekMs( ( position > SKIP_STEP_MS ) ? ( position - SKIP_STEP_MS ) : 0 );
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: NextSong
+Function: MusicPlayerSetTempo
 
 Description:
-  Handles the case of playing the song next to the current song.
-  Changes song index, resets variables, and automatically play the song.
+  Sets the tempo in percent. The song position at the current note edge becomes the new tempo origin,
+  and the notes already sounding are rescaled so they end at the new tempo.
+  This is the only division the tempo needs; loading each note is a multiply and a shift.
 */
-static void NextSong(void)
+void MusicPlayerSetTempo(u16 new_tempo)
 {
-  // If currently playing last song of the list, wrap back around to beginning of list
-  if( song_index == ( SONG_LIST_SIZE - 1 ) )
+  u32 origin_time;
+
+  if( new_tempo < TEMPO_MIN )
   {
-    song_index = 0;
+    new_tempo = TEMPO_MIN;
   }
-  else
+  else if( new_tempo > TEMPO_MAX )
   {
-    song_index++;
+    new_tempo = TEMPO_MAX;
   }
 
-  // Reset relevant variables
-  ResetBuzzerVariables();
+  // New origin is the latest point the voices have been advanced to
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  origin_time = sequencer_time;
+#else
+  origin_time = ( MusicPlayer_StateMachine == MusicPlayerSM_Pause ) ? pause_start_time : G_u32SystemTime1ms;
 
-  // Automatically move to new state
-  MusicPlayer_StateMachine = MusicPlayerSM_Play;
+  if( (s32)( next_note_edge_time - origin_time ) < 0 )
+  {
+    origin_time = next_note_edge_time;
+  }
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+  tempo_origin_position += ( ( origin_time - tempo_origin_time ) << TEMPO_SCALE_SHIFT ) / tempo_scale;
+  tempo_origin_time = origin_time;
+
+  tempo = new_tempo;
+  tempo_scale = ( ( (u32)TEMPO_NORMAL << TEMPO_SCALE_SHIFT ) + ( tempo / 2 ) ) / tempo;
+
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    voices[i].note_duration = GetTempoTime( voices[i].note_end_position ) - voices[i].note_start_time;
+  }
+
+  next_note_edge_time = GetNextNoteEdgeTime();
+
+#if( !MUSIC_PLAYER_TIMER_SEQUENCER )
+  note_edge_timer = origin_time;
+  time_to_next_note_edge = next_note_edge_time - origin_time;
+#endif /* !MUSIC_PLAYER_TIMER_SEQUENCER */
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: FlashLed
+Function: MusicPlayerGetTempo
 
 Description:
-  Flashes an LED based on which notes are being played.
-  If one frequency is zero, and the other is non-zero, the zero frequency is ignored.
-  If both buzzers frequencies are non-zero, then the frequency is averaged.
-  The resulting frequency will be used to determine which LED should be flashed.
+  Returns the tempo in percent.
 */
-static void FlashLed(u16 note_freq_right, u16 note_freq_left)
+u16 MusicPlayerGetTempo(void)
 {
-  u8  led_to_turn_on = -1;
-  u16 frequency = 0;
+  return tempo;
+}
 
-  // Use left note frequency if right note is currently zero
-  if( note_freq_right == 0 )
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerSetLedDisplay
+
+Description:
+  Chooses what the LEDs show. The LEDs are cleared and show the new display from the next note edge.
+*/
+void MusicPlayerSetLedDisplay(MusicLedDisplayType display)
+{
+  if( display == led_display )
   {
-    frequency = note_freq_left;
+    return;
   }
-  // Use right note frequency if left note is currently zero
-  else if( note_freq_left == 0 )
+
+  // Skip the red LED since it represents ANT channel status
+  for( u8 i = 0; i < RED; i++ )
   {
-    frequency = note_freq_right;
+    LedOff( (LedNumberType)i );
   }
-  // Take the average of the two buzzer frequencies if both are non-zero
-  else if( ( note_freq_right != 0 ) && ( note_freq_left != 0 ) )
+
+  lit_led = NO_LED;
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
   {
-    frequency = ( note_freq_right + note_freq_left ) / 2;
+    spectrum_notes[i] = SILENT_NOTE;
   }
 
-  // Determine which LED to turn on
-  // If frequency is 0 (both buzzers off), then it should not turn an LED on
-  if( frequency != 0 )
+  led_display = display;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerGetLedDisplay
+
+Description:
+  Returns what the LEDs show.
+*/
+MusicLedDisplayType MusicPlayerGetLedDisplay(void)
+{
+  return led_display;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if( !MUSIC_PLAYER_TIMER_SEQUENCER )
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PlayNote
+
+Description:
+  Runs the algorithm that determines which note to play on each buzzer and for how long.
+  Only called by the state machine when a note edge is due, so the PWM registers are only
+  written when a buzzer's note actually changes.
+*/
+static void PlayNote(void)
+{
+  bool note_changed = FALSE;
+  u8 note;
+
+  // Step every voice up to now, edges that were missed while the main loop was busy are caught up
+  while( (s32)( G_u32SystemTime1ms - next_note_edge_time ) >= 0 )
   {
-    if( frequency < LED_WHITE_FREQ_THRESHOLD )
-    {
-      led_to_turn_on = WHITE;
-    }
-    else if( frequency < LED_PURPLE_FREQ_THRESHOLD )
-    {
-      led_to_turn_on = PURPLE;
-    }
-    else if( frequency < LED_BLUE_FREQ_THRESHOLD )
+    // A song streamed from the SD card waits here if the card falls behind, then catches up the same way
+    if( IS_STREAMED_SONG( song_index ) && !SongStreamIsNoteReady() )
     {
-      led_to_turn_on = BLUE;
+      break;
     }
-    else if( frequency < LED_CYAN_FREQ_THRESHOLD )
-    {
-      led_to_turn_on = CYAN;
-    }
-    else if( frequency < LED_GREEN_FREQ_THRESHOLD )
+
+    AdvanceVoices( next_note_edge_time );
+    next_note_edge_time = GetNextNoteEdgeTime();
+  }
+
+  // Play each buzzer's new note
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
+  {
+    note = GetBuzzerNote( i );
+
+    if( note != buzzer_notes[i] )
     {
-      led_to_turn_on = GREEN;
+      buzzer_notes[i] = note;
+      SetBuzzerPeriod( buzzer_channels[i], note_period_table[note] );
+      note_changed = TRUE;
     }
-    else if( frequency < LED_YELLOW_FREQ_THRESHOLD )
+  }
+
+  // LED control
+  if( note_changed )
+  {
+    ShowNotesOnLeds( buzzer_notes[0], buzzer_notes[1] );
+  }
+
+  ScheduleNextNoteEdge();
+}
+#endif /* !MUSIC_PLAYER_TIMER_SEQUENCER */
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: StartSongCursor
+
+Description:
+  Points a voice's cursor at the start of its playlist.
+  The cursor is left at the end of the last phrase so the first decode wraps around to the first one.
+*/
+static void StartSongCursor(SongCursorType* cursor, const PhraseRefType* playlist, u16 playlist_size)
+{
+  cursor->playlist = playlist;
+  cursor->playlist_size = playlist_size;
+  cursor->playlist_index = playlist_size - 1;
+  cursor->repeats_left = 0;
+  cursor->phrase_offset = 0;
+  cursor->phrase_end = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: DecodeNextNote
+
+Description:
+  Decodes a voice's next note straight out of the song's phrase table in flash.
+  At the end of a phrase it either plays the phrase again or moves on to the next playlist entry,
+  wrapping back to the start at the end of the song. See songs.h for the format.
+  Returns the duration of the new note.
+*/
+static u16 DecodeNextNote(const SongInfoType* song, SongCursorType* cursor, u8* note)
+{
+  const PhraseType* phrase;
+  u16 note_duration = 0;
+  u8 duration_byte;
+
+  if( cursor->phrase_offset >= cursor->phrase_end )
+  {
+    // Move on to the next playlist entry once the phrase has been repeated enough
+    if( cursor->repeats_left != 0 )
     {
-      led_to_turn_on = YELLOW;
+      cursor->repeats_left--;
     }
     else
     {
-      led_to_turn_on = ORANGE;
+      if( ++cursor->playlist_index >= cursor->playlist_size )
+      {
+        cursor->playlist_index = 0;
+      }
+
+      cursor->repeats_left = cursor->playlist[cursor->playlist_index].repeat - 1;
     }
+
+    phrase = &song->phrases[cursor->playlist[cursor->playlist_index].phrase];
+    cursor->phrase_offset = phrase->offset;
+    cursor->phrase_end = phrase->offset + phrase->size;
   }
 
-  // LEDs are ENUMs in the same order as how its tied on the board
-  // Skip the red LED since they represent ANT channel status
-  for( u8 i = 0; i < RED; i++ )
+  *note = song->phrase_events[cursor->phrase_offset++];
+
+  // Duration is 7 bits per byte, most significant first, until a byte without the top bit set
+  do
+  {
+    duration_byte = song->phrase_events[cursor->phrase_offset++];
+    note_duration = ( note_duration << 7 ) | ( duration_byte & 0x7F );
+  } while( duration_byte & 0x80 );
+
+  return note_duration;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FindSeekPoint
+
+Description:
+  Binary searches a voice's seek points for the last one at or before a song position.
+  The first seek point is at position 0, so there always is one.
+*/
+static const SeekPointType* FindSeekPoint(const VoiceType* voice, u32 position)
+{
+  u16 low = 0;
+  u16 high = voice->num_seek_points - 1;
+  u16 middle;
+
+  while( low < high )
   {
-    if( i == led_to_turn_on )
+    middle = low + ( ( high - low + 1 ) / 2 );
+
+    if( voice->seek_points[middle].position <= position )
     {
-      LED_ON( (LedNumberType)i );
+      low = middle;
     }
     else
     {
-      LedOff( (LedNumberType)i );
+      high = middle - 1;
     }
   }
+
+  return &voice->seek_points[low];
 }
 
-/**********************************************************************************************************************
-State Machine Function Definitions
-**********************************************************************************************************************/
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SeekVoice
 
-/*-------------------------------------------------------------------------------------------------------------------*/
-/* Plays the current song. */
-static void MusicPlayerSM_Play(void)
+Description:
+  Points a voice's cursor at the seek point before a song position, then decodes notes from there until
+  the one playing at the position, which becomes the voice's current note.
+*/
+static void SeekVoice(const SongInfoType* song, u8 voice_index, u32 position)
 {
-  // Play the next note
-  PlayNote();
+  const SeekPointType* seek_point = FindSeekPoint( &song->voices[voice_index], position );
+  VoiceStateType* voice = &voices[voice_index];
+  SongCursorType* cursor = &voice->cursor;
+  const PhraseType* phrase;
+
+  cursor->playlist_index = seek_point->playlist_index;
+  cursor->repeats_left = seek_point->repeats_left;
+  phrase = &song->phrases[cursor->playlist[cursor->playlist_index].phrase];
+  cursor->phrase_offset = seek_point->phrase_offset;
+  cursor->phrase_end = phrase->offset + phrase->size;
+
+  voice->note_end_position = seek_point->position;
+  do
+  {
+    voice->note_end_position += DecodeNextNote( song, cursor, &voice->note );
+  } while( voice->note_end_position <= position );
+}
 
-  // Button 0 pauses the music
-  if( WasButtonPressed( BUTTON0 ) )
+/*----------------------------------------------------------------------------------------------------------------------
+Function: AdvanceVoices
+
+Description:
+  Moves every voice whose note ends at edge_time on to its next note, and takes the next arpeggio step if it is due.
+  Each new note starts exactly where the previous one ended so note timing does not drift.
+*/
+static void AdvanceVoices(u32 edge_time)
+{
+  const SongInfoType* song = IS_STREAMED_SONG( song_index ) ? NULL : song_list[song_index];
+  VoiceStateType* voice;
+
+  for( u8 i = 0; i < num_voices; i++ )
   {
-    ButtonAcknowledge( BUTTON0 );
-    MusicPlayer_StateMachine = MusicPlayerSM_Pause;
+    voice = &voices[i];
+
+    if( ( voice->note_start_time + voice->note_duration ) == edge_time )
+    {
+      // Move the tempo origin up to this edge now and then so the scaling never overflows
+      if( ( voice->note_end_position - tempo_origin_position ) >= TEMPO_REBASE_MS )
+      {
+        tempo_origin_time = edge_time;
+        tempo_origin_position = voice->note_end_position;
+      }
+
+      voice->note_start_time = edge_time;
+      if( song == NULL )
+      {
+        voice->note_end_position += SongStreamGetNextNote( i, &voice->note );
+      }
+      else
+      {
+        voice->note_end_position += DecodeNextNote( song, &voice->cursor, &voice->note );
+      }
+      voice->note_duration = GetTempoTime( voice->note_end_position ) - edge_time;
+    }
   }
 
-  // Button 1 goes to "previous" song
-  if( WasButtonPressed( BUTTON1 ) )
+  if( ( num_voices > NUM_BUZZERS ) && ( ( arpeggio_timer + ARPEGGIO_STEP_MS ) == edge_time ) )
   {
-    ButtonAcknowledge( BUTTON1 );
-    PreviousSong();
+    arpeggio_timer = edge_time;
+    arpeggio_step++;
   }
+}
 
-  // Button 2 goes to "next" song
-  if( WasButtonPressed( BUTTON2 ) )
-  {
-    ButtonAcknowledge( BUTTON2 );
-    NextSong();
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetNextNoteEdgeTime
+
+Description:
+  Returns the time of the next note edge: whichever voice's note ends first, or the next arpeggio step
+  if the song has more voices than buzzers.
+*/
+static u32 GetNextNoteEdgeTime(void)
+{
+  u32 next_edge_time = voices[0].note_start_time + voices[0].note_duration;
+  u32 edge_time;
+
+  for( u8 i = 1; i < num_voices; i++ )
+  {
+    edge_time = voices[i].note_start_time + voices[i].note_duration;
+
+    if( (s32)( edge_time - next_edge_time ) < 0 )
+    {
+      next_edge_time = edge_time;
+    }
   }
+
+  if( num_voices > NUM_BUZZERS )
+  {
+    edge_time = arpeggio_timer + ARPEGGIO_STEP_MS;
+
+    if( (s32)( edge_time - next_edge_time ) < 0 )
+    {
+      next_edge_time = edge_time;
+    }
+  }
+
+  return next_edge_time;
 }
 
-/*-------------------------------------------------------------------------------------------------------------------*/
-/* Turns buzzers off, and waits for prompt to go back to play. */
-static void MusicPlayerSM_Pause(void)
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetTempoTime
+
+Description:
+  Returns the time when the song reaches a position (in ms as written) at the current tempo.
+*/
+static u32 GetTempoTime(u32 position)
+{
+  return tempo_origin_time + ( ( ( position - tempo_origin_position ) * tempo_scale ) >> TEMPO_SCALE_SHIFT );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetBuzzerNote
+
+Description:
+  Returns the note a buzzer should be playing. Voices are shared out between the buzzers in turn.
+  If more than one of a buzzer's voices is sounding, the buzzer takes turns playing each of their notes.
+*/
+static u8 GetBuzzerNote(u8 buzzer)
+{
+  u8 sounding_notes[MAX_VOICES];
+  u8 num_sounding = 0;
+
+  for( u8 i = buzzer; i < num_voices; i += NUM_BUZZERS )
+  {
+    if( voices[i].note != SILENT_NOTE )
+    {
+      sounding_notes[num_sounding++] = voices[i].note;
+    }
+  }
+
+  if( num_sounding == 0 )
+  {
+    return SILENT_NOTE;
+  }
+
+  return sounding_notes[arpeggio_step % num_sounding];
+}
+
+#if( !MUSIC_PLAYER_TIMER_SEQUENCER )
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ScheduleNextNoteEdge
+
+Description:
+  Computes how long until the next note edge.
+  The state machine skips playback completely until that time is up.
+*/
+static void ScheduleNextNoteEdge(void)
+{
+  note_edge_timer = G_u32SystemTime1ms;
+  time_to_next_note_edge = next_note_edge_time - G_u32SystemTime1ms;
+
+  // Edge is already due if a streamed song is waiting on the SD card, so try again on the next pass
+  if( (s32)time_to_next_note_edge < 0 )
+  {
+    time_to_next_note_edge = 0;
+  }
+}
+#endif /* !MUSIC_PLAYER_TIMER_SEQUENCER */
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SetBuzzerPeriod
+
+Description:
+  Plays a PWM period on a buzzer. A period of zero is a rest and turns the buzzer off.
+  Also used from the timer interrupt so it must not do any division.
+*/
+static void SetBuzzerPeriod(u32 buzzer, u16 period)
 {
-  // Turn buzzers off
+  if( period == 0 )
+  {
+    PWMAudioOff( buzzer );
+  }
+  else
+  {
+    PWMAudioSetPeriod( buzzer, period );
+    PWMAudioOn( buzzer );
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ResetBuzzerVariables
+
+Description:
+  Resets variables for the buzzer.
+  Called when a song is switched, or on initialization.
+*/
+static void ResetBuzzerVariables(void)
+{
+  const SongInfoType* song = IS_STREAMED_SONG( song_index ) ? NULL : song_list[song_index];
+
+  num_voices = ( song == NULL ) ? SongStreamGetNumVoices() : song->num_voices;
+  if( num_voices > MAX_VOICES )
+  {
+    num_voices = MAX_VOICES;
+  }
+
+  // First note of every voice is due immediately
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    // Streamed voices are read from the start of the song by song_stream.c
+    if( song != NULL )
+    {
+      StartSongCursor( &voices[i].cursor, song->voices[i].playlist, song->voices[i].playlist_size );
+    }
+
+    voices[i].note_start_time = G_u32SystemTime1ms;
+    voices[i].note_duration = 0;
+    voices[i].note_end_position = 0;
+    voices[i].note = SILENT_NOTE;
+  }
+
+  // Song starts from the top at the tempo already chosen
+  tempo_origin_time = G_u32SystemTime1ms;
+  tempo_origin_position = 0;
+
+  arpeggio_timer = G_u32SystemTime1ms;
+  arpeggio_step = 0;
+
+  // Buzzers only get written when their note changes, so start them from silence
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
+  {
+    buzzer_notes[i] = SILENT_NOTE;
+    spectrum_notes[i] = SILENT_NOTE;
+    PWMAudioOff( buzzer_channels[i] );
+  }
+
+  next_note_edge_time = G_u32SystemTime1ms;
+  note_edge_timer = G_u32SystemTime1ms;
+  time_to_next_note_edge = 0;
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  // Drop anything still queued for the previous song
+  TimerStop( TIMER_CHANNEL1 );
+  note_event_count[0] = 0;
+  note_event_count[1] = 0;
+  note_event_play_buffer = 0;
+  note_event_play_index = 0;
+  note_event_fill_buffer = 0;
+  note_event_ticks_remaining = 0;
+
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
+  {
+    sequencer_notes[i] = SILENT_NOTE;
+    sequencer_periods[i] = 0;
+  }
+
+  sequencer_underrun = TRUE;
+  sequencer_time = G_u32SystemTime1ms;
+  sequencer_position = 0;
+  sequencer_position_time = G_u32SystemTime1ms;
+  sequencer_pause_ticks = 0;
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PauseSong
+
+Description:
+  Turns the buzzers off and remembers when the song was paused so it can resume from the same spot.
+*/
+static void PauseSong(void)
+{
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  // Remember how far into the current timer period we were
+  TimerStop( TIMER_CHANNEL1 );
+  sequencer_pause_ticks = (u16)( AT91C_BASE_TC1->TC_RC - TimerGetTime( TIMER_CHANNEL1 ) );
+  if( sequencer_pause_ticks == 0 )
+  {
+    sequencer_pause_ticks = 1;
+  }
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
   PWMAudioOff( BUZZER1 );
   PWMAudioOff( BUZZER2 );
 
-  // Button 0 plays music again
-  if( WasButtonPressed( BUTTON0 ) )
+  pause_start_time = G_u32SystemTime1ms;
+  MusicPlayer_StateMachine = MusicPlayerSM_Pause;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ResumeSong
+
+Description:
+  Shifts the note timers by the time spent paused and restores the notes that were playing.
+*/
+static void ResumeSong(void)
+{
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  // Song time only advances through the queued events, so just restore the notes and restart the timer.
+  // The song position goes on from the last edge played as if the pause had not happened.
+  sequencer_position_time += G_u32SystemTime1ms - pause_start_time;
+
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
   {
-    ButtonAcknowledge( BUTTON0 );
-    MusicPlayer_StateMachine = MusicPlayerSM_Play;
+    SetBuzzerPeriod( buzzer_channels[i], sequencer_periods[i] );
   }
 
-  // Button 1 goes to "previous" song
+  // Nothing to resume if the interrupt had already stopped, the play state restarts it
+  if( !sequencer_underrun )
+  {
+    TimerSet( TIMER_CHANNEL1, sequencer_pause_ticks );
+    TimerStart( TIMER_CHANNEL1 );
+  }
+
+  MusicPlayer_StateMachine = MusicPlayerSM_Play;
+#else
+  u32 time_paused = G_u32SystemTime1ms - pause_start_time;
+
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    voices[i].note_start_time += time_paused;
+  }
+
+  arpeggio_timer += time_paused;
+  tempo_origin_time += time_paused;
+  next_note_edge_time += time_paused;
+  note_edge_timer += time_paused;
+
+  // Notes are all silent if the song had not started yet
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
+  {
+    SetBuzzerPeriod( buzzer_channels[i], note_period_table[buzzer_notes[i]] );
+  }
+
+  MusicPlayer_StateMachine = MusicPlayerSM_Play;
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+}
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FillNoteEvents
+
+Description:
+  Refills whichever note event buffers the timer interrupt has finished with, using the upcoming
+  note edges in time order. PWM periods are looked up here in the main loop so the interrupt
+  only has to copy them into the PWM update registers.
+*/
+static void FillNoteEvents(void)
+{
+  NoteEventType* event;
+  u32 event_time;
+  u8 note;
+  u8 i;
+
+  // Buffers are filled strictly in turn so the interrupt always finds them in time order
+  while( note_event_count[note_event_fill_buffer] == 0 )
+  {
+    for( i = 0; i < NOTE_EVENT_BUFFER_SIZE; i++ )
+    {
+      // A song streamed from the SD card only queues the edges whose notes have been read so far
+      if( IS_STREAMED_SONG( song_index ) && !SongStreamIsNoteReady() )
+      {
+        break;
+      }
+
+      event_time = next_note_edge_time;
+      AdvanceVoices( event_time );
+      next_note_edge_time = GetNextNoteEdgeTime();
+
+      event = &note_event_buffers[note_event_fill_buffer][i];
+      event->delay_ticks = ( event_time - sequencer_time ) * NOTE_TIMER_TICKS_PER_MS;
+      event->position = tempo_origin_position + ( ( ( event_time - tempo_origin_time ) << TEMPO_SCALE_SHIFT ) / tempo_scale );
+      event->tempo_scale = tempo_scale;
+      event->buzzers_changed = 0;
+
+      for( u8 j = 0; j < NUM_BUZZERS; j++ )
+      {
+        note = GetBuzzerNote( j );
+
+        if( note != buzzer_notes[j] )
+        {
+          buzzer_notes[j] = note;
+          event->notes[j] = note;
+          event->periods[j] = note_period_table[note];
+          event->buzzers_changed |= ( 1 << j );
+        }
+      }
+
+      sequencer_time = event_time;
+    }
+
+    // Nothing to hand over until the card catches up
+    if( i == 0 )
+    {
+      return;
+    }
+
+    // Buffer is only handed to the interrupt once it is filled in
+    note_event_count[note_event_fill_buffer] = i;
+    note_event_fill_buffer ^= 1;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: StartSequencer
+
+Description:
+  Starts the timer interrupt on the delay of the next queued event.
+  Used at the start of a song and to recover after the interrupt ran out of events.
+*/
+static void StartSequencer(void)
+{
+  // Song position stood still at the last edge played until now
+  sequencer_position_time = G_u32SystemTime1ms;
+  sequencer_underrun = FALSE;
+  LoadNextEventDelay();
+  TimerStart( TIMER_CHANNEL1 );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LoadNextEventDelay
+
+Description:
+  Loads the timer with the delay until the next queued event.
+  Delays too long for the 16-bit timer are split up and counted down over several interrupts.
+*/
+static void LoadNextEventDelay(void)
+{
+  NoteEventType* event = &note_event_buffers[note_event_play_buffer][note_event_play_index];
+  u32 ticks = event->delay_ticks;
+
+  // Song plays up to this event at the tempo it was queued at
+  sequencer_tempo_scale = event->tempo_scale;
+
+  // Timer must be given at least one tick
+  if( ticks == 0 )
+  {
+    ticks = 1;
+  }
+
+  if( ticks > NOTE_TIMER_MAX_TICKS )
+  {
+    note_event_ticks_remaining = ticks - NOTE_TIMER_MAX_TICKS;
+    ticks = NOTE_TIMER_MAX_TICKS;
+  }
+  else
+  {
+    note_event_ticks_remaining = 0;
+  }
+
+  TimerSet( TIMER_CHANNEL1, (u16)ticks );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MusicPlayerTimerCallback
+
+Description:
+  TC1 interrupt callback. Plays the queued note event that is now due and loads the delay until the next one.
+  Since TC1 resets on every RC compare, each delay is measured from the previous edge and timing cannot drift.
+*/
+static void MusicPlayerTimerCallback(void)
+{
+  NoteEventType* event;
+  u32 ticks;
+
+  // Still counting down a long delay
+  if( note_event_ticks_remaining != 0 )
+  {
+    ticks = note_event_ticks_remaining;
+
+    if( ticks > NOTE_TIMER_MAX_TICKS )
+    {
+      ticks = NOTE_TIMER_MAX_TICKS;
+    }
+
+    note_event_ticks_remaining -= ticks;
+    TimerSet( TIMER_CHANNEL1, (u16)ticks );
+    return;
+  }
+
+  // Play the event that is due
+  event = &note_event_buffers[note_event_play_buffer][note_event_play_index];
+  sequencer_position = event->position;
+  sequencer_position_time = G_u32SystemTime1ms;
+
+  if( event->buzzers_changed != 0 )
+  {
+    for( u8 i = 0; i < NUM_BUZZERS; i++ )
+    {
+      if( event->buzzers_changed & ( 1 << i ) )
+      {
+        sequencer_notes[i] = event->notes[i];
+        sequencer_periods[i] = event->periods[i];
+        SetBuzzerPeriod( buzzer_channels[i], event->periods[i] );
+      }
+    }
+
+    sequencer_edge_count++;
+  }
+
+  // Hand a finished buffer back to the main loop and move on to the other one
+  if( ++note_event_play_index >= note_event_count[note_event_play_buffer] )
+  {
+    note_event_count[note_event_play_buffer] = 0;
+    note_event_play_buffer ^= 1;
+    note_event_play_index = 0;
+
+    // Main loop fell behind and there is nothing left to play
+    if( note_event_count[note_event_play_buffer] == 0 )
+    {
+      TimerStop( TIMER_CHANNEL1 );
+      sequencer_underrun = TRUE;
+      return;
+    }
+  }
+
+  LoadNextEventDelay();
+}
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PreviousSong
+
+Description:
+  Handles the case of playing the song previous to the current song.
+  Changes song index, resets variables, and automatically play the song
+*/
+static void PreviousSong(void)
+{
+  // Step on from the song still loading if there is one
+  u16 index = MusicPlayerGetSelectedSongIndex();
+
+  // If currently playing first song of the list, wrap back around to end of list
+  if( index == 0 )
+  {
+    index = GetSongCount() - 1;
+  }
+  else
+  {
+    index--;
+  }
+
+  StartSong( index );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: NextSong
+
+Description:
+  Handles the case of playing the song next to the current song.
+  Changes song index, resets variables, and automatically play the song.
+*/
+static void NextSong(void)
+{
+  // Step on from the song still loading if there is one
+  u16 index = MusicPlayerGetSelectedSongIndex();
+
+  // If currently playing last song of the list, wrap back around to beginning of list
+  if( index >= ( GetSongCount() - 1 ) )
+  {
+    index = 0;
+  }
+  else
+  {
+    index++;
+  }
+
+  StartSong( index );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: StartSong
+
+Description:
+  Plays a song from the start. Songs in flash start straight away; songs on the SD card are loaded first,
+  with the buzzers off, and start from the load state once their first sectors are in.
+*/
+static void StartSong(u16 index)
+{
+  if( IS_STREAMED_SONG( index ) )
+  {
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+    TimerStop( TIMER_CHANNEL1 );
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+    PWMAudioOff( BUZZER1 );
+    PWMAudioOff( BUZZER2 );
+
+    loading_song_index = index;
+    SongStreamOpen( index - SONG_LIST_SIZE );
+    MusicPlayer_StateMachine = MusicPlayerSM_Load;
+    return;
+  }
+
+  song_index = index;
+
+  // Reset relevant variables
+  ResetBuzzerVariables();
+
+  // Automatically move to new state
+  MusicPlayer_StateMachine = MusicPlayerSM_Play;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetSongCount
+
+Description:
+  Returns the number of songs that can be played: the ones in flash and the ones on the SD card.
+*/
+static u16 GetSongCount(void)
+{
+  return SONG_LIST_SIZE + SongStreamGetSongCount();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: IsSeekable
+
+Description:
+  Returns TRUE if the current song can be seeked: it is in flash, with its seek points, and not being replaced
+  by a song still loading from the SD card. Songs on the card are streamed straight through.
+*/
+static bool IsSeekable(void)
+{
+  return ( MusicPlayer_StateMachine != MusicPlayerSM_Load ) && !IS_STREAMED_SONG( song_index );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: HandleSongButtons
+
+Description:
+  Button 1 and button 2 go to the previous and next song when they are pressed and let go. Held down for
+  SKIP_HOLD_MS, they skip back and forward through the song instead, and keep skipping every SKIP_REPEAT_MS
+  until they are let go.
+*/
+static void HandleSongButtons(void)
+{
+  // A new press of either button takes over from the other one
   if( WasButtonPressed( BUTTON1 ) )
   {
     ButtonAcknowledge( BUTTON1 );
-    PreviousSong();
+    song_button = BUTTON1;
+    song_button_timer = G_u32SystemTime1ms;
+    song_button_skipped = FALSE;
   }
 
-  // Button 2 goes to "next" song
   if( WasButtonPressed( BUTTON2 ) )
   {
     ButtonAcknowledge( BUTTON2 );
-    NextSong();
+    song_button = BUTTON2;
+    song_button_timer = G_u32SystemTime1ms;
+    song_button_skipped = FALSE;
+  }
+
+  if( song_button == NO_SONG_BUTTON )
+  {
+    return;
+  }
+
+  if( !IsButtonPressed( song_button ) )
+  {
+    // Let go before it skipped, so change song
+    if( !song_button_skipped )
+    {
+      if( song_button == BUTTON1 )
+      {
+        PreviousSong();
+      }
+      else
+      {
+        NextSong();
+      }
+    }
+
+    song_button = NO_SONG_BUTTON;
+  }
+  else if( IsTimeUp( &song_button_timer, song_button_skipped ? SKIP_REPEAT_MS : SKIP_HOLD_MS ) )
+  {
+    song_button_timer = G_u32SystemTime1ms;
+    song_button_skipped = TRUE;
+
+    if( song_button == BUTTON1 )
+    {
+      MusicPlayerSkipBack();
+    }
+    else
+    {
+      MusicPlayerSkipForward();
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: StepTempo
+
+Description:
+  Speeds the tempo up by one button step, wrapping back around to the slowest button tempo after the fastest.
+*/
+static void StepTempo(void)
+{
+  if( tempo >= TEMPO_BUTTON_MAX )
+  {
+    MusicPlayerSetTempo( TEMPO_BUTTON_MIN );
+  }
+  else
+  {
+    MusicPlayerSetTempo( tempo + TEMPO_BUTTON_STEP );
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ShowNotesOnLeds
+
+Description:
+  Shows the notes playing on the right and left buzzers on the LED display chosen.
+  Called on every note edge.
+*/
+static void ShowNotesOnLeds(u8 note_right, u8 note_left)
+{
+  if( led_display == MUSIC_LED_SPECTRUM )
+  {
+    FlashSpectrumLeds( note_right, note_left );
+  }
+  else
+  {
+    FlashLed( note_freq_table[note_right], note_freq_table[note_left] );
   }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FlashLed
+
+Description:
+  Flashes an LED based on which notes are being played.
+  If one frequency is zero, and the other is non-zero, the zero frequency is ignored.
+  If both buzzers frequencies are non-zero, then the frequency is averaged.
+  The resulting frequency will be used to determine which LED should be flashed.
+  Only the LED that was lit and the one to light are written, and neither if they are the same.
+*/
+static void FlashLed(u16 note_freq_right, u16 note_freq_left)
+{
+  u8  led_to_turn_on = NO_LED;
+  u32 frequency_sum;
+
+  // A lone note counts twice, the same as averaging it with itself
+  if( note_freq_right == 0 )
+  {
+    note_freq_right = note_freq_left;
+  }
+  else if( note_freq_left == 0 )
+  {
+    note_freq_left = note_freq_right;
+  }
+
+  // If both buzzers are off, then it should not turn an LED on
+  frequency_sum = (u32)note_freq_right + note_freq_left;
+  if( frequency_sum != 0 )
+  {
+    frequency_sum /= LED_FREQ_SUM_STEP;
+    led_to_turn_on = led_freq_sum_table[ ( frequency_sum < LED_FREQ_SUM_STEPS ) ? frequency_sum : LED_FREQ_SUM_STEPS ];
+  }
+
+  if( led_to_turn_on == lit_led )
+  {
+    return;
+  }
+
+  if( lit_led != NO_LED )
+  {
+    LedOff( (LedNumberType)lit_led );
+  }
+
+  if( led_to_turn_on != NO_LED )
+  {
+    LED_ON( (LedNumberType)led_to_turn_on );
+  }
+
+  lit_led = led_to_turn_on;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: FlashSpectrumLeds
+
+Description:
+  Starts the LED of each buzzer's new note fading from that note's level in note_led_table.
+  Notes that have not changed are left to fade, and rests light nothing, so each LED dies away on its own.
+  Both buzzers playing in the same half octave share its LED, which restarts from the later note.
+*/
+static void FlashSpectrumLeds(u8 note_right, u8 note_left)
+{
+  const u8 notes[NUM_BUZZERS] = { note_right, note_left };
+  const NoteLedType* note_led;
+
+  for( u8 i = 0; i < NUM_BUZZERS; i++ )
+  {
+    if( notes[i] == spectrum_notes[i] )
+    {
+      continue;
+    }
+
+    spectrum_notes[i] = notes[i];
+    note_led = &note_led_table[notes[i]];
+    if( note_led->led != NO_LED )
+    {
+      LedFade( (LedNumberType)note_led->led, (LedRateType)note_led->level, LED_SPECTRUM_FADE_STEP_MS );
+    }
+  }
+}
+
+/**********************************************************************************************************************
+State Machine Function Definitions
+**********************************************************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Plays the current song. */
+static void MusicPlayerSM_Play(void)
+{
+  // SD card was taken out or could not be read, so go back to the first song in flash
+  if( IS_STREAMED_SONG( song_index ) && ( SongStreamGetStatus() != SONG_STREAM_OPEN ) )
+  {
+    StartSong( 0 );
+    PauseSong();
+    return;
+  }
+
+#if( MUSIC_PLAYER_TIMER_SEQUENCER )
+  // Keep the timer interrupt supplied with upcoming note edges
+  FillNoteEvents();
+
+  // Start of a song, or the interrupt ran out of events
+  if( sequencer_underrun )
+  {
+    StartSequencer();
+  }
+
+  // LED control
+  if( sequencer_edges_shown != sequencer_edge_count )
+  {
+    sequencer_edges_shown = sequencer_edge_count;
+    ShowNotesOnLeds( sequencer_notes[0], sequencer_notes[1] );
+  }
+#else
+  // Play the next note only when a note edge is due
+  if( IsTimeUp( &note_edge_timer, time_to_next_note_edge ) )
+  {
+    PlayNote();
+  }
+#endif /* MUSIC_PLAYER_TIMER_SEQUENCER */
+
+  // Button 0 pauses the music
+  if( WasButtonPressed( BUTTON0 ) )
+  {
+    ButtonAcknowledge( BUTTON0 );
+    PauseSong();
+  }
+
+  // Buttons 1 and 2 go to the "previous" and "next" song, or skip back and forward when held
+  HandleSongButtons();
+
+  // Button 3 steps through the tempos
+  if( WasButtonPressed( BUTTON3 ) )
+  {
+    ButtonAcknowledge( BUTTON3 );
+    StepTempo();
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Buzzers are turned off on the way in, so just wait for prompt to go back to play. */
+static void MusicPlayerSM_Pause(void)
+{
+  // Button 0 plays music again
+  if( WasButtonPressed( BUTTON0 ) )
+  {
+    ButtonAcknowledge( BUTTON0 );
+    ResumeSong();
+  }
+
+  // Buttons 1 and 2 go to the "previous" and "next" song, or skip back and forward when held
+  HandleSongButtons();
+
+  // Button 3 steps through the tempos
+  if( WasButtonPressed( BUTTON3 ) )
+  {
+    ButtonAcknowledge( BUTTON3 );
+    StepTempo();
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Buzzers are turned off on the way in, wait for the SD card song to load then play it. */
+static void MusicPlayerSM_Load(void)
+{
+  SongStreamStatusType status = SongStreamGetStatus();
+
+  if( status == SONG_STREAM_OPEN )
+  {
+    song_index = loading_song_index;
+    ResetBuzzerVariables();
+    MusicPlayer_StateMachine = MusicPlayerSM_Play;
+    return;
+  }
+
+  // Song could not be read from the card, so go back to the first song in flash
+  if( status != SONG_STREAM_OPENING )
+  {
+    StartSong( 0 );
+    PauseSong();
+    return;
+  }
+
+  // Buttons 1 and 2 go to the "previous" and "next" song, or skip back and forward when held
+  HandleSongButtons();
 }
\ No newline at end of file
@@ -11,6 +11,12 @@ Date: February 9, 2018
 /**********************************************************************************************************************
 Type Definitions
 **********************************************************************************************************************/
+/* What the LEDs show while music plays */
+typedef enum
+{
+  MUSIC_LED_PITCH = 0,            /* One LED for the average pitch of both buzzers */
+  MUSIC_LED_SPECTRUM              /* Each buzzer's note on the LED of its half octave, fading after it starts */
+} MusicLedDisplayType;
 
 
 /**********************************************************************************************************************
@@ -23,11 +29,23 @@ Function Declarations
 **********************************************************************************************************************/
 void MusicPlayerInitialize(void);
 void MusicPlayerRunActiveState(void);
-u8 MusicPlayerGetCurrentSongIndex(void);
+u16 MusicPlayerGetCurrentSongIndex(void);
+u16 MusicPlayerGetSelectedSongIndex(void);
+bool MusicPlayerGetSongInfo(u16 index, const char** title, const char** artist);
 const char* MusicPlayerGetCurrentSongTitle(void);
 const char* MusicPlayerGetCurrentSongArtist(void);
 void MusicPlayerTogglePlayPause(void);
 void MusicPlayerPreviousSong(void);
 void MusicPlayerNextSong(void);
+bool MusicPlayerSeekMs(u32 position);
+u32 MusicPlayerGetPositionMs(void);
+u32 MusicPlayerGetLengthMs(void);
+bool MusicPlayerIsPaused(void);
+void MusicPlayerSkipForward(void);
+void MusicPlayerSkipBack(void);
+void MusicPlayerSetTempo(u16 new_tempo);
+u16 MusicPlayerGetTempo(void);
+void MusicPlayerSetLedDisplay(MusicLedDisplayType display);
+MusicLedDisplayType MusicPlayerGetLedDisplay(void);
 
 #endif /* __MUSIC_PLAYER_H */
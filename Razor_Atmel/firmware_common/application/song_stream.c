@@ -0,0 +1,951 @@
+/**********************************************************************************************************************
+File: song_stream.c
+Description: Module that streams songs from the SD card for the music player, so the song library is not
+             limited by what fits in flash. See song_stream.h for the card layout. The library is either
+             written straight onto the card from its first sector or kept in the file SONGS.LIB of a FAT32
+             card, whose sectors are found through fat32.c.
+------------------------------------------------------------------------------------------------------------------------
+API:
+
+Public functions:
+  - void SongStreamInitialize(void)
+      Runs required initialzation for the task. Should only be called once in main init section.
+
+  - void SongStreamRunActiveState(void)
+      Runs current task state. Should only be called once in main loop, before the music player.
+
+  - u16 SongStreamGetSongCount(void)
+      Returns the number of songs on the card, 0 if there is no card or no song library on it
+
+  - void SongStreamOpen(u16 song)
+      Starts loading a song from the card. Its notes can be read once SongStreamGetStatus() returns SONG_STREAM_OPEN.
+
+  - SongStreamStatusType SongStreamGetStatus(void)
+      Returns whether the song is still loading, ready to play, or could not be opened
+
+  - const char* SongStreamGetTitle(void)
+  - const char* SongStreamGetArtist(void)
+  - u8 SongStreamGetNumVoices(void)
+      Return the open song's information
+
+  - bool SongStreamIsNoteReady(void)
+      Returns TRUE if every voice's next note has been read from the card. Must be checked before reading notes.
+
+  - u16 SongStreamGetNextNote(u8 voice, u8* note)
+      Returns the duration of a voice's next note and the note itself in *note
+
+  - u32 SongStreamGetUnderruns(void)
+      Returns the number of times the player had to wait for the card
+
+  - void SongStreamRequestInfo(u16 song)
+      Starts reading a song's title and artist from the library's index, without opening the song
+
+  - bool SongStreamIsInfoReady(u16 song)
+      Returns TRUE once the title and artist of that song have been read
+
+  - const char* SongStreamGetInfoTitle(void)
+  - const char* SongStreamGetInfoArtist(void)
+      Return the title and artist read for SongStreamRequestInfo()
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Type Definitions
+***********************************************************************************************************************/
+/* One voice being streamed: the notes play out of one sector while the next sector is read. The sectors are
+   borrowed from the SD card driver's read buffers and given back as soon as they have been played. */
+typedef struct
+{
+  u8* buffers[2];                 /* Sectors lent by the SD card driver, NULL when given back */
+  u16 buffer_size[2];             /* Bytes of note events in each buffer, 0 when the buffer is free to be refilled */
+  u8  read_buffer;                /* Buffer notes are being read from */
+  u16 read_offset;                /* Offset of the next byte in that buffer */
+  u32 first_sector;               /* Sector of the voice's first note events, counted from the song header */
+  u32 num_sectors;                /* Sectors of note events */
+  u32 size;                       /* Bytes of note events */
+  u32 next_sector;                /* Next of the voice's sectors to be read, wraps around to 0 at the end of the song */
+  u8  fill_buffer;                /* Buffer the sector being read goes into */
+} VoiceStreamType;
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+***********************************************************************************************************************/
+static fnCode_type SongStream_StateMachine;     /* The state machine function pointer */
+
+/* Library variables */
+static u16 song_count = 0;                      /* Songs on the card */
+static bool library_in_file = FALSE;            /* Set when the library is SONGS.LIB on a FAT32 card */
+static u32 records_sector;                      /* First sector of the song index, counted from the library header */
+static u32 strings_sector;                      /* First sector of the titles and artists */
+static u8 index_cache[SONG_STREAM_SECTOR_SIZE]; /* Last sector of the song index read, so nearby songs need no read */
+static u32 index_cache_sector = SONG_STREAM_NO_SECTOR;
+static u16 record_song;                         /* Song whose index record is being looked up */
+static fnCode_type record_done_state;           /* State to go to once the record is in index_cache */
+
+/* Open song variables */
+static SongStreamStatusType stream_status = SONG_STREAM_CLOSED;
+static bool open_requested = FALSE;             /* Set by SongStreamOpen() until the state machine starts loading the song */
+static u16 open_song = 0;                       /* Song being opened or played */
+static u32 song_sector;                         /* First sector of that song, counted from the library header */
+static char title[SONG_STREAM_TEXT_SIZE];
+static char artist[SONG_STREAM_TEXT_SIZE];
+static u8 num_voices = 0;
+static VoiceStreamType voice_streams[SONG_STREAM_MAX_VOICES];
+static VoiceStreamType* filling_voice = NULL;   /* Voice whose sector is being read */
+static u32 underruns = 0;                       /* Times the player found a voice with no note ready */
+static bool underrun = FALSE;                   /* Set while the player is waiting on the card */
+
+/* Song info variables */
+static bool info_requested = FALSE;             /* Set by SongStreamRequestInfo() until the state machine starts reading */
+static bool info_reading = FALSE;               /* Set while the title and artist are being read */
+static u16 info_song;                           /* Song asked for */
+static u16 info_ready_song = SONG_STREAM_NO_SONG; /* Song whose title and artist are in info_title and info_artist */
+static u32 info_title_offset;                   /* Offsets in the strings of the title and artist being read */
+static u32 info_artist_offset;
+static char info_title[SONG_STREAM_TEXT_SIZE];
+static char info_artist[SONG_STREAM_TEXT_SIZE];
+
+/* Sector read variables */
+static u32 read_sector;                         /* Card sector being read */
+static u8* read_data = NULL;                    /* Sector lent by the SD card driver once it has been read */
+static fnCode_type read_done_state;             /* State to go to once the sector is in */
+static bool read_started = FALSE;               /* Set once the card has accepted the read */
+
+/***********************************************************************************************************************
+Local functions
+***********************************************************************************************************************/
+static void ReadSector(u32 sector, fnCode_type done_state);
+static bool IsCardReady(void);
+static void CloseLibrary(void);
+static void ReleaseVoiceBuffers(void);
+static void LoadSongHeader(void);
+static void ReadSongRecord(u16 song, fnCode_type done_state);
+static const u8* GetSongRecord(void);
+static void CopyString(char* text, u32 offset);
+static VoiceStreamType* GetVoiceToFill(void);
+static u8 ReadVoiceByte(VoiceStreamType* voice);
+static u16 ReadU16(const u8* bytes);
+static u32 ReadU32(const u8* bytes);
+
+/***********************************************************************************************************************
+State Machine Declarations
+***********************************************************************************************************************/
+static void SongStreamSM_WaitCard(void);
+static void SongStreamSM_ReadSector(void);
+static void SongStreamSM_LibraryRead(void);
+static void SongStreamSM_OpenLibraryFile(void);
+static void SongStreamSM_Idle(void);
+static void SongStreamSM_RecordRead(void);
+static void SongStreamSM_OpenRecordFound(void);
+static void SongStreamSM_HeaderRead(void);
+static void SongStreamSM_InfoRecordFound(void);
+static void SongStreamSM_InfoTitleRead(void);
+static void SongStreamSM_InfoArtistRead(void);
+static void SongStreamSM_VoiceSectorRead(void);
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SongStreamInitialize
+
+Description:
+  Initializes the State Machine and its variables.
+*/
+void SongStreamInitialize(void)
+{
+  CloseLibrary();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamRunActiveState
+
+Description:
+  Selects and runs one iteration of the current state in the state machine.
+  All state machines have a TOTAL of 1ms to execute, so on average n state machines
+  may take 1ms / n to execute.
+*/
+void SongStreamRunActiveState(void)
+{
+  SongStream_StateMachine();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetSongCount
+
+Description:
+  Returns the number of songs in the card's library.
+*/
+u16 SongStreamGetSongCount(void)
+{
+  return song_count;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamOpen
+
+Description:
+  Requests a song to be loaded. Whatever was playing stops being read straight away. The song is found through
+  its record in the library's index, then the song header and the first two sectors of every voice are read
+  before the song is reported open.
+*/
+void SongStreamOpen(u16 song)
+{
+  if( song >= song_count )
+  {
+    stream_status = SONG_STREAM_FAILED;
+    return;
+  }
+
+  open_song = song;
+  open_requested = TRUE;
+  stream_status = SONG_STREAM_OPENING;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetStatus
+
+Description:
+  Returns the status of the song requested with SongStreamOpen().
+*/
+SongStreamStatusType SongStreamGetStatus(void)
+{
+  return stream_status;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetTitle
+
+Description:
+  Returns the title of the open song.
+*/
+const char* SongStreamGetTitle(void)
+{
+  return title;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetArtist
+
+Description:
+  Returns the artist of the open song.
+*/
+const char* SongStreamGetArtist(void)
+{
+  return artist;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetNumVoices
+
+Description:
+  Returns the number of voices of the open song.
+*/
+u8 SongStreamGetNumVoices(void)
+{
+  return num_voices;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamIsNoteReady
+
+Description:
+  Returns TRUE if the next note of every voice can be read without waiting for the card: either a whole note
+  event is left in the buffer being read, or the next sector is already in the other buffer.
+  Each time the player finds it has to wait counts as one underrun.
+*/
+bool SongStreamIsNoteReady(void)
+{
+  VoiceStreamType* voice;
+
+  if( stream_status != SONG_STREAM_OPEN )
+  {
+    return FALSE;
+  }
+
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    voice = &voice_streams[i];
+
+    if( ( ( voice->buffer_size[voice->read_buffer] - voice->read_offset ) < SONG_STREAM_MAX_EVENT_BYTES ) &&
+        ( voice->buffer_size[voice->read_buffer ^ 1] == 0 ) )
+    {
+      if( !underrun )
+      {
+        underrun = TRUE;
+        underruns++;
+      }
+
+      return FALSE;
+    }
+  }
+
+  underrun = FALSE;
+  return TRUE;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetNextNote
+
+Description:
+  Decodes a voice's next note event (see songs.h for the packing). Returns its duration.
+  Only to be called after SongStreamIsNoteReady() returned TRUE, once per voice.
+*/
+u16 SongStreamGetNextNote(u8 voice, u8* note)
+{
+  VoiceStreamType* stream = &voice_streams[voice];
+  u16 note_duration = 0;
+  u8 duration_byte;
+
+  *note = ReadVoiceByte( stream );
+
+  // Duration is 7 bits per byte, most significant first, until a byte without the top bit set
+  do
+  {
+    duration_byte = ReadVoiceByte( stream );
+    note_duration = ( note_duration << 7 ) | ( duration_byte & 0x7F );
+  } while( duration_byte & 0x80 );
+
+  return note_duration;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetUnderruns
+
+Description:
+  Returns the number of times the player has had to wait for the card since startup.
+*/
+u32 SongStreamGetUnderruns(void)
+{
+  return underruns;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamRequestInfo
+
+Description:
+  Asks for a song's title and artist, e.g. for the LCD while the song is still loading. They come from the
+  library's index and strings, not from the song itself: one sector read for the strings, plus one for the
+  index unless a nearby song's record was read last. The song being opened gets them from its header instead
+  if that is read first. A new request replaces one still being read.
+*/
+void SongStreamRequestInfo(u16 song)
+{
+  // Asking again for the song being read changes nothing
+  if( ( song >= song_count ) || ( song == info_ready_song ) ||
+      ( ( song == info_song ) && ( info_requested || info_reading ) ) )
+  {
+    return;
+  }
+
+  info_song = song;
+  info_requested = TRUE;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamIsInfoReady
+
+Description:
+  Returns TRUE if the title and artist of the song have been read and can be got with SongStreamGetInfoTitle()
+  and SongStreamGetInfoArtist().
+*/
+bool SongStreamIsInfoReady(u16 song)
+{
+  return ( song == info_ready_song );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetInfoTitle
+
+Description:
+  Returns the title read for SongStreamRequestInfo().
+*/
+const char* SongStreamGetInfoTitle(void)
+{
+  return info_title;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SongStreamGetInfoArtist
+
+Description:
+  Returns the artist read for SongStreamRequestInfo().
+*/
+const char* SongStreamGetInfoArtist(void)
+{
+  return info_artist;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ReadSector
+
+Description:
+  Starts reading one sector of the library, counted from the library header. The state machine moves on to
+  done_state once the sector is in read_data, which done_state must keep or give back to the SD card driver.
+  A sector past the end of SONGS.LIB fails the title and artist being read, or else the song being opened or
+  played.
+*/
+static void ReadSector(u32 sector, fnCode_type done_state)
+{
+  if( !library_in_file )
+  {
+    read_sector = SONG_LIBRARY_SECTOR + sector;
+  }
+  else if( !FatGetCardSector( sector, &read_sector ) )
+  {
+    SongStream_StateMachine = SongStreamSM_Idle;
+
+    // A bad title lookup leaves the song alone
+    if( info_reading )
+    {
+      info_reading = FALSE;
+      return;
+    }
+
+    ReleaseVoiceBuffers();
+    num_voices = 0;
+    filling_voice = NULL;
+    stream_status = SONG_STREAM_FAILED;
+    return;
+  }
+
+  read_data = NULL;
+  read_done_state = done_state;
+  read_started = FALSE;
+
+  SongStream_StateMachine = SongStreamSM_ReadSector;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: IsCardReady
+
+Description:
+  Returns TRUE if the card can still be read. If it has been taken out or has failed, the library is closed
+  and the state machine goes back to waiting for a card.
+*/
+static bool IsCardReady(void)
+{
+  SdCardStateType card_state = SdGetStatus();
+
+  if( ( card_state == SD_NO_CARD ) || ( card_state == SD_CARD_ERROR ) )
+  {
+    CloseLibrary();
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: CloseLibrary
+
+Description:
+  Forgets the card's library and any song being played from it. Sectors borrowed from the SD card driver are
+  just dropped: the driver takes its buffers back when the card is initialized again.
+*/
+static void CloseLibrary(void)
+{
+  song_count = 0;
+  num_voices = 0;
+  library_in_file = FALSE;
+  index_cache_sector = SONG_STREAM_NO_SECTOR;
+  read_data = NULL;
+  open_requested = FALSE;
+  info_requested = FALSE;
+  info_reading = FALSE;
+  info_ready_song = SONG_STREAM_NO_SONG;
+  filling_voice = NULL;
+  underrun = FALSE;
+  FatClose();
+
+  if( stream_status != SONG_STREAM_CLOSED )
+  {
+    stream_status = SONG_STREAM_FAILED;
+  }
+
+  SongStream_StateMachine = SongStreamSM_WaitCard;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ReleaseVoiceBuffers
+
+Description:
+  Gives every sector the open song's voices still hold back to the SD card driver.
+*/
+static void ReleaseVoiceBuffers(void)
+{
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    for( u8 j = 0; j < 2; j++ )
+    {
+      if( voice_streams[i].buffers[j] != NULL )
+      {
+        SdReleaseReadData( voice_streams[i].buffers[j] );
+        voice_streams[i].buffers[j] = NULL;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetVoiceToFill
+
+Description:
+  Returns the voice that most needs its free buffer refilled: the one with the fewest bytes left to play in the
+  buffer it is reading. Returns NULL if every buffer is full.
+*/
+static VoiceStreamType* GetVoiceToFill(void)
+{
+  VoiceStreamType* voice;
+  VoiceStreamType* most_urgent = NULL;
+  u16 bytes_left;
+  u16 fewest_bytes_left = SONG_STREAM_SECTOR_SIZE + 1;
+
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    voice = &voice_streams[i];
+
+    if( ( voice->buffer_size[0] != 0 ) && ( voice->buffer_size[1] != 0 ) )
+    {
+      continue;
+    }
+
+    bytes_left = voice->buffer_size[voice->read_buffer] - voice->read_offset;
+
+    if( bytes_left < fewest_bytes_left )
+    {
+      fewest_bytes_left = bytes_left;
+      most_urgent = voice;
+    }
+  }
+
+  return most_urgent;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ReadVoiceByte
+
+Description:
+  Returns the next byte of a voice's note events. A buffer is given back to the SD card driver to be refilled
+  as soon as its last byte has been read, and reading carries on in the other buffer.
+*/
+static u8 ReadVoiceByte(VoiceStreamType* voice)
+{
+  u8 byte = voice->buffers[voice->read_buffer][voice->read_offset++];
+
+  if( voice->read_offset >= voice->buffer_size[voice->read_buffer] )
+  {
+    SdReleaseReadData( voice->buffers[voice->read_buffer] );
+    voice->buffers[voice->read_buffer] = NULL;
+    voice->buffer_size[voice->read_buffer] = 0;
+    voice->read_buffer ^= 1;
+    voice->read_offset = 0;
+  }
+
+  return byte;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LoadSongHeader
+
+Description:
+  Reads the song header in read_data and sets up every voice to read from its first sector. The song fails
+  to open if the header is not valid.
+*/
+static void LoadSongHeader(void)
+{
+  const u8* voice_entry;
+  VoiceStreamType* voice;
+
+  num_voices = read_data[SONG_HEADER_VOICES_INDEX];
+
+  if( ( memcmp( read_data, SONG_HEADER_MAGIC, SONG_STREAM_MAGIC_SIZE ) != 0 ) ||
+      ( num_voices == 0 ) || ( num_voices > SONG_STREAM_MAX_VOICES ) )
+  {
+    num_voices = 0;
+    stream_status = SONG_STREAM_FAILED;
+    return;
+  }
+
+  memcpy( title, &read_data[SONG_HEADER_TITLE_INDEX], SONG_STREAM_TEXT_SIZE );
+  title[SONG_STREAM_TEXT_SIZE - 1] = '\0';
+  memcpy( artist, &read_data[SONG_HEADER_ARTIST_INDEX], SONG_STREAM_TEXT_SIZE );
+  artist[SONG_STREAM_TEXT_SIZE - 1] = '\0';
+
+  for( u8 i = 0; i < num_voices; i++ )
+  {
+    voice = &voice_streams[i];
+    voice_entry = &read_data[SONG_HEADER_VOICE_INDEX + ( i * 8 )];
+
+    voice->first_sector = ReadU32( &voice_entry[0] );
+    voice->size = ReadU32( &voice_entry[4] );
+    voice->num_sectors = ( voice->size + SONG_STREAM_SECTOR_SIZE - 1 ) / SONG_STREAM_SECTOR_SIZE;
+    voice->next_sector = 0;
+    voice->buffers[0] = NULL;
+    voice->buffers[1] = NULL;
+    voice->buffer_size[0] = 0;
+    voice->buffer_size[1] = 0;
+    voice->read_buffer = 0;
+    voice->read_offset = 0;
+
+    // A voice needs at least one note
+    if( voice->size < 2 )
+    {
+      num_voices = 0;
+      stream_status = SONG_STREAM_FAILED;
+      return;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ReadSongRecord
+
+Description:
+  Looks up a song's record in the library's index. The state machine moves on to done_state once the record
+  can be got with GetSongRecord(): straight away if the index sector holding it is the one kept from last
+  time, else after reading that sector.
+*/
+static void ReadSongRecord(u16 song, fnCode_type done_state)
+{
+  u32 sector = records_sector + ( song / SONG_RECORDS_PER_SECTOR );
+
+  record_song = song;
+
+  if( sector == index_cache_sector )
+  {
+    SongStream_StateMachine = done_state;
+    return;
+  }
+
+  record_done_state = done_state;
+  ReadSector( sector, SongStreamSM_RecordRead );
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GetSongRecord
+
+Description:
+  Returns the index record of the song looked up with ReadSongRecord().
+*/
+static const u8* GetSongRecord(void)
+{
+  return &index_cache[( record_song % SONG_RECORDS_PER_SECTOR ) * SONG_RECORD_SIZE];
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: CopyString
+
+Description:
+  Copies the string at offset in the strings out of the strings sector in read_data. It is cut short at the end
+  of the sector or of the text buffer, which only happens on a damaged card.
+*/
+static void CopyString(char* text, u32 offset)
+{
+  u16 index = offset % SONG_STREAM_SECTOR_SIZE;
+  u8 length = 0;
+
+  while( ( length < ( SONG_STREAM_TEXT_SIZE - 1 ) ) && ( index < SONG_STREAM_SECTOR_SIZE ) && ( read_data[index] != '\0' ) )
+  {
+    text[length++] = read_data[index++];
+  }
+
+  text[length] = '\0';
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: ReadU16 / ReadU32
+
+Description:
+  Read little-endian numbers out of a sector.
+*/
+static u16 ReadU16(const u8* bytes)
+{
+  return (u16)( bytes[0] | ( bytes[1] << 8 ) );
+}
+
+static u32 ReadU32(const u8* bytes)
+{
+  return (u32)bytes[0] | ( (u32)bytes[1] << 8 ) | ( (u32)bytes[2] << 16 ) | ( (u32)bytes[3] << 24 );
+}
+
+/**********************************************************************************************************************
+State Machine Function Definitions
+**********************************************************************************************************************/
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Waits for the SD card task to have a card ready, then reads its library header. */
+static void SongStreamSM_WaitCard(void)
+{
+  if( SdGetStatus() == SD_IDLE )
+  {
+    ReadSector( 0, SongStreamSM_LibraryRead );
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Reads a sector from the card. The SD card task only takes a read when it is idle and has a free read buffer,
+   and holds the data until it is borrowed. */
+static void SongStreamSM_ReadSector(void)
+{
+  if( !IsCardReady() )
+  {
+    return;
+  }
+
+  if( !read_started )
+  {
+    read_started = SdReadBlock( read_sector );
+  }
+  else
+  {
+    read_data = SdBorrowReadData();
+    if( read_data != NULL )
+    {
+      SongStream_StateMachine = read_done_state;
+    }
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Library header is in read_data. A card without one at its start may have a FAT32 file system with the
+   library in SONGS.LIB. A card with neither has no songs. */
+static void SongStreamSM_LibraryRead(void)
+{
+  song_count = 0;
+  SongStream_StateMachine = SongStreamSM_Idle;
+
+  if( memcmp( read_data, SONG_LIBRARY_MAGIC, SONG_STREAM_MAGIC_SIZE ) == 0 )
+  {
+    song_count = ReadU16( &read_data[SONG_LIBRARY_COUNT_INDEX] );
+    if( song_count > SONG_STREAM_MAX_SONGS )
+    {
+      song_count = SONG_STREAM_MAX_SONGS;
+    }
+
+    records_sector = ReadU32( &read_data[SONG_LIBRARY_RECORDS_INDEX] );
+    strings_sector = ReadU32( &read_data[SONG_LIBRARY_STRINGS_INDEX] );
+  }
+  else if( !library_in_file )
+  {
+    // The FAT task reads the card itself, so nothing else may be read until the file is open
+    FatOpen( SONG_LIBRARY_FILE );
+    SongStream_StateMachine = SongStreamSM_OpenLibraryFile;
+  }
+
+  SdReleaseReadData( read_data );
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Waits for the FAT task to find SONGS.LIB, then reads the library header from the file's first sector. */
+static void SongStreamSM_OpenLibraryFile(void)
+{
+  if( !IsCardReady() )
+  {
+    return;
+  }
+
+  if( FatGetStatus() == FAT_FILE_OPEN )
+  {
+    library_in_file = TRUE;
+    ReadSector( 0, SongStreamSM_LibraryRead );
+  }
+  else if( FatGetStatus() != FAT_OPENING )
+  {
+    // No file system or no library on it
+    SongStream_StateMachine = SongStreamSM_Idle;
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Keeps every voice's spare buffer filled with its next sector, most urgent voice first. */
+static void SongStreamSM_Idle(void)
+{
+  if( !IsCardReady() )
+  {
+    return;
+  }
+
+  // A new song takes over from whatever was being read
+  if( open_requested )
+  {
+    open_requested = FALSE;
+    ReleaseVoiceBuffers();
+    num_voices = 0;
+    ReadSongRecord( open_song, SongStreamSM_OpenRecordFound );
+    return;
+  }
+
+  filling_voice = GetVoiceToFill();
+
+  // Titles are read before a loading song's voices, but only once every voice is full while a song plays
+  if( info_requested && ( ( filling_voice == NULL ) || ( stream_status != SONG_STREAM_OPEN ) ) )
+  {
+    info_requested = FALSE;
+    info_reading = TRUE;
+    info_ready_song = SONG_STREAM_NO_SONG;
+    filling_voice = NULL;
+    ReadSongRecord( info_song, SongStreamSM_InfoRecordFound );
+  }
+  else if( filling_voice != NULL )
+  {
+    filling_voice->fill_buffer = ( filling_voice->buffer_size[filling_voice->read_buffer] == 0 ) ? filling_voice->read_buffer : ( filling_voice->read_buffer ^ 1 );
+    ReadSector( song_sector + filling_voice->first_sector + filling_voice->next_sector,
+                SongStreamSM_VoiceSectorRead );
+  }
+  else if( stream_status == SONG_STREAM_OPENING )
+  {
+    // Every voice has its first two sectors in, so the song can start
+    underrun = FALSE;
+    stream_status = SONG_STREAM_OPEN;
+  }
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* A sector of the song index is in read_data. It is kept for the next songs looked up. */
+static void SongStreamSM_RecordRead(void)
+{
+  memcpy( index_cache, read_data, SONG_STREAM_SECTOR_SIZE );
+  index_cache_sector = records_sector + ( record_song / SONG_RECORDS_PER_SECTOR );
+  SdReleaseReadData( read_data );
+
+  SongStream_StateMachine = record_done_state;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* The record of the song being opened is in index_cache. Reads the song header it points to. */
+static void SongStreamSM_OpenRecordFound(void)
+{
+  // Another song may have been asked for while the index was being read
+  if( open_requested )
+  {
+    SongStream_StateMachine = SongStreamSM_Idle;
+    return;
+  }
+
+  song_sector = ReadU32( &GetSongRecord()[SONG_RECORD_SECTOR_INDEX] );
+  ReadSector( song_sector, SongStreamSM_HeaderRead );
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* Song header is in read_data. Sets up every voice to read from its first sector. */
+static void SongStreamSM_HeaderRead(void)
+{
+  SongStream_StateMachine = SongStreamSM_Idle;
+
+  // Another song may have been asked for while this one was being read
+  if( !open_requested )
+  {
+    LoadSongHeader();
+
+    // The title asked for is usually the one of the song being opened, which has just been read with it
+    if( ( stream_status == SONG_STREAM_OPENING ) && info_requested && ( info_song == open_song ) )
+    {
+      info_requested = FALSE;
+      memcpy( info_title, title, SONG_STREAM_TEXT_SIZE );
+      memcpy( info_artist, artist, SONG_STREAM_TEXT_SIZE );
+      info_ready_song = open_song;
+    }
+  }
+
+  SdReleaseReadData( read_data );
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* A voice's next sector is in read_data and is kept as the voice's free buffer. */
+static void SongStreamSM_VoiceSectorRead(void)
+{
+  SongStream_StateMachine = SongStreamSM_Idle;
+
+  // Sector belonged to a song that is no longer being played
+  if( open_requested || ( filling_voice == NULL ) )
+  {
+    SdReleaseReadData( read_data );
+    return;
+  }
+
+  filling_voice->buffers[filling_voice->fill_buffer] = read_data;
+
+  // Last sector of the voice is only partly used, then the voice starts over from its first sector
+  if( filling_voice->next_sector == ( filling_voice->num_sectors - 1 ) )
+  {
+    filling_voice->buffer_size[filling_voice->fill_buffer] = filling_voice->size - ( filling_voice->next_sector * SONG_STREAM_SECTOR_SIZE );
+    filling_voice->next_sector = 0;
+  }
+  else
+  {
+    filling_voice->buffer_size[filling_voice->fill_buffer] = SONG_STREAM_SECTOR_SIZE;
+    filling_voice->next_sector++;
+  }
+
+  filling_voice = NULL;
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* The record of the song whose title was asked for is in index_cache. Reads the strings sector with the title. */
+static void SongStreamSM_InfoRecordFound(void)
+{
+  const u8* record = GetSongRecord();
+
+  info_title_offset = ReadU32( &record[SONG_RECORD_TITLE_INDEX] );
+  info_artist_offset = ReadU32( &record[SONG_RECORD_ARTIST_INDEX] );
+  ReadSector( strings_sector + ( info_title_offset / SONG_STREAM_SECTOR_SIZE ), SongStreamSM_InfoTitleRead );
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* The strings sector with the title is in read_data. The artist is usually in the same sector. */
+static void SongStreamSM_InfoTitleRead(void)
+{
+  SongStream_StateMachine = SongStreamSM_Idle;
+  CopyString( info_title, info_title_offset );
+
+  if( ( info_artist_offset / SONG_STREAM_SECTOR_SIZE ) == ( info_title_offset / SONG_STREAM_SECTOR_SIZE ) )
+  {
+    CopyString( info_artist, info_artist_offset );
+    info_reading = FALSE;
+
+    // A newer request starts over from the idle state
+    if( !info_requested )
+    {
+      info_ready_song = record_song;
+    }
+  }
+  else if( !info_requested )
+  {
+    SdReleaseReadData( read_data );
+    ReadSector( strings_sector + ( info_artist_offset / SONG_STREAM_SECTOR_SIZE ), SongStreamSM_InfoArtistRead );
+    return;
+  }
+  else
+  {
+    info_reading = FALSE;
+  }
+
+  SdReleaseReadData( read_data );
+}
+
+/*-------------------------------------------------------------------------------------------------------------------*/
+/* The strings sector with the artist is in read_data. */
+static void SongStreamSM_InfoArtistRead(void)
+{
+  SongStream_StateMachine = SongStreamSM_Idle;
+  CopyString( info_artist, info_artist_offset );
+  info_reading = FALSE;
+
+  if( !info_requested )
+  {
+    info_ready_song = record_song;
+  }
+
+  SdReleaseReadData( read_data );
+}
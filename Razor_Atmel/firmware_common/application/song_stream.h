@@ -0,0 +1,100 @@
+/**********************************************************************************************************************
+File: song_stream.h
+Description: Header file song_stream.c
+**********************************************************************************************************************/
+
+#ifndef __SONG_STREAM_H
+#define __SONG_STREAM_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+typedef enum {SONG_STREAM_CLOSED, SONG_STREAM_OPENING, SONG_STREAM_OPEN, SONG_STREAM_FAILED} SongStreamStatusType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+#define SONG_STREAM_SECTOR_SIZE       (u16)512        /* Bytes in one SD card sector */
+#define SONG_LIBRARY_SECTOR           (u32)0          /* Card sector holding the song library header */
+#define SONG_LIBRARY_FILE             "SONGS.LIB"     /* File holding the library on a FAT32 card, from its first sector */
+#define SONG_STREAM_MAX_VOICES        (u8)4           /* Same as MAX_VOICES in songs.h */
+#define SONG_STREAM_MAX_SONGS         (u16)65000      /* Leaves room for the songs in flash in the player's u16 song numbers */
+#define SONG_STREAM_NO_SONG           (u16)0xFFFF     /* No song's title and artist have been read */
+#define SONG_STREAM_NO_SECTOR         (u32)0xFFFFFFFF /* No index sector is cached */
+#define SONG_STREAM_TEXT_SIZE         (u8)64          /* Bytes for the title or artist in a song header, including the terminating 0 */
+#define SONG_STREAM_MAX_EVENT_BYTES   (u8)4           /* Largest packed note event: note byte and a 16-bit duration in 3 bytes */
+
+/* Card layout, all numbers little-endian
+
+   Library header (sector SONG_LIBRARY_SECTOR)
+     0: "EIESLIB2"
+     8: u16 number of songs
+    12: u32 first sector of the song index
+    16: u32 first sector of the strings
+
+   Song index: one SONG_RECORD_SIZE byte record per song, SONG_RECORDS_PER_SECTOR to a sector, so the
+   record of song N is found with one read of sector N / SONG_RECORDS_PER_SECTOR of the index
+     0: u32 first sector of the song
+     4: u32 offset of the song's title in the strings
+     8: u32 offset of the song's artist in the strings
+    12: reserved, 0
+
+   Strings: every title and artist, 0-terminated, with offsets counted in bytes from the first strings
+   sector. None crosses a sector boundary, so each is read with one sector read.
+
+   Song header (first sector of each song)
+     0: "EIESONG1"
+     8: u8 number of voices, up to SONG_STREAM_MAX_VOICES
+    16: title, 0-terminated
+    80: artist, 0-terminated
+   144: u32 first sector, u32 size in bytes of each voice's note events, sectors counted from the song header
+
+   Each voice's note events are packed the same way as phrase_events in songs.h, with the voice's whole
+   playlist written out in order. Every voice starts on a sector boundary and all voices are the same
+   length, so the song starts over on every voice at the same time. Written by midi_code_gen.py -sd or
+   by music_sim -w for the songs in songs.h.
+
+   Sectors are counted from the library header. The same library may instead be copied to a FAT32
+   card as SONGS.LIB in the root directory, when sector SONG_LIBRARY_SECTOR of the card does not start
+   with the library magic. Sectors are then counted from the start of the file.
+*/
+#define SONG_STREAM_MAGIC_SIZE        (u8)8           /* Both headers start with an 8 character magic string */
+#define SONG_LIBRARY_MAGIC            "EIESLIB2"
+#define SONG_LIBRARY_COUNT_INDEX      (u16)8
+#define SONG_LIBRARY_RECORDS_INDEX    (u16)12
+#define SONG_LIBRARY_STRINGS_INDEX    (u16)16
+
+#define SONG_RECORD_SIZE              (u16)16
+#define SONG_RECORDS_PER_SECTOR       (u16)( SONG_STREAM_SECTOR_SIZE / SONG_RECORD_SIZE )
+#define SONG_RECORD_SECTOR_INDEX      (u16)0
+#define SONG_RECORD_TITLE_INDEX       (u16)4
+#define SONG_RECORD_ARTIST_INDEX      (u16)8
+
+#define SONG_HEADER_MAGIC             "EIESONG1"
+#define SONG_HEADER_VOICES_INDEX      (u16)8
+#define SONG_HEADER_TITLE_INDEX       (u16)16
+#define SONG_HEADER_ARTIST_INDEX      (u16)( SONG_HEADER_TITLE_INDEX + SONG_STREAM_TEXT_SIZE )
+#define SONG_HEADER_VOICE_INDEX       (u16)( SONG_HEADER_ARTIST_INDEX + SONG_STREAM_TEXT_SIZE )
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+void SongStreamInitialize(void);
+void SongStreamRunActiveState(void);
+u16 SongStreamGetSongCount(void);
+void SongStreamOpen(u16 song);
+SongStreamStatusType SongStreamGetStatus(void);
+const char* SongStreamGetTitle(void);
+const char* SongStreamGetArtist(void);
+u8 SongStreamGetNumVoices(void);
+bool SongStreamIsNoteReady(void);
+u16 SongStreamGetNextNote(u8 voice, u8* note);
+u32 SongStreamGetUnderruns(void);
+void SongStreamRequestInfo(u16 song);
+bool SongStreamIsInfoReady(u16 song);
+const char* SongStreamGetInfoTitle(void);
+const char* SongStreamGetInfoArtist(void);
+
+#endif /* __SONG_STREAM_H */
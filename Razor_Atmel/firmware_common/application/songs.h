@@ -15,112 +15,204 @@ Constants / Definitions
 **********************************************************************************************************************/
 #define SONG_LIST_SIZE  ( sizeof( song_list ) / sizeof( song_list[0] ) )
 
+#define NUM_MIDI_NOTES  (u8)128   /* Size of the note tables, one entry for every MIDI note number */
+#define SILENT_NOTE     (u8)0     /* Note number used for a rest */
+#define MAX_VOICES      (u8)4     /* Most voices a song can have, voices beyond the two buzzers are arpeggiated */
+
 /**********************************************************************************************************************
 Type Definitions
 **********************************************************************************************************************/
+/* A run of notes stored once in a song's phrase table */
+typedef struct
+{
+  u16 offset;   /* Offset of the phrase's first note event in phrase_events */
+  u16 size;     /* Size of the phrase's note events in bytes */
+} PhraseType;
+
+/* One entry of a buzzer's playlist */
+typedef struct
+{
+  u16 phrase;   /* Index of the phrase in the song's phrase table */
+  u16 repeat;   /* Number of times in a row the phrase is played */
+} PhraseRefType;
+
+/* A note a voice can start from part way through the song */
+typedef struct
+{
+  u32 position;         /* Song position in ms as written where the note starts */
+  u16 playlist_index;   /* Playlist entry the note is played from */
+  u16 repeats_left;     /* Times that entry's phrase is still to be played after this one */
+  u16 phrase_offset;    /* Offset of the note's event in phrase_events */
+} SeekPointType;
+
+/* One voice (MIDI track) of a song */
+typedef struct
+{
+  const PhraseRefType*  playlist;             /* Phrases played by the voice, in order */
+  const u16             playlist_size;        /* Number of entries in the playlist */
+  const SeekPointType*  seek_points;          /* Notes to seek from, in song order, the first at position 0 */
+  const u16             num_seek_points;      /* Number of entries in seek_points */
+} VoiceType;
+
 typedef struct
 {
-  const char* title;
-  const char* artist;
-  const u16*  note_right;           /* Array of note frequencies for right buzzer */
-  const u16*  note_duration_right;  /* Array of note durations for right buzzer*/
-  const u16   num_notes_right;      /* Number of notes for right buzzer */
-  const u16*  note_left;            /* Array of note frequencies for left buzzer */
-  const u16*  note_duration_left;   /* Array of note durations for left buzzer*/
-  const u16   num_notes_left;       /* Number of notes for left buzzer */
+  const char*           title;
+  const char*           artist;
+  const u8*             phrase_events;        /* Packed note events of every phrase in the song */
+  const PhraseType*     phrases;              /* Phrase table shared by all voices */
+  const VoiceType*      voices;               /* Voice table, voice n plays on buzzer n % 2 (0 = right, 1 = left) */
+  const u8              num_voices;           /* Number of voices, up to MAX_VOICES */
+  const u32             length;               /* Length in ms as written, every voice is padded to it */
 } SongInfoType;
 
+/* Packed note events
+   Each note is one byte holding the MIDI note number (SILENT_NOTE for a rest), followed by its
+   duration in ms as a variable-length number: 7 bits per byte, most significant bits first, with the
+   top bit set on every byte except the last. Zero-length notes are never stored and back-to-back
+   rests are stored as one longer rest.
+
+   Phrases
+   Every run of notes that repeats anywhere in a song is only stored once, as a phrase. Each voice
+   plays its playlist of phrases in order, repeating each phrase as many times as its entry says,
+   then starts over.
+
+   Voices
+   Voices are shared out between the two buzzers in turn. When more than one voice on a buzzer is
+   sounding, the buzzer cycles quickly between their notes (arpeggio).
+
+   Seek points
+   Each voice lists the note playing at the start of the song and about every four seconds after it,
+   with where that note is in the playlist. Seeking binary searches them for the last one at or before
+   the position, then decodes the few dozen notes at most from there. Generated by midi_code_gen.py.
+*/
+
+/**********************************************************************************************************************
+Note Tables
+**********************************************************************************************************************/
+/* Frequency in Hz of each MIDI note number, matches midi_note_to_freq() in midi_code_gen.py */
+static const u16 note_freq_table[NUM_MIDI_NOTES] =
+{
+      0,     9,     9,    10,    10,    11,    12,    12,
+     13,    14,    15,    15,    16,    17,    18,    19,
+     21,    22,    23,    24,    26,    28,    29,    31,
+     33,    35,    37,    39,    41,    44,    46,    49,
+     52,    55,    58,    62,    65,    69,    73,    78,
+     82,    87,    92,    98,   104,   110,   117,   123,
+    131,   139,   147,   156,   165,   175,   185,   196,
+    208,   220,   233,   247,   262,   277,   294,   311,
+    330,   349,   370,   392,   415,   440,   466,   494,
+    523,   554,   587,   622,   659,   698,   740,   784,
+    831,   880,   932,   988,  1047,  1109,  1175,  1245,
+   1319,  1397,  1480,  1568,  1661,  1760,  1865,  1976,
+   2093,  2217,  2349,  2489,  2637,  2794,  2960,  3136,
+   3322,  3520,  3729,  3951,  4186,  4435,  4699,  4978,
+   5274,  5588,  5920,  6272,  6645,  7040,  7459,  7902,
+   8372,  8870,  9397,  9956, 10548, 11175, 11840, 12544
+};
+
+/* PWM channel period (CPRE_CLCK / frequency) of each MIDI note number, 0 for notes too low for the 16-bit period register.
+Not generated: after changing CPRE_CLCK or note_freq_table, music_sim -f checks every entry against the division. */
+static const u16 note_period_table[NUM_MIDI_NOTES] =
+{
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0,     0,     0,     0,     0,     0,     0,
+      0,     0, 65217, 61224, 57692, 54545, 51282, 48780,
+  45801, 43165, 40816, 38461, 36363, 34285, 32432, 30612,
+  28846, 27272, 25751, 24291, 22900, 21660, 20408, 19292,
+  18181, 17191, 16216, 15306, 14457, 13636, 12875, 12145,
+  11472, 10830, 10221,  9646,  9104,  8595,  8108,  7653,
+   7220,  6818,  6437,  6072,  5730,  5410,  5106,  4819,
+   4548,  4294,  4054,  3826,  3612,  3409,  3217,  3036,
+   2866,  2706,  2554,  2410,  2275,  2147,  2027,  1913,
+   1806,  1704,  1609,  1518,  1433,  1352,  1276,  1205,
+   1137,  1073,  1013,   956,   902,   852,   804,   759,
+    716,   676,   638,   602,   568,   536,   506,   478
+};
+
 /**********************************************************************************************************************
 Song Notes, Durations, and Information
 **********************************************************************************************************************/
 
 /* Song #1 */
-static const u16 song1_note_right[] = { 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 698, 0, 1047, 0, 880, 0, 784, 0, 523, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 932, 0, 880, 0, 784, 0, 698, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 698, 0, 1047, 0, 880, 0, 784, 0, 523, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 932, 0, 880, 0, 784, 0, 698, 0, 880, 0, 698, 0, 523, 0, 880, 0, 698, 0, 831, 0, 698, 0, 523, 0, 831, 0, 784, 0, 880, 0, 698, 0, 523, 0, 880, 0, 698, 0, 831, 0, 698, 0, 523, 0, 1047, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 587, 0, 1047, 0, 1175, 0, 1047, 0, 1175, 0, 1047, 0, 523, 0, 932, 0, 880, 0, 784, 0, 698, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 698, 0, 1047, 0, 880, 0, 784, 0, 523, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 932, 0, 880, 0, 784, 0, 698, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 698, 0, 1047, 0, 880, 0, 784, 0, 523, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 587, 0, 523, 0, 698, 0, 932, 0, 880, 0, 784, 0, 698, 0, 880, 0, 698, 0, 523, 0, 880, 0, 698, 0, 831, 0, 698, 0, 523, 0, 831, 0, 784, 0, 880, 0, 698, 0, 523, 0, 880, 0, 698, 0, 831, 0, 698, 0, 523, 0, 1047, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 523, 0, 587, 0, 698, 0, 587, 0, 1047, 0, 1175, 0, 1047, 0, 1175, 0, 1047, 0, 523, 0, 932, 0, 880, 0, 784, 0, 698, 0 };
-static const u16 song1_note_duration_right[] = { 5455, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 114, 227, 0, 341, 0, 455, 0, 114, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 0, 114, 0, 114, 0, 909, 114, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 114, 227, 0, 341, 0, 455, 0, 114, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 0, 114, 0, 114, 0, 909, 114, 341, 0, 341, 0, 227, 0, 341, 0, 568, 0, 114, 0, 114, 0, 114, 114, 341, 0, 1023, 0, 341, 0, 341, 0, 227, 0, 341, 0, 568, 0, 114, 0, 114, 0, 227, 0, 1364, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 0, 114, 0, 227, 0, 341, 0, 909, 0, 114, 0, 227, 0, 227, 0, 227, 0, 227, 0, 341, 0, 114, 0, 114, 0, 114, 0, 227, 0, 227, 12500, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 114, 227, 0, 341, 0, 455, 0, 114, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 0, 114, 0, 114, 0, 909, 114, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 114, 227, 0, 341, 0, 455, 0, 114, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 114, 114, 114, 114, 0, 114, 0, 114, 0, 909, 114, 341, 0, 341, 0, 227, 0, 341, 0, 568, 0, 114, 0, 114, 0, 114, 114, 341, 0, 1023, 0, 341, 0, 341, 0, 227, 0, 341, 0, 568, 0, 114, 0, 114, 0, 227, 0, 1364, 0, 455, 0, 341, 0, 114, 0, 114, 0, 114, 114, 455, 0, 114, 0, 114, 0, 114, 0, 227, 0, 341, 0, 909, 0, 114, 0, 227, 0, 227, 0, 227, 0, 227, 0, 341, 0, 114, 0, 114, 0, 114, 0, 227, 0, 227, 9715 };
-static const u16 song1_note_left[] = { 0, 175, 0, 147, 0, 196, 0, 131, 0, 175, 0, 147, 0, 208, 0, 196, 0, 175, 0, 220, 0, 233, 0, 247, 0, 220, 0, 208, 0, 196, 0, 131, 0, 147, 0, 165, 0, 175, 0, 220, 0, 233, 0, 247, 0, 262, 0, 131, 0, 165, 0, 196, 0, 175, 0, 131, 0, 175, 0, 175, 0, 220, 0, 233, 0, 247, 0, 220, 0, 208, 0, 196, 0, 131, 0, 147, 0, 165, 0, 175, 0, 220, 0, 233, 0, 247, 0, 262, 0, 131, 0, 165, 0, 196, 0, 175, 0, 131, 0, 175, 0, 220, 0, 233, 0, 262, 0, 294, 0, 262, 0, 220, 0, 175, 0, 196, 0, 208, 0, 262, 0, 294, 0, 349, 0, 392, 0, 349, 0, 330, 0, 262, 0, 233, 0, 220, 0, 233, 0, 262, 0, 349, 0, 330, 0, 262, 0, 220, 0, 247, 0, 262, 0, 349, 0, 262, 0, 233, 0, 294, 0, 262, 0, 330, 0, 175, 0, 175, 0, 156, 0, 156, 0, 147, 0, 147, 0, 139, 0, 139, 0, 131, 0, 131, 0, 147, 0, 165, 0, 175, 0, 131, 0, 175, 0, 175, 0, 233, 0, 220, 0, 233, 0, 247, 0, 262, 0, 277, 0, 294, 0, 220, 0, 196, 0, 233, 0, 220, 0, 196, 0, 175, 0, 147, 0, 131, 0, 220, 0, 233, 0, 220, 0, 233, 0, 247, 0, 262, 0, 277, 0, 294, 0, 220, 0, 196, 0, 233, 0, 220, 0, 196, 0, 175, 0, 131, 0, 175, 0, 147, 0, 175, 0, 147, 0, 196, 0, 131, 0, 175, 0, 147, 0, 208, 0, 196, 0, 175, 0, 220, 0, 233, 0, 247, 0, 220, 0, 208, 0, 196, 0, 131, 0, 147, 0, 165, 0, 175, 0, 220, 0, 233, 0, 247, 0, 262, 0, 131, 0, 165, 0, 196, 0, 175, 0, 131, 0, 175, 0, 175, 0, 220, 0, 233, 0, 247, 0, 220, 0, 208, 0, 196, 0, 131, 0, 147, 0, 165, 0, 175, 0, 220, 0, 233, 0, 247, 0, 262, 0, 131, 0, 165, 0, 196, 0, 175, 0, 131, 0, 175, 0, 220, 0, 233, 0, 262, 0, 294, 0, 262, 0, 220, 0, 175, 0, 196, 0, 208, 0, 262, 0, 294, 0, 349, 0, 392, 0, 349, 0, 330, 0, 262, 0, 233, 0, 220, 0, 233, 0, 262, 0, 349, 0, 330, 0, 262, 0, 220, 0, 247, 0, 262, 0, 349, 0, 262, 0, 233, 0, 294, 0, 262, 0, 330, 0, 175, 0, 175, 0, 156, 0, 156, 0, 147, 0, 147, 0, 139, 0, 139, 0, 131, 0, 131, 0, 147, 0, 165, 0, 175, 0, 131, 0, 175, 0, 175, 0, 233, 0, 220, 0, 233, 0, 247, 0, 262, 0, 277, 0, 294, 0, 220, 0, 196, 0, 233, 0, 220, 0, 196, 0, 175, 0, 147, 0, 131, 0, 220, 0, 233, 0, 220, 0, 233, 0, 247, 0, 262, 0, 277, 0, 294, 0, 220, 0, 196, 0, 233, 0, 220, 0, 196, 0, 175, 0, 131, 0, 175, 0, 147, 0 };
-static const u16 song1_note_duration_left[] = { 1818, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 682, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 909, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 682, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 909, 227, 0, 227, 0, 227, 0, 227, 227, 227, 227, 227, 227, 227, 227, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 0, 227, 1000 };
+static const u8 song1_phrase_events[] = { 0, 170, 79, 81, 131, 71, 77, 130, 85, 72, 114, 74, 114, 77, 114, 0, 114, 77, 131, 71, 74, 114, 72, 114, 0, 114, 77, 114, 0, 114, 77, 114, 0, 114, 84, 129, 99, 81, 130, 85, 79, 131, 71, 72, 114, 82, 114, 81, 114, 79, 114, 77, 135, 13, 0, 114, 81, 130, 85, 77, 130, 85, 72, 129, 99, 81, 130, 85, 77, 132, 56, 80, 114, 77, 114, 72, 114, 0, 114, 80, 130, 85, 79, 135, 127, 72, 129, 99, 84, 138, 84, 79, 114, 81, 114, 77, 114, 72, 129, 99, 74, 130, 85, 77, 135, 13, 74, 114, 84, 129, 99, 86, 129, 99, 84, 129, 99, 86, 129, 99, 84, 130, 85, 72, 114, 82, 114, 81, 114, 79, 129, 99, 77, 129, 99, 0, 225, 84, 72, 129, 99, 84, 138, 84, 0, 203, 115, 0, 142, 26, 53, 129, 99, 0, 129, 99, 50, 129, 99, 0, 129, 99, 55, 129, 99, 0, 129, 99, 48, 129, 99, 0, 129, 99, 56, 129, 99, 55, 133, 42, 53, 129, 99, 0, 129, 99, 57, 129, 99, 0, 129, 99, 58, 129, 99, 0, 129, 99, 59, 129, 99, 0, 129, 99, 57, 129, 99, 0, 129, 99, 56, 129, 99, 0, 129, 99, 55, 129, 99, 48, 129, 99, 50, 129, 99, 52, 129, 99, 60, 129, 99, 48, 129, 99, 52, 129, 99, 55, 129, 99, 53, 129, 99, 48, 129, 99, 53, 129, 99, 0, 129, 99, 57, 129, 99, 58, 129, 99, 60, 129, 99, 62, 129, 99, 60, 129, 99, 57, 129, 99, 53, 129, 99, 55, 129, 99, 56, 129, 99, 60, 129, 99, 62, 129, 99, 65, 129, 99, 67, 129, 99, 65, 129, 99, 64, 129, 99, 60, 129, 99, 58, 129, 99, 57, 129, 99, 58, 129, 99, 60, 129, 99, 65, 129, 99, 64, 129, 99, 60, 129, 99, 57, 129, 99, 59, 129, 99, 60, 129, 99, 65, 129, 99, 60, 129, 99, 58, 129, 99, 62, 129, 99, 60, 129, 99, 64, 129, 99, 53, 129, 99, 0, 129, 99, 53, 129, 99, 0, 129, 99, 51, 129, 99, 0, 129, 99, 51, 129, 99, 0, 129, 99, 50, 129, 99, 0, 129, 99, 50, 129, 99, 0, 129, 99, 49, 129, 99, 0, 129, 99, 49, 129, 99, 0, 129, 99, 48, 129, 99, 0, 135, 13, 48, 129, 99, 50, 129, 99, 52, 129, 99, 53, 129, 99, 0, 129, 99, 48, 129, 99, 0, 129, 99, 58, 129, 99, 57, 129, 99, 58, 129, 99, 59, 129, 99, 60, 129, 99, 61, 129, 99, 62, 129, 99, 57, 129, 99, 55, 129, 99, 58, 129, 99, 57, 129, 99, 55, 129, 99, 53, 129, 99, 50, 129, 99, 48, 129, 99, 57, 129, 99, 48, 129, 99, 53, 129, 99, 50, 129, 99, 48, 129, 99, 53, 129, 99, 50, 129, 99, 0, 135, 104 };
+static const PhraseType song1_phrases[] = { { 0, 45 }, { 3, 27 }, { 45, 11 }, { 3, 42 }, { 56, 29 }, { 56, 19 }, { 85, 6 }, { 3, 17 }, { 91, 47 }, { 45, 40 }, { 138, 6 }, { 91, 44 }, { 144, 3 }, { 147, 27 }, { 150, 12 }, { 174, 54 }, { 180, 24 }, { 228, 24 }, { 180, 48 }, { 252, 171 }, { 348, 12 }, { 423, 48 }, { 423, 39 }, { 471, 9 }, { 150, 24 }, { 228, 195 }, { 480, 12 } };
+static const PhraseRefType song1_playlist_voice0[] = { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 1, 1 }, { 2, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 3, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 1, 1 }, { 9, 1 }, { 5, 1 }, { 10, 1 }, { 7, 1 }, { 11, 1 }, { 12, 1 } };
+static const PhraseRefType song1_playlist_voice1[] = { { 13, 1 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 17, 1 }, { 18, 1 }, { 16, 1 }, { 17, 1 }, { 19, 1 }, { 20, 1 }, { 21, 1 }, { 22, 1 }, { 23, 1 }, { 24, 1 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 17, 1 }, { 18, 1 }, { 16, 1 }, { 25, 1 }, { 20, 1 }, { 21, 1 }, { 22, 1 }, { 26, 1 } };
+static const SeekPointType song1_seek_voice0[] = { { 0, 0, 0, 0 }, { 7960, 0, 0, 34 }, { 11716, 2, 0, 51 }, { 15812, 3, 0, 40 }, { 19909, 5, 0, 54 }, { 23661, 7, 0, 56 }, { 27753, 9, 0, 6 }, { 31846, 10, 0, 120 }, { 32983, 10, 0, 135 }, { 47988, 11, 0, 34 }, { 51744, 13, 0, 51 }, { 55840, 14, 0, 40 }, { 59937, 16, 0, 54 }, { 63689, 17, 0, 56 }, { 67781, 19, 0, 6 }, { 71874, 20, 0, 120 }, { 73011, 21, 0, 144 } };
+static const SeekPointType song1_seek_voice1[] = { { 0, 0, 0, 147 }, { 3861, 1, 0, 153 }, { 7948, 2, 0, 213 }, { 11807, 4, 0, 240 }, { 15893, 5, 0, 222 }, { 19979, 8, 0, 252 }, { 23838, 8, 0, 303 }, { 27924, 8, 0, 357 }, { 31102, 8, 0, 399 }, { 35870, 10, 0, 441 }, { 39956, 11, 0, 447 }, { 43815, 14, 0, 153 }, { 47902, 15, 0, 213 }, { 51988, 17, 0, 243 }, { 55847, 18, 0, 222 }, { 59933, 20, 0, 252 }, { 63792, 20, 0, 303 }, { 67878, 20, 0, 357 }, { 71965, 20, 0, 402 }, { 75824, 22, 0, 441 }, { 79910, 23, 0, 447 } };
 
-static const SongInfoType song1 = { "Super Mario World", "Koji Kondo", song1_note_right, song1_note_duration_right, sizeof( song1_note_right ) / sizeof( song1_note_right[0] ), song1_note_left, song1_note_duration_left, sizeof( song1_note_left ) / sizeof( song1_note_left[0] ) };
+static const VoiceType song1_voices[] = { { song1_playlist_voice0, sizeof( song1_playlist_voice0 ) / sizeof( song1_playlist_voice0[0] ), song1_seek_voice0, sizeof( song1_seek_voice0 ) / sizeof( song1_seek_voice0[0] ) }, { song1_playlist_voice1, sizeof( song1_playlist_voice1 ) / sizeof( song1_playlist_voice1[0] ), song1_seek_voice1, sizeof( song1_seek_voice1 ) / sizeof( song1_seek_voice1[0] ) } };
+
+static const SongInfoType song1 = { "Super Mario World", "Koji Kondo", song1_phrase_events, song1_phrases, song1_voices, sizeof( song1_voices ) / sizeof( song1_voices[0] ), 82726 };
 
 /* Song #2 */
-static const u16 song2_note_right[] = { 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 392, 0, 440, 0, 392, 0, 440, 0, 440, 0, 440, 0, 523, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 392, 0, 523, 0, 440, 0, 392, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 659, 0, 523, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 523, 0, 440, 0, 523, 0, 440, 0, 523, 0, 440, 0, 523, 0, 440, 0, 440, 0, 440, 0, 392, 0, 330, 0, 392, 0, 440, 0, 440, 0, 659, 0, 523, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 330, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 330, 0, 440, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 392, 0, 220, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 784, 0, 587, 0, 659, 0, 587, 0, 523, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 831, 0, 587, 0, 659, 0, 587, 0, 523, 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 392, 0, 440, 0, 392, 0, 440, 0, 440, 0, 440, 0, 523, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 392, 0, 523, 0, 440, 0, 392, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 659, 0, 523, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 523, 0, 440, 0, 523, 0, 440, 0, 523, 0, 440, 0, 523, 0, 440, 0, 440, 0, 440, 0, 392, 0, 330, 0, 392, 0, 440, 0, 440, 0, 659, 0, 523, 0, 440, 0, 330, 0, 392, 0, 440, 0, 440, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 330, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 330, 0, 440, 0, 440, 0, 392, 0, 440, 0, 392, 0, 440, 0, 392, 0, 220, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 784, 0, 587, 0, 659, 0, 587, 0, 523, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 831, 0, 587, 0, 659, 0, 587, 0, 523, 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 523, 0, 587, 0, 659, 0, 523, 0, 698, 0, 659, 0, 698, 0, 659, 0, 587, 0, 494, 0, 523, 0, 587, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0,
-392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 523, 0, 494, 0, 392, 0, 440, 0, 523, 0, 523, 0, 494, 0, 494, 0, 392, 0, 330, 0, 523, 0, 494, 0, 392, 0, 440, 0, 659, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 523, 0, 494, 0, 392, 0, 440, 0, 523, 0, 523, 0, 494, 0, 494, 0, 392, 0, 330, 0, 523, 0, 494, 0, 392, 0, 440, 0, 659, 0, 659, 0, 659, 0, 659, 0, 587, 0, 523, 0, 659, 0, 659, 0, 659, 0, 659, 0, 784, 0, 523, 0, 1047, 0, 1047, 0, 1047, 0, 1047, 0, 988, 0, 880, 0, 784, 0, 698, 0, 1047, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 1047, 0, 1047, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 784, 0, 587, 0, 659, 0, 587, 0, 523, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 587, 0, 587, 0, 659, 0, 659, 0, 659, 0, 659, 0, 831, 0, 587, 0, 659, 0, 587, 0, 523, 0, 1047, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 1047, 0, 1047, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 1047, 0, 1047, 0, 1047, 0, 880, 0, 1047, 0, 880, 0, 1047, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 440, 0, 440, 0, 659, 0, 659, 0, 698, 0, 659, 0, 523, 0, 523, 0, 440, 0, 523, 0, 523, 0 };
-static const u16 song2_note_duration_right[] = { 1838, 250, 2, 244, 8, 250, 2, 250, 2, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 624, 250, 2, 244, 8, 250, 2, 250, 2, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 1632, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 502, 2, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 502, 254, 111, 141, 210, 42, 178, 75, 201, 51, 424, 80, 138, 114, 246, 6, 136, 117, 150, 102, 250, 2, 754, 506, 100, 152, 250, 2, 110, 142, 250, 2, 139, 113, 220, 33, 116, 137, 186, 66, 165, 87, 232, 20, 502, 2, 136, 117, 250, 2, 167, 85, 1287, 703, 347, 157, 331, 170, 247, 2, 110, 140, 229, 37, 214, 61, 1287, 2999, 111, 141, 210, 42, 178, 75, 201, 51, 424, 80, 138, 114, 246, 6, 136, 117, 150, 102, 502, 1011, 100, 152, 250, 2, 110, 142, 250, 2, 139, 113, 220, 33, 116, 137, 186, 66, 165, 87, 220, 33, 250, 2, 250, 2, 136, 117, 250, 2, 167, 85, 1287, 703, 347, 157, 331, 170, 247, 2, 110, 140, 229, 37, 214, 61, 1287, 3125, 106, 20, 86, 40, 71, 55, 122, 19, 114, 202, 196, 860, 71, 56, 106, 20, 87, 39, 71, 55, 123, 18, 114, 202, 196, 851, 97, 150, 245, 2, 120, 151, 403, 309, 83, 222, 403, 60, 308, 38, 534, 916, 111, 141, 210, 42, 111, 141, 227, 25, 402, 102, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 282, 2, 123, 2, 99, 2, 879, 1405, 111, 141, 210, 42, 111, 141, 227, 34, 227, 16, 202, 51, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 242, 32, 111, 2, 113, 19, 879, 136, 250, 2, 250, 2, 250, 2, 234, 18, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 624, 250, 2, 244, 8, 250, 2, 250, 2, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 1632, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 502, 254, 111, 141, 210, 42, 178, 75, 201, 51, 424, 80, 138, 114, 246, 6, 136, 117, 150, 102, 250, 2, 754, 506, 100, 152, 250, 2, 110, 142, 250, 2, 139, 113, 220, 33, 116, 137, 186, 66, 165, 87, 232, 20, 502, 2, 136, 117, 250, 2, 167, 85, 1287, 703, 347, 157, 331, 170, 247, 2, 110, 140, 229, 37, 214, 61, 1287, 2999, 111, 141, 210, 42, 178, 75, 201, 51, 424, 80, 138, 114, 246, 6, 136, 117, 150, 102, 502, 1011, 100, 152, 250, 2, 110, 142, 250, 2, 139, 113, 220, 33, 116, 137, 186, 66, 165, 87, 220, 33, 250, 2, 250, 2, 136, 117, 250, 2, 167, 85, 1287, 703, 347, 157, 331, 170, 247, 2, 110, 140, 229, 37, 214, 61, 1287, 3125, 106, 20, 86, 40, 71, 55, 122, 19, 114, 202, 196, 860, 71, 56, 106, 20, 87, 39, 71, 55, 123, 18, 114, 202, 196, 851, 97, 150, 245, 2, 120, 151, 403, 309, 83, 222, 403, 60, 308, 38, 534, 916, 111, 141, 210, 42, 111, 141, 227, 25, 402, 102, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 282, 2, 123, 2, 99, 2, 879, 1405, 111, 141, 210, 42, 111, 141, 227, 34, 227, 16, 202, 51, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 242, 32, 111, 2, 113, 19, 879, 136, 250, 2, 250, 2, 250, 2, 250, 2, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 624, 250, 2, 244, 8, 250, 2, 250, 2, 754, 2, 250, 2, 250, 2, 250, 2, 1006, 254, 246, 6, 502, 2, 248, 257, 611, 100, 102, 161, 250, 23, 381, 160, 612, 1632, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 502, 2, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 502, 2, 395, 109, 374, 130, 101, 151, 107, 145, 214, 38, 109, 143, 190, 62, 128, 124, 157, 96, 144, 108, 118, 134, 70, 56, 335, 43, 85, 167, 358, 146, 400, 104, 106, 146, 116, 137, 221, 32, 108, 144, 125, 127, 136, 117, 154, 98, 140, 112, 120, 132, 70,
-56, 335, 43, 99, 153, 395, 109, 374, 130, 101, 151, 107, 145, 214, 38, 109, 143, 190, 62, 128, 124, 157, 96, 144, 108, 118, 134, 70, 56, 335, 43, 85, 167, 358, 146, 400, 104, 106, 146, 116, 137, 221, 32, 108, 144, 150, 80, 128, 148, 97, 43, 107, 136, 133, 180, 310, 233, 232, 40, 232, 257, 265, 2, 324, 181, 306, 204, 707, 44, 175, 70, 250, 4, 165, 80, 217, 37, 259, 2, 638, 85, 267, 2, 339, 161, 286, 247, 555, 209, 169, 69, 102, 159, 181, 69, 242, 2, 254, 2, 338, 400, 265, 2, 324, 181, 306, 204, 707, 44, 175, 70, 250, 4, 165, 80, 217, 37, 259, 2, 638, 85, 267, 2, 339, 161, 286, 247, 555, 209, 169, 69, 102, 159, 181, 69, 242, 2, 254, 2, 2015, 745, 209, 45, 114, 144, 189, 45, 243, 2, 257, 2, 1415, 1353, 181, 51, 106, 148, 170, 66, 244, 27, 251, 2, 503, 2, 106, 2, 1255, 691, 81, 147, 217, 2, 120, 136, 230, 2, 255, 17, 411, 2411, 81, 146, 218, 2, 119, 137, 229, 2, 255, 18, 410, 405, 111, 141, 210, 42, 111, 141, 227, 25, 402, 102, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 282, 2, 123, 2, 99, 2, 879, 1405, 111, 141, 210, 42, 111, 141, 227, 34, 227, 16, 202, 51, 169, 83, 184, 68, 110, 142, 232, 20, 348, 157, 357, 154, 357, 148, 89, 145, 199, 36, 96, 213, 383, 70, 242, 32, 111, 2, 113, 19, 879, 3413, 81, 147, 217, 2, 120, 136, 230, 2, 255, 17, 411, 2411, 81, 146, 218, 2, 119, 137, 229, 2, 255, 18, 410, 2422, 81, 147, 217, 2, 120, 136, 230, 2, 255, 17, 411, 4181, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 121, 131, 396, 108, 105, 147, 128, 124, 250, 2, 213, 39, 189, 315, 420, 84, 189, 63, 133, 119, 241, 12, 246, 258, 91, 161, 220, 33, 236, 16, 337, 167, 516, 1000 };
-static const u16 song2_note_left[] = { 0 };
-static const u16 song2_note_duration_left[] = { 65535 };
+static const u8 song2_phrase_events[] = { 0, 142, 46, 72, 129, 122, 0, 2, 74, 129, 116, 0, 8, 76, 129, 122, 0, 2, 72, 129, 122, 0, 2, 77, 133, 114, 0, 2, 76, 129, 122, 0, 2, 77, 129, 122, 0, 2, 76, 129, 122, 0, 2, 74, 135, 110, 0, 129, 126, 71, 129, 118, 0, 6, 72, 131, 118, 0, 2, 74, 129, 120, 0, 130, 1, 76, 132, 99, 0, 100, 76, 102, 0, 129, 33, 76, 129, 122, 0, 23, 74, 130, 125, 0, 129, 32, 72, 132, 100, 0, 132, 112, 0, 140, 96, 69, 129, 61, 0, 130, 59, 69, 131, 36, 0, 84, 76, 129, 61, 0, 63, 76, 129, 5, 0, 119, 77, 129, 113, 0, 12, 76, 129, 118, 0, 130, 2, 69, 121, 0, 129, 3, 69, 131, 12, 0, 108, 76, 105, 0, 129, 19, 76, 129, 0, 0, 124, 77, 129, 122, 0, 2, 76, 129, 85, 0, 39, 72, 91, 0, 129, 33, 72, 129, 92, 0, 33, 69, 129, 108, 0, 16, 72, 130, 81, 0, 129, 39, 72, 131, 118, 0, 2, 0, 129, 126, 67, 111, 0, 129, 13, 69, 129, 82, 0, 42, 67, 129, 50, 0, 75, 69, 129, 73, 0, 51, 69, 131, 40, 0, 80, 69, 129, 10, 0, 114, 72, 129, 118, 0, 6, 69, 129, 8, 0, 117, 67, 129, 22, 0, 102, 69, 129, 122, 0, 2, 67, 133, 114, 0, 131, 122, 69, 100, 0, 129, 24, 69, 129, 122, 0, 2, 67, 110, 0, 129, 14, 69, 129, 122, 0, 2, 67, 129, 11, 0, 113, 69, 129, 92, 0, 33, 67, 116, 0, 129, 9, 72, 129, 58, 0, 66, 69, 129, 37, 0, 87, 67, 129, 104, 0, 20, 69, 131, 118, 0, 2, 64, 129, 8, 0, 117, 67, 129, 122, 0, 2, 69, 129, 39, 0, 85, 69, 138, 7, 0, 133, 63, 76, 130, 91, 0, 129, 29, 72, 130, 75, 0, 129, 42, 69, 129, 119, 0, 2, 64, 110, 0, 129, 12, 67, 129, 101, 0, 37, 69, 129, 86, 0, 61, 69, 138, 7, 0, 151, 55, 72, 111, 0, 129, 13, 72, 129, 82, 0, 42, 69, 129, 50, 0, 75, 72, 129, 73, 0, 51, 72, 131, 40, 72, 129, 8, 0, 117, 69, 129, 22, 0, 102, 72, 131, 118, 0, 135, 115, 72, 100, 0, 129, 24, 72, 129, 122, 0, 2, 69, 110, 0, 129, 14, 72, 129, 122, 0, 2, 69, 129, 11, 0, 113, 72, 129, 92, 0, 33, 69, 116, 69, 129, 92, 0, 33, 69, 129, 122, 0, 2, 67, 129, 122, 0, 152, 53, 67, 106, 0, 20, 67, 86, 0, 40, 67, 71, 0, 55, 67, 122, 0, 19, 65, 114, 0, 129, 74, 64, 129, 68, 0, 134, 92, 67, 71, 0, 56, 67, 106, 0, 20, 67, 87, 0, 39, 67, 71, 0, 55, 67, 123, 0, 18, 65, 114, 0, 129, 74, 64, 129, 68, 0, 134, 83, 69, 97, 0, 129, 22, 69, 129, 117, 0, 2, 67, 120, 0, 129, 23, 69, 131, 19, 0, 130, 53, 67, 83, 0, 129, 94, 69, 131, 19, 0, 60, 67, 130, 52, 0, 38, 57, 132, 22, 0, 135, 20, 81, 111, 0, 129, 13, 81, 129, 82, 0, 42, 81, 111, 0, 129, 13, 81, 129, 99, 0, 25, 81, 131, 18, 0, 102, 79, 129, 41, 0, 83, 79, 129, 56, 0, 68, 79, 110, 0, 129, 14, 79, 129, 104, 0, 20, 74, 130, 92, 0, 129, 29, 74, 130, 101, 0, 129, 26, 76, 130, 101, 0, 129, 20, 76, 89, 0, 129, 17, 76, 129, 71, 0, 36, 76, 96, 0, 129, 85, 79, 130, 127, 0, 70, 74, 130, 26, 0, 2, 76, 123, 0, 2, 74, 99, 0, 2, 72, 134, 111, 0, 138, 125, 0, 34, 81, 129, 99, 0, 16, 81, 129, 74, 0, 51, 80, 130, 127, 0, 70, 74, 129, 114, 0, 32, 76, 111, 0, 2, 74, 113, 0, 19, 72, 134, 111, 0, 129, 8, 72, 129, 122, 0, 2, 74, 129, 122, 0, 2, 76, 129, 122, 0, 2, 72, 129, 106, 0, 18, 67, 131, 11, 0, 109, 67, 130, 118, 0, 129, 2, 67, 101, 0, 129, 23, 67, 107, 0, 129, 17, 67, 129, 86, 0, 38, 67, 109, 0, 129, 15, 67, 129, 62, 0, 62, 67, 129, 0, 0, 124, 67, 129, 29, 0, 96, 67, 129, 16, 0, 108, 67, 118, 0, 129, 6, 67, 70, 0, 56, 67, 130, 79, 0, 43, 67, 85, 0, 129, 39, 67, 130, 102, 0, 129, 18, 67, 131, 16, 0, 104, 67, 106, 0, 129, 18, 67, 116, 0, 129, 9, 67, 129, 93, 0, 32, 67, 108, 0, 129, 16, 67, 125, 0, 127, 67, 129, 8, 0, 117, 67, 129, 26, 0, 98, 67, 129, 12, 0, 112, 67, 120, 0, 129, 4, 67, 99, 0, 129, 25, 67, 129, 22, 0, 80, 67, 129, 0, 0, 129, 20, 67, 97, 0, 43, 67, 107, 0, 129, 8, 67, 129, 5, 0, 129, 52, 67, 130, 54, 0, 129, 105, 67, 129, 104, 0, 40, 65, 129, 104, 0, 130, 1, 72, 130, 9, 0, 2, 71, 130, 68, 0, 129, 53, 67, 130, 50, 0, 129, 76, 69, 133, 67, 0, 44, 72, 129, 47, 0, 70, 72, 129, 122, 0, 4, 71, 129, 37, 0, 80, 71, 129, 89, 0, 37, 67, 130, 3, 0, 2, 64, 132, 126, 0, 85, 72, 130, 11, 0, 2, 71, 130, 83, 0, 129, 33, 67, 130, 30, 0, 129, 119, 69, 132, 43, 0, 129, 81, 76, 129, 41, 0, 69, 76, 102, 0, 129, 31, 76, 129, 53, 0, 69, 76, 129, 114, 0, 2, 74, 129, 126, 0, 2, 72, 130, 82, 0, 131, 16, 72, 143, 95, 0, 133, 105, 76, 129, 81, 0, 45, 76, 114, 0, 129, 16, 76, 129, 61, 
+0, 45, 76, 129, 115, 0, 2, 79, 130, 1, 0, 2, 72, 139, 7, 0, 138, 73, 84, 129, 53, 0, 51, 84, 106, 0, 129, 20, 84, 129, 42, 0, 66, 84, 129, 116, 0, 27, 83, 129, 123, 0, 2, 81, 131, 119, 0, 2, 79, 106, 0, 2, 77, 137, 103, 0, 133, 51, 84, 81, 0, 129, 19, 84, 129, 89, 0, 2, 81, 120, 0, 129, 8, 84, 129, 102, 0, 2, 81, 129, 127, 0, 17, 84, 131, 27, 0, 146, 107, 84, 81, 0, 129, 18, 84, 129, 90, 0, 2, 81, 119, 0, 129, 9, 84, 129, 101, 0, 2, 81, 129, 127, 0, 18, 84, 131, 26, 0, 131, 21, 0, 154, 85, 0, 146, 118, 0, 160, 85, 72, 132, 4, 0, 135, 104 };
+static const PhraseType song2_phrases[] = { { 0, 92 }, { 3, 86 }, { 92, 65 }, { 95, 32 }, { 157, 26 }, { 95, 62 }, { 157, 24 }, { 183, 196 }, { 209, 12 }, { 379, 48 }, { 274, 13 }, { 427, 13 }, { 295, 58 }, { 440, 205 }, { 543, 18 }, { 645, 12 }, { 568, 53 }, { 657, 44 }, { 23, 69 }, { 657, 39 }, { 18, 74 }, { 701, 125 }, { 757, 9 }, { 826, 5 }, { 701, 101 }, { 831, 149 }, { 874, 100 }, { 980, 139 }, { 543, 102 }, { 657, 21 }, { 1119, 3 }, { 1057, 59 }, { 1122, 3 }, { 1057, 28 }, { 1125, 3 }, { 157, 21 }, { 1128, 6 } };
+static const PhraseRefType song2_playlist_voice0[] = { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 3, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 10, 1 }, { 11, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 17, 1 }, { 18, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 10, 1 }, { 11, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 19, 1 }, { 20, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 3, 1 }, { 4, 1 }, { 21, 1 }, { 22, 1 }, { 23, 1 }, { 24, 1 }, { 25, 1 }, { 26, 1 }, { 27, 1 }, { 28, 1 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 29, 1 }, { 30, 1 }, { 31, 1 }, { 32, 1 }, { 33, 1 }, { 34, 1 }, { 5, 1 }, { 3, 1 }, { 35, 1 }, { 36, 1 } };
+static const SeekPointType song2_seek_voice0[] = { { 0, 0, 0, 0 }, { 3854, 0, 0, 33 }, { 7853, 0, 0, 75 }, { 11919, 1, 0, 33 }, { 15918, 1, 0, 75 }, { 19984, 2, 0, 106 }, { 23933, 3, 0, 104 }, { 27967, 5, 0, 104 }, { 32000, 6, 0, 104 }, { 35866, 8, 0, 196 }, { 39900, 8, 0, 252 }, { 43179, 8, 0, 312 }, { 47214, 8, 0, 350 }, { 51962, 8, 0, 364 }, { 55787, 10, 0, 400 }, { 59319, 13, 0, 312 }, { 63354, 13, 0, 350 }, { 67978, 14, 0, 449 }, { 71913, 14, 0, 506 }, { 75959, 14, 0, 548 }, { 79982, 14, 0, 611 }, { 83884, 15, 0, 545 }, { 87904, 17, 0, 608 }, { 91588, 19, 0, 23 }, { 95621, 19, 0, 65 }, { 99653, 20, 0, 23 }, { 103686, 20, 0, 65 }, { 107907, 21, 0, 98 }, { 111940, 22, 0, 98 }, { 115783, 24, 0, 183 }, { 119565, 24, 0, 239 }, { 123854, 24, 0, 312 }, { 127889, 24, 0, 350 }, { 129176, 24, 0, 353 }, { 135199, 26, 0, 392 }, { 139994, 29, 0, 312 }, { 143968, 29, 0, 348 }, { 145316, 30, 0, 440 }, { 151490, 30, 0, 498 }, { 155466, 30, 0, 540 }, { 159918, 30, 0, 600 }, { 163043, 30, 0, 642 }, { 167985, 33, 0, 600 }, { 171759, 34, 0, 691 }, { 175791, 35, 0, 59 }, { 179824, 36, 0, 13 }, { 183856, 36, 0, 59 }, { 186761, 37, 0, 92 }, { 191922, 37, 0, 147 }, { 195956, 39, 0, 178 }, { 199989, 40, 0, 147 }, { 203856, 42, 0, 175 }, { 207930, 43, 0, 761 }, { 211965, 44, 0, 761 }, { 215998, 46, 0, 761 }, { 219848, 47, 0, 857 }, { 223929, 47, 0, 911 }, { 227982, 47, 0, 964 }, { 231997, 48, 0, 911 }, { 235981, 48, 0, 962 }, { 239822, 49, 0, 996 }, { 243984, 49, 0, 1030 }, { 247836, 49, 0, 1072 }, { 251865, 49, 0, 1103 }, { 255704, 50, 0, 588 }, { 259845, 50, 0, 642 }, { 263771, 53, 0, 588 }, { 267921, 55, 0, 1119 }, { 271901, 56, 0, 1069 }, { 275929, 56, 0, 1100 }, { 279969, 58, 0, 1069 }, { 281020, 59, 0, 1125 }, { 287722, 60, 0, 132 }, { 291975, 62, 0, 165 } };
+
+static const VoiceType song2_voices[] = { { song2_playlist_voice0, sizeof( song2_playlist_voice0 ) / sizeof( song2_playlist_voice0[0] ), song2_seek_voice0, sizeof( song2_seek_voice0 ) / sizeof( song2_seek_voice0[0] ) }, { song2_playlist_voice0, sizeof( song2_playlist_voice0 ) / sizeof( song2_playlist_voice0[0] ), song2_seek_voice0, sizeof( song2_seek_voice0 ) / sizeof( song2_seek_voice0[0] ) } };
 
-static const SongInfoType song2 = { "Bad Romance", "Lady Gaga", song2_note_right, song2_note_duration_right, sizeof( song2_note_right ) / sizeof( song2_note_right[0] ), song2_note_right, song2_note_duration_right, sizeof( song2_note_right ) / sizeof( song2_note_right[0] ) };
+static const SongInfoType song2 = { "Bad Romance", "Lady Gaga", song2_phrase_events, song2_phrases, song2_voices, sizeof( song2_voices ) / sizeof( song2_voices[0] ), 294280 };
 
 /* Song #3 */
-static const u16 song3_note_right[] = { 0, 740, 185, 370, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 740, 185, 370, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 740, 147, 294, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 0, 0, 740, 139, 277, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 165, 330, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 0, 0, 740, 185, 370, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 740, 185, 370, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 740, 147, 294, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1109, 0, 880, 0, 988, 0, 831, 0, 880, 0, 740, 0, 831, 0, 659, 0, 0, 0, 740, 139, 277, 0, 0, 0, 831, 0, 880, 0, 740, 0, 831, 0, 880, 0, 740, 0, 831, 0, 1319, 139, 277, 0, 1109, 0, 880, 0, 740, 0, 0, 0, 659, 139, 277, 0, 740, 0, 880, 0, 1109, 0, 0, 0, 1319, 139, 277, 0, 1109, 0, 880, 0, 831, 0, 0, 0, 740, 0, 831, 0, 880, 0, 1109, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 880, 147, 294, 0, 740, 0, 0, 0, 880, 147, 294, 0, 740, 0, 0, 0, 880, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 1175, 0, 1319, 0, 1480, 0, 0, 0, 1175, 147, 294, 0, 1319, 0, 1480, 0, 1661, 0, 0, 0, 1319, 147, 294, 0, 1480, 0, 1661, 0, 1760, 0, 0, 0, 1480, 147, 294, 0, 1661, 0, 1760, 0, 1976, 0, 0, 0, 880, 185, 370, 0, 880, 0, 740, 0, 0, 0, 880, 185, 370, 0, 880, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 880, 185, 370, 0, 880, 0, 740, 0, 0, 0, 880, 185, 370, 0, 880, 0, 740, 0, 0, 0, 880, 185, 370, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 1109, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 1109, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 1109, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 1109, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 740, 0, 0, 0, 988, 123, 247, 0, 988, 0, 740, 0, 0, 0, 988, 123, 247, 0, 988, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 988, 123, 247, 0, 988, 0, 740, 0, 0, 0, 988, 123, 247, 0, 988, 0, 740, 0, 0, 0, 988, 123, 247, 0, 740, 0, 0, 0, 880, 147, 294, 0, 880, 0, 740, 0, 0, 0, 880, 147, 294, 0, 880, 0, 740, 0, 0, 0, 880, 147, 294, 0, 740, 0, 0, 0, 1109, 147, 294, 0, 988, 0, 1109, 0, 988, 0, 0, 0, 1109, 147, 294, 0, 988, 0, 1109, 0, 988, 0, 0, 0, 1109, 147, 294, 0, 988, 0, 1109, 0, 988, 0, 0, 0, 1109, 147, 294, 0, 988, 0, 1109, 0, 988, 0, 0, 0, 185, 370, 0, 0, 1109, 0, 1109, 0, 1109, 0, 988, 0, 880, 0, 988, 0, 1109, 0, 988, 0, 880, 0, 988, 147, 294, 0, 1109, 0, 988, 0, 880, 0, 740, 0, 988, 0, 880, 0, 0, 0, 988, 165, 330, 0, 988, 0, 988, 0, 880, 0, 988, 0, 1109, 0, 988, 0, 880, 0, 0, 0, 988, 165, 330, 0, 0, 0, 1109, 165, 330, 0, 0, 0, 988, 165, 330, 0, 880, 0, 0, 165, 330, 0, 740, 0, 0, 0, 185, 370, 1760, 0, 2960, 0, 0, 0, 3520, 185, 370, 0, 2960, 0, 2217, 0, 0, 0, 1760, 185, 370, 0, 2217, 0, 1760, 0, 2217, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 370, 0, 440, 554, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 988, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 740, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1109, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 0, 880, 370, 440, 0, 0, 294, 0, 0,
-740, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 294, 0, 370, 440, 0, 0, 880, 294, 0, 370, 440, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 740, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 988, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 370, 0, 0, 988, 440, 554, 0, 0, 370, 0, 0, 880, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 740, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1109, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 0, 880, 370, 440, 0, 0, 294, 0, 0, 740, 370, 440, 0, 0, 294, 0, 0, 880, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 294, 0, 370, 440, 0, 0, 880, 294, 0, 370, 440, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 740, 370, 0, 440, 554, 0, 0, 0, 370, 0, 440, 554, 0, 0, 988, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1175, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 988, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 988, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 0, 740, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1175, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 370, 440, 0, 0, 0, 1175, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1319, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 330, 659, 0, 880, 0, 988, 0, 0, 1109, 220, 0, 277, 330, 0, 0, 220, 0, 0, 988, 277, 330, 0, 0, 220, 0, 277, 330, 0, 0, 0, 880, 220, 0, 277, 330, 0, 0, 0, 1319, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 1319, 330, 0, 415, 494, 0, 0, 0, 1319, 294, 0, 370, 440, 0, 0, 0, 1319, 294, 0, 0, 1175, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 1109, 294, 0, 370, 440, 0, 0, 0, 880, 294, 0, 370, 440, 0, 0, 0, 880, 294, 0, 0, 988, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 294, 0, 370, 440, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 1175, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 0, 1109, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 294, 0, 370, 440, 0, 0, 294, 0, 0, 988, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 880, 294, 0, 370, 440, 0, 0, 0, 880, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 988, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 880, 294, 0, 370, 440, 0, 0, 0, 880, 294, 0, 0, 988, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 294, 0, 370, 440, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 988, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 1319, 294, 0, 370, 440, 0, 0, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 1175, 247,
-0, 294, 370, 0, 0, 0, 1175, 247, 0, 0, 1175, 294, 370, 0, 0, 247, 0, 294, 370, 0, 0, 0, 1175, 247, 0, 294, 370, 0, 0, 0, 1175, 247, 0, 294, 370, 0, 0, 0, 1109, 247, 0, 0, 988, 294, 370, 0, 0, 247, 0, 294, 370, 0, 0, 0, 880, 247, 0, 294, 370, 0, 0, 0, 1319, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 330, 988, 0, 1109, 0, 1319, 0, 0, 1480, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 1480, 294, 0, 370, 440, 0, 0, 0, 1480, 294, 0, 370, 440, 0, 0, 294, 0, 0, 1319, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1319, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 370, 0, 440, 554, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 1109, 330, 0, 415, 494, 0, 0, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 880, 330, 0, 415, 494, 0, 0, 0, 1109, 277, 0, 330, 415, 0, 0, 277, 0, 330, 415, 0, 0, 277, 0, 330, 415, 0, 0, 277, 0, 330, 415, 0, 0, 277, 0, 330, 415, 0, 0, 0, 880, 277, 0, 330, 415, 0, 0, 0, 1109, 277, 0, 330, 415, 0, 0, 0, 1319, 277, 0, 330, 415, 0, 0, 0, 1480, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 1480, 294, 0, 0, 1480, 370, 440, 0, 0, 0, 1480, 294, 0, 370, 440, 0, 0, 294, 0, 0, 1319, 370, 440, 0, 0, 294, 0, 370, 440, 0, 0, 0, 988, 294, 0, 370, 440, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 0, 1319, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 988, 370, 0, 440, 554, 0, 0, 0, 1109, 370, 0, 440, 554, 0, 0, 370, 0, 440, 554, 0, 0, 0, 740, 370, 0, 440, 554, 0, 0, 0, 880, 370, 0, 440, 554, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 0, 988, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 415, 494, 0, 0, 0, 988, 330, 0, 0, 880, 0, 740, 0, 659, 1319, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 0, 988, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 988, 440, 554, 0, 0, 0, 880, 370, 0, 0, 740, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 370, 0, 0, 1109, 440, 554, 0, 0, 0, 2637, 370, 0, 440, 554, 0, 0, 0, 1109, 294, 0, 0, 1109, 370, 440, 0, 0, 294, 0, 0, 988, 370, 440, 0, 0, 0, 1109, 294, 0, 0, 1175, 370, 440, 0, 0, 0, 1319, 294, 0, 0, 1109, 370, 440, 0, 0, 0, 1319, 330, 0, 0, 1480, 415, 494, 0, 0, 0, 1661, 330, 0, 0, 3520, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 1319, 370, 0, 0, 1109, 440, 554, 0, 0, 0, 880, 370, 0, 0, 1760, 440, 554, 0, 0, 370, 0, 0, 880, 440, 554, 0, 0, 0, 1760, 370, 0, 0, 2217, 440, 554, 0, 0, 370, 0, 0, 1760, 440, 554, 0, 0, 0, 2217, 370, 0, 0, 2349, 440, 554, 0, 0, 0, 2637, 370, 0, 440, 554, 0, 0, 0, 2349, 370, 0, 0, 2217, 440, 554, 0, 0, 0, 2960, 294, 0, 0, 2960, 370, 440, 0, 0, 0, 2349, 294, 0, 0, 2960, 370, 440, 0, 0, 0, 2960, 294, 0, 0, 2349, 370, 440, 0, 0, 0, 2960, 294, 0, 0, 2349, 370, 440, 0, 0, 0, 2637, 330, 0, 1976, 0, 0, 2637, 415, 494, 0, 1976, 0, 0, 0, 2637, 330, 0, 1976, 0, 0, 2637, 415, 494, 0, 1976, 0, 0, 0, 2637, 330, 0, 1976, 0, 0, 2637, 415, 494, 0, 1976, 0, 0, 0, 2637, 330, 0, 1976, 0, 0, 2637, 415, 494, 0, 1976, 0, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 0, 988, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 988, 440, 554, 0, 0, 0, 880, 370, 0, 0, 740, 440, 554, 0, 0, 0, 1109, 370, 0, 0, 1109, 440, 554, 0, 0, 370, 0, 0, 880, 440, 554, 0, 0, 0, 988, 370, 0, 0, 1109, 440, 554, 0, 0, 0, 2637, 370, 0, 440, 554, 0, 0, 0, 1760, 294, 0, 1319, 0, 0, 1760, 370, 440, 0, 1319, 0, 0, 0, 1760, 294, 0, 1319, 0, 0, 1480, 370, 440, 0, 1175, 0, 0, 0, 1480, 294, 0, 1175, 0, 0, 1480, 370, 440, 0, 1175, 0, 0, 0, 1319, 294, 0, 1175, 0, 0, 1319, 370, 440, 0, 1175, 0, 0, 0, 1319, 330, 0, 0, 1480, 415, 494, 0, 0, 0, 1661, 330, 0, 0, 3520, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 330, 0, 415, 494, 0, 0, 0, 1319, 370, 0, 0, 1319, 440, 554, 0, 0, 370, 0, 0, 1109, 440, 554, 0, 1175, 0, 0, 0, 1319, 370, 0, 0, 1175, 440, 554, 0, 0, 0,
-1109, 370, 0, 0, 880, 440, 554, 0, 0, 0, 1319, 370, 0, 0, 1319, 440, 554, 0, 0, 370, 0, 0, 1109, 440, 554, 0, 1175, 0, 0, 0, 1319, 370, 0, 0, 1760, 440, 554, 0, 0, 0, 3520, 370, 0, 440, 554, 0, 0, 0, 3520, 294, 0, 2637, 0, 0, 3520, 370, 440, 0, 2637, 0, 0, 0, 3520, 294, 0, 2637, 0, 0, 3520, 370, 440, 0, 2637, 0, 0, 0, 3520, 294, 0, 2637, 0, 0, 3520, 370, 440, 0, 2637, 0, 0, 0, 3520, 294, 0, 2637, 0, 0, 3520, 370, 440, 0, 2637, 0, 0, 0, 2349, 330, 659, 0, 0, 0, 2637, 370, 740, 0, 0, 0, 2349, 330, 659, 0, 0, 0, 2217, 294, 587, 0, 0, 0, 1976, 277, 554, 0, 0, 0, 4435, 370, 0, 220, 0, 277, 0, 370, 0, 0, 220, 0, 277, 0, 370, 0, 220, 0, 277, 0, 370, 0, 220, 0, 277, 0, 370, 0, 220, 0, 277, 0, 370, 0, 185, 0, 370, 0, 1109, 185, 0, 0, 1109, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 988, 185, 0, 0, 880, 370, 0, 0, 988, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 185, 0, 370, 0, 740, 185, 0, 0, 880, 370, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 880, 147, 0, 0, 740, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 147, 0, 294, 0, 880, 147, 0, 294, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 740, 165, 0, 0, 880, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 330, 0, 0, 988, 165, 0, 0, 880, 330, 0, 165, 0, 0, 740, 330, 0, 185, 370, 0, 0, 0, 185, 0, 370, 0, 1109, 185, 0, 0, 1109, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 988, 185, 0, 0, 880, 370, 0, 0, 988, 185, 0, 0, 988, 370, 0, 185, 0, 0, 880, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 740, 185, 0, 0, 880, 370, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 147, 0, 0, 988, 294, 0, 147, 0, 0, 880, 294, 0, 147, 0, 0, 740, 294, 0, 147, 0, 294, 0, 0, 147, 0, 294, 0, 147, 0, 294, 0, 880, 147, 0, 294, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 740, 185, 0, 370, 0, 185, 0, 370, 0, 0, 988, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 1175, 147, 0, 294, 0, 0, 1175, 147, 0, 0, 1109, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1175, 147, 0, 294, 0, 0, 1175, 147, 0, 0, 1109, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 988, 185, 0, 370, 0, 0, 880, 185, 0, 0, 740, 370, 0, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 1175, 147, 0, 294, 0, 0, 1175, 147, 0, 0, 1109, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1175, 147, 0, 294, 0, 0, 1175, 147, 0, 0, 1109, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1319, 165, 0, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 165, 0, 659, 0, 880, 0, 988, 0, 1109, 110, 0, 220, 0, 110, 0, 0, 988, 220, 0, 110, 0, 220, 0, 0, 880, 110, 0, 220, 0, 0, 1319, 165, 0, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 1319, 165, 0, 330, 0, 0, 1319, 147, 0, 294, 0, 0, 1319, 147, 0, 0, 1175, 294, 0, 147, 0, 294, 0, 0, 1109, 147, 0, 294, 0, 0, 880, 147, 0, 294, 0, 0, 880, 147, 0, 0, 988, 294, 0, 147, 0, 294, 0, 0, 147, 0, 294, 0, 1109, 185, 0, 370, 0, 0, 1109, 185, 0, 0, 1175, 370, 0, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 0, 1109, 330, 0, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 147, 0, 294, 0, 147, 0, 0, 988, 294, 0, 147, 0, 294, 0, 0, 880, 147, 0, 294, 0, 0, 880, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 880, 147, 0, 294, 0, 0, 880, 147, 0, 0, 988, 294, 0, 147, 0, 294, 0, 0, 147, 0, 294, 0, 1109, 185, 0, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 1319, 147, 0, 294, 0, 147, 0, 0, 1109, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1175, 123, 0, 0, 1175, 247, 0, 123, 0, 0, 1175, 247, 0, 0, 1175, 123, 0, 247, 0, 0, 1175, 123, 0, 247, 0, 0, 1175, 123, 0, 0,
-1175, 247, 0, 0, 1175, 123, 0, 247, 0, 0, 1319, 123, 0, 247, 0, 0, 1480, 123, 0, 0, 1319, 247, 0, 165, 0, 330, 0, 0, 1319, 165, 0, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 165, 0, 880, 0, 1109, 0, 1319, 0, 1480, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1480, 147, 0, 294, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 0, 1319, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1319, 185, 0, 0, 1109, 370, 0, 185, 0, 370, 0, 185, 0, 370, 0, 185, 0, 370, 0, 0, 185, 0, 370, 0, 880, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 988, 165, 0, 330, 0, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 330, 0, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 1109, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 0, 880, 139, 0, 277, 0, 0, 1109, 139, 0, 277, 0, 0, 1319, 139, 0, 277, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1480, 147, 0, 0, 1480, 294, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 0, 1319, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1319, 185, 0, 0, 1109, 370, 0, 185, 0, 370, 0, 0, 988, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 185, 0, 370, 0, 0, 740, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 988, 165, 0, 330, 0, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 0, 880, 0, 740, 0, 659, 1319, 0, 0, 1109, 185, 0, 0, 1109, 370, 0, 185, 0, 0, 988, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 0, 880, 185, 0, 0, 740, 370, 0, 0, 1109, 185, 0, 0, 1109, 370, 0, 185, 0, 0, 880, 370, 0, 0, 988, 185, 0, 0, 1109, 370, 0, 0, 2637, 185, 0, 370, 0, 0, 1760, 147, 0, 0, 1760, 294, 0, 147, 0, 0, 1661, 294, 0, 0, 1760, 147, 0, 0, 1976, 294, 0, 0, 2217, 147, 0, 0, 1760, 294, 0, 0, 2217, 165, 0, 0, 1976, 330, 0, 0, 1760, 165, 0, 0, 1976, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 2637, 185, 0, 0, 1109, 370, 0, 0, 880, 185, 0, 0, 1760, 370, 0, 185, 0, 0, 880, 370, 0, 0, 1760, 185, 0, 0, 2217, 370, 0, 185, 0, 0, 1760, 370, 0, 0, 2217, 185, 0, 0, 2349, 370, 0, 0, 2637, 185, 0, 370, 0, 0, 2349, 185, 0, 0, 2217, 370, 0, 0, 1760, 147, 0, 0, 1760, 294, 0, 0, 1319, 147, 0, 0, 1760, 294, 0, 0, 1760, 147, 0, 0, 1319, 294, 0, 0, 1175, 147, 0, 0, 1109, 294, 0, 0, 1319, 165, 0, 0, 1109, 330, 0, 0, 1760, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 185, 0, 988, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 0, 880, 185, 0, 0, 740, 370, 0, 0, 185, 0, 988, 370, 0, 0, 1109, 185, 0, 0, 988, 370, 0, 0, 1109, 185, 0, 0, 1175, 370, 0, 0, 2637, 185, 0, 370, 0, 0, 1760, 147, 0, 1319, 0, 0, 1760, 294, 0, 1319, 0, 0, 1760, 147, 0, 1319, 0, 0, 1480, 294, 0, 1175, 0, 0, 1480, 147, 0, 1175, 0, 0, 1480, 294, 0, 1175, 0, 0, 1319, 147, 0, 1109, 0, 0, 1319, 294, 0, 1109, 0, 0, 1319, 165, 0, 0, 1480, 330, 0, 0, 1661, 165, 0, 0, 3520, 330, 0, 165, 0, 330, 0, 165, 0, 330, 0, 0, 2217, 185, 0, 0, 2217, 370, 0, 185, 0, 0, 2217, 370, 0, 1976, 0, 0, 2217, 185, 0, 0, 1976, 370, 0, 0, 1760, 185, 0, 0, 1480, 370, 0, 0, 2217, 185, 0, 0, 2217, 370, 0, 185, 0, 0, 1976, 370, 0, 2217, 0, 0, 1976, 185, 0, 0, 2217, 370, 0, 0, 2960, 185, 0, 370, 0, 0, 2637, 147, 0, 2217, 0, 0, 2637, 294, 0, 2217, 0, 0, 2637, 147, 0, 2217, 0, 0, 2637, 294, 0, 2217, 0, 0, 2637, 147, 0, 2217, 0, 0, 2637, 294, 0, 2217, 0, 0, 2637, 147, 0, 2217, 0, 0, 2637, 294, 0, 2217, 0, 0, 2349, 147, 0, 0, 2637, 165, 0, 0, 2349, 147, 0, 0, 2217, 139, 0, 0, 1976, 123, 0, 0, 2217, 185, 370, 0, 0, 165, 330, 0, 0, 0, 185, 370, 0, 0, 880, 1760, 0, 0, 831, 1661, 0, 0, 740, 1480, 165, 330, 0, 0, 0, 0, 185, 370, 0, 0, 1109, 2217, 0, 0, 988, 1976, 0, 0, 880, 1760, 165, 330, 0, 0, 0, 0, 185, 370, 0, 0, 880, 1760, 0, 0, 831, 1661, 0, 0, 880, 1760, 0, 0, 831, 1661, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 165, 330, 0, 0, 185, 370, 0, 0, 1760, 0, 2217, 0, 880, 1760, 2960, 0, 3520, 0, 4435, 0, 0, 0, 831, 1661, 1760, 0, 2217, 0, 0, 0, 740, 1480, 2960, 0, 3520, 0, 165, 330, 0, 0, 0, 0, 185, 370, 0, 0, 1760, 0, 2217, 0, 1109, 2217, 2960, 0, 3520, 0, 4435, 0, 0, 0, 988, 1976, 1760, 0, 2217, 0, 0, 0, 880, 1760, 2960, 0, 3520, 0, 165, 330, 0, 0, 0, 0, 185, 370, 0, 0, 1760, 0, 2217, 0, 880, 1760, 2960, 0, 3520, 0,
-4435, 0, 0, 0, 831, 1661, 1760, 0, 0, 0, 880, 1760, 2217, 0, 2960, 0, 3520, 0, 0, 0, 831, 1661, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 740, 1480, 147, 294, 0, 0, 0, 0, 1480, 147, 294, 0, 1109, 0, 880, 0, 740, 0, 0, 0, 1480, 147, 294, 0, 1109, 0, 880, 0, 740, 0, 0, 0, 1480, 185, 370, 0, 0, 185, 370, 0, 0, 0, 1760, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 1976, 0, 0, 185, 370, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 0, 185, 370, 0, 1661, 0, 0, 0, 1480, 147, 294, 0, 0, 147, 294, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 0, 147, 294, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 0, 147, 294, 0, 1760, 0, 0, 0, 1976, 165, 330, 0, 1760, 0, 0, 165, 330, 0, 1661, 0, 0, 0, 1480, 185, 370, 0, 0, 185, 370, 0, 0, 0, 1760, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 1976, 0, 0, 185, 370, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 0, 185, 370, 0, 1661, 0, 0, 0, 1480, 147, 294, 0, 0, 147, 294, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 0, 147, 294, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 0, 147, 294, 0, 1760, 0, 0, 0, 1976, 165, 330, 0, 1760, 0, 0, 165, 330, 0, 1661, 0, 0, 0, 1109, 147, 294, 0, 1109, 0, 0, 147, 294, 0, 1175, 0, 0, 0, 1109, 185, 370, 0, 988, 0, 0, 0, 880, 185, 370, 0, 0, 0, 988, 165, 330, 0, 988, 0, 0, 165, 330, 0, 1109, 0, 0, 0, 988, 185, 370, 0, 880, 0, 740, 0, 659, 0, 0, 0, 740, 185, 370, 0, 0, 0, 1319, 147, 294, 0, 0, 0, 1760, 147, 294, 0, 0, 0, 1976, 147, 294, 0, 0, 0, 1319, 147, 294, 0, 0, 0, 1480, 165, 330, 0, 1319, 0, 0, 0, 988, 165, 330, 0, 1319, 0, 0, 0, 1319, 165, 330, 0, 0, 0, 1480, 165, 330, 0, 1760, 0, 3520, 0, 0, 0, 1480, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 1319, 0, 1480, 0, 0, 0, 1760, 147, 294, 0, 1319, 0, 0, 147, 294, 0, 1109, 0, 0, 165, 330, 0, 1109, 0, 0, 165, 330, 0, 880, 0, 0, 0, 988, 185, 370, 0, 1109, 0, 988, 0, 1109, 0, 0, 0, 740, 185, 370, 0, 0, 0, 1109, 139, 277, 0, 988, 0, 0, 0, 1109, 139, 277, 0, 1319, 0, 1109, 0, 988, 0, 0, 0, 1109, 139, 277, 0, 988, 0, 0, 0, 1109, 139, 277, 0, 1319, 0, 1109, 0, 988, 0, 0, 0, 1760, 147, 294, 0, 1319, 0, 1760, 0, 1976, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 1760, 0, 1480, 0, 0, 0, 1319, 165, 330, 0, 0, 165, 330, 0, 0, 0, 1480, 185, 370, 0, 0, 185, 370, 0, 0, 0, 1760, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 1976, 0, 0, 185, 370, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 0, 185, 370, 0, 1661, 0, 0, 0, 1480, 147, 294, 0, 0, 147, 294, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 0, 147, 294, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 0, 147, 294, 0, 1760, 0, 0, 0, 1976, 165, 330, 0, 1760, 0, 0, 165, 330, 0, 1661, 0, 0, 0, 1480, 185, 370, 0, 0, 185, 370, 0, 0, 0, 1760, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 1976, 0, 0, 185, 370, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 0, 185, 370, 0, 1661, 0, 0, 0, 1480, 147, 294, 0, 0, 147, 294, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 0, 147, 294, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 0, 147, 294, 0, 1760, 0, 0, 0, 1976, 165, 330, 0, 1760, 0, 0, 165, 330, 0, 1661, 0, 0, 0, 740, 147, 294, 0, 740, 0, 0, 0, 1760, 147, 294, 0, 740, 0, 0, 0, 831, 185, 370, 0, 659, 0, 0, 0, 554, 185, 370, 0, 1661, 0, 0, 0, 554, 139, 277, 0, 587, 0, 0, 139, 277, 0, 659, 0, 0, 0, 1661, 185, 370, 0, 0, 185, 370, 0, 0, 0, 587, 147, 294, 0, 659, 0, 740, 0, 831, 0, 0, 0, 880, 147, 294, 0, 831, 0, 740, 0, 831, 0, 0, 0, 740, 147, 294, 0, 659, 0, 831, 0, 880, 0, 0, 0, 1175, 147, 294, 0, 1109, 0, 988, 0, 1109, 0, 0, 0, 740, 165, 330, 0, 659, 0, 740, 0, 831, 0, 0, 0, 880, 165, 330, 0, 988, 0, 1109, 0, 1175, 0, 0, 0, 1109, 165, 330, 0, 988, 0, 1109, 0, 1175, 0, 0, 0, 2637, 165, 330, 0, 0, 0, 1109, 185, 370, 0, 2637, 0, 0, 185, 370, 0, 1109, 0, 0, 0, 988, 147, 294, 0, 2217, 0, 0, 147, 294, 0, 988, 0, 0, 0, 880, 165, 330, 0, 880, 0, 0, 0, 1976, 165, 330, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 1661, 0, 1760, 0, 0, 185, 370, 0, 0, 0, 1976, 139, 277, 0, 1480, 0, 2217, 0, 1480, 0, 0, 0, 1480, 139, 277, 0, 1109, 0, 1661, 0, 1109, 0, 0, 0, 1175, 139, 277, 0, 988, 0, 880, 0, 740, 0, 0, 0, 880, 139, 277, 0, 659, 0, 740, 0, 659, 0, 0, 0, 554, 147,
-294, 0, 659, 0, 740, 0, 659, 0, 0, 0, 740, 147, 294, 0, 880, 0, 740, 0, 880, 0, 0, 0, 988, 165, 330, 0, 880, 0, 988, 0, 1109, 0, 0, 0, 1480, 165, 330, 0, 1760, 0, 1480, 0, 1760, 0, 0, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 2637, 0, 2217, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 1976, 147, 294, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 0, 2637, 0, 2217, 0, 1976, 0, 2217, 0, 4435, 0, 0, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 2637, 0, 2217, 0, 2217, 185, 370, 0, 2217, 0, 2217, 0, 0, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 147, 294, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 0, 1976, 0, 1480, 0, 1760, 0, 1976, 0, 2217, 0, 0, 0, 2217, 139, 277, 0, 1976, 0, 1760, 0, 1480, 0, 1760, 0, 1976, 0, 1760, 0, 1480, 0, 2217, 0, 1976, 0, 1760, 0, 1480, 0, 0, 0, 139, 277, 0, 0, 880, 185, 370, 0, 831, 0, 740, 0, 831, 0, 0, 0, 740, 185, 370, 0, 587, 0, 554, 0, 587, 0, 0, 0, 740, 185, 370, 0, 831, 0, 880, 0, 988, 0, 0, 0, 1109, 185, 370, 0, 988, 0, 1109, 0, 1175, 0, 0, 0, 1109, 185, 370, 0, 1175, 0, 1480, 0, 1319, 0, 0, 0, 1480, 185, 370, 0, 1661, 0, 1760, 0, 0, 0, 1661, 185, 370, 0, 1760, 0, 1976, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 1661, 0, 1480, 0, 0, 0, 1175, 147, 294, 0, 1480, 0, 1661, 0, 1760, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 1976, 0, 2217, 0, 0, 0, 1976, 147, 294, 0, 2217, 0, 2349, 0, 1976, 0, 0, 0, 2349, 147, 294, 0, 2217, 0, 2637, 0, 2217, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 1661, 0, 1760, 0, 0, 0, 2960, 147, 294, 0, 0, 147, 294, 0, 0, 0, 2960, 165, 330, 0, 2637, 0, 2960, 0, 2349, 0, 0, 0, 2960, 165, 330, 0, 2217, 0, 1976, 0, 1760, 0, 0, 0, 1661, 165, 330, 0, 1480, 0, 1661, 0, 1976, 0, 0, 0, 2217, 165, 330, 0, 2349, 0, 2637, 0, 0, 0, 2637, 165, 330, 0, 2349, 0, 2637, 0, 2217, 0, 0, 0, 2637, 165, 330, 0, 1976, 0, 1760, 0, 1661, 0, 0, 0, 1480, 165, 330, 0, 1661, 0, 1760, 0, 1976, 0, 0, 0, 2349, 165, 330, 0, 0, 0, 1480, 185, 370, 0, 1760, 0, 1976, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 2217, 0, 1976, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 1661, 0, 1760, 0, 0, 0, 1661, 185, 370, 0, 1480, 0, 1319, 0, 1109, 0, 0, 0, 1175, 185, 370, 0, 1319, 0, 1175, 0, 1109, 0, 0, 0, 988, 185, 370, 0, 880, 0, 831, 0, 740, 0, 0, 0, 831, 185, 370, 0, 880, 0, 988, 0, 1109, 0, 0, 0, 1175, 185, 370, 0, 1319, 0, 1480, 0, 1661, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 2637, 185, 370, 0, 3520, 0, 0, 185, 370, 0, 2637, 0, 0, 0, 2960, 185, 370, 0, 2637, 0, 0, 0, 2960, 185, 370, 0, 2637, 0, 0, 0, 2217, 185, 370, 0, 1976, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 0, 0, 2217, 185, 370, 0, 0, 0, 3322, 147, 294, 0, 3322, 0, 0, 0, 2637, 147, 294, 0, 3520, 0, 0, 0, 3322, 147, 294, 0, 2960, 0, 0, 0, 2637, 147, 294, 0, 0, 0, 3951, 147, 294, 0, 3951, 0, 0, 0, 1976, 147, 294, 0, 2217, 0, 0, 0, 1976, 147, 294, 0, 0, 147, 294, 0, 0, 0, 1480, 165, 330, 0, 1760, 0, 2217, 0, 2960, 0, 0, 0, 3520, 165, 330, 0, 2217, 0, 2960, 0, 0, 0, 3520, 165, 330, 0, 2960, 0, 2217, 0, 2960, 0, 0, 0, 3520, 165, 330, 0, 2960, 0, 4435, 0, 3520, 0, 0, 0, 1480, 165, 330, 0, 1760, 0, 2217, 0, 2960, 0, 0, 165, 330, 0, 3520, 0, 2960, 0, 3520, 0, 0, 0, 2960, 165, 330, 0, 1480, 0, 3520, 0, 0, 0, 2960, 165, 330, 0, 0, 0, 2960, 185, 370, 0, 2217, 0, 2960, 0, 2217, 0, 2960, 0, 2217, 0, 1976, 0, 2217, 0, 2960, 0, 2217, 0, 2960, 0, 2217, 0, 2960, 0, 2217, 0, 1976, 0, 2217, 0, 0, 0, 2960, 185, 370, 0, 2217, 0, 2960, 0, 2217, 0, 2960, 0, 2217, 0, 1976, 0, 2217, 0, 2960, 0, 0, 0, 554, 139, 277, 0, 587, 0, 659, 0, 0, 0, 740, 139, 277, 0, 831, 0, 880, 0, 988, 0, 0, 0, 1109, 139, 277, 0, 1175, 0, 1319, 0, 1480, 0, 0, 0, 1661, 139, 277, 0, 1760, 0, 1976, 0, 2217, 0, 0, 0, 2637, 139, 277, 0, 0, 0, 2637, 139, 277, 0, 0, 0, 2960, 139, 277, 0, 0, 0, 2637, 139, 277, 0, 2217, 0, 1760, 0, 0, 0, 2960, 185, 370, 0, 2217, 0, 1760, 0, 0, 0, 2960, 185, 370, 0, 2217, 0, 1760, 0, 0, 0, 2960, 0, 2217, 0, 1760, 0, 2960, 0, 2217, 0, 1760, 0, 2960, 0, 2217, 0, 1760, 0, 2960, 0, 2217, 0, 1760, 0, 2960, 0, 2217, 0, 1760, 0, 2960, 185,
-370, 0, 2217, 0, 1760, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 1976, 0, 2217, 0, 2960, 147, 294, 0, 1760, 0, 2960, 0, 2637, 0, 1760, 0, 2637, 0, 0, 0, 2960, 147, 294, 0, 1760, 0, 2960, 0, 2349, 0, 1760, 0, 2349, 0, 0, 0, 2960, 147, 294, 0, 1760, 0, 2960, 0, 2637, 0, 1760, 0, 2637, 0, 0, 0, 2960, 147, 294, 0, 1760, 0, 2960, 0, 2349, 0, 1760, 0, 2349, 0, 0, 0, 2960, 147, 294, 0, 2349, 0, 1760, 0, 1480, 0, 0, 0, 1175, 147, 294, 0, 1480, 0, 1760, 0, 2349, 0, 0, 0, 2637, 147, 294, 0, 2349, 0, 2637, 0, 2960, 0, 0, 0, 3520, 147, 294, 0, 2349, 0, 0, 0, 1976, 165, 330, 0, 2637, 0, 1976, 0, 2637, 0, 0, 0, 1976, 0, 3322, 0, 1976, 0, 3322, 0, 1976, 0, 3322, 0, 831, 0, 880, 0, 988, 0, 1109, 0, 1175, 0, 1319, 0, 1480, 0, 1661, 0, 2349, 0, 2217, 110, 220, 0, 0, 110, 220, 0, 0, 0, 2217, 110, 220, 0, 0, 110, 220, 0, 1976, 0, 1760, 0, 0, 0, 1976, 165, 330, 0, 1760, 0, 0, 0, 1480, 165, 330, 0, 1319, 0, 0, 165, 330, 0, 0, 165, 330, 0, 988, 0, 1109, 0, 0, 0, 1319, 147, 294, 0, 1109, 0, 0, 0, 1109, 147, 294, 0, 988, 0, 0, 0, 880, 147, 294, 0, 988, 0, 0, 0, 1109, 147, 294, 0, 1319, 0, 0, 0, 1480, 147, 294, 0, 1760, 0, 0, 0, 1976, 147, 294, 0, 1319, 0, 0, 0, 3520, 147, 294, 0, 0, 147, 294, 0, 0, 0, 185, 370, 0, 0, 2217, 185, 370, 0, 0, 0, 2349, 185, 370, 0, 0, 0, 2637, 185, 370, 0, 2349, 0, 0, 0, 2960, 165, 330, 0, 2637, 0, 0, 165, 330, 0, 2637, 0, 0, 165, 330, 0, 2349, 0, 0, 165, 330, 0, 2217, 0, 0, 0, 2349, 147, 294, 0, 2217, 0, 0, 0, 1760, 147, 294, 0, 1319, 0, 0, 0, 1109, 147, 294, 0, 1319, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 0, 147, 294, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 0, 0, 1319, 147, 294, 0, 0, 0, 1760, 185, 370, 0, 2637, 0, 0, 0, 1760, 185, 370, 0, 1480, 0, 0, 185, 370, 0, 2217, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 0, 0, 1175, 147, 294, 0, 1319, 0, 0, 0, 1760, 147, 294, 0, 1976, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 1760, 0, 1976, 0, 0, 0, 2637, 147, 294, 0, 0, 0, 5274, 185, 370, 0, 0, 0, 3951, 185, 370, 0, 0, 0, 3520, 185, 370, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 1976, 110, 220, 0, 0, 110, 220, 0, 2217, 0, 0, 110, 220, 0, 0, 110, 220, 0, 0, 0, 2960, 123, 247, 0, 2349, 0, 2217, 0, 1760, 0, 0, 0, 2217, 123, 247, 0, 2349, 0, 2960, 0, 2349, 0, 0, 0, 2960, 123, 247, 0, 2349, 0, 2217, 0, 1760, 0, 0, 0, 2217, 123, 247, 0, 2349, 0, 2960, 0, 2349, 0, 0, 0, 2960, 123, 247, 0, 2349, 0, 2217, 0, 1760, 0, 0, 0, 1661, 123, 247, 0, 1480, 0, 1319, 0, 1175, 0, 0, 0, 988, 123, 247, 0, 880, 0, 988, 0, 1175, 0, 0, 0, 1109, 123, 247, 0, 988, 0, 0, 0, 880, 185, 370, 0, 1109, 0, 1319, 0, 0, 0, 1760, 185, 370, 0, 2637, 0, 2349, 0, 2217, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 1661, 0, 1480, 0, 0, 0, 1319, 185, 370, 0, 1175, 0, 1109, 0, 988, 0, 0, 0, 880, 165, 330, 0, 988, 0, 1109, 0, 1175, 0, 0, 0, 1319, 165, 330, 0, 1480, 0, 1661, 0, 1760, 0, 0, 0, 1661, 165, 330, 0, 1480, 0, 1319, 0, 1175, 0, 0, 0, 1319, 165, 330, 0, 1480, 0, 1661, 0, 1760, 0, 0, 147, 294, 0, 0, 147, 294, 0, 1760, 0, 0, 147, 294, 0, 1480, 0, 0, 147, 294, 0, 1480, 0, 0, 0, 1760, 147, 294, 0, 1976, 0, 0, 147, 294, 0, 2217, 0, 0, 147, 294, 0, 1760, 0, 0, 147, 294, 0, 1661, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 1109, 0, 880, 0, 0, 0, 988, 185, 370, 0, 1109, 0, 988, 0, 880, 0, 0, 0, 988, 185, 370, 0, 0, 185, 370, 0, 0, 0, 988, 185, 370, 0, 880, 0, 0, 0, 1109, 185, 370, 0, 1760, 0, 0, 185, 370, 0, 0, 185, 370, 0, 0, 0, 2217, 165, 330, 0, 2217, 0, 0, 0, 1760, 165, 330, 0, 2217, 0, 0, 0, 2217, 165, 330, 0, 1760, 0, 0, 0, 2217, 165, 330, 0, 1760, 0, 0, 0, 2217, 165, 330, 0, 2349, 0, 0, 0, 165, 330, 2217, 0, 0, 0, 165, 330, 1760, 0, 0, 0, 3520, 165, 330, 0, 0, 0, 740, 139, 277, 0, 831, 0, 880, 0, 988, 0, 0, 0, 1109, 139, 277, 0, 880, 0, 988, 0, 1109, 0, 0, 0, 1175, 139, 277, 0, 988, 0, 1109, 0, 1175, 0, 0, 0, 1319, 139, 277, 0, 1109, 0, 1175, 0, 1319, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 1976, 0, 1480, 0, 0, 0, 2217, 147, 294, 0, 1976, 0, 1760, 0, 1480, 0, 0, 0, 1976, 165, 330, 0, 1661, 0, 2217, 0, 1661, 0, 0, 0, 2637, 165, 330, 0, 2217, 0, 1760, 0, 1480, 0, 0, 0, 1760, 147, 294, 0, 1480, 0, 0, 0, 1976, 147, 294, 0, 1480, 0, 0, 0, 2217, 147, 294, 0, 1480, 0, 0, 0, 1976, 147, 294, 0, 1480, 0, 0, 0, 2349, 147, 294, 0, 1760, 0, 1480, 0, 2349, 0, 1760, 0, 1480, 0,
-0, 0, 2349, 147, 294, 0, 1760, 0, 1480, 0, 2349, 0, 1760, 0, 1480, 0, 0, 0, 2349, 147, 294, 0, 1760, 0, 1480, 0, 2349, 0, 1760, 0, 1480, 0, 0, 0, 2349, 147, 294, 0, 1760, 0, 1480, 0, 2349, 0, 1760, 0, 1480, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 1480, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 2217, 0, 1976, 0, 1760, 0, 0, 0, 1976, 185, 370, 0, 1760, 0, 1480, 0, 1319, 0, 0, 0, 1109, 185, 370, 0, 988, 0, 1109, 0, 1319, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 1109, 0, 0, 0, 1319, 185, 370, 0, 1109, 0, 0, 0, 988, 185, 370, 0, 1109, 0, 988, 0, 880, 0, 0, 0, 3520, 185, 370, 0, 0, 0, 1760, 165, 330, 0, 1661, 0, 0, 0, 1760, 165, 330, 0, 1661, 0, 0, 0, 165, 330, 1319, 0, 0, 165, 330, 0, 1319, 0, 0, 0, 3322, 165, 330, 0, 0, 165, 330, 0, 1109, 0, 0, 0, 988, 165, 330, 0, 880, 0, 0, 0, 1760, 165, 330, 0, 0, 0, 740, 185, 370, 0, 831, 0, 880, 0, 988, 0, 0, 0, 1109, 185, 370, 0, 1175, 0, 1319, 0, 1480, 0, 0, 0, 1480, 185, 370, 0, 1109, 0, 1480, 0, 1109, 0, 0, 0, 1480, 185, 370, 0, 1109, 0, 1480, 0, 1109, 0, 0, 0, 2960, 185, 370, 0, 0, 0, 740, 185, 370, 0, 0, 0, 880, 185, 370, 0, 0, 0, 988, 185, 370, 0, 0, 0, 1109, 185, 370, 0, 1109, 0, 1109, 0, 1109, 0, 0, 0, 988, 185, 0, 0, 880, 220, 0, 0, 740, 294, 0, 740, 0, 831, 0, 880, 0, 0, 988, 165, 0, 988, 0, 988, 0, 988, 0, 0, 880, 277, 0, 0, 988, 247, 0, 0, 1109, 220, 0, 0, 740, 247, 0, 0, 880, 277, 0, 0, 988, 330, 0, 0, 1109, 370, 0, 1109, 0, 1109, 0, 1109, 0, 0, 988, 440, 0, 0, 880, 330, 0, 0, 880, 294, 0, 988, 0, 880, 0, 740, 0, 330, 0, 0, 880, 370, 0, 0, 988, 330, 0, 988, 0, 988, 0, 988, 0, 1109, 0, 1175, 0, 0, 1109, 139, 0, 0, 880, 0, 1109, 0, 1319, 0, 1480, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1480, 147, 0, 294, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 0, 1319, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1319, 185, 0, 0, 1109, 370, 0, 185, 0, 370, 0, 185, 0, 370, 0, 185, 0, 370, 0, 0, 185, 0, 370, 0, 880, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 988, 165, 0, 330, 0, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 1109, 165, 0, 330, 0, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 880, 165, 0, 330, 0, 0, 1109, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 139, 0, 277, 0, 0, 880, 139, 0, 277, 0, 0, 1109, 139, 0, 277, 0, 0, 1319, 139, 0, 277, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 294, 0, 147, 0, 294, 0, 0, 1480, 147, 0, 0, 1480, 294, 0, 0, 1480, 147, 0, 294, 0, 147, 0, 0, 1319, 294, 0, 147, 0, 294, 0, 0, 988, 147, 0, 294, 0, 0, 1109, 185, 0, 370, 0, 0, 1319, 185, 0, 0, 1109, 370, 0, 185, 0, 370, 0, 0, 988, 185, 0, 370, 0, 0, 1109, 185, 0, 370, 0, 185, 0, 370, 0, 0, 740, 185, 0, 370, 0, 0, 880, 185, 0, 370, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 0, 988, 330, 0, 165, 0, 330, 0, 0, 988, 165, 0, 330, 0, 0, 988, 165, 0, 0, 880, 0, 740, 0, 659, 1319, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1319, 147, 294, 0, 1480, 0, 1661, 0, 1760, 0, 0, 0, 1661, 147, 294, 0, 1760, 0, 1976, 0, 1760, 0, 0, 0, 1976, 147, 294, 0, 2217, 0, 1976, 0, 1760, 0, 0, 0, 1976, 147, 294, 0, 1760, 0, 1480, 0, 1319, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 880, 1760, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 880, 1760,
-0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 880, 1760, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 880, 1760, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 1760, 185, 370, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 1109, 2217, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 1109, 2217, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 1109, 2217, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 1109, 2217, 0, 0, 740, 1480, 0, 0, 0, 0, 1109, 2217, 147, 294, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 988, 1976, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 988, 1976, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 988, 1976, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 988, 1976, 0, 0, 740, 1480, 0, 0, 0, 0, 988, 1976, 123, 247, 0, 0, 740, 1480, 0, 0, 0, 0, 880, 165, 330, 0, 1109, 0, 1480, 0, 1760, 0, 2217, 0, 2349, 0, 1760, 0, 1480, 0, 1760, 0, 1480, 0, 1109, 0, 1480, 0, 1109, 0, 880, 0, 1109, 0, 880, 0, 0, 0, 740, 0, 880, 0, 1109, 0, 1480, 0, 1760, 0, 1480, 0, 2217, 0, 1760, 0, 2349, 0, 2217, 0, 1760, 0, 2217, 0, 2349, 0, 2217, 0, 1760, 0, 2349, 0, 2217, 185, 370, 0, 0, 0, 2637, 185, 370, 0, 0, 0, 2637, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 0, 0, 2637, 0, 2637, 185, 370, 0, 0, 0, 2217, 0, 2637, 185, 370, 0, 0, 0, 2637, 0, 2217, 185, 370, 0, 0, 0, 2217, 0, 2637, 185, 370, 0, 0, 0, 2637, 185, 370, 0, 0, 0, 2217, 185, 370, 0, 0, 0, 1976, 185, 370, 0, 0, 0, 1760, 0, 1976, 110, 220, 0, 0, 0, 2217, 110, 220, 0, 0, 0, 2217, 110, 220, 0, 0, 0, 1976, 110, 220, 0, 0, 0, 2217, 0, 2217, 110, 220, 0, 0, 0, 1976, 0, 2217, 110, 220, 0, 0, 0, 2217, 0, 1976, 110, 220, 0, 0, 0, 2217, 0, 2217, 110, 220, 0, 0, 0, 2349, 110, 220, 0, 0, 0, 2217, 110, 220, 0, 0, 0, 1976, 110, 220, 0, 0, 0, 1760, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 123, 247, 0, 0, 2637, 139, 277, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 2637, 0, 2217, 0, 0, 0, 1175, 2349, 139, 277, 0, 0, 0, 0, 1109, 2217, 139, 277, 0, 0, 0, 0, 988, 1976, 139, 277, 0, 0, 0, 0, 880, 1760, 139, 277, 0, 0, 0, 0, 1109, 2217, 139, 277, 0, 0, 0, 0, 988, 1976, 139, 277, 0, 0, 0, 0, 880, 1760, 139, 277, 0, 0, 0, 0, 831, 1661, 139, 277, 0, 0, 0, 0, 4435, 139, 277, 0, 0, 0, 831, 0, 1760, 185, 370, 0, 1976, 0, 0, 0, 1760, 185, 370, 0, 0, 0, 1480, 185, 370, 0, 1319, 0, 0, 0, 1109, 185, 370, 0, 0, 0, 1319, 185, 370, 0, 0, 0, 1480, 185, 370, 0, 0, 0, 5920, 185, 370, 0, 0, 0 };
-static const u16 song3_note_duration_right[] = { 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 300, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 300, 0, 0, 150, 0, 150, 0, 300, 0, 150, 0, 150, 0, 300, 0, 300, 300, 150, 0, 150, 0, 0, 0, 300, 0, 150, 0, 300, 0, 300, 0, 750, 300, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 300, 0, 300, 0, 300, 0, 300, 0, 150, 0, 450, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 150, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0,
-0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 300, 300, 0, 300, 0, 300, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0,
-150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 300, 300, 0, 300, 0, 300, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 300, 0, 0, 300, 0, 300, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0,
-0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 1050, 150, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 300, 0, 300, 0, 300, 0, 300, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0,
-0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 300, 0, 300, 0, 300, 0, 300, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 300, 0, 300, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 225, 0, 0, 0, 225, 0, 0, 0, 150, 0, 0, 0, 0, 1800, 0, 300, 0, 300, 0, 0, 0, 0, 300, 0, 300, 0, 600, 0, 0, 0, 600, 0, 0, 0, 450, 0, 150, 0, 0, 0, 0, 0, 300, 0, 300, 0, 600, 0, 0, 0, 600, 0, 0, 0, 300, 0, 300, 0, 0, 0, 0, 0, 300, 0, 300, 0, 600, 0, 0, 0, 450, 0, 0, 0, 450, 0, 0, 0, 300, 0, 0, 0, 0, 0, 2100, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 300, 0, 0, 0, 0, 300, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 300, 0, 0, 0, 0, 300, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150,
-0, 300, 0, 0, 0, 0, 300, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 1200, 0, 0, 0, 0, 0, 0, 0, 450, 0, 0, 0, 0, 0, 0, 0, 450, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 225, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0,
-0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 300, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 300, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 300, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 0, 150, 0, 1050, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 150, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 600, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 300, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0,
-0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 525, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 600, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 300, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 225, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 300, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 150, 150, 0, 0, 0, 0, 150, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50,
-0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 49, 0, 50, 0, 50, 0, 49, 0, 50, 0, 50, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 150, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 450, 0, 450, 0, 300, 0, 450, 0, 0, 0, 0, 450, 0, 0, 0, 300, 0, 0, 0, 1200, 300, 300, 0, 300, 0, 300, 0, 0, 0, 450, 0, 450, 0, 300, 0, 450, 0, 0, 0, 450, 0, 0, 0, 300, 0, 0, 0, 1200, 300, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 300, 0, 0, 0, 450, 0, 450, 0, 300, 0, 450, 0, 0, 0, 450, 0, 0, 0, 300, 0, 0, 0, 450, 0, 450, 0, 300, 0, 450, 0, 150, 300, 0, 0, 300, 0, 0, 0, 450, 0, 450, 0, 300, 0, 450, 0, 450, 0, 300, 0, 0, 0, 300, 0, 1200, 300, 0, 300, 0, 300, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 0, 300, 0, 0, 300, 0, 300, 0, 0, 300, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0,
-150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 0, 0, 150, 0, 150, 0, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 75, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 300, 0, 300, 0, 600, 0, 0, 0, 75, 0, 75, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 150, 0, 150, 0, 0, 0, 0, 0, 199, 0, 0, 0, 0, 0, 200, 0, 0, 0, 0, 0, 200, 0, 0, 0, 0, 0, 600, 0, 0, 1000 };
-static const u16 song3_note_left[] = { 0 };
-static const u16 song3_note_duration_left[] = { 65535 };
-
-static const SongInfoType song3 = { "Through the Fire and Flames", "Dragonforce", song3_note_right, song3_note_duration_right, sizeof( song3_note_right ) / sizeof( song3_note_right[0] ), song3_note_right, song3_note_duration_right, sizeof( song3_note_right ) / sizeof( song3_note_right[0] ) };
+static const u8 song3_phrase_events[] = { 66, 129, 22, 80, 129, 22, 81, 129, 22, 78, 129, 22, 80, 129, 22, 81, 129, 22, 78, 129, 22, 80, 129, 22, 85, 129, 22, 81, 129, 22, 83, 129, 22, 76, 129, 22, 76, 129, 22, 62, 129, 22, 76, 129, 22, 61, 129, 22, 64, 129, 22, 81, 129, 22, 83, 129, 22, 76, 129, 22, 76, 129, 22, 76, 129, 22, 62, 129, 22, 76, 129, 22, 61, 129, 22, 61, 75, 85, 75, 81, 75, 78, 75, 61, 75, 78, 75, 81, 75, 85, 75, 61, 75, 85, 75, 81, 75, 80, 75, 78, 75, 80, 75, 81, 75, 85, 75, 66, 130, 44, 78, 129, 22, 66, 130, 44, 78, 129, 22, 66, 129, 22, 78, 129, 22, 62, 130, 44, 78, 129, 22, 62, 130, 44, 78, 129, 22, 62, 129, 22, 78, 129, 22, 59, 130, 44, 78, 129, 22, 59, 130, 44, 78, 129, 22, 59, 129, 22, 62, 75, 86, 75, 88, 75, 90, 75, 62, 75, 88, 75, 90, 75, 92, 75, 62, 75, 90, 75, 92, 75, 93, 75, 62, 75, 92, 75, 93, 75, 95, 75, 66, 129, 22, 81, 129, 22, 78, 129, 22, 66, 129, 22, 81, 129, 22, 78, 129, 22, 66, 129, 22, 81, 129, 22, 78, 129, 22, 66, 129, 22, 78, 129, 22, 62, 129, 22, 85, 129, 22, 78, 129, 22, 62, 129, 22, 85, 129, 22, 78, 129, 22, 62, 129, 22, 78, 129, 22, 59, 129, 22, 83, 129, 22, 78, 129, 22, 59, 129, 22, 83, 129, 22, 78, 129, 22, 59, 129, 22, 78, 129, 22, 62, 129, 22, 81, 129, 22, 78, 129, 22, 62, 129, 22, 81, 129, 22, 78, 129, 22, 62, 129, 22, 78, 129, 22, 62, 75, 83, 75, 85, 75, 83, 75, 66, 130, 44, 85, 129, 22, 85, 129, 22, 85, 130, 44, 83, 129, 22, 81, 129, 22, 83, 130, 44, 85, 130, 44, 0, 130, 44, 83, 129, 22, 81, 129, 22, 62, 130, 44, 85, 129, 22, 83, 130, 44, 81, 130, 44, 78, 133, 110, 0, 130, 44, 83, 129, 22, 81, 129, 22, 64, 130, 44, 83, 130, 44, 83, 130, 44, 81, 130, 44, 83, 130, 44, 85, 129, 22, 83, 131, 66, 81, 130, 44, 64, 130, 44, 64, 130, 44, 64, 129, 22, 81, 129, 22, 64, 129, 22, 78, 129, 22, 66, 129, 22, 93, 75, 102, 75, 66, 75, 102, 75, 97, 129, 22, 66, 75, 97, 75, 93, 75, 97, 75, 66, 130, 44, 66, 129, 22, 73, 129, 22, 66, 129, 22, 73, 129, 22, 62, 129, 22, 69, 129, 22, 62, 129, 22, 69, 129, 22, 64, 129, 22, 71, 129, 22, 64, 129, 22, 71, 129, 22, 64, 130, 44, 76, 130, 44, 81, 130, 44, 83, 130, 44, 57, 129, 22, 64, 129, 22, 57, 129, 22, 64, 129, 22, 59, 129, 22, 66, 129, 22, 59, 129, 22, 66, 129, 22, 83, 130, 44, 85, 130, 44, 88, 130, 44, 61, 129, 22, 68, 129, 22, 61, 129, 22, 68, 129, 22, 81, 130, 44, 78, 130, 44, 88, 130, 44, 64, 75, 95, 75, 71, 75, 95, 75, 62, 75, 88, 75, 69, 75, 88, 75, 62, 75, 88, 75, 69, 75, 86, 75, 62, 75, 86, 75, 69, 75, 86, 75, 66, 129, 22, 73, 129, 22, 66, 129, 22, 73, 75, 73, 129, 22, 73, 129, 22, 62, 75, 100, 75, 69, 75, 100, 75, 76, 130, 44, 78, 130, 44, 76, 129, 97, 74, 129, 97, 73, 129, 22, 66, 129, 22, 57, 129, 22, 61, 129, 22, 66, 129, 22, 57, 129, 22, 61, 129, 22, 54, 129, 22, 66, 129, 22, 54, 129, 22, 66, 129, 22, 50, 129, 22, 62, 129, 22, 50, 129, 22, 62, 129, 22, 52, 129, 22, 64, 129, 22, 52, 129, 22, 64, 129, 22, 66, 129, 22, 0, 136, 26, 52, 130, 44, 76, 130, 44, 81, 130, 44, 83, 130, 44, 45, 129, 22, 57, 129, 22, 45, 129, 22, 57, 129, 22, 47, 129, 22, 59, 129, 22, 47, 129, 22, 59, 129, 22, 52, 130, 44, 81, 130, 44, 85, 130, 44, 88, 130, 44, 49, 129, 22, 61, 129, 22, 49, 129, 22, 61, 129, 22, 52, 130, 44, 81, 130, 44, 78, 130, 44, 88, 130, 44, 50, 75, 88, 75, 62, 75, 88, 75, 50, 75, 88, 75, 62, 75, 86, 75, 50, 75, 86, 75, 62, 75, 86, 75, 50, 75, 85, 75, 62, 75, 85, 75, 54, 129, 22, 66, 129, 22, 54, 129, 22, 66, 75, 95, 75, 97, 75, 50, 75, 97, 75, 62, 75, 97, 75, 50, 130, 44, 52, 130, 44, 50, 129, 97, 49, 129, 97, 47, 129, 22, 66, 142, 8, 0, 130, 44, 64, 130, 44, 66, 130, 44, 0, 130, 44, 93, 132, 88, 92, 132, 88, 90, 131, 66, 64, 129, 22, 66, 130, 44, 0, 130, 44, 97, 132, 88, 95, 132, 88, 93, 130, 44, 92, 131, 66, 93, 131, 66, 92, 130, 44, 62, 144, 52, 64, 130, 44, 66, 130, 44, 93, 129, 22, 97, 129, 22, 102, 129, 22, 105, 129, 22, 109, 130, 44, 92, 130, 44, 0, 129, 22, 64, 129, 22, 95, 130, 44, 92, 130, 44, 62, 137, 48, 62, 131, 66, 62, 131, 66, 62, 130, 44, 62, 130, 44, 62, 130, 44, 62, 75, 85, 75, 81, 75, 78, 75, 66, 130, 44, 66, 130, 44, 66, 75, 90, 129, 97, 66, 130, 44, 66, 129, 97, 95, 75, 66, 129, 22, 93, 129, 22, 66, 129, 97, 93, 75, 66, 129, 22, 92, 129, 22, 62, 130, 44, 62, 130, 44, 62, 75, 90, 129, 97, 62, 130, 44, 62, 129, 97, 95, 75, 62, 129, 22, 93, 129, 22, 64, 129, 97, 93, 75, 64, 129, 22, 92, 129, 22, 62, 129, 22, 85, 129, 22, 62, 129, 
+22, 86, 129, 22, 66, 129, 22, 83, 129, 22, 66, 130, 44, 64, 129, 22, 83, 129, 22, 64, 129, 22, 85, 129, 22, 66, 75, 81, 75, 78, 75, 76, 75, 66, 130, 44, 62, 130, 44, 62, 130, 44, 62, 130, 44, 62, 130, 44, 64, 129, 22, 88, 129, 22, 64, 129, 22, 88, 129, 22, 64, 130, 44, 64, 75, 93, 75, 105, 129, 22, 66, 129, 22, 90, 129, 22, 66, 129, 22, 88, 75, 90, 75, 62, 129, 97, 88, 75, 62, 129, 22, 85, 129, 22, 64, 129, 22, 85, 129, 22, 64, 129, 22, 81, 129, 22, 66, 75, 85, 75, 83, 75, 85, 75, 66, 130, 44, 61, 129, 97, 83, 75, 61, 75, 88, 75, 85, 75, 83, 75, 62, 75, 88, 75, 93, 75, 95, 75, 62, 75, 95, 75, 93, 75, 90, 75, 64, 130, 44, 64, 130, 44, 78, 129, 22, 62, 129, 22, 78, 129, 22, 66, 129, 22, 76, 129, 22, 66, 129, 22, 92, 129, 22, 61, 129, 97, 74, 75, 61, 129, 22, 76, 129, 22, 66, 130, 44, 66, 130, 44, 62, 75, 76, 75, 78, 75, 80, 75, 62, 75, 80, 75, 78, 75, 80, 75, 62, 75, 76, 75, 80, 75, 81, 75, 62, 75, 85, 75, 83, 75, 85, 75, 64, 75, 76, 75, 78, 75, 80, 75, 64, 75, 83, 75, 85, 75, 86, 75, 64, 130, 44, 66, 129, 97, 100, 75, 66, 129, 22, 85, 129, 22, 62, 129, 97, 97, 75, 62, 129, 22, 83, 129, 22, 64, 129, 22, 81, 129, 22, 64, 130, 44, 66, 75, 93, 75, 92, 75, 93, 75, 66, 130, 44, 61, 75, 90, 75, 97, 75, 90, 75, 61, 75, 85, 75, 92, 75, 85, 75, 61, 75, 83, 75, 81, 75, 78, 75, 61, 75, 76, 75, 78, 75, 76, 75, 62, 75, 81, 75, 78, 75, 81, 75, 64, 75, 81, 75, 83, 75, 85, 75, 64, 75, 93, 75, 90, 75, 93, 75, 66, 129, 22, 97, 75, 97, 75, 97, 129, 22, 95, 129, 22, 93, 129, 22, 90, 129, 22, 93, 129, 22, 95, 129, 22, 100, 129, 22, 97, 130, 44, 62, 75, 97, 75, 95, 75, 93, 75, 90, 75, 93, 75, 95, 75, 97, 75, 100, 75, 97, 75, 95, 75, 97, 75, 109, 130, 44, 100, 129, 22, 97, 130, 44, 93, 75, 95, 75, 97, 75, 95, 75, 90, 129, 22, 93, 129, 22, 95, 129, 22, 97, 129, 22, 61, 75, 93, 75, 90, 75, 61, 129, 22, 0, 136, 26, 66, 75, 80, 75, 78, 75, 80, 75, 66, 75, 74, 75, 73, 75, 74, 75, 66, 75, 80, 75, 81, 75, 83, 75, 66, 75, 83, 75, 85, 75, 86, 75, 66, 75, 86, 75, 90, 75, 88, 75, 66, 129, 22, 92, 75, 93, 75, 66, 75, 93, 75, 95, 75, 93, 75, 66, 130, 44, 62, 75, 93, 75, 92, 75, 90, 75, 93, 75, 95, 75, 97, 75, 62, 75, 97, 75, 98, 75, 95, 75, 62, 75, 97, 75, 100, 75, 97, 75, 62, 75, 93, 75, 92, 75, 93, 75, 62, 130, 44, 62, 130, 44, 64, 75, 100, 75, 102, 75, 98, 75, 64, 75, 97, 75, 95, 75, 93, 75, 64, 75, 90, 75, 92, 75, 95, 75, 64, 75, 98, 75, 100, 129, 22, 64, 75, 98, 75, 100, 75, 97, 75, 64, 75, 95, 75, 93, 75, 92, 75, 64, 75, 92, 75, 93, 75, 95, 75, 64, 130, 44, 66, 75, 97, 75, 95, 75, 93, 75, 66, 75, 90, 75, 88, 75, 85, 75, 66, 75, 88, 75, 86, 75, 85, 75, 66, 75, 81, 75, 80, 75, 78, 75, 66, 75, 81, 75, 83, 75, 85, 75, 66, 75, 88, 75, 90, 75, 92, 75, 66, 130, 44, 66, 129, 22, 105, 129, 22, 66, 129, 22, 100, 129, 22, 66, 129, 22, 100, 129, 22, 66, 129, 22, 100, 129, 22, 66, 129, 22, 95, 129, 22, 66, 129, 22, 88, 129, 22, 66, 130, 44, 62, 129, 22, 104, 129, 22, 62, 129, 22, 105, 129, 22, 62, 129, 22, 102, 129, 22, 62, 130, 44, 62, 129, 22, 107, 129, 22, 62, 129, 22, 97, 129, 22, 62, 130, 44, 62, 130, 44, 64, 75, 93, 75, 97, 75, 102, 75, 64, 75, 97, 75, 102, 129, 22, 64, 75, 102, 75, 97, 75, 102, 75, 64, 75, 102, 75, 109, 75, 105, 75, 105, 75, 102, 75, 105, 75, 64, 75, 90, 129, 22, 105, 75, 64, 130, 44, 66, 75, 97, 75, 102, 75, 97, 75, 102, 75, 97, 75, 95, 75, 102, 75, 97, 75, 95, 75, 97, 75, 97, 75, 102, 132, 88, 61, 129, 22, 74, 75, 76, 75, 61, 75, 80, 75, 81, 75, 83, 75, 61, 75, 86, 75, 88, 75, 90, 75, 61, 75, 93, 75, 95, 75, 97, 75, 61, 129, 22, 61, 129, 22, 0, 129, 22, 61, 129, 22, 61, 129, 22, 97, 129, 22, 93, 130, 44, 66, 49, 97, 50, 93, 50, 66, 49, 97, 50, 93, 50, 102, 49, 97, 50, 93, 50, 102, 49, 66, 49, 97, 50, 93, 50, 66, 129, 22, 66, 129, 22, 100, 129, 22, 97, 129, 22, 100, 129, 22, 97, 129, 22, 95, 129, 22, 97, 129, 22, 62, 49, 93, 50, 102, 50, 100, 49, 93, 50, 100, 50, 62, 49, 93, 50, 102, 50, 98, 49, 93, 50, 98, 50, 62, 75, 98, 75, 93, 75, 90, 75, 62, 75, 90, 75, 93, 75, 98, 75, 62, 75, 98, 75, 100, 75, 102, 75, 62, 129, 22, 98, 129, 22, 64, 75, 100, 75, 95, 75, 100, 75, 95, 75, 104, 75, 95, 75, 104, 75, 95, 75, 104, 132, 13, 80, 75, 81, 75, 83, 75, 85, 75, 86, 75, 88, 75, 90, 75, 92, 75, 98, 132, 88, 57, 130, 44, 57, 130, 44, 
+57, 130, 44, 57, 129, 22, 95, 75, 93, 75, 64, 129, 22, 93, 129, 22, 64, 129, 22, 88, 129, 22, 64, 130, 44, 64, 129, 22, 83, 75, 85, 75, 62, 129, 22, 85, 129, 22, 62, 129, 22, 83, 129, 22, 62, 129, 22, 83, 129, 22, 62, 129, 22, 88, 129, 22, 62, 129, 22, 93, 129, 22, 62, 129, 22, 88, 129, 22, 62, 130, 44, 62, 130, 44, 66, 130, 44, 66, 130, 44, 66, 130, 44, 66, 129, 22, 98, 129, 22, 64, 129, 22, 100, 129, 22, 64, 129, 22, 100, 129, 22, 64, 129, 22, 98, 129, 22, 64, 129, 22, 97, 129, 22, 62, 129, 22, 97, 129, 22, 62, 129, 22, 88, 129, 22, 62, 130, 44, 62, 129, 22, 93, 129, 22, 62, 129, 97, 93, 75, 62, 130, 44, 66, 129, 22, 100, 129, 22, 66, 129, 22, 90, 129, 22, 66, 129, 22, 97, 129, 22, 66, 129, 22, 88, 129, 22, 62, 129, 22, 88, 129, 22, 62, 129, 22, 95, 129, 22, 62, 75, 95, 75, 93, 75, 95, 75, 66, 130, 44, 57, 130, 44, 57, 129, 22, 97, 129, 22, 57, 130, 44, 57, 130, 44, 59, 75, 98, 75, 97, 75, 93, 75, 59, 75, 98, 75, 102, 75, 98, 75, 90, 75, 88, 75, 86, 75, 59, 75, 81, 75, 83, 75, 86, 75, 59, 129, 22, 83, 129, 22, 66, 129, 22, 85, 75, 88, 75, 66, 75, 100, 75, 98, 75, 97, 75, 66, 75, 93, 75, 92, 75, 90, 75, 66, 75, 86, 75, 85, 75, 83, 75, 64, 75, 90, 75, 92, 75, 93, 75, 64, 75, 90, 75, 88, 75, 86, 75, 62, 130, 44, 62, 129, 22, 93, 129, 22, 62, 129, 22, 90, 129, 22, 62, 129, 22, 90, 129, 22, 62, 129, 22, 95, 129, 22, 62, 129, 22, 97, 129, 22, 62, 129, 22, 93, 129, 22, 62, 129, 22, 92, 129, 22, 66, 75, 88, 75, 85, 75, 81, 75, 66, 75, 85, 75, 83, 75, 81, 75, 66, 130, 44, 66, 130, 44, 66, 129, 22, 81, 129, 22, 66, 129, 22, 93, 129, 22, 66, 130, 44, 66, 130, 44, 64, 129, 22, 97, 129, 22, 64, 129, 22, 97, 129, 22, 64, 129, 22, 93, 129, 22, 64, 129, 22, 93, 129, 22, 64, 129, 22, 93, 129, 22, 64, 130, 44, 81, 75, 83, 75, 85, 75, 61, 75, 83, 75, 85, 75, 86, 75, 61, 75, 85, 75, 86, 75, 88, 75, 62, 75, 90, 75, 95, 75, 90, 75, 64, 75, 92, 75, 97, 75, 92, 75, 64, 75, 97, 75, 93, 75, 90, 75, 90, 129, 22, 62, 129, 22, 90, 129, 22, 62, 49, 93, 50, 90, 50, 98, 49, 93, 50, 90, 50, 66, 75, 88, 75, 90, 75, 93, 75, 93, 75, 90, 75, 88, 75, 66, 75, 83, 75, 85, 75, 88, 75, 66, 129, 22, 88, 75, 85, 75, 66, 129, 22, 85, 129, 22, 64, 129, 22, 92, 129, 22, 64, 129, 22, 92, 129, 22, 64, 130, 44, 86, 75, 88, 75, 90, 75, 66, 75, 85, 75, 90, 75, 85, 75, 66, 130, 44, 66, 130, 44, 66, 130, 44, 66, 130, 44, 66, 131, 66, 85, 131, 66, 85, 130, 44, 85, 131, 66, 54, 131, 66, 57, 130, 44, 62, 137, 48, 0, 130, 44, 78, 130, 44, 80, 130, 44, 81, 130, 44, 52, 131, 66, 83, 131, 66, 83, 130, 44, 83, 131, 66, 61, 131, 66, 59, 130, 44, 57, 137, 48, 0, 130, 44, 59, 130, 44, 61, 130, 44, 64, 130, 44, 69, 131, 66, 64, 130, 44, 62, 131, 66, 83, 131, 66, 81, 130, 44, 78, 131, 66, 64, 129, 22, 0, 130, 44, 66, 130, 44, 64, 131, 66, 83, 131, 66, 83, 130, 44, 83, 131, 66, 85, 131, 66, 86, 130, 44, 49, 130, 44, 0, 137, 48, 81, 130, 44, 85, 130, 44, 88, 130, 44, 66, 130, 44, 90, 129, 22, 66, 130, 44, 90, 129, 22, 66, 129, 22, 90, 129, 22, 62, 130, 44, 90, 129, 22, 62, 130, 44, 90, 129, 22, 62, 129, 22, 90, 129, 22, 59, 130, 44, 90, 129, 22, 59, 130, 44, 90, 129, 22, 59, 129, 22, 93, 75, 95, 75, 93, 75, 62, 75, 93, 75, 90, 75, 88, 75, 66, 129, 22, 93, 129, 22, 90, 129, 22, 66, 129, 22, 93, 129, 22, 90, 129, 22, 66, 129, 22, 93, 129, 22, 90, 129, 22, 66, 129, 22, 90, 129, 22, 62, 129, 22, 97, 129, 22, 90, 129, 22, 62, 129, 22, 97, 129, 22, 90, 129, 22, 62, 129, 22, 90, 129, 22, 59, 129, 22, 95, 129, 22, 90, 129, 22, 59, 129, 22, 95, 129, 22, 90, 129, 22, 59, 129, 22, 90, 129, 22, 64, 75, 85, 75, 90, 75, 93, 75, 97, 75, 98, 75, 93, 75, 90, 75, 93, 75, 90, 75, 85, 75, 90, 75, 85, 75, 81, 75, 85, 75, 81, 75, 78, 75, 81, 75, 85, 75, 90, 75, 93, 75, 90, 75, 97, 75, 93, 75, 98, 75, 97, 75, 93, 75, 97, 75, 98, 75, 97, 75, 93, 75, 98, 75, 66, 129, 22, 66, 129, 22, 66, 129, 22, 66, 129, 22, 100, 129, 22, 66, 129, 22, 97, 129, 22, 93, 129, 22, 57, 129, 22, 57, 129, 22, 57, 129, 22, 57, 129, 22, 97, 129, 22, 57, 129, 22, 95, 129, 22, 57, 129, 22, 97, 129, 22, 57, 129, 22, 97, 129, 22, 93, 129, 22, 59, 129, 22, 59, 129, 22, 59, 129, 22, 59, 129, 22, 0, 129, 22, 59, 129, 22, 0, 129, 22, 61, 75, 97, 75, 100, 75, 97, 75, 100, 75, 97, 75, 100, 75, 97, 75, 61, 129, 22, 61, 129, 22, 61, 129, 22, 61, 129, 22, 61, 130, 44, 0, 130, 44, 80, 
+132, 88, 66, 75, 95, 75, 66, 129, 22, 66, 129, 22, 88, 129, 22, 66, 129, 71, 66, 129, 72, 66, 129, 72, 66, 132, 88, 0, 135, 104 };
+static const PhraseType song3_phrases[] = { { 0, 33 }, { 3, 12 }, { 33, 3 }, { 36, 6 }, { 3, 30 }, { 42, 6 }, { 3, 21 }, { 48, 9 }, { 57, 3 }, { 60, 3 }, { 63, 6 }, { 69, 6 }, { 75, 50 }, { 107, 18 }, { 125, 15 }, { 122, 18 }, { 140, 18 }, { 122, 21 }, { 158, 53 }, { 196, 15 }, { 211, 33 }, { 220, 24 }, { 244, 24 }, { 268, 35 }, { 295, 8 }, { 303, 136 }, { 427, 12 }, { 439, 12 }, { 451, 12 }, { 427, 24 }, { 439, 24 }, { 463, 24 }, { 475, 12 }, { 487, 12 }, { 451, 15 }, { 499, 9 }, { 508, 12 }, { 520, 9 }, { 529, 8 }, { 537, 20 }, { 549, 8 }, { 557, 4 }, { 561, 11 }, { 559, 11 }, { 572, 3 }, { 575, 11 }, { 578, 8 }, { 586, 33 }, { 601, 18 }, { 601, 12 }, { 619, 12 }, { 631, 12 }, { 643, 12 }, { 655, 6 }, { 619, 24 }, { 631, 24 }, { 661, 24 }, { 673, 12 }, { 685, 12 }, { 697, 12 }, { 709, 12 }, { 721, 12 }, { 733, 32 }, { 765, 13 }, { 765, 11 }, { 778, 2 }, { 780, 6 }, { 778, 8 }, { 786, 59 }, { 809, 12 }, { 845, 36 }, { 863, 12 }, { 881, 6 }, { 860, 18 }, { 887, 3 }, { 857, 24 }, { 890, 29 }, { 911, 8 }, { 919, 72 }, { 991, 138 }, { 1116, 13 }, { 1129, 22 }, { 919, 75 }, { 1151, 86 }, { 1229, 8 }, { 1237, 79 }, { 1308, 8 }, { 1316, 47 }, { 1338, 16 }, { 1363, 6 }, { 1338, 25 }, { 1369, 27 }, { 1396, 6 }, { 1137, 8 }, { 1402, 22 }, { 1373, 10 }, { 1424, 4 }, { 1345, 12 }, { 1428, 72 }, { 174, 10 }, { 1500, 94 }, { 1481, 8 }, { 1594, 8 }, { 1271, 8 }, { 1602, 152 }, { 1723, 10 }, { 1754, 30 }, { 1772, 10 }, { 1784, 8 }, { 1770, 14 }, { 1792, 77 }, { 1857, 12 }, { 1857, 10 }, { 1869, 54 }, { 1899, 24 }, { 1923, 201 }, { 2049, 12 }, { 2124, 61 }, { 2070, 12 }, { 2185, 34 }, { 2203, 16 }, { 2203, 10 }, { 2219, 51 }, { 2270, 16 }, { 2270, 8 }, { 2286, 109 }, { 2100, 12 }, { 2395, 9 }, { 1804, 10 }, { 2404, 30 }, { 2434, 16 }, { 2295, 15 }, { 2450, 21 }, { 2459, 12 }, { 2471, 8 }, { 1594, 10 }, { 2479, 27 }, { 2339, 11 }, { 2506, 12 }, { 1047, 15 }, { 1093, 12 }, { 2518, 3 }, { 1450, 10 }, { 2521, 14 }, { 2527, 8 }, { 2535, 78 }, { 2547, 12 }, { 2613, 60 }, { 2673, 18 }, { 2691, 15 }, { 2688, 18 }, { 2706, 18 }, { 2688, 21 }, { 2724, 6 }, { 1369, 8 }, { 2730, 29 }, { 2744, 15 }, { 2759, 27 }, { 2298, 12 }, { 2774, 12 }, { 2786, 30 }, { 2792, 24 }, { 2816, 88 }, { 2892, 12 }, { 2883, 12 }, { 2904, 36 }, { 2907, 12 }, { 2940, 24 }, { 2952, 12 }, { 2943, 15 }, { 2964, 10 }, { 2966, 8 }, { 2974, 18 }, { 2980, 12 }, { 2992, 37 } };
+static const PhraseRefType song3_playlist_voice0[] = { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 0, 1 }, { 1, 1 }, { 3, 1 }, { 4, 1 }, { 1, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 1, 1 }, { 8, 1 }, { 0, 1 }, { 1, 1 }, { 9, 1 }, { 0, 1 }, { 1, 1 }, { 10, 1 }, { 4, 1 }, { 1, 1 }, { 11, 1 }, { 6, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 16, 2 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 20, 1 }, { 21, 1 }, { 22, 2 }, { 23, 1 }, { 24, 3 }, { 25, 1 }, { 26, 3 }, { 27, 4 }, { 28, 6 }, { 26, 5 }, { 29, 1 }, { 27, 2 }, { 30, 1 }, { 28, 5 }, { 26, 1 }, { 29, 1 }, { 27, 3 }, { 26, 3 }, { 29, 1 }, { 27, 2 }, { 30, 1 }, { 28, 1 }, { 31, 1 }, { 32, 1 }, { 28, 2 }, { 27, 4 }, { 26, 2 }, { 28, 2 }, { 27, 4 }, { 26, 1 }, { 29, 1 }, { 27, 1 }, { 26, 1 }, { 29, 1 }, { 27, 1 }, { 33, 4 }, { 28, 1 }, { 34, 1 }, { 35, 1 }, { 27, 4 }, { 26, 4 }, { 28, 4 }, { 36, 4 }, { 27, 4 }, { 26, 4 }, { 28, 1 }, { 34, 1 }, { 37, 1 }, { 26, 3 }, { 29, 1 }, { 30, 1 }, { 28, 1 }, { 26, 3 }, { 29, 1 }, { 27, 1 }, { 38, 4 }, { 26, 4 }, { 39, 1 }, { 40, 1 }, { 41, 1 }, { 28, 2 }, { 42, 1 }, { 43, 1 }, { 44, 1 }, { 42, 1 }, { 43, 1 }, { 45, 1 }, { 46, 3 }, { 47, 1 }, { 48, 1 }, { 49, 1 }, { 50, 4 }, { 51, 4 }, { 52, 6 }, { 53, 1 }, { 50, 3 }, { 54, 1 }, { 51, 2 }, { 55, 1 }, { 52, 5 }, { 50, 1 }, { 54, 1 }, { 51, 3 }, { 50, 3 }, { 54, 1 }, { 51, 2 }, { 55, 1 }, { 52, 1 }, { 56, 1 }, { 57, 1 }, { 52, 2 }, { 51, 4 }, { 50, 2 }, { 52, 2 }, { 51, 4 }, { 50, 1 }, { 54, 1 }, { 51, 1 }, { 50, 1 }, { 54, 1 }, { 51, 1 }, { 58, 4 }, { 52, 2 }, { 59, 1 }, { 51, 4 }, { 50, 4 }, { 52, 4 }, { 60, 4 }, { 51, 4 }, { 50, 4 }, { 52, 2 }, { 61, 1 }, { 50, 3 }, { 54, 1 }, { 55, 1 }, { 52, 1 }, { 50, 3 }, { 54, 1 }, { 55, 1 }, { 52, 1 }, { 50, 4 }, { 62, 1 }, { 52, 2 }, { 63, 1 }, { 50, 1 }, { 64, 1 }, { 65, 1 }, { 50, 1 }, { 66, 1 }, { 67, 3 }, { 68, 1 }, { 69, 1 }, { 70, 1 }, { 71, 1 }, { 72, 1 }, { 73, 1 }, { 74, 1 }, { 71, 1 }, { 75, 1 }, { 71, 1 }, { 76, 1 }, { 77, 1 }, { 78, 2 }, { 79, 1 }, { 80, 1 }, { 81, 1 }, { 78, 1 }, { 82, 1 }, { 83, 1 }, { 84, 1 }, { 85, 1 }, { 86, 1 }, { 87, 1 }, { 88, 1 }, { 89, 1 }, { 90, 1 }, { 91, 1 }, { 90, 1 }, { 88, 1 }, { 92, 1 }, { 90, 1 }, { 93, 1 }, { 94, 1 }, { 95, 1 }, { 96, 1 }, { 97, 1 }, { 98, 1 }, { 99, 1 }, { 100, 1 }, { 101, 1 }, { 102, 1 }, { 103, 1 }, { 104, 1 }, { 105, 1 }, { 106, 1 }, { 107, 1 }, { 108, 1 }, { 109, 1 }, { 110, 1 }, { 111, 1 }, { 112, 1 }, { 113, 1 }, { 114, 1 }, { 115, 1 }, { 116, 1 }, { 117, 1 }, { 118, 1 }, { 119, 1 }, { 120, 1 }, { 121, 1 }, { 122, 1 }, { 84, 1 }, { 123, 1 }, { 124, 1 }, { 125, 1 }, { 126, 1 }, { 127, 1 }, { 128, 1 }, { 129, 1 }, { 93, 1 }, { 130, 1 }, { 131, 1 }, { 132, 1 }, { 133, 3 }, { 134, 1 }, { 135, 1 }, { 136, 1 }, { 137, 1 }, { 138, 1 }, { 139, 1 }, { 140, 1 }, { 141, 1 }, { 142, 1 }, { 143, 1 }, { 144, 1 }, { 145, 1 }, { 146, 1 }, { 147, 1 }, 
+{ 51, 4 }, { 50, 4 }, { 52, 4 }, { 60, 4 }, { 51, 4 }, { 50, 4 }, { 52, 2 }, { 61, 1 }, { 148, 2 }, { 149, 1 }, { 150, 1 }, { 151, 2 }, { 152, 1 }, { 99, 1 }, { 153, 1 }, { 154, 1 }, { 155, 1 }, { 156, 1 }, { 157, 1 }, { 158, 1 }, { 159, 1 }, { 160, 1 }, { 161, 1 }, { 162, 1 }, { 163, 1 }, { 164, 1 }, { 165, 1 }, { 166, 1 }, { 167, 1 }, { 168, 1 }, { 169, 1 }, { 170, 1 }, { 171, 22 }, { 172, 1 }, { 173, 1 }, { 174, 1 } };
+static const SeekPointType song3_seek_voice0[] = { { 0, 0, 0, 0 }, { 3900, 3, 0, 30 }, { 7950, 9, 0, 15 }, { 12000, 16, 0, 0 }, { 15900, 19, 0, 30 }, { 19950, 23, 0, 116 }, { 24000, 27, 1, 143 }, { 27975, 29, 0, 168 }, { 31950, 31, 0, 238 }, { 36000, 34, 0, 271 }, { 39900, 36, 0, 324 }, { 43800, 36, 0, 366 }, { 48000, 36, 0, 427 }, { 51900, 38, 1, 445 }, { 55950, 39, 0, 454 }, { 60000, 41, 0, 439 }, { 63900, 44, 3, 457 }, { 67950, 47, 2, 442 }, { 72000, 49, 0, 439 }, { 75900, 53, 0, 466 }, { 79950, 56, 2, 442 }, { 84000, 59, 3, 439 }, { 87900, 61, 0, 445 }, { 91950, 66, 2, 490 }, { 96000, 70, 3, 439 }, { 99900, 71, 1, 433 }, { 103950, 73, 2, 511 }, { 108000, 75, 3, 427 }, { 111900, 78, 0, 520 }, { 115950, 81, 0, 442 }, { 120000, 84, 0, 439 }, { 123900, 87, 1, 433 }, { 127950, 93, 0, 564 }, { 132000, 99, 0, 601 }, { 135900, 102, 1, 625 }, { 139950, 104, 4, 646 }, { 144000, 106, 2, 619 }, { 147900, 108, 0, 637 }, { 151950, 110, 0, 646 }, { 156000, 114, 2, 619 }, { 159900, 116, 0, 637 }, { 163950, 120, 0, 676 }, { 168000, 123, 1, 619 }, { 171900, 125, 1, 637 }, { 175950, 130, 0, 622 }, { 180000, 133, 1, 643 }, { 183900, 135, 1, 637 }, { 187950, 137, 2, 646 }, { 192000, 139, 3, 631 }, { 195900, 140, 1, 625 }, { 199950, 143, 1, 622 }, { 204000, 147, 2, 619 }, { 207900, 149, 0, 649 }, { 211950, 152, 0, 753 }, { 216000, 159, 0, 780 }, { 218400, 161, 0, 803 }, { 223800, 161, 0, 836 }, { 228000, 163, 0, 854 }, { 231900, 164, 0, 863 }, { 235950, 169, 0, 872 }, { 240000, 171, 0, 905 }, { 243900, 173, 1, 958 }, { 247800, 173, 0, 944 }, { 252000, 174, 0, 1012 }, { 255900, 174, 0, 1075 }, { 259800, 176, 0, 1145 }, { 264000, 177, 0, 969 }, { 267900, 178, 0, 958 }, { 271800, 179, 0, 1183 }, { 276000, 181, 0, 1262 }, { 279900, 183, 0, 1345 }, { 283950, 187, 0, 1389 }, { 288000, 192, 0, 1137 }, { 291975, 197, 0, 1444 }, { 295800, 199, 0, 1530 }, { 300000, 203, 0, 1610 }, { 303900, 203, 0, 1690 }, { 307875, 205, 0, 1762 }, { 312000, 209, 0, 1828 }, { 315989, 212, 0, 1915 }, { 319784, 214, 0, 1990 }, { 323984, 214, 0, 2055 }, { 327884, 214, 0, 2118 }, { 331934, 216, 0, 2181 }, { 335984, 220, 0, 2203 }, { 339884, 225, 0, 2289 }, { 343784, 225, 0, 2365 }, { 347984, 229, 0, 2426 }, { 351951, 236, 0, 1596 }, { 355926, 241, 0, 1102 }, { 359976, 246, 0, 2556 }, { 363576, 246, 0, 2580 }, { 367776, 246, 0, 2607 }, { 371976, 248, 0, 2628 }, { 375876, 248, 0, 2661 }, { 379926, 249, 0, 634 }, { 383976, 251, 1, 643 }, { 387876, 253, 3, 637 }, { 391926, 254, 0, 622 }, { 395976, 257, 0, 2673 }, { 399876, 260, 1, 2712 }, { 403926, 264, 0, 1373 }, { 407976, 268, 0, 2307 }, { 411951, 272, 0, 2829 }, { 415926, 274, 0, 2889 }, { 419976, 278, 0, 2955 }, { 423951, 281, 13, 2966 }, { 427926, 281, 0, 2968 }, { 431975, 284, 0, 3023 } };
+
+static const VoiceType song3_voices[] = { { song3_playlist_voice0, sizeof( song3_playlist_voice0 ) / sizeof( song3_playlist_voice0[0] ), song3_seek_voice0, sizeof( song3_seek_voice0 ) / sizeof( song3_seek_voice0[0] ) }, { song3_playlist_voice0, sizeof( song3_playlist_voice0 ) / sizeof( song3_playlist_voice0[0] ), song3_seek_voice0, sizeof( song3_seek_voice0 ) / sizeof( song3_seek_voice0[0] ) } };
+
+static const SongInfoType song3 = { "Through the Fire and Flames", "Dragonforce", song3_phrase_events, song3_phrases, song3_voices, sizeof( song3_voices ) / sizeof( song3_voices[0] ), 433575 };
 
 /* Song #4 */
-static const u16 song4_note_right[] = { 0, 1047, 0, 880, 0, 880, 0, 1047, 0, 1175, 0, 784, 0, 784, 0, 880, 0, 932, 0, 1397, 0, 1397, 0, 1319, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 1047, 0, 1175, 0, 1175, 0, 1175, 0, 1568, 0, 1397, 0, 1319, 0, 1397, 0, 1175, 0, 1047, 0, 698, 0, 784, 0, 880, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 880, 0, 659, 0, 698, 0, 698, 0, 1047, 0, 880, 0, 880, 0, 1047, 0, 1175, 0, 784, 0, 784, 0, 880, 0, 932, 0, 1397, 0, 1397, 0, 1319, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 1047, 0, 1175, 0, 1175, 0, 1175, 0, 1568, 0, 1397, 0, 1319, 0, 1397, 0, 1175, 0, 1047, 0, 698, 0, 784, 0, 880, 0, 1175, 0, 1047, 0, 880, 0, 932, 0, 880, 0, 698, 0, 698, 0, 698, 0, 1397, 0, 1175, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 1175, 0, 1397, 0, 1175, 0, 1397, 0, 932, 0, 1397, 0, 1175, 0, 1047, 0, 932, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 784, 0, 698, 0, 698, 0, 1397, 0, 1175, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 1175, 0, 1397, 0, 1175, 0, 1397, 0, 932, 0, 1397, 0, 1175, 0, 1047, 0, 932, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 784, 0, 698, 0, 698, 0, 1047, 0, 1175, 0, 1245, 0, 1175, 0, 1245, 0, 1319, 0, 1397, 0, 1568, 0, 1568, 0, 1047, 0, 880, 0, 880, 0, 1047, 0, 1175, 0, 784, 0, 784, 0, 880, 0, 932, 0, 1397, 0, 1397, 0, 1319, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 1047, 0, 1175, 0, 1175, 0, 1175, 0, 1568, 0, 1397, 0, 1319, 0, 1397, 0, 1175, 0, 1047, 0, 698, 0, 784, 0, 880, 0, 1175, 0, 1047, 0, 880, 0, 932, 0, 880, 0, 698, 0, 698, 0, 698, 0, 1397, 0, 1175, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 1175, 0, 1397, 0, 1175, 0, 1397, 0, 932, 0, 1397, 0, 1175, 0, 1047, 0, 932, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 784, 0, 698, 0, 698, 0, 1397, 0, 1175, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 1175, 0, 1397, 0, 1175, 0, 1397, 0, 932, 0, 1397, 0, 1175, 0, 1047, 0, 932, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 784, 0, 698, 0, 698, 0, 1047, 0, 1175, 0, 1245, 0, 1175, 0, 1245, 0, 1319, 0, 1397, 0, 1568, 0, 1568, 0, 1047, 0, 1175, 0, 1397, 0, 1047, 0, 1175, 0, 1047, 0, 784, 0, 880, 0, 880, 0, 1047, 0, 1175, 0, 784, 0, 784, 0, 880, 0, 932, 0, 1397, 0, 1397, 0, 1319, 0, 1047, 0, 1175, 0, 1047, 0, 932, 0, 880, 0, 1047, 0, 1175, 0, 1175, 0, 1175, 0, 1568, 0, 1397, 0, 1319, 0, 1397, 0, 1175, 0, 1047, 0, 698, 0, 784, 0, 880, 0, 1175, 0, 1047, 0, 1047, 0, 932, 0, 880, 659, 0, 0, 698, 0, 831, 0, 880, 0, 988, 0, 1047, 0, 1319, 0, 1397, 0, 1661, 0, 1760, 0, 1976, 0, 2093, 0, 2794, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0, 698, 0, 880, 0, 1047, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1568, 0, 1397, 0, 1245, 0, 1175, 0, 1047, 0 };
-static const u16 song4_note_duration_right[] = { 0, 405, 0, 1622, 405, 405, 0, 203, 0, 405, 0, 1622, 0, 203, 0, 405, 0, 811, 0, 1014, 0, 405, 0, 405, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 405, 405, 0, 405, 0, 405, 405, 405, 0, 203, 0, 405, 0, 405, 0, 203, 0, 203, 0, 1622, 0, 405, 0, 405, 0, 405, 0, 608, 0, 811, 0, 405, 0, 405, 0, 405, 0, 405, 0, 405, 0, 2432, 0, 608, 0, 1622, 405, 405, 0, 203, 0, 405, 0, 1622, 0, 203, 0, 405, 0, 608, 0, 1014, 0, 405, 0, 405, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 405, 405, 0, 203, 0, 203, 811, 405, 0, 34, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 0, 405, 0, 405, 0, 405, 0, 608, 0, 811, 0, 405, 0, 405, 0, 405, 0, 811, 0, 1622, 2230, 101, 101, 101, 101, 101, 0, 101, 304, 203, 203, 203, 203, 101, 0, 405, 0, 203, 0, 1014, 0, 203, 0, 1014, 0, 203, 0, 608, 0, 405, 0, 405, 0, 1014, 0, 405, 0, 1216, 0, 405, 0, 608, 0, 405, 0, 1622, 1419, 101, 101, 101, 101, 101, 0, 101, 304, 203, 203, 203, 203, 101, 0, 405, 0, 203, 0, 1014, 0, 203, 0, 1014, 0, 203, 0, 608, 0, 405, 0, 405, 0, 1014, 0, 405, 0, 811, 0, 811, 0, 608, 203, 203, 0, 1216, 0, 405, 0, 405, 0, 405, 0, 608, 0, 203, 0, 811, 0, 405, 0, 405, 0, 608, 0, 1419, 2230, 811, 0, 1622, 405, 405, 0, 203, 0, 405, 0, 1622, 0, 203, 0, 405, 0, 608, 0, 1014, 0, 405, 0, 405, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 405, 405, 0, 203, 0, 203, 811, 405, 0, 34, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 0, 405, 0, 405, 0, 405, 0, 608, 0, 811, 0, 405, 0, 405, 0, 405, 0, 811, 0, 1622, 2230, 101, 101, 101, 101, 101, 0, 101, 304, 203, 203, 203, 203, 101, 0, 405, 0, 203, 0, 1014, 0, 203, 0, 1014, 0, 203, 0, 608, 0, 405, 0, 405, 0, 1014, 0, 405, 0, 1216, 0, 405, 0, 608, 0, 405, 0, 1622, 1419, 101, 101, 101, 101, 101, 0, 101, 304, 203, 203, 203, 203, 101, 0, 405, 0, 203, 0, 1014, 0, 203, 0, 1014, 0, 203, 0, 608, 0, 405, 0, 405, 0, 1014, 0, 405, 0, 811, 0, 811, 0, 608, 203, 203, 0, 1216, 0, 405, 0, 405, 0, 405, 0, 608, 0, 203, 0, 811, 0, 405, 0, 405, 0, 608, 0, 1419, 2230, 203, 0, 405, 0, 203, 0, 203, 0, 203, 0, 203, 0, 203, 0, 1216, 0, 405, 0, 405, 0, 405, 0, 1622, 0, 203, 0, 405, 0, 811, 0, 1014, 0, 405, 0, 405, 0, 405, 0, 203, 0, 203, 0, 203, 0, 1622, 405, 405, 0, 405, 0, 405, 405, 405, 0, 203, 0, 405, 0, 405, 0, 203, 0, 203, 0, 1622, 0, 405, 0, 405, 0, 405, 0, 203, 0, 811, 811, 405, 0, 405, 0, 405, 405, 405, 0, 270, 135, 405, 0, 270, 135, 405, 0, 270, 135, 405, 0, 270, 135, 405, 0, 270, 135, 405, 0, 270, 135, 1622, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 0, 1622, 0, 811, 0, 811, 0, 203, 0, 203, 0, 405, 0, 2432, 0, 203, 0, 203, 0, 405, 0, 1622, 0, 405, 0, 405, 0, 3243, 1000 };
-static const u16 song4_note_left[] = { 0 };
-static const u16 song4_note_duration_left[] = { 65535 };
+static const u8 song4_phrase_events[] = { 84, 131, 21, 81, 140, 86, 0, 131, 21, 81, 131, 21, 84, 129, 75, 86, 131, 21, 79, 140, 86, 79, 129, 75, 81, 131, 21, 82, 134, 43, 89, 135, 118, 89, 131, 21, 88, 131, 21, 84, 131, 21, 86, 129, 75, 84, 129, 75, 82, 129, 75, 81, 140, 86, 0, 131, 21, 84, 131, 21, 86, 131, 21, 86, 131, 21, 0, 131, 21, 86, 131, 21, 91, 129, 75, 89, 131, 21, 88, 131, 21, 89, 129, 75, 86, 129, 75, 84, 140, 86, 77, 131, 21, 79, 131, 21, 81, 131, 21, 86, 132, 96, 84, 134, 43, 84, 131, 21, 82, 131, 21, 81, 131, 21, 76, 131, 21, 77, 131, 21, 77, 147, 0, 84, 132, 96, 82, 132, 96, 86, 129, 75, 86, 129, 75, 0, 134, 43, 86, 131, 21, 91, 34, 89, 131, 21, 88, 129, 75, 81, 131, 21, 82, 131, 21, 81, 131, 21, 77, 134, 43, 77, 140, 86, 0, 145, 54, 77, 101, 0, 101, 89, 101, 0, 101, 86, 101, 86, 101, 0, 130, 48, 84, 129, 75, 0, 129, 75, 84, 129, 75, 0, 129, 75, 82, 101, 86, 131, 21, 89, 129, 75, 86, 135, 118, 89, 129, 75, 82, 135, 118, 89, 129, 75, 86, 132, 96, 84, 131, 21, 82, 131, 21, 84, 135, 118, 86, 131, 21, 84, 137, 64, 82, 131, 21, 81, 132, 96, 79, 131, 21, 77, 140, 86, 0, 139, 11, 84, 134, 43, 82, 134, 43, 81, 132, 96, 0, 129, 75, 79, 129, 75, 77, 137, 64, 77, 131, 21, 84, 131, 21, 86, 131, 21, 87, 132, 96, 86, 129, 75, 87, 134, 43, 88, 131, 21, 89, 131, 21, 91, 132, 96, 91, 139, 11, 0, 145, 54, 84, 134, 43, 82, 132, 96, 84, 129, 75, 86, 131, 21, 89, 129, 75, 84, 129, 75, 86, 129, 75, 84, 129, 75, 79, 129, 75, 81, 137, 64, 81, 131, 21, 84, 131, 21, 86, 129, 75, 84, 134, 43, 0, 134, 43, 0, 131, 21, 77, 130, 14, 0, 129, 7, 80, 131, 21, 81, 130, 14, 0, 129, 7, 83, 131, 21, 84, 130, 14, 0, 129, 7, 88, 131, 21, 89, 130, 14, 0, 129, 7, 92, 131, 21, 93, 130, 14, 0, 129, 7, 95, 131, 21, 96, 130, 14, 0, 129, 7, 101, 140, 86, 77, 140, 86, 81, 134, 43, 84, 134, 43, 91, 129, 75, 89, 129, 75, 91, 131, 21, 89, 147, 0, 91, 129, 75, 89, 129, 75, 91, 131, 21, 89, 140, 86, 87, 131, 21, 86, 131, 21, 84, 153, 43, 0, 135, 104 };
+static const PhraseType song4_phrases[] = { { 0, 126 }, { 3, 24 }, { 126, 3 }, { 30, 30 }, { 129, 20 }, { 81, 24 }, { 149, 98 }, { 167, 62 }, { 247, 54 }, { 301, 3 }, { 247, 51 }, { 304, 30 }, { 15, 84 }, { 334, 9 }, { 105, 12 }, { 343, 99 }, { 400, 42 }, { 442, 3 } };
+static const PhraseRefType song4_playlist_voice0[] = { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 1, 1 }, { 9, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 10, 1 }, { 11, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 16, 5 }, { 17, 1 } };
+static const SeekPointType song4_seek_voice0[] = { { 0, 0, 0, 0 }, { 3445, 0, 0, 18 }, { 7905, 0, 0, 36 }, { 11756, 0, 0, 60 }, { 14795, 0, 0, 87 }, { 19861, 0, 0, 111 }, { 23508, 0, 0, 123 }, { 27156, 1, 0, 18 }, { 31818, 3, 0, 39 }, { 35670, 4, 0, 135 }, { 39961, 5, 0, 93 }, { 43405, 6, 0, 158 }, { 45838, 6, 0, 164 }, { 51716, 6, 0, 208 }, { 55770, 6, 0, 229 }, { 58404, 6, 0, 241 }, { 63876, 7, 0, 202 }, { 67728, 7, 0, 223 }, { 71783, 8, 0, 262 }, { 75836, 8, 0, 283 }, { 78673, 8, 0, 295 }, { 83741, 9, 0, 9 }, { 87592, 11, 0, 30 }, { 90430, 11, 0, 51 }, { 95532, 13, 0, 87 }, { 99788, 14, 0, 149 }, { 103436, 14, 0, 164 }, { 107894, 14, 0, 199 }, { 111949, 14, 0, 223 }, { 115597, 14, 0, 238 }, { 119953, 15, 0, 182 }, { 123908, 15, 0, 214 }, { 127556, 16, 0, 250 }, { 131812, 16, 0, 274 }, { 134852, 16, 0, 292 }, { 139921, 17, 0, 322 }, { 142555, 18, 0, 18 }, { 147825, 18, 0, 42 }, { 151676, 18, 0, 66 }, { 155932, 18, 0, 93 }, { 159782, 20, 0, 114 }, { 163832, 21, 0, 382 }, { 166669, 21, 0, 400 }, { 170724, 21, 0, 418 }, { 175994, 21, 0, 436 }, { 179642, 22, 4, 400 }, { 183697, 22, 4, 418 }, { 186940, 22, 4, 430 }, { 189372, 22, 4, 439 }, { 195859, 22, 3, 409 }, { 199913, 22, 3, 430 }, { 202345, 22, 3, 439 }, { 207210, 22, 2, 403 }, { 209643, 22, 2, 418 }, { 215318, 22, 2, 439 }, { 218561, 22, 1, 400 }, { 222616, 22, 1, 418 }, { 227886, 22, 1, 436 }, { 231534, 22, 0, 400 }, { 235589, 22, 0, 418 }, { 238832, 22, 0, 430 }, { 241264, 22, 0, 439 } };
 
-static const SongInfoType song4 = { "Hey Jude", "The Beatles", song4_note_right, song4_note_duration_right, sizeof( song4_note_right ) / sizeof( song4_note_right[0] ), song4_note_right, song4_note_duration_right, sizeof( song4_note_right ) / sizeof( song4_note_right[0] ) };
+static const VoiceType song4_voices[] = { { song4_playlist_voice0, sizeof( song4_playlist_voice0 ) / sizeof( song4_playlist_voice0[0] ), song4_seek_voice0, sizeof( song4_seek_voice0 ) / sizeof( song4_seek_voice0[0] ) }, { song4_playlist_voice0, sizeof( song4_playlist_voice0 ) / sizeof( song4_playlist_voice0[0] ), song4_seek_voice0, sizeof( song4_seek_voice0 ) / sizeof( song4_seek_voice0[0] ) } };
+
+static const SongInfoType song4 = { "Hey Jude", "The Beatles", song4_phrase_events, song4_phrases, song4_voices, sizeof( song4_voices ) / sizeof( song4_voices[0] ), 245507 };
 
 /* Song #5 */
-static const u16 song5_note_right[] = { 0, 1047, 0, 698, 0, 880, 0, 698, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 294, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 233, 0, 349, 0, 349, 0, 262, 262, 0, 0, 440, 0, 440, 0, 233, 0, 349, 0, 349, 262, 0, 0, 262, 0, 440, 0, 440, 0, 262, 0, 349, 0, 349, 0, 262, 0, 440, 0, 440, 466, 0, 0, 440, 0, 392, 349, 0, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 294, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 392, 0, 392, 0, 349, 0, 233, 0, 349, 0, 349, 0, 262, 0, 440, 0, 440, 233, 0, 0, 233, 233, 0, 0, 349, 0, 349, 0, 262, 0, 262, 0, 440, 0, 440, 0, 262, 0, 349, 349, 0, 349, 0, 0, 262, 0, 440, 0, 440, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 392, 0, 392, 0, 392, 0, 466, 0, 440, 0, 392, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 349, 0, 466, 0, 466, 0, 466, 0, 523, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 349, 0, 349, 0, 349, 0, 466, 0, 440, 0, 392, 0, 349, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 294, 262, 0, 0, 440, 0, 349, 0, 349, 0, 349, 523, 0, 0, 349, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 294, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 233, 0, 349, 0, 349, 0, 262, 262, 0, 0, 440, 0, 440, 0, 233, 0, 349, 0, 349, 262, 0, 0, 262, 0, 440, 0, 440, 0, 262, 0, 349, 0, 349, 0, 262, 0, 440, 0, 440, 466, 0, 0, 440, 0, 392, 349, 0, 349, 0, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 392, 0, 349, 0, 392, 0, 349, 0, 392, 0, 294, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 440, 0, 440, 0, 392, 0, 392, 0, 392, 0, 349, 0, 233, 0, 349, 0, 349, 0, 262, 0, 440, 0, 440, 233, 0, 0, 349, 0, 349, 0, 262, 0, 262, 0, 440, 0, 440, 0, 262, 0, 349, 349, 0, 349, 0, 0, 262, 0, 440, 0, 440, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 262, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 392, 0, 392, 0, 392, 0, 466, 0, 440, 0, 392, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 349, 0, 466, 0, 466, 0, 466, 0, 523, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 349, 0, 349, 0, 349, 0, 349, 0, 392, 0, 440, 0, 349, 0, 349, 0, 349, 0, 440, 0, 330, 0, 330, 0, 349, 0, 523, 0, 523, 0, 523, 0, 466, 0, 440, 0, 466, 0, 440, 0, 392, 0, 349, 0, 349, 0, 349, 0, 466, 0, 440, 0, 392, 0, 349, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 392, 0, 349, 0, 294, 262, 0, 0, 440, 0, 349, 0, 349, 0, 349, 0, 349, 0, 330, 0, 330, 0, 294, 0, 262, 0, 233, 0, 233, 0, 233, 0, 220, 0, 349, 0, 330, 0, 330, 0, 294, 0, 294, 0, 262, 0, 262, 0, 233, 0, 233, 0, 233, 0, 220, 0,
-220, 349, 0, 0, 262, 330, 0, 0, 262, 330, 0, 0, 233, 294, 0, 0, 220, 262, 0, 0, 196, 233, 0, 0, 196, 233, 0, 0, 196, 233, 0, 0, 175, 220, 0, 0, 262, 349, 0, 0, 262, 330, 0, 0, 262, 330, 262, 294, 0, 0, 262, 294, 0, 0, 262, 349, 466, 0, 0, 0, 0, 0, 262, 349, 466, 0, 0, 0, 262, 349, 466, 0, 0, 0, 262, 349, 466, 0, 0, 0, 262, 349, 466, 294, 349, 523, 0, 0, 0, 0, 0, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 880, 0, 659, 0, 659, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 698, 0, 698, 0, 698, 0, 880, 0, 659, 0, 659, 0, 698, 0, 1047, 0, 1047, 0, 1047, 0, 932, 0, 880, 0, 932, 0, 880, 0, 784, 0, 784, 0, 784, 0, 784, 0, 932, 0, 880, 0, 784, 0, 698, 0, 1047, 0, 1047, 0, 1047, 0, 932, 0, 880, 0, 932, 0, 880, 0, 784, 0, 698, 0, 932, 0, 932, 0, 932, 0, 1047, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 698, 0, 698, 0, 880, 0, 659, 0, 659, 0, 698, 0, 698, 0, 698, 0, 698, 0, 698, 0, 784, 0, 880, 0, 698, 0, 698, 0, 698, 0, 880, 0, 659, 0, 659, 0, 698, 0, 1047, 0, 1047, 0, 1047, 0, 932, 0, 880, 0, 932, 0, 880, 0, 784, 0, 698, 0, 698, 0, 698, 0, 932, 0, 880, 0, 784, 0, 698, 0, 784, 0, 784, 0, 784, 0, 784, 0, 784, 0, 784, 0, 784, 0, 698, 0, 587, 523, 0, 0, 880, 0, 698, 0, 698, 0, 698, 0 };
-static const u16 song5_note_duration_right[] = { 0, 886, 5, 1480, 5, 886, 5, 1485, 594, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 292, 5, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 589, 5, 149, 0, 144, 5, 292, 5, 589, 5, 292, 5, 292, 5, 446, 0, 144, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 297, 0, 144, 5, 144, 5, 1485, 0, 891, 594, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 441, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 446, 0, 144, 5, 149, 0, 144, 5, 292, 5, 441, 5, 144, 5, 292, 5, 292, 5, 589, 5, 292, 5, 149, 0, 297, 0, 441, 5, 292, 5, 292, 5, 297, 297, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 292, 5, 292, 302, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 589, 5, 589, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 144, 5, 144, 5, 441, 5, 441, 5, 441, 5, 144, 5, 1040, 0, 144, 5, 292, 5, 292, 5, 144, 5, 149, 0, 886, 5, 1480, 5, 886, 5, 1480, 599, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 292, 5, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 589, 5, 149, 0, 144, 5, 292, 5, 589, 5, 292, 5, 292, 5, 446, 0, 144, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 297, 0, 144, 5, 144, 5, 1485, 0, 594, 0, 297, 594, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 589, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 441, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 594, 0, 292, 5, 292, 5, 441, 5, 144, 5, 292, 5, 292, 5, 589, 5, 292, 5, 149, 0, 297, 0, 441, 5, 292, 5, 292, 5, 297, 297, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 144, 5, 144, 5, 292, 5, 292, 302, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 589, 5, 589, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 144, 5, 144, 5, 441, 5, 441, 5, 441, 5, 144, 5, 1040, 0, 144, 5, 292, 5, 292, 5, 144, 5, 149, 297, 886, 5, 144, 5, 441, 5, 589, 5, 589, 5, 144, 5, 441, 5, 589, 5, 886, 5, 886, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 144, 5, 441, 5, 589, 5, 886,
-5, 0, 886, 0, 5, 0, 144, 0, 5, 0, 441, 0, 5, 0, 589, 0, 5, 0, 589, 0, 5, 0, 144, 0, 5, 0, 441, 0, 5, 0, 589, 0, 5, 0, 886, 0, 5, 0, 886, 0, 5, 0, 144, 0, 5, 0, 446, 0, 0, 0, 149, 0, 0, 0, 446, 0, 0, 0, 0, 144, 0, 0, 5, 0, 0, 441, 0, 0, 5, 0, 0, 144, 0, 0, 5, 0, 0, 441, 0, 0, 5, 0, 0, 594, 0, 0, 0, 0, 0, 589, 0, 0, 302, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 589, 5, 589, 5, 292, 5, 589, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 144, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 1183, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 144, 5, 144, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 292, 5, 589, 5, 292, 5, 292, 5, 144, 5, 144, 5, 441, 5, 441, 5, 441, 5, 144, 5, 1040, 0, 144, 5, 292, 5, 292, 5, 144, 5, 743, 1000 };
-static const u16 song5_note_left[] = { 0 };
-static const u16 song5_note_duration_left[] = { 65535 };
+static const u8 song5_phrase_events[] = { 84, 134, 118, 0, 5, 77, 139, 72, 0, 5, 81, 134, 118, 0, 5, 77, 139, 77, 0, 132, 82, 65, 129, 16, 0, 5, 65, 131, 57, 0, 5, 65, 132, 77, 0, 5, 69, 129, 16, 0, 5, 69, 130, 36, 0, 5, 69, 130, 36, 0, 5, 67, 130, 36, 0, 5, 65, 129, 16, 0, 5, 67, 129, 16, 0, 5, 65, 129, 16, 0, 5, 67, 130, 36, 0, 5, 62, 132, 77, 0, 5, 58, 130, 36, 0, 5, 65, 130, 36, 0, 5, 65, 132, 77, 0, 5, 60, 129, 21, 0, 129, 21, 69, 130, 36, 0, 5, 69, 132, 77, 65, 131, 62, 0, 129, 21, 60, 130, 36, 0, 5, 69, 130, 36, 0, 5, 69, 132, 77, 0, 5, 60, 130, 36, 69, 130, 41, 0, 129, 21, 69, 129, 16, 0, 5, 67, 139, 77, 0, 139, 77, 65, 132, 77, 0, 5, 67, 129, 16, 67, 129, 16, 0, 5, 67, 129, 16, 0, 5, 65, 131, 57, 69, 131, 62, 0, 129, 21, 58, 129, 21, 0, 129, 21, 65, 130, 36, 0, 5, 65, 131, 57, 0, 5, 60, 129, 16, 0, 5, 0, 5, 65, 129, 21, 0, 133, 103, 69, 130, 41, 0, 130, 41, 60, 129, 16, 0, 5, 60, 129, 16, 0, 5, 60, 130, 36, 0, 5, 60, 130, 36, 0, 5, 60, 130, 36, 0, 5, 0, 130, 46, 65, 129, 16, 0, 5, 65, 129, 16, 0, 5, 67, 130, 36, 0, 5, 69, 137, 31, 0, 5, 65, 130, 36, 0, 5, 69, 130, 36, 0, 5, 64, 130, 36, 0, 5, 64, 130, 36, 0, 5, 65, 132, 77, 0, 5, 65, 130, 36, 72, 129, 16, 0, 5, 72, 129, 16, 0, 5, 72, 130, 36, 0, 5, 70, 130, 36, 0, 5, 69, 130, 36, 0, 5, 67, 132, 77, 0, 5, 67, 130, 36, 0, 5, 67, 130, 36, 0, 5, 67, 130, 36, 67, 130, 36, 0, 5, 65, 132, 77, 0, 5, 65, 130, 36, 0, 5, 70, 132, 77, 0, 5, 70, 132, 77, 0, 5, 70, 130, 36, 0, 5, 72, 132, 77, 0, 5, 65, 130, 36, 65, 130, 36, 0, 5, 65, 130, 36, 65, 130, 36, 65, 130, 36, 0, 5, 65, 130, 36, 0, 5, 65, 130, 36, 67, 131, 57, 0, 5, 67, 131, 57, 0, 5, 67, 131, 57, 0, 5, 65, 129, 16, 0, 5, 62, 136, 16, 0, 129, 21, 69, 130, 36, 0, 5, 65, 130, 36, 0, 5, 65, 129, 16, 0, 5, 65, 129, 21, 0, 134, 123, 65, 139, 72, 0, 5, 69, 134, 118, 0, 5, 65, 139, 72, 0, 132, 87, 69, 132, 82, 0, 130, 41, 0, 5, 65, 129, 21, 0, 133, 103, 0, 130, 41, 65, 134, 118, 0, 5, 64, 129, 16, 0, 5, 64, 131, 57, 0, 5, 62, 132, 77, 0, 5, 60, 132, 77, 0, 5, 58, 129, 16, 0, 5, 58, 131, 57, 0, 5, 58, 132, 77, 0, 5, 57, 134, 118, 0, 5, 62, 129, 16, 0, 5, 62, 131, 57, 0, 5, 60, 129, 16, 0, 5, 60, 131, 57, 64, 131, 62, 0, 133, 104, 70, 131, 57, 0, 5, 70, 129, 16, 0, 5, 70, 131, 57, 0, 5, 70, 132, 82, 0, 134, 123, 77, 129, 16, 0, 5, 77, 129, 16, 0, 5, 79, 130, 36, 0, 5, 81, 137, 31, 0, 5, 77, 130, 36, 0, 5, 81, 130, 36, 0, 5, 76, 130, 36, 0, 5, 76, 130, 36, 0, 5, 77, 132, 77, 0, 5, 77, 130, 36, 84, 129, 16, 0, 5, 84, 129, 16, 0, 5, 84, 130, 36, 0, 5, 82, 130, 36, 0, 5, 81, 130, 36, 0, 5, 79, 132, 77, 0, 5, 79, 130, 36, 0, 5, 79, 130, 36, 0, 5, 79, 130, 36, 79, 130, 36, 0, 5, 77, 132, 77, 0, 5, 77, 130, 36, 0, 5, 82, 132, 77, 0, 5, 82, 132, 77, 0, 5, 82, 130, 36, 0, 5, 84, 132, 77, 0, 5, 77, 130, 36, 77, 130, 36, 0, 5, 77, 130, 36, 77, 130, 36, 77, 130, 36, 0, 5, 77, 130, 36, 0, 5, 77, 130, 36, 79, 129, 16, 0, 5, 79, 129, 16, 0, 5, 79, 131, 57, 0, 5, 79, 131, 57, 0, 5, 79, 131, 57, 0, 5, 77, 129, 16, 0, 5, 74, 136, 16, 0, 129, 21, 81, 130, 36, 0, 5, 77, 130, 36, 0, 5, 77, 129, 16, 0, 5, 77, 133, 103, 0, 135, 104 };
+static const PhraseType song5_phrases[] = { { 0, 31 }, { 21, 10 }, { 31, 50 }, { 21, 55 }, { 81, 29 }, { 79, 12 }, { 110, 24 }, { 84, 12 }, { 116, 10 }, { 134, 22 }, { 21, 30 }, { 156, 3 }, { 59, 12 }, { 61, 20 }, { 21, 35 }, { 159, 13 }, { 79, 17 }, { 172, 27 }, { 116, 18 }, { 199, 8 }, { 207, 16 }, { 213, 10 }, { 223, 15 }, { 213, 18 }, { 238, 13 }, { 241, 10 }, { 251, 10 }, { 261, 25 }, { 241, 20 }, { 286, 3 }, { 259, 27 }, { 289, 23 }, { 302, 10 }, { 312, 20 }, { 302, 12 }, { 332, 10 }, { 289, 25 }, { 304, 15 }, { 342, 25 }, { 241, 25 }, { 367, 3 }, { 370, 8 }, { 249, 17 }, { 378, 3 }, { 381, 13 }, { 319, 10 }, { 159, 10 }, { 394, 63 }, { 21, 60 }, { 56, 25 }, { 457, 6 }, { 184, 15 }, { 463, 8 }, { 213, 25 }, { 381, 10 }, { 266, 20 }, { 304, 28 }, { 251, 15 }, { 394, 44 }, { 471, 48 }, { 474, 15 }, { 519, 18 }, { 497, 22 }, { 474, 45 }, { 474, 10 }, { 537, 37 }, { 564, 10 }, { 574, 10 }, { 584, 25 }, { 564, 20 }, { 609, 3 }, { 582, 27 }, { 612, 23 }, { 625, 10 }, { 635, 20 }, { 625, 12 }, { 655, 10 }, { 612, 25 }, { 627, 15 }, { 665, 25 }, { 564, 25 }, { 690, 3 }, { 693, 8 }, { 572, 17 }, { 701, 3 }, { 704, 13 }, { 642, 10 }, { 717, 57 } };
+static const PhraseRefType song5_playlist_voice0[] = { { 0, 1 }, { 1, 2 }, { 2, 1 }, { 1, 2 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 1, 1 }, { 10, 1 }, { 11, 1 }, { 12, 1 }, { 13, 1 }, { 1, 2 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 8, 1 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 8, 1 }, { 20, 1 }, { 21, 1 }, { 22, 1 }, { 23, 1 }, { 24, 1 }, { 25, 2 }, { 26, 1 }, { 25, 2 }, { 27, 1 }, { 25, 2 }, { 28, 1 }, { 25, 1 }, { 29, 1 }, { 30, 1 }, { 31, 1 }, { 32, 1 }, { 33, 1 }, { 34, 1 }, { 35, 1 }, { 36, 1 }, { 37, 1 }, { 38, 1 }, { 25, 2 }, { 39, 1 }, { 40, 1 }, { 30, 1 }, { 25, 1 }, { 41, 1 }, { 42, 1 }, { 43, 1 }, { 30, 1 }, { 36, 1 }, { 37, 1 }, { 44, 1 }, { 34, 1 }, { 35, 1 }, { 45, 1 }, { 46, 1 }, { 47, 1 }, { 1, 2 }, { 48, 1 }, { 1, 2 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 1, 1 }, { 10, 1 }, { 46, 1 }, { 49, 1 }, { 1, 2 }, { 14, 1 }, { 15, 1 }, { 16, 1 }, { 8, 1 }, { 50, 1 }, { 51, 1 }, { 18, 1 }, { 52, 1 }, { 8, 1 }, { 20, 1 }, { 53, 1 }, { 23, 1 }, { 24, 1 }, { 25, 1 }, { 28, 1 }, { 25, 2 }, { 27, 1 }, { 25, 2 }, { 28, 1 }, { 25, 1 }, { 54, 1 }, { 55, 1 }, { 36, 1 }, { 56, 1 }, { 34, 1 }, { 35, 1 }, { 36, 1 }, { 37, 1 }, { 38, 1 }, { 25, 2 }, { 39, 1 }, { 54, 1 }, { 55, 1 }, { 25, 1 }, { 54, 1 }, { 57, 1 }, { 54, 1 }, { 55, 1 }, { 36, 1 }, { 37, 1 }, { 44, 1 }, { 34, 1 }, { 35, 1 }, { 45, 1 }, { 46, 1 }, { 58, 1 }, { 59, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 63, 1 }, { 64, 1 }, { 65, 1 }, { 66, 2 }, { 67, 1 }, { 66, 2 }, { 68, 1 }, { 66, 2 }, { 69, 1 }, { 66, 1 }, { 70, 1 }, { 71, 1 }, { 72, 1 }, { 73, 1 }, { 74, 1 }, { 75, 1 }, { 76, 1 }, { 77, 1 }, { 78, 1 }, { 79, 1 }, { 66, 2 }, { 80, 1 }, { 81, 1 }, { 71, 1 }, { 66, 1 }, { 82, 1 }, { 83, 1 }, { 84, 1 }, { 71, 1 }, { 77, 1 }, { 78, 1 }, { 85, 1 }, { 75, 1 }, { 76, 1 }, { 86, 1 }, { 87, 1 } };
+static const SeekPointType song5_seek_voice0[] = { { 0, 0, 0, 0 }, { 3267, 0, 0, 15 }, { 7874, 2, 0, 41 }, { 11888, 4, 0, 31 }, { 15752, 5, 0, 102 }, { 19614, 8, 0, 91 }, { 22882, 10, 0, 148 }, { 27935, 15, 0, 61 }, { 31949, 17, 0, 46 }, { 35962, 21, 0, 184 }, { 39825, 25, 0, 207 }, { 43989, 31, 0, 251 }, { 47996, 34, 1, 244 }, { 51717, 38, 0, 276 }, { 55876, 42, 0, 304 }, { 59738, 46, 0, 342 }, { 63305, 48, 0, 256 }, { 67761, 53, 0, 251 }, { 71920, 56, 0, 299 }, { 75781, 60, 0, 337 }, { 79943, 63, 0, 420 }, { 83211, 63, 0, 446 }, { 87966, 65, 0, 31 }, { 91682, 66, 0, 26 }, { 95695, 68, 0, 91 }, { 99855, 70, 0, 131 }, { 103717, 73, 0, 148 }, { 107729, 75, 0, 41 }, { 111744, 79, 0, 31 }, { 115904, 83, 0, 457 }, { 119321, 86, 0, 468 }, { 123928, 91, 0, 241 }, { 127794, 95, 0, 276 }, { 131956, 100, 0, 266 }, { 135818, 102, 0, 319 }, { 139977, 106, 0, 314 }, { 143841, 109, 0, 251 }, { 148000, 113, 0, 381 }, { 151861, 116, 0, 281 }, { 155723, 120, 0, 304 }, { 159587, 124, 0, 414 }, { 163451, 125, 0, 489 }, { 167759, 126, 0, 484 }, { 171475, 129, 0, 474 }, { 175338, 129, 0, 514 }, { 179500, 131, 0, 558 }, { 183960, 135, 0, 584 }, { 186933, 137, 0, 579 }, { 191984, 142, 0, 632 }, { 195846, 146, 0, 627 }, { 199999, 148, 0, 688 }, { 203868, 152, 0, 599 }, { 207730, 157, 0, 584 }, { 211889, 160, 0, 704 }, { 215603, 164, 0, 732 }, { 219319, 164, 0, 771 } };
+
+static const VoiceType song5_voices[] = { { song5_playlist_voice0, sizeof( song5_playlist_voice0 ) / sizeof( song5_playlist_voice0[0] ), song5_seek_voice0, sizeof( song5_seek_voice0 ) / sizeof( song5_seek_voice0[0] ) }, { song5_playlist_voice0, sizeof( song5_playlist_voice0 ) / sizeof( song5_playlist_voice0[0] ), song5_seek_voice0, sizeof( song5_seek_voice0 ) / sizeof( song5_seek_voice0[0] ) } };
 
-static const SongInfoType song5 = { "Blank Space", "Taylor Swift", song5_note_right, song5_note_duration_right, sizeof( song5_note_right ) / sizeof( song5_note_right[0] ), song5_note_right, song5_note_duration_right, sizeof( song5_note_right ) / sizeof( song5_note_right[0] ) };
+static const SongInfoType song5 = { "Blank Space", "Taylor Swift", song5_phrase_events, song5_phrases, song5_voices, sizeof( song5_voices ) / sizeof( song5_voices[0] ), 220319 };
 
 /* Song #6 */
-static const u16 song6_note_right[] = { 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 147, 0, 220, 0, 208, 0, 185, 0, 165, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 220, 147, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 147, 0, 220, 0, 208, 0, 185, 0, 165, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 220, 147, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 147, 0, 220, 0, 208, 0, 185, 0, 165, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 220, 147, 0, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 330, 0, 370, 0, 330, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 370, 0, 147, 0, 147, 0, 415, 0, 147, 0, 440, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 185, 0, 185, 0, 415, 0, 185, 0, 370, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 415, 0, 370, 0, 330, 0, 294, 0, 330, 0, 370, 0, 415, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 330, 0, 370, 0, 330, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 370, 0, 147, 0, 147, 0, 415, 0, 147, 0, 440, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 185, 0, 185, 0, 415, 0, 185, 0, 370, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 415, 0, 370, 0, 330, 0, 294, 0, 330, 0, 370, 0, 415, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0,
-208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 988, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 1109, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 554, 0, 494, 0, 440, 0, 554, 0, 494, 0, 554, 0, 494, 0, 440, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 147, 0, 220, 0, 208, 0, 185, 0, 165, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 220, 147, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 147, 0, 220, 0, 208, 0, 185, 0, 165, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 185, 0, 208, 0, 220, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 220, 147, 0, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 330, 0, 370, 0, 330, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 370, 0, 147, 0, 147, 0, 415, 0, 147, 0, 440, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 185, 0, 185, 0, 415, 0, 185, 0, 370, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 415, 0, 370, 0, 330, 0, 294, 0,
-330, 0, 370, 0, 415, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 330, 0, 370, 0, 330, 0, 165, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 147, 0, 370, 0, 147, 0, 147, 0, 415, 0, 147, 0, 440, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 185, 0, 185, 0, 415, 0, 185, 0, 370, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 440, 0, 415, 0, 370, 0, 330, 0, 294, 0, 330, 0, 370, 0, 415, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 165, 0, 147, 0, 147, 0, 147, 0, 165, 0, 147, 0, 147, 0, 147, 0, 185, 0, 147, 0, 147, 0, 220, 0, 147, 0, 208, 0, 147, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 185, 0, 208, 0, 208, 0, 220, 0, 220, 0, 247, 0, 247, 0, 277, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 988, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 1109, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 554, 0, 494, 0, 440, 0, 554, 0, 494, 0, 554, 0, 494, 0, 440, 0, 370, 277, 185, 0, 0, 0, 370, 277, 185, 0, 0, 0, 440, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 415, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 370, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 415, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 440, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 415, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 370, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 415, 0, 494, 0, 554, 0, 587, 0, 554, 0, 494, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0,
-277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 330, 247, 165, 0, 0, 0, 330, 247, 165, 0, 0, 0, 370, 0, 370, 0, 415, 0, 440, 0, 370, 0, 415, 0, 440, 0, 415, 0, 440, 0, 494, 0, 440, 0, 415, 0, 659, 0, 740, 0, 831, 0, 740, 0, 740, 0, 831, 0, 880, 0, 988, 0, 1109, 0, 1175, 0, 1319, 0, 1480, 0, 1661, 0, 1661, 0, 1760, 0, 1661, 0, 1175, 0, 1319, 0, 1480, 0, 1661, 0, 1760, 0, 1976, 0, 1976, 0, 1976, 0, 1976, 0, 2217, 0, 1760, 0, 1480, 0, 1109, 0, 1480, 0, 1760, 0, 2217, 0, 1760, 0, 1480, 0, 1109, 0, 1480, 0, 1760, 0, 2217, 0, 1760, 0, 1480, 0, 1109, 0, 1480, 0, 1760, 0, 2217, 0, 1760, 0, 1480, 0, 1109, 0, 1760, 0, 1661, 0, 1319, 0, 988, 0, 880, 0, 831, 0, 1175, 0, 1175, 0, 1175, 0, 1175, 0, 1109, 0, 1109, 0, 831, 0, 831, 0, 831, 0, 880, 0, 880, 0, 880, 0, 831, 0, 831, 0, 988, 0, 988, 0, 988, 0, 880, 0, 880, 0, 880, 0, 831, 0, 831, 0, 740, 277, 185, 0, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 277, 185, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 247, 165, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 220, 147, 0, 0, 330, 247, 165, 0, 0, 0, 330, 247, 165, 0, 0, 0, 370, 277, 185, 0, 0, 0, 440, 330, 220, 0, 0, 0, 330, 247, 165, 0, 0, 0, 415, 311, 208, 0, 0, 0, 440, 330, 220, 0, 0, 0, 294, 220, 147, 0, 0, 0, 415, 311, 208, 0, 0, 0, 440, 330, 220, 0, 0, 0, 330, 247, 165, 0, 0, 0, 330, 220, 0, 0, 311, 208, 0, 0, 330, 220, 0, 0, 311, 208, 0, 0, 370, 277, 185, 0, 0, 0, 440, 330, 220, 0, 0, 0, 330, 247, 165, 0, 0, 0, 415, 311, 208, 0, 0, 0, 440, 330, 220, 0, 0, 0, 294, 220, 147, 0, 0, 0, 415, 311, 208, 0, 0, 0, 440, 330, 220, 0, 0, 0, 330, 247, 165, 0, 0, 0, 330, 220, 0, 0, 311, 208, 0, 0, 330, 220, 0, 0, 311, 208, 0, 0, 554, 0, 494, 0,
-440, 0, 554, 0, 494, 0, 554, 0, 494, 0, 440, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 1109, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 1109, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 740, 0, 740, 0, 1109, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 880, 0, 831, 0, 659, 0, 880, 0, 831, 0, 740, 0, 880, 0, 831, 0, 880, 0, 831, 0, 740, 0, 440, 0, 415, 0, 330, 0, 370, 0 };
-static const u16 song6_note_duration_right[] = { 0, 0, 284, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 284, 0, 284, 0, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 1137, 0, 0, 0, 284, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 284, 0, 284, 0, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 1137, 0, 0, 0, 284, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 284, 0, 284, 0, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 1137, 0, 0, 142, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 284, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 284, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 142,
-0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 0, 0, 142, 0, 0, 0, 142, 0, 0, 0, 0, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 0, 0, 142, 0, 0, 0, 142, 0, 0, 0, 0, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 0, 284, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 284, 0, 284, 0, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 1137, 0, 0, 0, 284, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 284, 0, 284, 0, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 142, 0, 142, 0, 142, 0, 0, 427, 0, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 80, 0, 1137, 0, 0, 142, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 284, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142,
-0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 284, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 62, 80, 62, 80, 142, 0, 62, 80, 142, 0, 62, 80, 0, 0, 142, 0, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 0, 0, 142, 0, 0, 0, 142, 0, 0, 0, 0, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 62, 9, 62, 9, 62, 80, 0, 0, 142, 0, 0, 0, 142, 0, 0, 0, 0, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 0, 0, 6825, 0, 0, 0, 0, 0, 284, 0, 0, 853, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0,
-9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 0, 1706, 0, 0, 0, 0, 0, 569, 0, 0, 0, 711, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 284, 0, 142, 0, 142, 0, 569, 0, 71, 0, 71, 0, 71, 0, 71, 0, 71, 0, 71, 0, 71, 0, 71, 0, 0, 0, 142, 0, 142, 0, 569, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 0, 0, 0, 0, 1137, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 95, 0, 284, 0, 427, 0, 427, 0, 284, 0, 427, 0, 427, 0, 284, 0, 853, 0, 142, 0, 142, 0, 0, 0, 142, 0, 853, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 0, 0, 62, 0, 9, 0, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 1075, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 62, 0, 9, 0, 0, 1706, 0, 0, 0, 0, 0, 569, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 569, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 1137, 0, 0, 0, 0, 142, 0, 0, 0, 427, 0, 0, 0, 142, 0, 0, 0, 427, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 569, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 1706, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 1137, 0, 0, 0, 0, 142, 0, 0, 0, 427, 0, 0, 0, 142, 0, 0, 0, 427, 0, 0, 427, 0, 427,
-0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 142, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 569, 0, 284, 0, 71, 0, 71, 0, 142, 0, 284, 0, 427, 0, 427, 0, 284, 0, 284, 1000 };
-static const u16 song6_note_left[] = { 0 };
-static const u16 song6_note_duration_left[] = { 65535 };
-
-static const SongInfoType song6 = { "The Deceived", "Trivium", song6_note_right, song6_note_duration_right, sizeof( song6_note_right ) / sizeof( song6_note_right[0] ), song6_note_right, song6_note_duration_right, sizeof( song6_note_right ) / sizeof( song6_note_right[0] ) };
+static const u8 song6_phrase_events[] = { 54, 130, 28, 54, 62, 0, 9, 54, 62, 0, 9, 54, 62, 0, 80, 54, 129, 14, 56, 129, 14, 57, 129, 14, 54, 131, 43, 50, 130, 28, 57, 130, 28, 56, 129, 14, 54, 129, 14, 52, 129, 14, 54, 131, 43, 50, 136, 113, 50, 136, 113, 50, 136, 113, 52, 129, 14, 50, 129, 14, 50, 62, 0, 80, 50, 62, 0, 80, 64, 129, 14, 66, 129, 14, 64, 129, 14, 52, 130, 28, 66, 129, 14, 68, 129, 14, 50, 62, 0, 80, 69, 129, 14, 50, 62, 0, 80, 54, 129, 14, 54, 62, 0, 80, 54, 62, 0, 80, 69, 129, 14, 68, 129, 14, 54, 62, 0, 80, 66, 129, 14, 54, 62, 66, 129, 14, 64, 129, 14, 62, 129, 14, 64, 129, 14, 66, 129, 14, 68, 129, 14, 66, 129, 14, 52, 129, 14, 50, 129, 14, 50, 129, 14, 50, 129, 14, 54, 129, 14, 50, 129, 14, 50, 129, 14, 57, 129, 14, 50, 129, 14, 56, 129, 14, 50, 129, 14, 54, 131, 43, 56, 129, 14, 57, 129, 14, 57, 129, 14, 59, 129, 14, 59, 129, 14, 61, 129, 14, 56, 129, 14, 57, 129, 14, 59, 129, 14, 61, 129, 14, 81, 131, 43, 80, 131, 43, 78, 132, 57, 81, 130, 28, 80, 71, 81, 71, 80, 129, 14, 78, 130, 28, 81, 131, 43, 80, 131, 43, 76, 132, 57, 76, 130, 28, 78, 130, 28, 78, 129, 14, 83, 129, 14, 81, 129, 14, 80, 129, 14, 81, 129, 14, 80, 129, 14, 78, 129, 14, 76, 129, 14, 76, 130, 28, 78, 130, 28, 78, 129, 14, 85, 129, 14, 76, 130, 28, 73, 131, 43, 71, 131, 43, 69, 132, 57, 73, 130, 28, 71, 71, 73, 71, 71, 129, 14, 69, 130, 28, 50, 136, 113, 66, 129, 14, 66, 129, 14, 76, 130, 28, 76, 130, 28, 78, 130, 28, 78, 129, 14, 85, 129, 14, 76, 130, 28, 54, 181, 41, 54, 130, 28, 0, 134, 85, 69, 131, 43, 71, 131, 43, 73, 130, 28, 74, 131, 43, 73, 131, 43, 71, 130, 28, 68, 131, 43, 66, 131, 43, 66, 131, 43, 0, 136, 51, 0, 9, 54, 62, 0, 9, 52, 62, 0, 9, 52, 62, 0, 9, 52, 62, 0, 136, 51, 50, 62, 0, 9, 50, 62, 0, 9, 50, 62, 0, 9, 50, 62, 0, 136, 51, 0, 9, 50, 62, 0, 9, 52, 141, 42, 52, 132, 57, 66, 133, 71, 66, 129, 14, 68, 129, 14, 69, 129, 14, 66, 129, 14, 68, 129, 14, 69, 129, 14, 68, 129, 14, 69, 129, 14, 71, 129, 14, 69, 129, 14, 68, 129, 14, 76, 130, 28, 78, 129, 14, 80, 129, 14, 78, 132, 57, 78, 71, 80, 71, 81, 71, 83, 71, 85, 71, 86, 71, 88, 71, 90, 71, 92, 129, 14, 93, 129, 14, 92, 132, 57, 86, 95, 88, 95, 90, 95, 92, 95, 93, 95, 95, 95, 95, 136, 113, 97, 95, 93, 95, 90, 95, 85, 95, 90, 95, 93, 95, 97, 95, 93, 95, 90, 95, 85, 130, 28, 93, 131, 43, 92, 131, 43, 88, 130, 28, 83, 131, 43, 81, 131, 43, 80, 130, 28, 86, 134, 85, 86, 129, 14, 86, 129, 14, 85, 129, 14, 85, 134, 85, 80, 129, 14, 80, 129, 14, 80, 129, 14, 81, 129, 14, 81, 129, 14, 81, 129, 14, 80, 129, 14, 80, 129, 14, 83, 129, 14, 83, 129, 14, 83, 129, 14, 0, 136, 51, 0, 9, 50, 62, 0, 136, 51, 54, 141, 42, 57, 132, 57, 52, 141, 42, 56, 130, 28, 57, 130, 28, 50, 141, 42, 56, 130, 28, 57, 130, 28, 52, 136, 113, 57, 129, 14, 56, 131, 43, 57, 129, 14, 56, 131, 43, 76, 130, 28, 78, 130, 28, 78, 129, 14, 85, 129, 14, 76, 130, 28, 78, 130, 28, 78, 129, 14, 85, 129, 14, 76, 130, 28, 78, 130, 28, 78, 129, 14, 85, 129, 14, 76, 130, 28, 69, 131, 43, 68, 131, 43, 64, 130, 28, 66, 130, 28, 0, 135, 104 };
+static const PhraseType song6_phrases[] = { { 0, 15 }, { 3, 12 }, { 15, 12 }, { 27, 18 }, { 3, 24 }, { 45, 3 }, { 48, 3 }, { 51, 17 }, { 60, 8 }, { 68, 12 }, { 57, 11 }, { 80, 3 }, { 83, 25 }, { 100, 8 }, { 108, 3 }, { 111, 12 }, { 95, 13 }, { 100, 14 }, { 123, 18 }, { 54, 14 }, { 60, 20 }, { 141, 3 }, { 100, 11 }, { 144, 12 }, { 156, 24 }, { 3, 18 }, { 180, 18 }, { 144, 36 }, { 198, 12 }, { 210, 31 }, { 219, 10 }, { 241, 3 }, { 210, 28 }, { 244, 27 }, { 271, 3 }, { 274, 9 }, { 253, 18 }, { 283, 3 }, { 210, 22 }, { 286, 22 }, { 308, 3 }, { 311, 3 }, { 314, 3 }, { 198, 43 }, { 317, 3 }, { 320, 3 }, { 323, 9 }, { 332, 3 }, { 335, 30 }, { 347, 15 }, { 365, 3 }, { 347, 18 }, { 344, 21 }, { 368, 3 }, { 3, 10 }, { 5, 8 }, { 371, 3 }, { 374, 12 }, { 378, 8 }, { 386, 7 }, { 380, 10 }, { 378, 12 }, { 378, 10 }, { 393, 8 }, { 401, 2 }, { 390, 13 }, { 395, 8 }, { 403, 4 }, { 378, 15 }, { 407, 3 }, { 374, 16 }, { 393, 14 }, { 395, 12 }, { 399, 11 }, { 410, 112 }, { 510, 12 }, { 522, 75 }, { 573, 15 }, { 597, 3 }, { 600, 4 }, { 604, 3 }, { 410, 12 }, { 607, 39 }, { 646, 3 }, { 649, 9 }, { 658, 3 }, { 661, 9 }, { 670, 3 }, { 673, 9 }, { 682, 3 }, { 685, 15 } };
+static const PhraseRefType song6_playlist_voice0[] = { { 0, 1 }, { 1, 4 }, { 2, 1 }, { 1, 3 }, { 3, 1 }, { 1, 4 }, { 4, 1 }, { 1, 3 }, { 5, 1 }, { 0, 1 }, { 1, 3 }, { 4, 1 }, { 1, 3 }, { 3, 1 }, { 1, 4 }, { 4, 1 }, { 1, 3 }, { 6, 1 }, { 0, 1 }, { 1, 3 }, { 4, 1 }, { 1, 3 }, { 3, 1 }, { 1, 4 }, { 4, 1 }, { 1, 3 }, { 7, 1 }, { 8, 4 }, { 9, 1 }, { 10, 1 }, { 8, 2 }, { 11, 1 }, { 8, 1 }, { 12, 1 }, { 13, 2 }, { 14, 1 }, { 13, 1 }, { 15, 1 }, { 16, 1 }, { 13, 1 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 8, 3 }, { 20, 1 }, { 10, 1 }, { 8, 2 }, { 21, 1 }, { 8, 1 }, { 12, 1 }, { 13, 1 }, { 22, 1 }, { 13, 1 }, { 15, 1 }, { 16, 1 }, { 13, 1 }, { 17, 1 }, { 18, 1 }, { 23, 2 }, { 24, 1 }, { 1, 2 }, { 25, 1 }, { 26, 1 }, { 23, 1 }, { 27, 1 }, { 1, 3 }, { 28, 1 }, { 23, 1 }, { 27, 1 }, { 1, 2 }, { 25, 1 }, { 26, 1 }, { 23, 1 }, { 27, 1 }, { 1, 3 }, { 28, 1 }, { 29, 1 }, { 30, 1 }, { 31, 1 }, { 32, 1 }, { 33, 1 }, { 29, 1 }, { 30, 1 }, { 34, 1 }, { 32, 1 }, { 35, 1 }, { 36, 1 }, { 29, 1 }, { 30, 1 }, { 37, 1 }, { 38, 1 }, { 39, 1 }, { 0, 1 }, { 1, 3 }, { 4, 1 }, { 1, 3 }, { 3, 1 }, { 1, 4 }, { 4, 1 }, { 1, 3 }, { 40, 1 }, { 0, 1 }, { 1, 3 }, { 4, 1 }, { 1, 3 }, { 3, 1 }, { 1, 4 }, { 4, 1 }, { 1, 3 }, { 7, 1 }, { 8, 3 }, { 20, 1 }, { 10, 1 }, { 8, 2 }, { 41, 1 }, { 8, 1 }, { 12, 1 }, { 13, 1 }, { 22, 1 }, { 13, 1 }, { 15, 1 }, { 16, 1 }, { 13, 1 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 8, 3 }, { 20, 1 }, { 10, 1 }, { 8, 2 }, { 42, 1 }, { 8, 1 }, { 12, 1 }, { 13, 1 }, { 22, 1 }, { 13, 1 }, { 15, 1 }, { 16, 1 }, { 13, 1 }, { 17, 1 }, { 18, 1 }, { 23, 1 }, { 27, 1 }, { 1, 2 }, { 25, 1 }, { 26, 1 }, { 23, 1 }, { 27, 1 }, { 1, 3 }, { 28, 1 }, { 23, 1 }, { 27, 1 }, { 1, 2 }, { 25, 1 }, { 26, 1 }, { 23, 1 }, { 27, 1 }, { 1, 3 }, { 43, 1 }, { 30, 1 }, { 44, 1 }, { 32, 1 }, { 33, 1 }, { 29, 1 }, { 30, 1 }, { 45, 1 }, { 32, 1 }, { 46, 1 }, { 36, 1 }, { 29, 1 }, { 30, 1 }, { 47, 1 }, { 38, 1 }, { 39, 1 }, { 48, 1 }, { 49, 1 }, { 50, 1 }, { 51, 1 }, { 49, 1 }, { 52, 1 }, { 49, 1 }, { 53, 1 }, { 51, 1 }, { 49, 1 }, { 54, 1 }, { 55, 3 }, { 56, 1 }, { 54, 1 }, { 55, 2 }, { 57, 1 }, { 58, 3 }, { 59, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 63, 4 }, { 64, 1 }, { 65, 1 }, { 66, 2 }, { 67, 1 }, { 61, 2 }, { 68, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 54, 1 }, { 55, 3 }, { 69, 1 }, { 54, 1 }, { 55, 2 }, { 70, 1 }, { 61, 1 }, { 68, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 71, 1 }, { 72, 1 }, { 73, 1 }, { 71, 1 }, { 72, 1 }, { 74, 1 }, { 75, 2 }, { 76, 1 }, { 77, 1 }, { 54, 1 }, { 55, 3 }, { 78, 1 }, { 54, 1 }, { 55, 2 }, { 70, 1 }, { 61, 1 }, { 68, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 71, 1 }, { 72, 1 }, { 73, 1 }, { 71, 1 }, { 72, 1 }, { 79, 1 }, { 61, 2 }, { 68, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 54, 1 }, { 55, 3 }, 
+{ 80, 1 }, { 54, 1 }, { 55, 2 }, { 70, 1 }, { 61, 1 }, { 68, 1 }, { 60, 1 }, { 61, 1 }, { 62, 1 }, { 71, 1 }, { 72, 1 }, { 73, 1 }, { 71, 1 }, { 72, 1 }, { 81, 1 }, { 82, 2 }, { 39, 1 }, { 29, 1 }, { 30, 1 }, { 83, 1 }, { 32, 1 }, { 84, 1 }, { 36, 1 }, { 29, 1 }, { 30, 1 }, { 85, 1 }, { 32, 1 }, { 86, 1 }, { 36, 1 }, { 29, 1 }, { 30, 1 }, { 87, 1 }, { 32, 1 }, { 88, 1 }, { 36, 1 }, { 29, 1 }, { 30, 1 }, { 89, 1 }, { 38, 1 }, { 90, 1 } };
+static const SeekPointType song6_seek_voice0[] = { { 0, 0, 0, 0 }, { 3977, 4, 0, 33 }, { 7955, 8, 0, 45 }, { 11995, 12, 1, 5 }, { 15768, 15, 0, 24 }, { 19888, 20, 0, 15 }, { 23999, 23, 0, 9 }, { 27986, 27, 3, 64 }, { 31962, 33, 0, 104 }, { 35938, 42, 0, 57 }, { 39914, 49, 0, 90 }, { 43890, 57, 0, 132 }, { 47867, 61, 0, 18 }, { 51986, 65, 0, 3 }, { 55963, 70, 0, 3 }, { 59940, 74, 2, 3 }, { 63635, 76, 0, 232 }, { 67901, 79, 0, 229 }, { 71882, 81, 0, 219 }, { 75863, 84, 0, 216 }, { 79985, 87, 0, 213 }, { 83824, 89, 0, 283 }, { 87806, 91, 0, 295 }, { 91987, 95, 0, 13 }, { 95965, 99, 2, 13 }, { 99880, 103, 0, 24 }, { 104000, 107, 0, 15 }, { 107978, 110, 0, 60 }, { 111954, 118, 0, 100 }, { 115992, 126, 2, 62 }, { 119968, 132, 0, 102 }, { 123882, 141, 0, 144 }, { 127859, 145, 0, 186 }, { 131978, 149, 0, 201 }, { 135955, 153, 0, 18 }, { 139994, 157, 1, 13 }, { 143628, 158, 0, 235 }, { 147751, 161, 0, 232 }, { 151874, 163, 0, 226 }, { 155998, 166, 0, 219 }, { 159978, 169, 0, 216 }, { 163674, 172, 0, 210 }, { 167940, 173, 0, 305 }, { 168224, 174, 0, 335 }, { 175333, 174, 0, 341 }, { 179600, 175, 0, 353 }, { 183868, 178, 0, 350 }, { 187993, 180, 0, 347 }, { 191834, 182, 0, 359 }, { 195024, 186, 0, 371 }, { 199570, 197, 0, 390 }, { 203983, 206, 0, 7 }, { 207961, 215, 0, 384 }, { 210305, 221, 0, 416 }, { 215990, 221, 0, 470 }, { 219973, 222, 1, 516 }, { 223673, 223, 0, 549 }, { 227935, 224, 0, 585 }, { 230980, 232, 0, 390 }, { 235526, 243, 0, 390 }, { 239939, 254, 0, 384 }, { 243988, 263, 0, 416 }, { 247969, 264, 1, 610 }, { 250812, 264, 1, 622 }, { 255361, 264, 0, 607 }, { 259910, 264, 0, 622 }, { 263890, 264, 0, 640 }, { 267588, 266, 0, 216 }, { 271711, 269, 0, 213 }, { 275833, 272, 0, 210 }, { 279957, 273, 0, 226 }, { 283938, 276, 0, 667 }, { 287634, 278, 0, 235 }, { 291757, 281, 0, 232 }, { 295880, 284, 0, 226 }, { 299435, 287, 0, 216 } };
+
+static const VoiceType song6_voices[] = { { song6_playlist_voice0, sizeof( song6_playlist_voice0 ) / sizeof( song6_playlist_voice0[0] ), song6_seek_voice0, sizeof( song6_seek_voice0 ) / sizeof( song6_seek_voice0[0] ) }, { song6_playlist_voice0, sizeof( song6_playlist_voice0 ) / sizeof( song6_playlist_voice0[0] ), song6_seek_voice0, sizeof( song6_seek_voice0 ) / sizeof( song6_seek_voice0[0] ) } };
+
+static const SongInfoType song6 = { "The Deceived", "Trivium", song6_phrase_events, song6_phrases, song6_voices, sizeof( song6_voices ) / sizeof( song6_voices[0] ), 303278 };
 
 /* Song #7 */
-static const u16 song7_note_right[] = { 0, 880, 0, 1047, 0, 880, 0, 1175, 0, 1397, 0, 1319, 0, 880, 0, 1047, 0, 880, 0, 1397, 0, 1319, 0, 1047, 0, 880, 440, 0, 0, 1047, 523, 0, 0, 880, 440, 0, 0, 1175, 587, 0, 0, 1397, 698, 0, 0, 1319, 659, 0, 0, 880, 440, 0, 0, 1047, 523, 0, 0, 880, 440, 0, 0, 1397, 698, 0, 0, 1319, 659, 0, 0, 1047, 523, 0, 0, 880, 440, 0, 0, 1047, 523, 0, 0, 880, 440, 0, 0, 1175, 587, 0, 0, 880, 0, 880, 0, 880, 0, 880, 0, 932, 0, 880, 0, 880, 0, 784, 0, 698, 0, 523, 0, 880, 0, 880, 0, 784, 0, 698, 0, 784, 0, 523, 0, 880, 0, 880, 0, 784, 0, 698, 0, 784, 0, 880, 0, 880, 0, 880, 0, 880, 0, 932, 0, 880, 0, 880, 0, 784, 0, 698, 0, 523, 0, 880, 0, 880, 0, 784, 0, 698, 0, 784, 0, 523, 0, 880, 0, 784, 0, 698, 0, 784, 0, 880, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 880, 0, 880, 0, 1175, 0, 1175, 0, 1047, 0, 880, 0, 880, 0, 880, 0, 880, 0, 1175, 0, 1175, 0, 1047, 0, 880, 0, 932, 0, 1047, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 0, 1175, 0, 1175, 0, 1175, 0, 1047, 0, 1175, 0, 1047, 0, 1047, 0, 1047, 0, 1175, 0, 1047, 0, 1047, 0, 1047, 0, 880, 0, 880, 0, 932, 0, 880, 0, 784, 0, 880, 0, 880, 0, 698, 0, 880, 0, 880, 0, 880, 0, 880, 0, 932, 0, 880, 0, 880, 0, 784, 0, 698, 0, 523, 0, 880, 0, 880, 0, 784, 0, 698, 0, 880, 0, 784, 0, 698, 0, 784, 0, 880, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 880, 0, 880, 0, 1175, 0, 1175, 0, 1047, 0, 880, 0, 880, 0, 880, 0, 880, 0, 1175, 0, 1175, 0, 1047, 0, 880, 0, 932, 0, 1047, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 587, 0, 880, 0, 880, 0, 880, 0, 1175, 0, 1175, 0, 1047, 0, 880, 0, 880, 0, 880, 0, 880, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0,
-0, 0, 1175, 587, 294, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1397, 698, 349, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1865, 932, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1568, 784, 0, 0, 1397, 698, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1175, 587, 294, 0, 0, 0, 1319, 659, 330, 0, 0, 0, 1047, 523, 262, 0, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1865, 932, 0, 0, 1760, 880, 0, 0, 1760, 880, 0, 0, 1568, 784, 0, 0, 1397, 698, 0, 0, 1319, 659, 0, 0, 1175, 587, 0, 0 };
-static const u16 song7_note_duration_right[] = { 1364, 273, 0, 273, 0, 273, 0, 818, 0, 818, 0, 1091, 818, 273, 0, 273, 0, 273, 0, 818, 0, 818, 0, 1091, 818, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 818, 0, 0, 0, 818, 0, 0, 0, 545, 545, 818, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 818, 0, 0, 0, 818, 0, 0, 0, 545, 545, 818, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 545, 0, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 545, 545, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 545, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 818, 545, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 545, 545, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 545, 0, 273, 0, 273, 0, 545, 0, 545, 0, 545, 0, 818, 0, 273, 0, 136, 0, 136, 0, 273, 0, 136, 0, 273, 0, 273, 0, 136, 0, 273, 0, 136, 0, 136, 0, 273, 0, 818, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 545, 0, 818, 0, 273, 0, 136, 0, 136, 0, 273, 0, 136, 0, 273, 0, 273, 0, 136, 0, 273, 0, 136, 0, 136, 0, 273, 0, 1364, 0, 0, 0, 818, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 1364, 0, 273, 0, 273, 0, 273, 0, 545, 0, 545, 0, 273, 0, 273, 0, 545, 0, 545, 0, 545, 0, 545, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 545, 545, 273, 0, 273, 0, 273, 0, 273, 0, 1364, 0, 273, 0, 545, 0, 545, 0, 545, 0, 818, 0, 273, 0, 136, 0, 136, 0, 273, 0, 136, 0, 273, 0, 273, 0, 136, 0, 273, 0, 136, 0, 136, 0, 273, 0, 818, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 545, 0, 818, 0, 273, 0, 136, 0, 136, 0, 273, 0, 136, 0, 273, 0, 273, 0, 136, 0, 273, 0, 136, 0, 136, 0, 273, 0, 545, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 273, 0, 545, 0, 273, 0, 273, 0, 273, 0, 0, 0, 409, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 1364, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 1636, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 1091, 0, 0, 0, 0, 0, 1091, 0, 0, 0, 0, 0, 1091, 0, 0, 0, 0, 0, 1091, 0, 0, 0, 0, 0, 1364,
-0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 1909, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 273, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 1364, 0, 0, 0, 0, 818, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 545, 0, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 273, 273, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 818, 0, 0, 0, 545, 0, 0, 0, 2182, 0, 1000 };
-static const u16 song7_note_left[] = { 0 };
-static const u16 song7_note_duration_left[] = { 65535 };
-
-static const SongInfoType song7 = { "Numb", "Linkin Park", song7_note_right, song7_note_duration_right, sizeof( song7_note_right ) / sizeof( song7_note_right[0] ), song7_note_right, song7_note_duration_right, sizeof( song7_note_right ) / sizeof( song7_note_right[0] ) };
+static const u8 song7_phrase_events[] = { 0, 138, 84, 81, 130, 17, 84, 130, 17, 81, 130, 17, 86, 134, 50, 89, 134, 50, 88, 136, 67, 0, 134, 50, 81, 130, 17, 84, 130, 17, 81, 130, 17, 89, 134, 50, 88, 134, 50, 84, 136, 67, 0, 134, 50, 69, 130, 17, 72, 130, 17, 69, 130, 17, 74, 134, 50, 77, 134, 50, 76, 132, 33, 0, 138, 83, 69, 130, 17, 72, 130, 17, 69, 130, 17, 77, 134, 50, 76, 134, 50, 72, 132, 33, 74, 132, 33, 81, 130, 17, 81, 130, 17, 81, 130, 17, 81, 130, 17, 82, 130, 17, 81, 132, 33, 81, 130, 17, 79, 130, 17, 77, 132, 33, 0, 132, 33, 72, 130, 17, 81, 130, 17, 81, 130, 17, 79, 130, 17, 77, 132, 33, 79, 132, 33, 79, 134, 50, 0, 132, 33, 72, 130, 17, 81, 130, 17, 79, 132, 33, 77, 132, 33, 79, 132, 33, 81, 134, 50, 74, 130, 17, 74, 129, 8, 74, 129, 8, 74, 130, 17, 74, 129, 8, 74, 130, 17, 74, 130, 17, 74, 129, 8, 74, 134, 50, 81, 130, 17, 81, 130, 17, 86, 130, 17, 86, 130, 17, 84, 130, 17, 81, 132, 33, 81, 130, 17, 82, 132, 33, 84, 134, 50, 74, 138, 84, 62, 134, 50, 62, 130, 17, 62, 132, 33, 60, 132, 33, 62, 132, 33, 62, 130, 17, 62, 130, 17, 62, 132, 33, 64, 132, 33, 60, 132, 33, 62, 130, 17, 60, 132, 33, 62, 132, 33, 86, 130, 17, 86, 130, 17, 86, 130, 17, 86, 130, 17, 84, 130, 17, 86, 132, 33, 84, 130, 17, 84, 130, 17, 84, 138, 84, 86, 130, 17, 84, 130, 17, 84, 130, 17, 84, 132, 33, 81, 132, 33, 81, 130, 17, 82, 130, 17, 81, 132, 33, 79, 132, 33, 81, 132, 33, 81, 132, 33, 77, 130, 17, 77, 138, 84, 82, 132, 33, 84, 134, 50, 81, 130, 17, 81, 130, 17, 65, 131, 25, 64, 131, 25, 65, 134, 50, 64, 132, 33, 60, 132, 33, 62, 138, 84, 62, 130, 17, 65, 130, 17, 64, 140, 100, 62, 130, 17, 64, 132, 33, 65, 136, 67, 64, 136, 67, 65, 136, 67, 64, 136, 67, 62, 138, 84, 62, 130, 17, 65, 130, 17, 64, 142, 117, 64, 130, 17, 62, 130, 17, 64, 130, 17, 64, 132, 33, 64, 132, 33, 62, 130, 17, 64, 130, 17, 65, 130, 17, 64, 134, 50, 62, 134, 50, 60, 134, 50, 60, 132, 33, 81, 130, 17, 0, 130, 17, 81, 130, 17, 79, 130, 17, 77, 138, 84, 77, 134, 50, 76, 132, 33, 74, 145, 6, 0, 135, 104 };
+static const PhraseType song7_phrases[] = { { 0, 84 }, { 63, 12 }, { 84, 51 }, { 117, 15 }, { 135, 6 }, { 87, 48 }, { 141, 42 }, { 159, 12 }, { 183, 24 }, { 186, 18 }, { 207, 6 }, { 159, 24 }, { 213, 36 }, { 219, 21 }, { 225, 15 }, { 225, 24 }, { 249, 69 }, { 87, 42 }, { 318, 3 }, { 144, 39 }, { 321, 6 }, { 84, 12 }, { 192, 15 }, { 327, 18 }, { 216, 33 }, { 345, 63 }, { 390, 15 }, { 408, 15 }, { 423, 3 }, { 216, 30 }, { 87, 15 }, { 426, 15 }, { 426, 12 }, { 441, 12 } };
+static const PhraseRefType song7_playlist_voice0[] = { { 0, 1 }, { 1, 1 }, { 2, 1 }, { 3, 1 }, { 4, 1 }, { 5, 1 }, { 6, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 10, 1 }, { 11, 1 }, { 7, 1 }, { 12, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 13, 1 }, { 16, 1 }, { 17, 1 }, { 18, 1 }, { 19, 1 }, { 7, 1 }, { 8, 1 }, { 9, 1 }, { 20, 1 }, { 11, 1 }, { 7, 1 }, { 21, 1 }, { 22, 1 }, { 23, 1 }, { 24, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 13, 1 }, { 25, 1 }, { 26, 1 }, { 27, 1 }, { 24, 1 }, { 13, 1 }, { 14, 1 }, { 15, 1 }, { 13, 1 }, { 28, 1 }, { 29, 1 }, { 30, 1 }, { 31, 1 }, { 29, 1 }, { 30, 1 }, { 32, 1 }, { 33, 1 } };
+static const SeekPointType song7_seek_voice0[] = { { 0, 0, 0, 0 }, { 3819, 0, 0, 18 }, { 7365, 0, 0, 36 }, { 11729, 0, 0, 57 }, { 15274, 0, 0, 75 }, { 19637, 2, 0, 84 }, { 23728, 2, 0, 117 }, { 27547, 4, 0, 135 }, { 31911, 5, 0, 114 }, { 35729, 6, 0, 150 }, { 39818, 7, 0, 168 }, { 43911, 9, 0, 195 }, { 47865, 11, 0, 180 }, { 51819, 13, 0, 225 }, { 55636, 14, 0, 222 }, { 59998, 15, 0, 237 }, { 63814, 16, 0, 246 }, { 67631, 18, 0, 252 }, { 71996, 18, 0, 282 }, { 75541, 18, 0, 309 }, { 79905, 19, 0, 114 }, { 83724, 21, 0, 150 }, { 87813, 22, 0, 168 }, { 91906, 24, 0, 195 }, { 95996, 27, 0, 159 }, { 99815, 30, 0, 327 }, { 103633, 31, 0, 222 }, { 107995, 32, 0, 222 }, { 111811, 33, 0, 231 }, { 115628, 34, 0, 243 }, { 119990, 36, 0, 348 }, { 123809, 36, 0, 363 }, { 127627, 36, 0, 375 }, { 130628, 36, 0, 387 }, { 135538, 37, 0, 399 }, { 139628, 39, 0, 216 }, { 143990, 39, 0, 243 }, { 147807, 41, 0, 225 }, { 151624, 42, 0, 237 }, { 155986, 43, 0, 237 }, { 159802, 45, 0, 231 }, { 163894, 47, 0, 432 }, { 167985, 48, 0, 228 }, { 171803, 49, 0, 99 }, { 174531, 51, 0, 447 } };
+
+static const VoiceType song7_voices[] = { { song7_playlist_voice0, sizeof( song7_playlist_voice0 ) / sizeof( song7_playlist_voice0[0] ), song7_seek_voice0, sizeof( song7_seek_voice0 ) / sizeof( song7_seek_voice0[0] ) }, { song7_playlist_voice0, sizeof( song7_playlist_voice0 ) / sizeof( song7_playlist_voice0[0] ), song7_seek_voice0, sizeof( song7_seek_voice0 ) / sizeof( song7_seek_voice0[0] ) } };
+
+static const SongInfoType song7 = { "Numb", "Linkin Park", song7_phrase_events, song7_phrases, song7_voices, sizeof( song7_voices ) / sizeof( song7_voices[0] ), 177713 };
 
 /* List of songs */
 static const SongInfoType* song_list[] = { &song1, &song2, &song3, &song4, &song5, &song6, &song7 };
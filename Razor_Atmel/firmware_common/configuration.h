@@ -70,6 +70,7 @@ Includes
 #include "eief1-pcb-01.h"
 #include "lcd_nhd-c0220biz.h"
 #include "sdcard.h"
+#include "fat32.h"
 #endif /* EIE1 */
 
 #ifdef MPGL2
@@ -91,6 +92,7 @@ Includes
 #include "ant_channel.h"
 #include "lcd_control.h"
 #include "music_player.h"
+#include "song_stream.h"
 #include "version.h"
 
 /**********************************************************************************************************************
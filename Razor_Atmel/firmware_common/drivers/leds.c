@@ -5,7 +5,9 @@ Description:
 LED driver that provides on, off, toggle, blink and PWM functionality.
 The basic on/off/toggle functionality is applied directly to the LEDs.
 Blinking and PWMing of LEDs rely on the EIE operating system to provide timing at
-regular 1ms calls to LedUpdate().
+regular 1ms calls to LedUpdate().  Every PWM LED at a LedRateType level shares the same LED_PWM_PERIOD ms
+period, and LedUpdate() works out which LEDs change in one pass, then writes each port's SODR and
+CODR at most once for all of them.
 
 ------------------------------------------------------------------------------------------------------------------------
 API:
@@ -37,10 +39,20 @@ void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)
 Sets up an LED for PWM mode.  PWM mode requires the main loop to be running at 1ms period.
 e.g. LedPWM(BLUE, LED_PWM_5);
 
+void LedPWMLevel(LedNumberType eLED_, u16 u16Level_)
+Same as LedPWM() with a finer duty cycle: 0 (off) to LED_PWM_LEVELS (on), LED_PWM_STEPS_PER_MS times
+finer than LedRateType.  A level between two LedRateType levels is on for single ms spread evenly over time.
+e.g. LedPWMLevel(BLUE, LED_PWM_LEVELS / 100);
+
 void LedBlink(LedNumberType eLED_, LedRateType eBlinkRate_)
 Sets an LED to BLINK mode.  BLINK mode requires the main loop to be running at 1ms period.
 e.g. LedBlink(BLUE, LED_1HZ);
 
+void LedFade(LedNumberType eLED_, LedRateType eStartRate_, u16 u16StepMs_)
+Sets an LED to PWM at eStartRate_, then steps its duty cycle down by one PWM level every u16StepMs_ until it
+is off, like the decay of a struck note.  FADE mode requires the main loop to be running at 1ms period.
+e.g. LedFade(BLUE, LED_PWM_100, 20);
+
 Protected:
 void LedInitialize(void)
 Test all LEDs and initialize to OFF state.
@@ -75,6 +87,9 @@ Global variable definitions with scope limited to this local application.
 Variable names shall start with "Led_" and be declared as static.
 ***********************************************************************************************************************/
 
+static u8 Led_u8PwmPhase = 0;                          /* ms into the PWM period shared by every PWM LED */
+static const LedPortType Led_aePorts[LED_PORTS] = {LED_PORTA, LED_PORTB};
+
 /************ %LED% EDIT BOARD-SPECIFIC GPIO DEFINITIONS BELOW ***************/
 
 #ifdef EIE1
@@ -187,6 +202,7 @@ void LedOn(LedNumberType eLED_)
   
   /* Turn on the LED */
   *pu32SetAddress = Led_au32BitPositions[(u8)eLED_];
+  Leds_asLedArray[(u8)eLED_].eCurrentDuty = LED_PWM_DUTY_HIGH;
   
   /* Always set the LED back to LED_NORMAL_MODE mode */
 	Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
@@ -227,6 +243,7 @@ void LedOff(LedNumberType eLED_)
   
   /* Clear the bit corresponding to eLED_ */
 	*pu32ClearAddress = Led_au32BitPositions[(u8)eLED_];
+  Leds_asLedArray[(u8)eLED_].eCurrentDuty = LED_PWM_DUTY_LOW;
 
   /* Always set the LED back to LED_NORMAL_MODE mode */
 	Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
@@ -253,6 +270,8 @@ void LedToggle(LedNumberType eLED_)
   u32 *pu32Address = (u32*)(&(AT91C_BASE_PIOA->PIO_ODSR) + Leds_asLedArray[eLED_].ePort);
 
   *pu32Address ^= Led_au32BitPositions[ (u8)eLED_ ];
+  Leds_asLedArray[(u8)eLED_].eCurrentDuty = (Leds_asLedArray[(u8)eLED_].eCurrentDuty == LED_PWM_DUTY_HIGH) ?
+                                            LED_PWM_DUTY_LOW : LED_PWM_DUTY_HIGH;
   
 } /* end LedToggle() */
 
@@ -273,14 +292,43 @@ Promises:
 */
 void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)
 {
-	Leds_asLedArray[(u8)eLED_].eMode = LED_PWM_MODE;
-	Leds_asLedArray[(u8)eLED_].eRate = ePwmRate_;
-	Leds_asLedArray[(u8)eLED_].u16Count = (u16)ePwmRate_;
-  Leds_asLedArray[(u8)eLED_].eCurrentDuty = LED_PWM_DUTY_HIGH;
+  LedPWMLevel(eLED_, (u16)ePwmRate_ * LED_PWM_STEPS_PER_MS);
 
 } /* end LedPWM() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedPWMLevel
+
+Description:
+Sets an LED to PWM mode with a duty cycle finer than LedRateType
+
+Requires:
+  - eLED_ is a valid LED index
+  - u16Level_ is 0 (off) to LED_PWM_LEVELS (on)
+
+Promises:
+  - Requested LED is set to PWM mode at u16Level_ / LED_PWM_LEVELS, starting with the whole ms of it
+    in what is left of the current PWM period, or with one ms on straight away for a level finer than
+    LedRateType
+  - eRate is the nearest LedRateType at or below the level
+*/
+void LedPWMLevel(LedNumberType eLED_, u16 u16Level_)
+{
+  if(u16Level_ > LED_PWM_LEVELS)
+  {
+    u16Level_ = LED_PWM_LEVELS;
+  }
+
+	Leds_asLedArray[(u8)eLED_].eMode = LED_PWM_MODE;
+	Leds_asLedArray[(u8)eLED_].eRate = (LedRateType)(u16Level_ / LED_PWM_STEPS_PER_MS);
+  Leds_asLedArray[(u8)eLED_].u16Level = u16Level_;
+  Leds_asLedArray[(u8)eLED_].u16LevelError = LED_PWM_LEVELS - u16Level_;
+  Leds_asLedArray[(u8)eLED_].u8OnMs = (u8)(u16Level_ / LED_PWM_STEPS_PER_MS);
+
+} /* end LedPWMLevel() */
+
+
 /*----------------------------------------------------------------------------------------------------------------------
 Function: LedBlink
 
@@ -304,6 +352,35 @@ void LedBlink(LedNumberType eLED_, LedRateType eBlinkRate_)
 } /* end LedBlink() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedFade
+
+Description:
+Sets an LED to FADE mode: PWM that starts at eStartRate_ and drops one level every u16StepMs_.
+
+Requires:
+  - eLED_ is a valid LED index
+  - eStartRate_ is an allowed duty cycle:
+    LED_PWM_0, LED_PWM_5, LED_PWM_10, ..., LED_PWM_95, LED_PWM_100
+  - u16StepMs_ is at least 1
+
+Promises:
+  - Requested LED is set to FADE mode at the duty cycle specified, restarting any fade already running
+  - LedUpdate() lowers the duty cycle every u16StepMs_ and leaves the LED in PWM mode at LED_PWM_0
+*/
+void LedFade(LedNumberType eLED_, LedRateType eStartRate_, u16 u16StepMs_)
+{
+  LedPWM(eLED_, eStartRate_);
+  if(eStartRate_ != LED_PWM_0)
+  {
+    Leds_asLedArray[(u8)eLED_].eMode = LED_FADE_MODE;
+  }
+  Leds_asLedArray[(u8)eLED_].u16FadeStepMs = u16StepMs_;
+  Leds_asLedArray[(u8)eLED_].u16FadeCount = u16StepMs_;
+
+} /* end LedFade() */
+
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Protected functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -351,6 +428,13 @@ void LedInitialize(void)
 
 #endif /* MPGL2 */
   
+  /* LedUpdate() only writes the LEDs that change, so start from every LED off */
+  for(u8 j = 0; j < TOTAL_LEDS; j++)
+  {
+    LedOff((LedNumberType)j);
+    LedPWM((LedNumberType)j, LED_PWM_100);
+  }
+
   /* Turn all LEDs on full, then fade them out over a few seconds */
   for(u8Index = 20; u8Index > 0; u8Index--)
   {
@@ -380,7 +464,7 @@ void LedInitialize(void)
     /* Set the LED intensity for the next iteration */
     for(u8 j = 0; j < TOTAL_LEDS; j++)
     {
-      Leds_asLedArray[j].eRate = (LedRateType)(u8Index - 1);
+      LedPWM((LedNumberType)j, (LedRateType)(u8Index - 1));
     }
     
     /* Set the buzzer frequency for the next iteration */
@@ -439,72 +523,125 @@ void LedInitialize(void)
 Function: LedUpdate
 
 Description:
-Update all LEDs for the current cycle.
+Update all LEDs for the current cycle.  Works out which LEDs turn on or off this ms, then writes
+them all at once with one SODR and one CODR write per port, skipping writes with nothing to change.
 
 Requires:
  - G_u32SystemTime1ms is counting
+ - eCurrentDuty of every LED is what it shows (kept by LedOn(), LedOff() and LedToggle())
 
 Promises:
    - All LEDs updated based on their counters
+   - Fading LEDs are one ms further into their current fade step
+   - At the start of each PWM period, every PWM LED at a LedRateType level is on for its level's ms
+   - A PWM LED at a finer level is on for each ms in which the duty it is owed adds up to a whole ms,
+     so its on-ms are never more than LED_PWM_LEVELS / u16Level ms apart
 */
 void LedUpdate(void)
 {
+  u32 au32Set[LED_PORTS] = {0, 0};
+  u32 au32Clear[LED_PORTS] = {0, 0};
+  LedConfigType* psLed;
+  LedPWMDutyType eDuty;
+  u8 u8Port;
+
+  /* Every PWM LED's period starts together so they share the writes that turn them on */
+  if(++Led_u8PwmPhase >= LED_PWM_PERIOD)
+  {
+    Led_u8PwmPhase = 0;
+  }
+
 	/* Loop through each LED */
   for(u8 i = 0; i < TOTAL_LEDS; i++)
   {
-    /* Check if LED is PWMing */
-    if(Leds_asLedArray[(LedNumberType)i].eMode == LED_PWM_MODE)
+    psLed = &Leds_asLedArray[i];
+
+    /* Fading LEDs step down a PWM level when their step time is up, and are plain PWM once they are off */
+    if(psLed->eMode == LED_FADE_MODE)
     {
-      /* Handle special case of 0% duty cycle */
-      if( Leds_asLedArray[i].eRate == LED_PWM_0 )
+      if(--psLed->u16FadeCount == 0)
       {
-        LedOff( (LedNumberType)i );
+        psLed->u16FadeCount = psLed->u16FadeStepMs;
+        psLed->eRate = (LedRateType)(psLed->eRate - 1);
+        psLed->u16Level = (u16)psLed->eRate * LED_PWM_STEPS_PER_MS;
+        if(psLed->eRate == LED_PWM_0)
+        {
+          psLed->eMode = LED_PWM_MODE;
+        }
       }
-      
-      /* Handle special case of 100% duty cycle */
-      else if( Leds_asLedArray[i].eRate == LED_PWM_100 )
+    }
+
+    /* Finer levels are on whenever the duty owed reaches a ms.  Carrying the fraction over whole periods
+    instead would bunch the extra ms into a cycle up to LED_PWM_LEVELS ms long, which flickers. */
+    if( (psLed->eMode == LED_PWM_MODE) && ((psLed->u16Level % LED_PWM_STEPS_PER_MS) != 0) )
+    {
+      psLed->u16LevelError += psLed->u16Level;
+      eDuty = LED_PWM_DUTY_LOW;
+      if(psLed->u16LevelError >= LED_PWM_LEVELS)
       {
-        LedOn( (LedNumberType)i );
+        psLed->u16LevelError -= LED_PWM_LEVELS;
+        eDuty = LED_PWM_DUTY_HIGH;
       }
-  
-      /* Otherwise, regular PWM: decrement counter; toggle and reload if counter reaches 0 */
-      else
+    }
+
+    /* Other PWM LEDs are on for the first u8OnMs of the period */
+    else if( (psLed->eMode == LED_PWM_MODE) || (psLed->eMode == LED_FADE_MODE) )
+    {
+      if(Led_u8PwmPhase == 0)
       {
-        if(--Leds_asLedArray[(LedNumberType)i].u16Count == 0)
-        {
-          if(Leds_asLedArray[(LedNumberType)i].eCurrentDuty == LED_PWM_DUTY_HIGH)
-          {
-            /* Turn the LED off and update the counters for the next cycle */
-            LedOff( (LedNumberType)i );
-            Leds_asLedArray[(LedNumberType)i].u16Count = LED_PWM_PERIOD - Leds_asLedArray[(LedNumberType)i].eRate;
-            Leds_asLedArray[(LedNumberType)i].eCurrentDuty = LED_PWM_DUTY_LOW;
-          }
-          else
-          {
-            /* Turn the LED on and update the counters for the next cycle */
-            LedOn( (LedNumberType)i );
-            Leds_asLedArray[i].u16Count = Leds_asLedArray[i].eRate;
-            Leds_asLedArray[i].eCurrentDuty = LED_PWM_DUTY_HIGH;
-          }
-        }
+        psLed->u8OnMs = (u8)(psLed->u16Level / LED_PWM_STEPS_PER_MS);
       }
 
-      /* Set the LED back to PWM mode since LedOff and LedOn set it to normal mode */
-     	Leds_asLedArray[(LedNumberType)i].eMode = LED_PWM_MODE;
-      
-    } /* end if PWM mode */
+      eDuty = (Led_u8PwmPhase < psLed->u8OnMs) ? LED_PWM_DUTY_HIGH : LED_PWM_DUTY_LOW;
+    }
     
-    /* LED is in LED_BLINK_MODE mode */
-    else if(Leds_asLedArray[(LedNumberType)i].eMode == LED_BLINK_MODE)
+    /* LED is in LED_BLINK_MODE mode: toggle and reload when the counter reaches 0 */
+    else if(psLed->eMode == LED_BLINK_MODE)
     {
-      /* Decrement counter; toggle and reload if counter reaches 0 */
-      if( --Leds_asLedArray[(LedNumberType)i].u16Count == 0)
+      eDuty = psLed->eCurrentDuty;
+      if(--psLed->u16Count == 0)
       {
-        LedToggle( (LedNumberType)i );
-        Leds_asLedArray[(LedNumberType)i].u16Count = Leds_asLedArray[(LedNumberType)i].eRate;
+        psLed->u16Count = psLed->eRate;
+        eDuty = (eDuty == LED_PWM_DUTY_HIGH) ? LED_PWM_DUTY_LOW : LED_PWM_DUTY_HIGH;
+      }
+    }
+
+    /* LEDs in LED_NORMAL_MODE are written straight away by LedOn(), LedOff() and LedToggle() */
+    else
+    {
+      continue;
+    }
+
+    /* Add the LED to its port's set or clear mask if it changes */
+    if(eDuty != psLed->eCurrentDuty)
+    {
+      psLed->eCurrentDuty = eDuty;
+      u8Port = (psLed->ePort == LED_PORTA) ? 0 : 1;
+      if( (eDuty == LED_PWM_DUTY_HIGH) == (psLed->eActiveState == LED_ACTIVE_HIGH) )
+      {
+        au32Set[u8Port] |= Led_au32BitPositions[i];
+      }
+      else
+      {
+        au32Clear[u8Port] |= Led_au32BitPositions[i];
       }
     }
   } /* end for */
+
+  /* One write per port and register for all the LEDs that changed */
+  for(u8 i = 0; i < LED_PORTS; i++)
+  {
+    if(au32Set[i] != 0)
+    {
+      *(u32*)(&(AT91C_BASE_PIOA->PIO_SODR) + Led_aePorts[i]) = au32Set[i];
+    }
+
+    if(au32Clear[i] != 0)
+    {
+      *(u32*)(&(AT91C_BASE_PIOA->PIO_CODR) + Led_aePorts[i]) = au32Clear[i];
+    }
+  }
+  
 } /* end LedUpdate() */
 
 
@@ -35,12 +35,15 @@ typedef enum {RED0 = 0, RED1, RED2, RED3, GREEN0, GREEN1, GREEN2, GREEN3, BLUE0,
 
 #endif /* MPGL2 */
 
-typedef enum {LED_NORMAL_MODE, LED_PWM_MODE, LED_BLINK_MODE} LedModeType;
+typedef enum {LED_NORMAL_MODE, LED_PWM_MODE, LED_BLINK_MODE, LED_FADE_MODE} LedModeType;
 typedef enum {LED_PORTA = 0, LED_PORTB = 0x80} LedPortType;  /* Offset between port registers (in 32 bit words) */
 typedef enum {LED_ACTIVE_LOW = 0, LED_ACTIVE_HIGH = 1} LedActiveType;
 typedef enum {LED_PWM_DUTY_LOW = 0, LED_PWM_DUTY_HIGH = 1} LedPWMDutyType;
 
 #define LED_PWM_PERIOD    (u8)20
+#define LED_PWM_STEPS_PER_MS (u16)16     /* LedPWMLevel() steps in each ms of the period */
+#define LED_PWM_LEVELS    (u16)(LED_PWM_PERIOD * LED_PWM_STEPS_PER_MS)
+#define LED_PORTS         (u8)2          /* LED_PORTA and LED_PORTB */
 
 /* Standard blinky values.  If other values are needed, add them at the end of the enum */
 typedef enum {LED_0_5HZ = 1000, LED_1HZ = 500, LED_2HZ = 250, LED_4HZ = 125, LED_8HZ = 63,
@@ -59,6 +62,11 @@ typedef struct
   LedPWMDutyType eCurrentDuty;
   LedActiveType eActiveState;
   LedPortType ePort;
+  u16 u16FadeStepMs;                /* FADE mode only: time at each PWM level */
+  u16 u16FadeCount;                 /* FADE mode only: ms left at the current level */
+  u16 u16Level;                     /* PWM and FADE modes: duty cycle in 1/LED_PWM_LEVELS */
+  u16 u16LevelError;                /* PWM mode, levels finer than LedRateType: duty owed, in 1/LED_PWM_LEVELS ms */
+  u8 u8OnMs;                        /* PWM and FADE modes: ms the LED is on in the current PWM period */
 }LedConfigType;
 
 
@@ -76,7 +84,9 @@ void LedOn(LedNumberType eLED_);
 void LedOff(LedNumberType eLED_);
 void LedToggle(LedNumberType eLED_);
 void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_);
+void LedPWMLevel(LedNumberType eLED_, u16 u16Level_);
 void LedBlink(LedNumberType eLED_, LedRateType ePwmRate_);
+void LedFade(LedNumberType eLED_, LedRateType eStartRate_, u16 u16StepMs_);
 
 /* Protected Functions */
 void LedInitialize(void);
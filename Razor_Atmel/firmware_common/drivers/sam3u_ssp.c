@@ -486,8 +486,9 @@ bool SspReadData(SspPeripheralType* psSspPeripheral_, u16 u16Size_)
 {
   u8 au8MsgTooBig[] = "\r\nSSP message to large\n\r";
   
-  /* Do not allow if requested size is too large */
-  if(u16Size_ > MAX_TX_MESSAGE_LENGTH)
+  /* Do not allow if requested size is too large.  The dummy bytes are clocked out of the receive buffer
+  itself, so the limit is the client's buffer and not the messaging payload size. */
+  if(u16Size_ > psSspPeripheral_->u16RxBufferSize)
   {
     DebugPrintf(au8MsgTooBig);
     return FALSE;
@@ -0,0 +1,139 @@
+/***********************************************************************************************************************
+File: configuration.h (SD card and LED benchmarks)
+
+Description:
+Stands in for firmware_common/configuration.h when sdcard.c is built for the host by sd_bench.c and leds.c
+by led_bench.c.  The benchmarks' include paths put this directory first, so the drivers compile unchanged
+against the SSP, messaging, PIO and board definitions declared here instead of the SAM3U headers.  Only what
+the drivers use is provided; sd_bench.c implements the functions with a model of the SSP peripheral and an
+SD card, and led_bench.c models the LED port registers.
+***********************************************************************************************************************/
+
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************************************************
+Type definitions (same names as typedefs.h, but fixed to the target's sizes so u32 stays 32 bits on a 64-bit host)
+***********************************************************************************************************************/
+typedef int32_t  s32;
+typedef int16_t  s16;
+typedef int8_t   s8;
+
+typedef uint32_t u32;
+typedef uint16_t u16;
+typedef uint8_t  u8;
+
+typedef void(*fnCode_type)(void);
+
+typedef enum {FALSE = 0, TRUE = !FALSE} bool;
+
+#define BIT6    ((u8)0x40)
+#define BIT7    ((u8)0x80)
+
+
+/***********************************************************************************************************************
+Board definitions (EIE1)
+***********************************************************************************************************************/
+typedef enum {USART0, USART1, USART2, SPI} PeripheralType;
+typedef void* AT91PS_PIO;
+
+#define SD_SSP                      USART1
+#define SD_BASE_PORT                NULL
+#define SD_CS_PIN                   (u32)0x00000100
+#define SD_CARD_INSERTED()          BenchIsCardInserted()
+
+#define _APPLICATION_FLAGS_SDCARD   0x00000080
+
+#define EIE1
+#define TOTAL_LEDS                  (u8)11
+
+#define PB_20_LED_RED               (u32)0x00100000
+#define PB_19_LED_GRN               (u32)0x00080000
+#define PB_18_LED_BLU               (u32)0x00040000
+#define PB_17_LED_YLW               (u32)0x00020000
+#define PB_16_LED_CYN               (u32)0x00010000
+#define PB_15_LED_ORG               (u32)0x00008000
+#define PB_14_LED_PRP               (u32)0x00004000
+#define PB_13_LED_WHT               (u32)0x00002000
+#define PB_12_LCD_BL_BLU            (u32)0x00001000
+#define PB_11_LCD_BL_GRN            (u32)0x00000800
+#define PB_10_LCD_BL_RED            (u32)0x00000400
+
+#define _APPLICATION_FLAGS_LED      0x00000001
+
+
+/***********************************************************************************************************************
+PIO definitions (same register offsets as AT91SAM3U4.h, port B 0x200 bytes after port A)
+***********************************************************************************************************************/
+typedef struct
+{
+  volatile u32 au32Reserved1[12];
+  volatile u32 PIO_SODR;              /* Set Output Data Register */
+  volatile u32 PIO_CODR;              /* Clear Output Data Register */
+  volatile u32 PIO_ODSR;              /* Output Data Status Register */
+  volatile u32 au32Reserved2[0x80 - 15];
+} BenchPioType;
+
+/* Every register access in leds.c names the base address once, so led_bench.c counts the accesses there */
+#define AT91C_BASE_PIOA             BenchPioAccess()
+
+
+/***********************************************************************************************************************
+SSP and messaging definitions (same as sam3u_ssp.h and messaging.h)
+***********************************************************************************************************************/
+typedef enum {MSB_FIRST, LSB_FIRST} SspeBitOrderType;
+typedef enum {SPI_MASTER_AUTO_CS, SPI_MASTER_MANUAL_CS, SPI_SLAVE, SPI_SLAVE_FLOW_CONTROL} SspModeType;
+typedef enum {SSP_RX_EMPTY = 0, SSP_RX_WAITING, SSP_RX_RECEIVING, SSP_RX_COMPLETE, SSP_RX_TIMEOUT} SspRxStatusType;
+typedef enum {EMPTY = 0, WAITING, SENDING, RECEIVING, COMPLETE, TIMEOUT, ABANDONED, NOT_FOUND = 0xff} MessageStateType;
+
+typedef struct 
+{
+  PeripheralType SspPeripheral;       /* Easy name of peripheral */
+  AT91PS_PIO pCsGpioAddress;          /* Base address for GPIO port for chip select line */
+  u32 u32CsPin;                       /* Pin location for SSEL line */
+  SspeBitOrderType eBitOrder;         /* MSB_FIRST or LSB_FIRST */
+  SspModeType eSspMode;               /* Type of SPI configured */
+  u8* pu8RxBufferAddress;             /* Address to receive buffer */
+  u8** ppu8RxNextByte;                /* Location of pointer to next byte to write in buffer */
+  u16 u16RxBufferSize;                /* Size of receive buffer in bytes */
+} SspConfigurationType;
+
+/* The emulated peripheral, only used through a pointer by sdcard.c */
+typedef struct BenchSspType SspPeripheralType;
+
+#define SSP_DUMMY_BYTE              (u8)0x00
+#define TX_QUEUE_SIZE               (u8)16
+#define MAX_TX_MESSAGE_LENGTH       (u16)128
+
+
+/***********************************************************************************************************************
+Stubbed driver functions (sd_bench.c)
+***********************************************************************************************************************/
+SspPeripheralType* SspRequest(SspConfigurationType* psSspConfig_);
+void SspRelease(SspPeripheralType* psSspPeripheral_);
+void SspAssertCS(SspPeripheralType* psSspPeripheral_);
+void SspDeAssertCS(SspPeripheralType* psSspPeripheral_);
+u32 SspWriteData(SspPeripheralType* psSspPeripheral_, u32 u32Size_, u8* u8Data_);
+bool SspReadData(SspPeripheralType* psSspPeripheral_, u16 u16Size_);
+bool SspReadByte(SspPeripheralType* psSspPeripheral_);
+SspRxStatusType SspQueryReceiveStatus(SspPeripheralType* psSspPeripheral_);
+
+MessageStateType QueryMessageStatus(u32 u32Token_);
+u32 DebugPrintf(u8* u8String_);
+bool IsTimeUp(u32 *pu32SavedTick_, u32 u32Period_);
+
+bool BenchIsCardInserted(void);
+BenchPioType* BenchPioAccess(void);
+
+
+/***********************************************************************************************************************
+Driver header files
+***********************************************************************************************************************/
+#include "sdcard.h"
+#include "leds.h"
+
+#endif /* __CONFIG_H */
@@ -0,0 +1,460 @@
+/***********************************************************************************************************************
+File: led_bench.c
+
+Description:
+Host benchmark for the LED driver.  Runs the unmodified leds.c against a model of the PIO port registers and
+counts how many register writes LedUpdate() makes per 1ms frame while the LEDs show what the board shows:
+  - Idle after LedInitialize(), with every discrete LED left at LED_PWM_0.
+  - The pitch display: one LED at LED_PWM_5.
+  - Eight LEDs at different duty cycles, including LED_PWM_100.
+  - The spectrum display: two LEDs fading from LED_PWM_100, restarted at every note.
+  - Three LEDs blinking at different rates.
+  - Four LEDs at duty cycles finer than LedRateType, set with LedPWMLevel().
+
+While it runs it checks what the pins do:
+  - Every PWM LED is on for exactly its level over LED_PWM_STEPS_PER_MS periods.
+  - Every PWM LED is on at least every LED_PWM_PERIOD ms, or for a level finer than LedRateType, at least
+    every LED_PWM_LEVELS / level ms, so the fraction of a ms is not bunched into a flicker.
+  - Blinking LEDs change every eRate ms.
+  - A fading LED is on when the fade starts and stays off once its last step is over.
+
+The model follows the board: the main loop makes one pass per ms and LedUpdate() runs once in it.  A write to
+PIO_SODR or PIO_CODR changes the pins in PIO_ODSR, and a write to PIO_ODSR sets them directly.
+
+Usage: led_bench [-m <ms per scenario>]
+  -m  How long each scenario runs (default: LED_BENCH_DEFAULT_MS)
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+#include <stdio.h>
+
+/***********************************************************************************************************************
+Type Definitions
+***********************************************************************************************************************/
+/* Sets up the LEDs for a scenario; called every ms before LedUpdate() with the ms into the scenario */
+typedef void (*BenchScenarioFunctionType)(u32 u32Ms_);
+
+typedef struct
+{
+  const char* pcName;
+  BenchScenarioFunctionType pfSetup;
+} BenchScenarioType;
+
+
+/***********************************************************************************************************************
+Constants / Definitions
+***********************************************************************************************************************/
+#define LED_BENCH_DEFAULT_MS        (u32)4000     /* Long enough for a few blinks at LED_0_5HZ */
+#define LED_BENCH_SETTLE_MS         (u32)LED_PWM_PERIOD  /* Time before a new duty cycle is measured */
+#define LED_BENCH_DUTY_MS           (u32)(LED_PWM_PERIOD * LED_PWM_STEPS_PER_MS) /* Duty cycles repeat this often */
+#define LED_BENCH_NOTE_MS           (u32)250      /* Time between notes in the spectrum scenario */
+#define LED_BENCH_FADE_STEP_MS      (u16)20       /* Same as LED_SPECTRUM_FADE_STEP_MS in music_player.c */
+#define LED_BENCH_PORT_B            (u8)1
+#define LED_BENCH_DISCRETE_LEDS     (u8)(RED + 1) /* The LEDs before the LCD backlight */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+volatile u32 G_u32SystemFlags = 0;
+volatile u32 G_u32ApplicationFlags = 0;
+
+volatile u32 G_u32SystemTime1ms = 0;
+volatile u32 G_u32SystemTime1s = 0;
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "Bench_" and be declared as static.
+***********************************************************************************************************************/
+static BenchPioType Bench_asPio[2];                    /* Ports A and B, laid out as on the SAM3U */
+static u32 Bench_u32Writes = 0;                        /* Register writes counted by BenchPioAccess() */
+static bool Bench_bPassed = TRUE;
+
+/* What each LED is expected to do in the scenario running, checked by BenchCheckLeds() */
+static u16 Bench_au16Level[TOTAL_LEDS];                /* Duty cycle in 1/LED_PWM_LEVELS */
+static bool Bench_abCheckDuty[TOTAL_LEDS];
+static u32 Bench_au32DutyStartMs[TOTAL_LEDS];          /* Measuring starts here */
+static u32 Bench_au32OnMs[TOTAL_LEDS];                 /* ms on since then */
+static u32 Bench_au32MaxGapMs[TOTAL_LEDS];             /* Longest time allowed between on-ms, 0 when not checked */
+static u32 Bench_au32LastOnMs[TOTAL_LEDS];
+static u32 Bench_au32BlinkMs[TOTAL_LEDS];              /* Blink half period, 0 when not blinking */
+static u32 Bench_au32LastChangeMs[TOTAL_LEDS];
+static u32 Bench_au32FadeStartMs[TOTAL_LEDS];          /* Start of the fade running, 0 when not fading */
+static bool Bench_abWasOn[TOTAL_LEDS];
+
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Stubbed driver functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Applies any write to PIO_SODR or PIO_CODR to the pins, then counts the access about to happen */
+BenchPioType* BenchPioAccess(void)
+{
+  for(u8 i = 0; i < 2; i++)
+  {
+    Bench_asPio[i].PIO_ODSR |= Bench_asPio[i].PIO_SODR;
+    Bench_asPio[i].PIO_ODSR &= ~Bench_asPio[i].PIO_CODR;
+    Bench_asPio[i].PIO_SODR = 0;
+    Bench_asPio[i].PIO_CODR = 0;
+  }
+
+  Bench_u32Writes++;
+  return &Bench_asPio[0];
+
+} /* end BenchPioAccess() */
+
+
+u32 DebugPrintf(u8* u8String_)
+{
+  return 1;
+
+} /* end DebugPrintf() */
+
+
+/* LedInitialize() waits for the time to pass, so the clock moves on each time it asks */
+bool IsTimeUp(u32 *pu32SavedTick_, u32 u32Period_)
+{
+  if( (G_u32SystemTime1ms - *pu32SavedTick_) < u32Period_ )
+  {
+    G_u32SystemTime1ms++;
+  }
+
+  return ( (G_u32SystemTime1ms - *pu32SavedTick_) >= u32Period_ ) ? TRUE : FALSE;
+
+} /* end IsTimeUp() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Scenarios */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Sets an LED to PWM and measures its duty cycle from the next period on */
+static void BenchPwm(LedNumberType eLed_, u16 u16Level_, u32 u32Ms_)
+{
+  LedPWMLevel(eLed_, u16Level_);
+  Bench_au16Level[eLed_] = u16Level_;
+  Bench_abCheckDuty[eLed_] = TRUE;
+  Bench_au32DutyStartMs[eLed_] = u32Ms_ + LED_BENCH_SETTLE_MS;
+  Bench_au32OnMs[eLed_] = 0;
+  Bench_au32LastOnMs[eLed_] = Bench_au32DutyStartMs[eLed_];
+
+  /* One ms on in every LED_PWM_LEVELS / u16Level_ is as evenly as 1ms steps can spread a finer level */
+  Bench_au32MaxGapMs[eLed_] = LED_PWM_PERIOD;
+  if(u16Level_ == 0)
+  {
+    Bench_au32MaxGapMs[eLed_] = 0;
+  }
+  else if( (u16Level_ % LED_PWM_STEPS_PER_MS) != 0 )
+  {
+    Bench_au32MaxGapMs[eLed_] = (LED_PWM_LEVELS + u16Level_ - 1) / u16Level_;
+  }
+
+} /* end BenchPwm() */
+
+
+static void BenchBlink(LedNumberType eLed_, LedRateType eRate_, u32 u32Ms_)
+{
+  LedBlink(eLed_, eRate_);
+  Bench_au32BlinkMs[eLed_] = eRate_;
+  Bench_au32LastChangeMs[eLed_] = u32Ms_ - 1;    /* The LedUpdate() of ms u32Ms_ counts as the first ms */
+
+} /* end BenchBlink() */
+
+
+static void ScenarioIdle(u32 u32Ms_)
+{
+  if(u32Ms_ == 0)
+  {
+    for(u8 i = 0; i < LED_BENCH_DISCRETE_LEDS; i++)
+    {
+      Bench_au16Level[i] = 0;
+      Bench_abCheckDuty[i] = TRUE;
+      Bench_au32DutyStartMs[i] = 0;
+    }
+  }
+
+} /* end ScenarioIdle() */
+
+
+static void ScenarioPitch(u32 u32Ms_)
+{
+  if(u32Ms_ == 0)
+  {
+    BenchPwm(BLUE, LED_PWM_5 * LED_PWM_STEPS_PER_MS, u32Ms_);
+  }
+
+} /* end ScenarioPitch() */
+
+
+static void ScenarioMixed(u32 u32Ms_)
+{
+  static const LedRateType aeRates[LED_BENCH_DISCRETE_LEDS] =
+    {LED_PWM_5, LED_PWM_15, LED_PWM_30, LED_PWM_50, LED_PWM_65, LED_PWM_80, LED_PWM_95, LED_PWM_100};
+
+  if(u32Ms_ == 0)
+  {
+    for(u8 i = 0; i < LED_BENCH_DISCRETE_LEDS; i++)
+    {
+      BenchPwm((LedNumberType)i, aeRates[i] * LED_PWM_STEPS_PER_MS, u32Ms_);
+    }
+  }
+
+} /* end ScenarioMixed() */
+
+
+/* Like the spectrum display: each note restarts the fade on the LED of its half octave */
+static void ScenarioSpectrum(u32 u32Ms_)
+{
+  static const LedNumberType aeNotes[] = {GREEN, BLUE, GREEN, YELLOW};
+  LedNumberType eLed;
+
+  if( (u32Ms_ % LED_BENCH_NOTE_MS) == 0 )
+  {
+    eLed = aeNotes[(u32Ms_ / LED_BENCH_NOTE_MS) % (sizeof(aeNotes) / sizeof(aeNotes[0]))];
+    LedFade(eLed, LED_PWM_100, LED_BENCH_FADE_STEP_MS);
+    Bench_au32FadeStartMs[eLed] = u32Ms_ + 1;
+  }
+
+} /* end ScenarioSpectrum() */
+
+
+static void ScenarioBlink(u32 u32Ms_)
+{
+  if(u32Ms_ == 0)
+  {
+    BenchBlink(WHITE, LED_1HZ, u32Ms_);
+    BenchBlink(PURPLE, LED_2HZ, u32Ms_);
+    BenchBlink(BLUE, LED_8HZ, u32Ms_);
+  }
+
+} /* end ScenarioBlink() */
+
+
+static void ScenarioFine(u32 u32Ms_)
+{
+  if(u32Ms_ == 0)
+  {
+    BenchPwm(WHITE, 1, u32Ms_);
+    BenchPwm(PURPLE, LED_PWM_LEVELS / 100, u32Ms_);
+    BenchPwm(BLUE, (LED_PWM_5 * LED_PWM_STEPS_PER_MS) + 5, u32Ms_);
+    BenchPwm(CYAN, LED_PWM_LEVELS - 1, u32Ms_);
+  }
+
+} /* end ScenarioFine() */
+
+
+static const BenchScenarioType Bench_asScenarios[] =
+{
+  {"Idle after LedInitialize()", ScenarioIdle},
+  {"Pitch display, 1 LED at 5%", ScenarioPitch},
+  {"8 LEDs at 5% to 100%", ScenarioMixed},
+  {"Spectrum display, fades", ScenarioSpectrum},
+  {"3 LEDs blinking", ScenarioBlink},
+  {"4 LEDs at fine levels", ScenarioFine},
+};
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Checks */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool BenchIsLedOn(u8 u8Led_)
+{
+  static const u32 au32Bits[TOTAL_LEDS] = {PB_13_LED_WHT, PB_14_LED_PRP, PB_18_LED_BLU, PB_16_LED_CYN,
+                                           PB_19_LED_GRN, PB_17_LED_YLW, PB_15_LED_ORG, PB_20_LED_RED,
+                                           PB_10_LCD_BL_RED, PB_11_LCD_BL_GRN, PB_12_LCD_BL_BLU};
+
+  return (Bench_asPio[LED_BENCH_PORT_B].PIO_ODSR & au32Bits[u8Led_]) ? TRUE : FALSE;
+
+} /* end BenchIsLedOn() */
+
+
+static void BenchFail(const char* pcScenario_, u8 u8Led_, u32 u32Ms_, const char* pcWhat_)
+{
+  printf("  FAILED: %s, LED %u at %lu ms: %s\n", pcScenario_, u8Led_, (unsigned long)u32Ms_, pcWhat_);
+  Bench_bPassed = FALSE;
+
+} /* end BenchFail() */
+
+
+/* Checks the pins after the LedUpdate() of ms u32Ms_ */
+static void BenchCheckLeds(const char* pcScenario_, u32 u32Ms_)
+{
+  bool bOn;
+  char acWhat[80];
+
+  for(u8 i = 0; i < TOTAL_LEDS; i++)
+  {
+    bOn = BenchIsLedOn(i);
+
+    /* Every LED_BENCH_DUTY_MS the LED has been on for exactly its level */
+    if(Bench_abCheckDuty[i] && (u32Ms_ >= Bench_au32DutyStartMs[i]))
+    {
+      Bench_au32OnMs[i] += bOn ? 1 : 0;
+      if( ((u32Ms_ + 1 - Bench_au32DutyStartMs[i]) % LED_BENCH_DUTY_MS) == 0 )
+      {
+        if(Bench_au32OnMs[i] != Bench_au16Level[i])
+        {
+          snprintf(acWhat, sizeof(acWhat), "on for %lu of %lu ms, expected %u",
+                   (unsigned long)Bench_au32OnMs[i], (unsigned long)LED_BENCH_DUTY_MS, Bench_au16Level[i]);
+          BenchFail(pcScenario_, i, u32Ms_, acWhat);
+          Bench_abCheckDuty[i] = FALSE;
+        }
+        Bench_au32OnMs[i] = 0;
+      }
+
+      /* An LED off for longer than its longest gap flickers */
+      if(bOn)
+      {
+        Bench_au32LastOnMs[i] = u32Ms_;
+      }
+      else if( (Bench_au32MaxGapMs[i] != 0) && ((u32Ms_ - Bench_au32LastOnMs[i]) >= Bench_au32MaxGapMs[i]) )
+      {
+        snprintf(acWhat, sizeof(acWhat), "off for more than %lu ms", (unsigned long)Bench_au32MaxGapMs[i]);
+        BenchFail(pcScenario_, i, u32Ms_, acWhat);
+        Bench_au32MaxGapMs[i] = 0;
+      }
+    }
+
+    /* Blinking LEDs change exactly every eRate ms */
+    if( (Bench_au32BlinkMs[i] != 0) && (bOn != Bench_abWasOn[i]) )
+    {
+      if( (u32Ms_ - Bench_au32LastChangeMs[i]) != Bench_au32BlinkMs[i] )
+      {
+        snprintf(acWhat, sizeof(acWhat), "blinked after %lu ms, expected %lu",
+                 (unsigned long)(u32Ms_ - Bench_au32LastChangeMs[i]), (unsigned long)Bench_au32BlinkMs[i]);
+        BenchFail(pcScenario_, i, u32Ms_, acWhat);
+        Bench_au32BlinkMs[i] = 0;
+      }
+      Bench_au32LastChangeMs[i] = u32Ms_;
+    }
+
+    /* Fades start on and are off for good once every step has passed */
+    if(Bench_au32FadeStartMs[i] != 0)
+    {
+      if( (u32Ms_ + 1 == Bench_au32FadeStartMs[i]) && !bOn )
+      {
+        BenchFail(pcScenario_, i, u32Ms_, "off when its fade started");
+      }
+      if( (u32Ms_ + 1 >= Bench_au32FadeStartMs[i] + (LED_PWM_100 * LED_BENCH_FADE_STEP_MS)) && bOn )
+      {
+        BenchFail(pcScenario_, i, u32Ms_, "still on after its fade");
+        Bench_au32FadeStartMs[i] = 0;
+      }
+    }
+
+    Bench_abWasOn[i] = bOn;
+  }
+
+} /* end BenchCheckLeds() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  u32 u32ScenarioMs = LED_BENCH_DEFAULT_MS;
+  u32 u32Writes;
+  u32 u32MostWrites;
+  u32 u32Changes;
+  bool abWasOn[TOTAL_LEDS];
+
+  for(int i = 1; i < argc; i++)
+  {
+    if( (strcmp(argv[i], "-m") == 0) && (i + 1 < argc) )
+    {
+      u32ScenarioMs = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [-m <ms per scenario>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if(u32ScenarioMs < LED_BENCH_SETTLE_MS + LED_BENCH_DUTY_MS)
+  {
+    fprintf(stderr, "Each scenario must run for at least %lu ms\n",
+            (unsigned long)(LED_BENCH_SETTLE_MS + LED_BENCH_DUTY_MS));
+    return 1;
+  }
+
+  /* The board starts with every LED on */
+  Bench_asPio[LED_BENCH_PORT_B].PIO_ODSR = 0xFFFFFFFF;
+  LedInitialize();
+  printf("LedInitialize(): %lu register writes in %lu ms\n\n", (unsigned long)Bench_u32Writes,
+         (unsigned long)G_u32SystemTime1ms);
+
+  printf("%-30s %14s %14s %14s\n", "Scenario", "writes/frame", "most/frame", "changes/frame");
+  for(u8 u8Scenario = 0; u8Scenario < sizeof(Bench_asScenarios) / sizeof(Bench_asScenarios[0]); u8Scenario++)
+  {
+    const BenchScenarioType* psScenario = &Bench_asScenarios[u8Scenario];
+
+    /* Each scenario starts from the LEDs as LedInitialize() leaves them, with the backlight on */
+    for(u8 i = 0; i < LED_BENCH_DISCRETE_LEDS; i++)
+    {
+      LedPWM((LedNumberType)i, LED_PWM_0);
+      Bench_abCheckDuty[i] = FALSE;
+      Bench_au32MaxGapMs[i] = 0;
+      Bench_au32BlinkMs[i] = 0;
+      Bench_au32FadeStartMs[i] = 0;
+    }
+    for(u8 i = 0; i < LED_PWM_PERIOD; i++)
+    {
+      LedUpdate();
+    }
+    for(u8 i = 0; i < TOTAL_LEDS; i++)
+    {
+      abWasOn[i] = BenchIsLedOn(i);
+      Bench_abWasOn[i] = abWasOn[i];
+    }
+
+    u32Writes = 0;
+    u32MostWrites = 0;
+    u32Changes = 0;
+    for(u32 u32Ms = 0; u32Ms < u32ScenarioMs; u32Ms++)
+    {
+      psScenario->pfSetup(u32Ms);
+
+      /* Only the writes LedUpdate() makes are counted, then the last of them is applied to the pins */
+      Bench_u32Writes = 0;
+      LedUpdate();
+      G_u32SystemTime1ms++;
+      u32Writes += Bench_u32Writes;
+      if(Bench_u32Writes > u32MostWrites)
+      {
+        u32MostWrites = Bench_u32Writes;
+      }
+      (void)BenchPioAccess();
+
+      for(u8 i = 0; i < TOTAL_LEDS; i++)
+      {
+        if(BenchIsLedOn(i) != abWasOn[i])
+        {
+          u32Changes++;
+          abWasOn[i] = !abWasOn[i];
+        }
+      }
+
+      BenchCheckLeds(psScenario->pcName, u32Ms);
+    }
+
+    printf("%-30s %14.3f %14lu %14.3f\n", psScenario->pcName, (double)u32Writes / u32ScenarioMs,
+           (unsigned long)u32MostWrites, (double)u32Changes / u32ScenarioMs);
+  }
+
+  printf("\n%s\n", Bench_bPassed ? "All LED checks passed" : "LED checks FAILED");
+  return Bench_bPassed ? 0 : 1;
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
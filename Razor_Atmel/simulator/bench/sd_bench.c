@@ -0,0 +1,1172 @@
+/***********************************************************************************************************************
+File: sd_bench.c
+
+Description:
+Host benchmark and fault-injection test for the SD card driver.  Runs the unmodified sdcard.c against a model
+of the SSP peripheral and of an SD card in SPI mode, and measures how many blocks per second a client gets from
+single block reads (SdReadBlock(), one CMD17 per block), from one multiple block read (SdReadBlocks(), CMD18)
+and from queued writes (SdWriteBlock()) that go out one block per CMD24 or as CMD25 runs.
+
+The writes are then repeated with faults injected into the card, checking what ends up on the card each time:
+  - The card rejects every SD_BENCH_REJECT_EVERY th block once: the driver must send them again.
+  - One block is always rejected: only that block may be lost, and it must be counted as a write error.
+  - The card stays busy after a block: the driver must give up, start the card over and count the blocks
+    it dropped, then write normally again.
+
+The model follows the board's timing:
+  - The main loop makes one pass per ms.  The SSP task starts a queued transfer at the start of a pass and the
+    SD card task and its client run SD_BENCH_TASK_OFFSET_US later in the same pass.
+  - Each byte takes 8 SPI clocks.  A transfer is only seen as complete once its last byte is in.
+  - The card answers every command after one byte (Ncr), and sends a data block's start token once its access
+    time has passed after the read command or after the previous block of a multiple block read.
+  - The card answers a written block right after its checksum and is then busy for its programming time.
+  - The SSP sends one queued message per pass; the driver splits a block being written into messages of
+    at most MAX_TX_MESSAGE_LENGTH bytes.
+
+Usage: sd_bench [-c <SPI clock Hz>] [-a <access time us>] [-p <program time us>] [-n <blocks>] [-v]
+  -c  SPI clock (default: 1000000, the rate set by SD_US_BRGR_INIT)
+  -a  Card access time in us before each block (default: SD_BENCH_DEFAULT_ACCESS_US)
+  -p  Card programming time in us after each block written (default: SD_BENCH_DEFAULT_PROGRAM_US)
+  -n  Number of blocks to read and write each way (default: 256)
+  -v  Print the SD card task's debug messages
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+#include <stdio.h>
+
+/***********************************************************************************************************************
+Type Definitions
+***********************************************************************************************************************/
+/* The emulated SSP peripheral: messages queue up to be sent one per pass, and one read can be queued */
+struct BenchSspType
+{
+  bool bAssigned;                           /* Requested by the SD card task */
+  bool bCsAsserted;                         /* Card chip select */
+  u8* pu8RxBuffer;                          /* Client receive buffer */
+  u16 u16RxBufferSize;
+  u16 u16RxBytes;                           /* Bytes of the queued or current read, 0 when none */
+  bool bRxComplete;                         /* Read finished and not yet queried */
+  u8 aau8TxData[TX_QUEUE_SIZE][MAX_TX_MESSAGE_LENGTH]; /* Queued messages, oldest at u8TxHead */
+  u32 au32TxSize[TX_QUEUE_SIZE];
+  u32 au32TxToken[TX_QUEUE_SIZE];
+  u8 u8TxHead;
+  u8 u8TxCount;                             /* Messages queued and not yet started */
+  u32 u32TxToken;                           /* Token of the message in flight */
+  bool bBusy;                               /* A transfer is in flight */
+  bool bBusyIsRead;                         /* The transfer in flight is a read */
+  u32 u32BusyEndUs;                         /* Time the transfer in flight finishes */
+};
+
+/* What the card is doing with its data output */
+typedef enum {CARD_NOT_READING, CARD_READING_ONE, CARD_READING_MANY} BenchCardReadType;
+
+/* What the card is doing with its data input */
+typedef enum {CARD_NOT_WRITING, CARD_WRITING_ONE, CARD_WRITING_MANY} BenchCardWriteType;
+
+/* Faults the card can be made to have while it is written */
+typedef enum {FAULT_NONE, FAULT_REJECT_SOME, FAULT_BAD_BLOCK, FAULT_STUCK_BUSY} BenchFaultType;
+
+
+/***********************************************************************************************************************
+Constants / Definitions
+***********************************************************************************************************************/
+#define SD_BENCH_TASK_OFFSET_US     (u32)300      /* Time into each 1ms pass that the SD card task runs */
+#define SD_BENCH_DEFAULT_ACCESS_US  (u32)250      /* Typical read access time of a card */
+#define SD_BENCH_INIT_US            (u32)20000    /* Time the card takes to leave idle after its first ACMD41 */
+#define SD_BENCH_BUSY_US            (u32)100      /* Time the card stays busy after CMD12 */
+#define SD_BENCH_DEFAULT_PROGRAM_US (u32)800      /* Typical time a card is busy after a block is written */
+#define SD_BENCH_BLOCK_SIZE         (u32)512
+#define SD_BENCH_BLOCK_BYTES        (u32)(SD_BENCH_BLOCK_SIZE + 3)   /* Start token, data and CRC */
+#define SD_BENCH_FIRST_BLOCK        (u32)2048     /* Where the reads start on the card */
+#define SD_BENCH_WRITE_BLOCK        (u32)65536    /* Where the writes start on the card */
+#define SD_BENCH_REJECT_EVERY       (u32)5        /* FAULT_REJECT_SOME rejects every this many blocks received */
+#define SD_BENCH_FAULT_BLOCKS       (u32)24       /* Blocks written in each fault test */
+#define SD_BENCH_BAD_BLOCK          (u32)10       /* Block FAULT_BAD_BLOCK always rejects */
+#define SD_BENCH_STUCK_BLOCK        (u32)6        /* Block after which FAULT_STUCK_BUSY keeps the card busy */
+#define SD_DATA_WRITE_ERROR         (u8)0x0D      /* Data response when the card could not write a block */
+#define SD_BENCH_MAX_PASSES         (u32)600000   /* Give up if anything takes more than 10 minutes */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+volatile u32 G_u32SystemFlags = 0;
+volatile u32 G_u32ApplicationFlags = 0;
+
+volatile u32 G_u32SystemTime1ms = 0;
+volatile u32 G_u32SystemTime1s = 0;
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "Bench_" and be declared as static.
+***********************************************************************************************************************/
+static SspPeripheralType Bench_sSsp;
+static u32 Bench_u32NowUs = 0;                         /* Time the code being run sees */
+static u32 Bench_u32ByteUs = 8;                        /* Time for one byte on the SPI bus */
+static u32 Bench_u32SpiClock = 1000000;
+static u32 Bench_u32AccessUs = SD_BENCH_DEFAULT_ACCESS_US;
+static u32 Bench_u32ProgramUs = SD_BENCH_DEFAULT_PROGRAM_US;
+static u32 Bench_u32NextToken = 1;
+static bool Bench_bVerbose = FALSE;
+
+/* Card model */
+static u8 Card_au8Command[SD_CMD_SIZE];                /* Command being received */
+static u8 Card_u8CommandBytes = 0;
+static u8 Card_au8Response[8];                         /* Bytes the card sends next, before anything else */
+static u8 Card_u8ResponseNext = 0;
+static u8 Card_u8ResponseSize = 0;
+static bool Card_bAppCommand = FALSE;                  /* Last command was CMD55 */
+static bool Card_bIdle = TRUE;                         /* Card has not finished initializing */
+static u32 Card_u32FirstAcmd41Us = 0;
+static bool Card_bAcmd41Seen = FALSE;
+static BenchCardReadType Card_eRead = CARD_NOT_READING;
+static u32 Card_u32ReadBlock = 0;                      /* Block being sent */
+static u32 Card_u32ReadReadyUs = 0;                    /* Time its start token can be sent */
+static u32 Card_u32ReadIndex = 0;                      /* Next byte of it to send: token, data then CRC */
+static u32 Card_u32BusyUntilUs = 0;
+static BenchCardWriteType Card_eWrite = CARD_NOT_WRITING;
+static u32 Card_u32WriteBlock = 0;                     /* Block being received */
+static u32 Card_u32WriteIndex = 0;                     /* Next byte of it to receive after its token: data then CRC */
+static u8 Card_au8WriteData[SD_BENCH_BLOCK_SIZE];
+static u8* Card_pu8Written = NULL;                     /* Card contents from SD_BENCH_WRITE_BLOCK on */
+static bool* Card_pbWritten = NULL;                    /* Which of those blocks have been written */
+static u32 Card_u32WriteBlocks = 0;                    /* Size of the written area in blocks */
+static u32 Card_u32StrayWrites = 0;                    /* Blocks written outside that area */
+static u32 Card_u32BlocksReceived = 0;
+static BenchFaultType Card_eFault = FAULT_NONE;
+static bool Card_bStuck = FALSE;                       /* FAULT_STUCK_BUSY has struck: busy until the next CMD0 */
+static bool Card_bWriteReceiving = FALSE;              /* Start token seen, block data coming in */
+
+/* Client variables */
+static u32 Bench_u32BlocksChecked = 0;
+static u32 Bench_u32BadBlocks = 0;
+
+
+/***********************************************************************************************************************
+Function Declarations
+***********************************************************************************************************************/
+static void BenchRunPass(void);
+static void BenchStartTransfer(void);
+static u8 BenchCardExchange(u8 u8Mosi_, u32 u32TimeUs_);
+static void BenchCardCommand(u32 u32TimeUs_);
+static void BenchCardRespond(const u8* pu8Response_, u8 u8Size_);
+static u8 BenchBlockByte(u32 u32Block_, u32 u32Index_);
+static void BenchCheckBlock(u32 u32Block_, const u8* pu8Data_);
+static void BenchBlockCallback(u32 u32Block_, u8* pu8Data_);
+static u32 BenchReadSingle(u32 u32Blocks_);
+static u32 BenchReadMultiple(u32 u32Blocks_);
+static void BenchReport(const char* pcName_, u32 u32Blocks_, u32 u32Ms_);
+static void BenchCardDataByte(u8 u8Mosi_, u32 u32TimeUs_);
+static u8 BenchWriteByte(u32 u32Block_, u32 u32Index_);
+static u32 BenchWrite(u32 u32Blocks_, u32 u32Stride_);
+static u32 BenchCheckWrites(u32 u32Blocks_, u32 u32Stride_);
+static bool BenchFaultTest(const char* pcName_, BenchFaultType eFault_, u32 u32Stride_);
+
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+
+Description:
+Initializes the card through the real driver, times both ways of reading the same blocks and both ways of
+writing, then runs the write fault tests.
+*/
+int main(int argc, char* argv[])
+{
+  u32 u32Blocks = 256;
+  u32 u32Passes;
+  bool bPassed = TRUE;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if( (strcmp(argv[i], "-c") == 0) && (i + 1 < argc) )
+    {
+      Bench_u32SpiClock = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if( (strcmp(argv[i], "-a") == 0) && (i + 1 < argc) )
+    {
+      Bench_u32AccessUs = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if( (strcmp(argv[i], "-p") == 0) && (i + 1 < argc) )
+    {
+      Bench_u32ProgramUs = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if( (strcmp(argv[i], "-n") == 0) && (i + 1 < argc) )
+    {
+      u32Blocks = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if(strcmp(argv[i], "-v") == 0)
+    {
+      Bench_bVerbose = TRUE;
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [-c <SPI clock Hz>] [-a <access time us>] [-p <program time us>] [-n <blocks>] [-v]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+
+  if( (Bench_u32SpiClock < 8000) || (Bench_u32SpiClock > 50000000) || (u32Blocks == 0) )
+  {
+    fprintf(stderr, "SPI clock must be 8 kHz - 50 MHz and at least one block must be read\n");
+    return 1;
+  }
+
+  /* Byte time is rounded up to whole us */
+  Bench_u32ByteUs = (8000000 + Bench_u32SpiClock - 1) / Bench_u32SpiClock;
+
+  /* Room for every other block of the longest write */
+  Card_u32WriteBlocks = 2 * ((u32Blocks > SD_BENCH_FAULT_BLOCKS) ? u32Blocks : SD_BENCH_FAULT_BLOCKS);
+  Card_pu8Written = malloc(Card_u32WriteBlocks * SD_BENCH_BLOCK_SIZE);
+  Card_pbWritten = calloc(Card_u32WriteBlocks, sizeof(bool));
+  if( (Card_pu8Written == NULL) || (Card_pbWritten == NULL) )
+  {
+    fprintf(stderr, "Out of memory\n");
+    return 1;
+  }
+
+  SdCardInitialize();
+  for(u32Passes = 0; SdGetStatus() != SD_IDLE; u32Passes++)
+  {
+    if(u32Passes == SD_BENCH_MAX_PASSES)
+    {
+      fprintf(stderr, "Card did not initialize\n");
+      return 1;
+    }
+
+    BenchRunPass();
+  }
+
+  printf("SPI clock %lu Hz (%lu us/byte), card access time %lu us, program time %lu us, card ready after %lu ms\n",
+         (unsigned long)Bench_u32SpiClock, (unsigned long)Bench_u32ByteUs, (unsigned long)Bench_u32AccessUs,
+         (unsigned long)Bench_u32ProgramUs, (unsigned long)u32Passes);
+
+  BenchReport("Single block reads (CMD17)", u32Blocks, BenchReadSingle(u32Blocks));
+  BenchReport("Multiple block read (CMD18)", u32Blocks, BenchReadMultiple(u32Blocks));
+
+  /* Every other block cannot be joined into a run, adjacent blocks can */
+  BenchReport("Single block writes (CMD24)", u32Blocks, BenchWrite(u32Blocks, 2));
+  if(BenchCheckWrites(u32Blocks, 2) != u32Blocks)
+  {
+    fprintf(stderr, "Single block writes did not all reach the card\n");
+    bPassed = FALSE;
+  }
+  
+  BenchReport("Queued block writes (CMD25)", u32Blocks, BenchWrite(u32Blocks, 1));
+  if(BenchCheckWrites(u32Blocks, 1) != u32Blocks)
+  {
+    fprintf(stderr, "Queued block writes did not all reach the card\n");
+    bPassed = FALSE;
+  }
+
+  /* The bus limit counts only the bytes of each block, with no time between them */
+  printf("SPI line rate: %.1f blocks/s\n", 1000000.0 / (double)(SD_BENCH_BLOCK_BYTES * Bench_u32ByteUs));
+
+  for(u32 u32Stride = 1; u32Stride <= 2; u32Stride++)
+  {
+    bPassed &= BenchFaultTest("Rejected blocks", FAULT_REJECT_SOME, u32Stride);
+    bPassed &= BenchFaultTest("Bad block", FAULT_BAD_BLOCK, u32Stride);
+    bPassed &= BenchFaultTest("Card stuck busy", FAULT_STUCK_BUSY, u32Stride);
+  }
+
+  if( (Bench_u32BadBlocks != 0) || (Card_u32StrayWrites != 0) )
+  {
+    fprintf(stderr, "%lu of %lu blocks had the wrong data, %lu blocks were written in the wrong place\n", 
+            (unsigned long)Bench_u32BadBlocks, (unsigned long)Bench_u32BlocksChecked, (unsigned long)Card_u32StrayWrites);
+    return 1;
+  }
+
+  return bPassed ? 0 : 1;
+
+} /* end main() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchReadSingle
+
+Description:
+Reads blocks one at a time the way a streaming client of SdReadBlock() does: request a block when the card is
+idle and borrow it when it is ready.  The client holds on to the last SD_READ_BUFFERS - 1 blocks the way song
+playback does and checks each one again as it gives it back, so a buffer reused while it was lent shows up.
+The client runs after the SD card task in each pass.
+Returns the time taken in ms, or 0 if the read failed.
+*/
+static u32 BenchReadSingle(u32 u32Blocks_)
+{
+  u8* apu8Held[SD_READ_BUFFERS];
+  u8* pu8Data;
+  u32 u32Requested = 0;
+  u32 u32Received = 0;
+  u32 u32Released = 0;
+  u32 u32StartMs = G_u32SystemTime1ms;
+
+  while(u32Released < u32Blocks_)
+  {
+    BenchRunPass();
+
+    pu8Data = SdBorrowReadData();
+    if(pu8Data != NULL)
+    {
+      BenchCheckBlock(u32Received, pu8Data);
+      apu8Held[u32Received % SD_READ_BUFFERS] = pu8Data;
+      u32Received++;
+    }
+
+    /* Give the oldest block back once enough are held, or all of them at the end */
+    while( (u32Released < u32Received) && 
+           (((u32Received - u32Released) >= (u32)(SD_READ_BUFFERS - 1)) || (u32Received == u32Blocks_)) )
+    {
+      BenchCheckBlock(u32Released, apu8Held[u32Released % SD_READ_BUFFERS]);
+      SdReleaseReadData(apu8Held[u32Released % SD_READ_BUFFERS]);
+      u32Released++;
+    }
+
+    if( (u32Requested == u32Received) && (u32Requested < u32Blocks_) && SdReadBlock(SD_BENCH_FIRST_BLOCK + u32Requested) )
+    {
+      u32Requested++;
+    }
+
+    if( (SdGetStatus() != SD_READING) && (SdGetStatus() != SD_DATA_READY) && (SdGetStatus() != SD_IDLE) )
+    {
+      fprintf(stderr, "Single block read failed at block %lu\n", (unsigned long)u32Received);
+      return 0;
+    }
+  }
+
+  return G_u32SystemTime1ms - u32StartMs;
+
+} /* end BenchReadSingle() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchReadMultiple
+
+Description:
+Reads the same blocks with one SdReadBlocks() call, checking each one in the callback.
+Returns the time taken in ms until the card is idle again, or 0 if the read failed.
+*/
+static u32 BenchReadMultiple(u32 u32Blocks_)
+{
+  u32 u32StartMs = G_u32SystemTime1ms;
+  u32 u32Checked = Bench_u32BlocksChecked;
+
+  if(!SdReadBlocks(SD_BENCH_FIRST_BLOCK, u32Blocks_, BenchBlockCallback))
+  {
+    fprintf(stderr, "Multiple block read was not accepted\n");
+    return 0;
+  }
+
+  do
+  {
+    BenchRunPass();
+  } while(SdGetStatus() == SD_READING);
+
+  if( (SdGetStatus() != SD_IDLE) || (Bench_u32BlocksChecked - u32Checked != u32Blocks_) )
+  {
+    fprintf(stderr, "Multiple block read failed after %lu blocks\n", (unsigned long)(Bench_u32BlocksChecked - u32Checked));
+    return 0;
+  }
+
+  return G_u32SystemTime1ms - u32StartMs;
+
+} /* end BenchReadMultiple() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchWrite
+
+Description:
+Writes blocks u32Stride_ apart from SD_BENCH_WRITE_BLOCK the way a logging client would: each block is handed to
+SdWriteBlock() as soon as the driver takes it, and the client keeps trying if it does not.  The written area of
+the card is cleared first.
+Returns the time taken in ms until every block has been written or dropped and the card is idle, or 0 if that
+did not happen.
+*/
+static u32 BenchWrite(u32 u32Blocks_, u32 u32Stride_)
+{
+  u8 au8Block[SD_BENCH_BLOCK_SIZE];
+  u32 u32Queued = 0;
+  u32 u32StartMs = G_u32SystemTime1ms;
+
+  memset(Card_pbWritten, 0, Card_u32WriteBlocks * sizeof(bool));
+  for(u32 u32Passes = 0; u32Passes < SD_BENCH_MAX_PASSES; u32Passes++)
+  {
+    BenchRunPass();
+
+    while(u32Queued < u32Blocks_)
+    {
+      for(u32 i = 0; i < SD_BENCH_BLOCK_SIZE; i++)
+      {
+        au8Block[i] = BenchWriteByte(u32Queued * u32Stride_, i);
+      }
+
+      if(!SdWriteBlock(SD_BENCH_WRITE_BLOCK + (u32Queued * u32Stride_), au8Block))
+      {
+        break;
+      }
+      u32Queued++;
+    }
+
+    if( (u32Queued == u32Blocks_) && (SdGetWritesPending() == 0) && (SdGetStatus() == SD_IDLE) )
+    {
+      return G_u32SystemTime1ms - u32StartMs;
+    }
+  }
+
+  fprintf(stderr, "Writes did not finish after %lu of %lu blocks\n", (unsigned long)u32Queued, (unsigned long)u32Blocks_);
+  return 0;
+
+} /* end BenchWrite() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCheckWrites
+
+Description:
+Checks the written area of the card after BenchWrite(): every block written must hold what the client wrote
+there and nothing may have been written between the blocks.
+Returns the number of blocks written correctly.
+*/
+static u32 BenchCheckWrites(u32 u32Blocks_, u32 u32Stride_)
+{
+  u32 u32Written = 0;
+  u8* pu8Block;
+
+  for(u32 u32Block = 0; u32Block < Card_u32WriteBlocks; u32Block++)
+  {
+    if(!Card_pbWritten[u32Block])
+    {
+      continue;
+    }
+
+    Bench_u32BlocksChecked++;
+    if( ((u32Block % u32Stride_) != 0) || (u32Block >= u32Blocks_ * u32Stride_) )
+    {
+      Card_u32StrayWrites++;
+      continue;
+    }
+
+    pu8Block = &Card_pu8Written[u32Block * SD_BENCH_BLOCK_SIZE];
+    for(u32 i = 0; i < SD_BENCH_BLOCK_SIZE; i++)
+    {
+      if(pu8Block[i] != BenchWriteByte(u32Block, i))
+      {
+        Bench_u32BadBlocks++;
+        break;
+      }
+
+      if(i == SD_BENCH_BLOCK_SIZE - 1)
+      {
+        u32Written++;
+      }
+    }
+  }
+
+  return u32Written;
+
+} /* end BenchCheckWrites() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchFaultTest
+
+Description:
+Writes SD_BENCH_FAULT_BLOCKS blocks u32Stride_ apart to a card with the fault given, and checks the driver
+copes: blocks the card rejects once are sent again, a block it always rejects is dropped and counted, and when
+the card stays busy the driver starts it over, counts the blocks it had queued and goes on writing.
+Returns TRUE if the right blocks reached the card and the right number of errors were counted.
+*/
+static bool BenchFaultTest(const char* pcName_, BenchFaultType eFault_, u32 u32Stride_)
+{
+  u32 u32ErrorsBefore = SdGetWriteErrors();
+  u32 u32Errors;
+  u32 u32Ms;
+  u32 u32Written;
+  bool bPassed;
+
+  Card_eFault = eFault_;
+  u32Ms = BenchWrite(SD_BENCH_FAULT_BLOCKS, u32Stride_);
+  u32Written = BenchCheckWrites(SD_BENCH_FAULT_BLOCKS, u32Stride_);
+  u32Errors = SdGetWriteErrors() - u32ErrorsBefore;
+  Card_eFault = FAULT_NONE;
+
+  switch(eFault_)
+  {
+    case FAULT_REJECT_SOME:
+    {
+      bPassed = (u32Written == SD_BENCH_FAULT_BLOCKS) && (u32Errors == 0);
+      break;
+    }
+
+    case FAULT_BAD_BLOCK:
+    {
+      bPassed = (u32Errors == 1) && !Card_pbWritten[SD_BENCH_BAD_BLOCK] && 
+                (u32Written + u32Errors == SD_BENCH_FAULT_BLOCKS);
+      break;
+    }
+
+    default:
+    {
+      /* The block the card got stuck on was written, and at least the next one was lost */
+      bPassed = (u32Errors != 0) && Card_pbWritten[SD_BENCH_STUCK_BLOCK] && 
+                (u32Written + u32Errors == SD_BENCH_FAULT_BLOCKS) && 
+                Card_pbWritten[(SD_BENCH_FAULT_BLOCKS - 1) * u32Stride_];
+      break;
+    }
+  }
+
+  printf("%s, blocks %lu apart: %lu of %lu written, %lu write errors in %lu ms: %s\n", pcName_,
+         (unsigned long)u32Stride_, (unsigned long)u32Written, (unsigned long)SD_BENCH_FAULT_BLOCKS,
+         (unsigned long)u32Errors, (unsigned long)u32Ms, ((u32Ms != 0) && bPassed) ? "passed" : "FAILED");
+
+  return (u32Ms != 0) && bPassed;
+
+} /* end BenchFaultTest() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchReport
+
+Description:
+Prints the throughput of one way of reading or writing.
+*/
+static void BenchReport(const char* pcName_, u32 u32Blocks_, u32 u32Ms_)
+{
+  if(u32Ms_ == 0)
+  {
+    printf("%s: failed\n", pcName_);
+    return;
+  }
+
+  printf("%s: %lu blocks in %lu ms, %.1f blocks/s, %.1f KB/s\n", pcName_, (unsigned long)u32Blocks_,
+         (unsigned long)u32Ms_, (u32Blocks_ * 1000.0) / u32Ms_, (u32Blocks_ * (double)SD_BENCH_BLOCK_SIZE) / u32Ms_);
+
+} /* end BenchReport() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchBlockCallback
+
+Description:
+Client callback for SdReadBlocks().
+*/
+static void BenchBlockCallback(u32 u32Block_, u8* pu8Data_)
+{
+  BenchCheckBlock(u32Block_, pu8Data_);
+
+} /* end BenchBlockCallback() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCheckBlock
+
+Description:
+Compares a block a client received with what the card holds at SD_BENCH_FIRST_BLOCK + u32Block_.
+*/
+static void BenchCheckBlock(u32 u32Block_, const u8* pu8Data_)
+{
+  Bench_u32BlocksChecked++;
+
+  for(u32 i = 0; i < SD_BENCH_BLOCK_SIZE; i++)
+  {
+    if(pu8Data_[i] != BenchBlockByte(SD_BENCH_FIRST_BLOCK + u32Block_, i))
+    {
+      Bench_u32BadBlocks++;
+      return;
+    }
+  }
+
+} /* end BenchCheckBlock() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchBlockByte
+
+Description:
+Contents of the emulated card: a pattern that is different in every block.
+*/
+static u8 BenchBlockByte(u32 u32Block_, u32 u32Index_)
+{
+  return (u8)( (u32Block_ * 31) + (u32Block_ >> 8) + (u32Index_ * 7) );
+
+} /* end BenchBlockByte() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchWriteByte
+
+Description:
+What the client writes to the block u32Block_ blocks from SD_BENCH_WRITE_BLOCK: a different pattern from
+the one the card is read with, so data read back by mistake does not pass.
+*/
+static u8 BenchWriteByte(u32 u32Block_, u32 u32Index_)
+{
+  return (u8)( (u32Block_ * 13) + (u32Block_ >> 5) + (u32Index_ * 3) + 0x5A );
+
+} /* end BenchWriteByte() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchRunPass
+
+Description:
+One pass of the board's main loop for the tasks that are modelled, then 1 ms of time.
+*/
+static void BenchRunPass(void)
+{
+  u32 u32PassUs = G_u32SystemTime1ms * 1000;
+
+  /* SSP task */
+  Bench_u32NowUs = u32PassUs;
+  BenchStartTransfer();
+
+  /* SD card task (and the client, which runs after it) */
+  Bench_u32NowUs = u32PassUs + SD_BENCH_TASK_OFFSET_US;
+  SdCardRunActiveState();
+
+  G_u32SystemTime1ms++;
+  G_u32SystemTime1s = G_u32SystemTime1ms / 1000;
+
+} /* end BenchRunPass() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchStartTransfer
+
+Description:
+What the SSP task does each pass: if the bus is free, starts the oldest queued message or the read.  Every byte is
+exchanged with the card model at the time it would be on the bus; the results only become visible to the
+driver once the transfer's end time has passed.
+*/
+static void BenchStartTransfer(void)
+{
+  SspPeripheralType* psSsp = &Bench_sSsp;
+  u32 u32StartUs = Bench_u32NowUs;
+
+  if( (psSsp->bBusy && (Bench_u32NowUs < psSsp->u32BusyEndUs)) || !psSsp->bAssigned )
+  {
+    return;
+  }
+
+  if(psSsp->bBusy && psSsp->bBusyIsRead)
+  {
+    psSsp->u16RxBytes = 0;
+    psSsp->bRxComplete = TRUE;
+  }
+  psSsp->bBusy = FALSE;
+
+  /* A queued message goes first */
+  if(psSsp->u8TxCount != 0)
+  {
+    u8 u8Message = psSsp->u8TxHead;
+
+    for(u32 i = 0; i < psSsp->au32TxSize[u8Message]; i++)
+    {
+      (void)BenchCardExchange(psSsp->aau8TxData[u8Message][i], u32StartUs + (i * Bench_u32ByteUs));
+    }
+
+    psSsp->bBusy = TRUE;
+    psSsp->bBusyIsRead = FALSE;
+    psSsp->u32BusyEndUs = u32StartUs + (psSsp->au32TxSize[u8Message] * Bench_u32ByteUs);
+    psSsp->u32TxToken = psSsp->au32TxToken[u8Message];
+    psSsp->u8TxHead = (u8Message + 1) % TX_QUEUE_SIZE;
+    psSsp->u8TxCount--;
+  }
+  else if(psSsp->u16RxBytes != 0)
+  {
+    /* Dummy bytes are clocked out of the receive buffer, so it is cleared first */
+    memset(psSsp->pu8RxBuffer, SSP_DUMMY_BYTE, psSsp->u16RxBufferSize);
+    for(u32 i = 0; i < psSsp->u16RxBytes; i++)
+    {
+      psSsp->pu8RxBuffer[i] = BenchCardExchange(SSP_DUMMY_BYTE, u32StartUs + (i * Bench_u32ByteUs));
+    }
+
+    psSsp->bBusy = TRUE;
+    psSsp->bBusyIsRead = TRUE;
+    psSsp->u32BusyEndUs = u32StartUs + (psSsp->u16RxBytes * Bench_u32ByteUs);
+  }
+
+} /* end BenchStartTransfer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCardExchange
+
+Description:
+One byte on the SPI bus: the card takes u8Mosi_ and returns what it drives on its output at u32TimeUs_.
+*/
+static u8 BenchCardExchange(u8 u8Mosi_, u32 u32TimeUs_)
+{
+  u8 u8Miso = 0xFF;
+
+  if(!Bench_sSsp.bCsAsserted)
+  {
+    return u8Miso;
+  }
+
+  /* Output: a command response first, then block data, then busy */
+  if(Card_u8ResponseNext < Card_u8ResponseSize)
+  {
+    u8Miso = Card_au8Response[Card_u8ResponseNext++];
+  }
+  else if( (Card_eRead != CARD_NOT_READING) && (u32TimeUs_ >= Card_u32ReadReadyUs) )
+  {
+    if(Card_u32ReadIndex == 0)
+    {
+      u8Miso = TOKEN_START_BLOCK;
+    }
+    else if(Card_u32ReadIndex <= SD_BENCH_BLOCK_SIZE)
+    {
+      u8Miso = BenchBlockByte(Card_u32ReadBlock, Card_u32ReadIndex - 1);
+    }
+    else
+    {
+      /* CRC is not checked */
+      u8Miso = 0x00;
+    }
+
+    Card_u32ReadIndex++;
+    if(Card_u32ReadIndex == SD_BENCH_BLOCK_BYTES)
+    {
+      Card_u32ReadIndex = 0;
+      Card_u32ReadBlock++;
+      Card_u32ReadReadyUs = u32TimeUs_ + Bench_u32AccessUs;
+      if(Card_eRead == CARD_READING_ONE)
+      {
+        Card_eRead = CARD_NOT_READING;
+      }
+    }
+  }
+  else if(Card_bStuck || (u32TimeUs_ < Card_u32BusyUntilUs))
+  {
+    u8Miso = 0x00;
+  }
+
+  /* Input: a block being written, or a command that starts with 01 in its top two bits */
+  if( Card_bWriteReceiving || ((Card_eWrite != CARD_NOT_WRITING) && (Card_u8CommandBytes == 0)) )
+  {
+    BenchCardDataByte(u8Mosi_, u32TimeUs_);
+  }
+  
+  if( !Card_bWriteReceiving && ((Card_u8CommandBytes != 0) || ((u8Mosi_ & 0xC0) == 0x40)) )
+  {
+    Card_au8Command[Card_u8CommandBytes++] = u8Mosi_;
+    if(Card_u8CommandBytes == SD_CMD_SIZE)
+    {
+      Card_u8CommandBytes = 0;
+      BenchCardCommand(u32TimeUs_);
+    }
+  }
+
+  return u8Miso;
+
+} /* end BenchCardExchange() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCardCommand
+
+Description:
+Acts on the command that just finished arriving and queues its response.
+*/
+static void BenchCardCommand(u32 u32TimeUs_)
+{
+  u8 u8Command = Card_au8Command[0] & 0x3F;
+  u32 u32Argument = ((u32)Card_au8Command[1] << 24) | ((u32)Card_au8Command[2] << 16) |
+                    ((u32)Card_au8Command[3] << 8) | (u32)Card_au8Command[4];
+  u8 u8R1 = Card_bIdle ? SD_STATUS_IDLE : SD_STATUS_READY;
+  bool bAppCommand = Card_bAppCommand;
+
+  Card_bAppCommand = FALSE;
+
+  switch(u8Command)
+  {
+    case SD_CMD0:
+    {
+      Card_bIdle = TRUE;
+      Card_bAcmd41Seen = FALSE;
+      Card_eRead = CARD_NOT_READING;
+      Card_eWrite = CARD_NOT_WRITING;
+      Card_bWriteReceiving = FALSE;
+      Card_bStuck = FALSE;
+      BenchCardRespond((u8[]){SD_STATUS_IDLE}, 1);
+      break;
+    }
+
+    case SD_CMD8:
+    {
+      BenchCardRespond((u8[]){u8R1, 0x00, 0x00, SD_VHS_VALUE, SD_CHECK_PATTERN}, 5);
+      break;
+    }
+
+    case SD_CMD55:
+    {
+      Card_bAppCommand = TRUE;
+      BenchCardRespond(&u8R1, 1);
+      break;
+    }
+
+    case SD_ACMD41:
+    {
+      if(!bAppCommand)
+      {
+        BenchCardRespond((u8[]){u8R1 | SD_STATUS_ILLEGAL_CMD}, 1);
+        break;
+      }
+
+      /* The card takes a while to power up, the host keeps asking until it is ready */
+      if(!Card_bAcmd41Seen)
+      {
+        Card_bAcmd41Seen = TRUE;
+        Card_u32FirstAcmd41Us = u32TimeUs_;
+      }
+      if(u32TimeUs_ - Card_u32FirstAcmd41Us >= SD_BENCH_INIT_US)
+      {
+        Card_bIdle = FALSE;
+      }
+
+      BenchCardRespond((u8[]){Card_bIdle ? SD_STATUS_IDLE : SD_STATUS_READY}, 1);
+      break;
+    }
+
+    case SD_CMD58:
+    {
+      /* Powered up, high capacity */
+      BenchCardRespond((u8[]){u8R1, 0xC0, 0xFF, 0x80, 0x00}, 5);
+      break;
+    }
+
+    case SD_CMD16:
+    {
+      BenchCardRespond(&u8R1, 1);
+      break;
+    }
+
+    case SD_CMD17:
+    case SD_CMD18:
+    {
+      Card_eRead = (u8Command == SD_CMD17) ? CARD_READING_ONE : CARD_READING_MANY;
+      Card_u32ReadBlock = u32Argument;
+      Card_u32ReadIndex = 0;
+      Card_u32ReadReadyUs = u32TimeUs_ + Bench_u32AccessUs;
+      BenchCardRespond(&u8R1, 1);
+      break;
+    }
+
+    case SD_CMD24:
+    case SD_CMD25:
+    {
+      Card_eWrite = (u8Command == SD_CMD24) ? CARD_WRITING_ONE : CARD_WRITING_MANY;
+      Card_u32WriteBlock = u32Argument;
+      BenchCardRespond(&u8R1, 1);
+      break;
+    }
+
+    case SD_CMD12:
+    {
+      /* R1b: one stuff byte, the response, then busy while the card stops */
+      Card_eRead = CARD_NOT_READING;
+      Card_u32BusyUntilUs = u32TimeUs_ + SD_BENCH_BUSY_US;
+      BenchCardRespond((u8[]){0xFF, u8R1}, 2);
+      break;
+    }
+
+    default:
+    {
+      BenchCardRespond((u8[]){u8R1 | SD_STATUS_ILLEGAL_CMD}, 1);
+      break;
+    }
+  }
+
+} /* end BenchCardCommand() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCardDataByte
+
+Description:
+Takes a byte sent to the card after CMD24 or CMD25 and before a command is sent again: first the start token,
+then the block and its CRC.  The data response is queued right behind the CRC and the card is then busy while
+it programs the block.  Faults are injected here.
+*/
+static void BenchCardDataByte(u8 u8Mosi_, u32 u32TimeUs_)
+{
+  u32 u32Offset;
+  bool bAccept = TRUE;
+
+  if(!Card_bWriteReceiving)
+  {
+    if( (u8Mosi_ == TOKEN_START_BLOCK_MULT) && (Card_eWrite == CARD_WRITING_MANY) ) 
+    {
+      Card_bWriteReceiving = TRUE;
+      Card_u32WriteIndex = 0;
+    }
+    else if( (u8Mosi_ == TOKEN_START_BLOCK) && (Card_eWrite == CARD_WRITING_ONE) )
+    {
+      Card_bWriteReceiving = TRUE;
+      Card_u32WriteIndex = 0;
+    }
+    else if( (u8Mosi_ == TOKEN_STOP_BLOCK_MULT) && (Card_eWrite == CARD_WRITING_MANY) )
+    {
+      /* The card is busy for a moment as it finishes */
+      Card_eWrite = CARD_NOT_WRITING;
+      Card_u32BusyUntilUs = u32TimeUs_ + Bench_u32ByteUs + SD_BENCH_BUSY_US;
+    }
+
+    return;
+  }
+
+  /* Block data, then two bytes of CRC that are not checked */
+  if(Card_u32WriteIndex < SD_BENCH_BLOCK_SIZE)
+  {
+    Card_au8WriteData[Card_u32WriteIndex] = u8Mosi_;
+  }
+  Card_u32WriteIndex++;
+  if(Card_u32WriteIndex < SD_BENCH_BLOCK_SIZE + 2)
+  {
+    return;
+  }
+
+  Card_bWriteReceiving = FALSE;
+  Card_u32BlocksReceived++;
+  u32Offset = Card_u32WriteBlock - SD_BENCH_WRITE_BLOCK;
+
+  if( (Card_eFault == FAULT_REJECT_SOME) && ((Card_u32BlocksReceived % SD_BENCH_REJECT_EVERY) == 0) )
+  {
+    bAccept = FALSE;
+  }
+  if( (Card_eFault == FAULT_BAD_BLOCK) && (u32Offset == SD_BENCH_BAD_BLOCK) )
+  {
+    bAccept = FALSE;
+  }
+
+  /* The unused top bits of the data response are sent as 1s, as some cards do */
+  if(bAccept)
+  {
+    if( (Card_u32WriteBlock >= SD_BENCH_WRITE_BLOCK) && (u32Offset < Card_u32WriteBlocks) )
+    {
+      memcpy(&Card_pu8Written[u32Offset * SD_BENCH_BLOCK_SIZE], Card_au8WriteData, SD_BENCH_BLOCK_SIZE);
+      Card_pbWritten[u32Offset] = TRUE;
+    }
+    else
+    {
+      Card_u32StrayWrites++;
+    }
+
+    Card_au8Response[0] = 0xE0 | SD_DATA_ACCEPTED;
+    Card_u32BusyUntilUs = u32TimeUs_ + Bench_u32ByteUs + Bench_u32ProgramUs;
+    Card_u32WriteBlock++;
+
+    /* The fault only strikes once: the card stays busy until it is started over */
+    if( (Card_eFault == FAULT_STUCK_BUSY) && (u32Offset == SD_BENCH_STUCK_BLOCK) )
+    {
+      Card_bStuck = TRUE;
+      Card_eFault = FAULT_NONE;
+    }
+  }
+  else
+  {
+    Card_au8Response[0] = 0xE0 | SD_DATA_WRITE_ERROR;
+    Card_u32BusyUntilUs = u32TimeUs_ + Bench_u32ByteUs + SD_BENCH_BUSY_US;
+  }
+
+  Card_u8ResponseSize = 1;
+  Card_u8ResponseNext = 0;
+
+  if(Card_eWrite == CARD_WRITING_ONE)
+  {
+    Card_eWrite = CARD_NOT_WRITING;
+  }
+
+} /* end BenchCardDataByte() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCardRespond
+
+Description:
+Queues a response to go out after one byte of Ncr.
+*/
+static void BenchCardRespond(const u8* pu8Response_, u8 u8Size_)
+{
+  Card_au8Response[0] = 0xFF;
+  memcpy(&Card_au8Response[1], pu8Response_, u8Size_);
+  Card_u8ResponseSize = u8Size_ + 1;
+  Card_u8ResponseNext = 0;
+
+} /* end BenchCardRespond() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Stubbed Driver Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+SspPeripheralType* SspRequest(SspConfigurationType* psSspConfig_)
+{
+  if(Bench_sSsp.bAssigned)
+  {
+    return NULL;
+  }
+
+  Bench_sSsp.bAssigned = TRUE;
+  Bench_sSsp.pu8RxBuffer = psSspConfig_->pu8RxBufferAddress;
+  Bench_sSsp.u16RxBufferSize = psSspConfig_->u16RxBufferSize;
+  Bench_sSsp.u16RxBytes = 0;
+  Bench_sSsp.bRxComplete = FALSE;
+  Bench_sSsp.u8TxCount = 0;
+  return &Bench_sSsp;
+
+} /* end SspRequest() */
+
+
+void SspRelease(SspPeripheralType* psSspPeripheral_)
+{
+  psSspPeripheral_->bAssigned = FALSE;
+  psSspPeripheral_->bCsAsserted = FALSE;
+
+} /* end SspRelease() */
+
+
+void SspAssertCS(SspPeripheralType* psSspPeripheral_)
+{
+  psSspPeripheral_->bCsAsserted = TRUE;
+
+} /* end SspAssertCS() */
+
+
+void SspDeAssertCS(SspPeripheralType* psSspPeripheral_)
+{
+  psSspPeripheral_->bCsAsserted = FALSE;
+
+} /* end SspDeAssertCS() */
+
+
+u32 SspWriteData(SspPeripheralType* psSspPeripheral_, u32 u32Size_, u8* u8Data_)
+{
+  u8 u8Message;
+
+  /* Messages are not split up here, so one that would need more than one slot is refused */
+  if( (u32Size_ > MAX_TX_MESSAGE_LENGTH) || (psSspPeripheral_->u8TxCount == TX_QUEUE_SIZE) )
+  {
+    return 0;
+  }
+
+  u8Message = (psSspPeripheral_->u8TxHead + psSspPeripheral_->u8TxCount) % TX_QUEUE_SIZE;
+  memcpy(psSspPeripheral_->aau8TxData[u8Message], u8Data_, u32Size_);
+  psSspPeripheral_->au32TxSize[u8Message] = u32Size_;
+  psSspPeripheral_->au32TxToken[u8Message] = Bench_u32NextToken++;
+  psSspPeripheral_->u8TxCount++;
+  return psSspPeripheral_->au32TxToken[u8Message];
+
+} /* end SspWriteData() */
+
+
+bool SspReadData(SspPeripheralType* psSspPeripheral_, u16 u16Size_)
+{
+  if( (u16Size_ > psSspPeripheral_->u16RxBufferSize) || (psSspPeripheral_->u16RxBytes != 0) )
+  {
+    return FALSE;
+  }
+
+  psSspPeripheral_->u16RxBytes = u16Size_;
+  psSspPeripheral_->bRxComplete = FALSE;
+  return TRUE;
+
+} /* end SspReadData() */
+
+
+bool SspReadByte(SspPeripheralType* psSspPeripheral_)
+{
+  return SspReadData(psSspPeripheral_, 1);
+
+} /* end SspReadByte() */
+
+
+SspRxStatusType SspQueryReceiveStatus(SspPeripheralType* psSspPeripheral_)
+{
+  /* A read finishes as soon as its last byte is in, whether or not the SSP task has run since */
+  if(psSspPeripheral_->bBusy && psSspPeripheral_->bBusyIsRead && (Bench_u32NowUs >= psSspPeripheral_->u32BusyEndUs))
+  {
+    psSspPeripheral_->bBusy = FALSE;
+    psSspPeripheral_->u16RxBytes = 0;
+    psSspPeripheral_->bRxComplete = TRUE;
+  }
+
+  if(psSspPeripheral_->u16RxBytes == 0)
+  {
+    if(psSspPeripheral_->bRxComplete)
+    {
+      psSspPeripheral_->bRxComplete = FALSE;
+      return SSP_RX_COMPLETE;
+    }
+
+    return SSP_RX_EMPTY;
+  }
+
+  return psSspPeripheral_->bBusy ? SSP_RX_RECEIVING : SSP_RX_WAITING;
+
+} /* end SspQueryReceiveStatus() */
+
+
+MessageStateType QueryMessageStatus(u32 u32Token_)
+{
+  SspPeripheralType* psSsp = &Bench_sSsp;
+
+  /* Tokens are handed out in order, so everything from the oldest queued message on is still waiting */
+  if( (psSsp->u8TxCount != 0) && (u32Token_ >= psSsp->au32TxToken[psSsp->u8TxHead]) && (u32Token_ < Bench_u32NextToken) )
+  {
+    return SENDING;
+  }
+
+  if( (u32Token_ == psSsp->u32TxToken) && psSsp->bBusy && !psSsp->bBusyIsRead && (Bench_u32NowUs < psSsp->u32BusyEndUs) )
+  {
+    return SENDING;
+  }
+
+  if( (u32Token_ == 0) || (u32Token_ >= Bench_u32NextToken) )
+  {
+    return NOT_FOUND;
+  }
+
+  return COMPLETE;
+
+} /* end QueryMessageStatus() */
+
+
+u32 DebugPrintf(u8* u8String_)
+{
+  if(Bench_bVerbose)
+  {
+    printf("%6lu ms: %s", (unsigned long)G_u32SystemTime1ms, (char*)u8String_);
+  }
+
+  return 1;
+
+} /* end DebugPrintf() */
+
+
+bool IsTimeUp(u32 *pu32SavedTick_, u32 u32Period_)
+{
+  return ( (G_u32SystemTime1ms - *pu32SavedTick_) >= u32Period_ ) ? TRUE : FALSE;
+
+} /* end IsTimeUp() */
+
+
+bool BenchIsCardInserted(void)
+{
+  return TRUE;
+
+} /* end BenchIsCardInserted() */
+
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
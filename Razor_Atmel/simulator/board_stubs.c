@@ -0,0 +1,977 @@
+/***********************************************************************************************************************
+File: board_stubs.c
+
+Description:
+Host stand-ins for the board and driver functions used by the music player.  The PWM audio channels and
+TC1 are emulated closely enough that music_player.c behaves as it does on the board: period updates on a
+running channel are latched until the end of the current period, and the TC1 interrupt fires on the exact
+timer tick it would on the board.  Every change to a buzzer is passed on to music_sim.c to be rendered.
+The LEDs are emulated at the level of their duty cycle, including the fades that LedUpdate() runs, and
+passed on to music_sim.c to be traced.
+The SD card is emulated from a disk image file at the level of the sdcard.c API, with every sector read
+taking a fixed number of ms like the card task's state machine does.
+TWI0 is emulated at the level of the sam3u_i2c.c API: every message is counted and passed to a model of the
+LCD's controller, which keeps the display RAM and CGRAM the way the NHD-C0220BiZ does and counts the bytes it
+gets while it is still busy.  Each message takes as many main loop passes to send as the TWI task would take, which is
+what QueryMessageStatus() reports.
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+#include <stdio.h>
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+volatile u32 G_u32SystemFlags;                         /* _SYSTEM_INITIALIZING while music_sim.c runs the startup section */
+volatile u32 G_u32ApplicationFlags;
+volatile u32 G_u32SystemTime1ms;                       /* Simulated system time, advanced by SimAdvance1ms() */
+volatile u32 G_u32SystemTime1s;                        /* Simulated system time in seconds */
+
+SimTcType G_sSimTc1;                                   /* Emulated TC1 registers */
+SimBuzzerType G_asSimBuzzers[SIM_NUM_BUZZERS];         /* Emulated PWM audio channels */
+u32 G_u32SimTick;                                      /* TC1 ticks elapsed in the current ms */
+u32 G_u32SimLedWrites;                                 /* LED driver calls, counted per song by music_sim.c */
+u32 G_u32SimPwmWrites;                                 /* PWM register writes the audio driver makes, counted by music_sim.c */
+SimLedType G_asSimLeds[SIM_NUM_LEDS];                  /* Emulated LEDs */
+SimPioType G_sSimPioB;                                 /* Emulated port B registers */
+SimTwiType G_sSimTwi;                                  /* TWI bus traffic, counted per song by music_sim.c */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "Sim_" and be declared as static.
+***********************************************************************************************************************/
+static bool Sim_bTimer1Running = FALSE;                /* TC1 clock enabled */
+static fnCode_type Sim_pfTimer1Callback = NULL;        /* Function called on the TC1 RC compare interrupt */
+
+static FILE* Sim_pfSdImage = NULL;                     /* Disk image of the emulated SD card, NULL for no card */
+static SdCardStateType Sim_eSdState = SD_NO_CARD;
+static u32 Sim_u32SdReadMs = SIM_SD_DEFAULT_READ_MS;   /* Time each sector read takes */
+static u32 Sim_u32SdReadTimer = 0;                     /* Time when the current read started */
+static u32 Sim_u32SdSector = 0;                        /* Sector being read */
+static u8 Sim_aau8SdBuffers[SIM_SD_READ_BUFFERS][SIM_SD_SECTOR_SIZE]; /* Read ring, as in sdcard.c */
+static bool Sim_abSdBufferInUse[SIM_SD_READ_BUFFERS];   /* Set while a buffer is being read into, waiting or lent */
+static u8 Sim_u8SdBuffer = 0;                          /* Buffer of the current read */
+static u32 Sim_u32SdReads = 0;                         /* Sectors read since the card went in */
+
+static bool Sim_bTwiTransferOpen = FALSE;              /* Last message was sent without a STOP */
+static bool Sim_bTwiFull = FALSE;                      /* TWI queue refuses every message, see SimTwiSetFull() */
+static u32 Sim_u32TwiToken = 0;                        /* Token of the last message queued */
+static u32 Sim_u32TwiFreeMs = 0;                       /* First pass the TWI task can start another message on */
+static uint64_t Sim_u64TwiFreeUs = 0;                  /* Time in us the last message is off the bus */
+static SimTwiMessageType Sim_asTwiStatus[SIM_TWI_STATUS_SIZE]; /* Messages QueryMessageStatus() knows about */
+static u8 Sim_u8TwiStatusNext = 0;                     /* Entry for the next message, overwriting the oldest */
+static u8 Sim_aau8LcdRam[SIM_LCD_LINES][SIM_LCD_LINE_RAM]; /* LCD display RAM, line 2 starts at LINE2_START_ADDR */
+static u8 Sim_u8LcdAddress = 0;                        /* LCD address counter */
+static bool Sim_bLcdControlNext = TRUE;                /* Next byte to the LCD is a control byte */
+static bool Sim_bLcdData = FALSE;                      /* Bytes after the last control byte are data, not commands */
+static bool Sim_bLcdContinuation = FALSE;              /* Last control byte had Co set: another control byte follows
+                                                          the next byte */
+static bool Sim_bLcdTable1 = FALSE;                    /* Function set chose instruction table 1 (IS) */
+static u8 Sim_au8LcdCgram[SIM_LCD_CGRAM_SIZE];         /* Rows of the LCD's custom characters */
+static bool Sim_bLcdCgram = FALSE;                     /* Data goes to CGRAM, not the display RAM */
+static u8 Sim_u8LcdCgramAddress = 0;                   /* CGRAM address counter */
+static u8 Sim_aau8LcdText[SIM_LCD_LINES][LCD_MAX_LINE_DISPLAY_SIZE]; /* What SimLcdGetLine() returns */
+static uint64_t Sim_u64LcdReadyUs = 0;                 /* Time in us the LCD is done with the last byte it took */
+static u32 Sim_u32LcdBusyBytes = 0;                    /* Commands and data that reached the LCD before that */
+
+/* The custom characters lcd_control.c draws its status line with */
+static const SimLcdGlyphType Sim_asLcdGlyphs[] =
+{
+  { {0x10, 0x18, 0x1C, 0x1E, 0x1C, 0x18, 0x10, 0x00}, '>' },   /* Play */
+  { {0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x00}, '"' },   /* Pause */
+  { {0x00, 0x00, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x00}, 'a' },   /* ANT searching */
+  { {0x11, 0x15, 0x15, 0x0E, 0x04, 0x04, 0x04, 0x00}, 'A' },   /* ANT connected */
+  { {0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00}, '-' },   /* Progress bar cells, empty to full */
+  { {0x00, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x1F, 0x00}, '1' },
+  { {0x00, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x00}, '2' },
+  { {0x00, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x00}, '3' },
+  { {0x00, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x00}, '4' },
+  { {0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00}, '#' }
+};
+
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Simulator Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimBoardReset
+
+Description:
+Puts the emulated board in its power-on state.
+
+Requires:
+  - None
+
+Promises:
+  - System time is 0, both buzzers and every LED are off and TC1 is stopped with no callback
+  - The LCD has been powered long enough to take commands and shows spaces
+*/
+void SimBoardReset(void)
+{
+  G_u32SystemTime1ms = 0;
+  G_u32SystemTime1s = 0;
+  G_u32SimTick = 0;
+
+  memset(G_asSimBuzzers, 0, sizeof(G_asSimBuzzers));
+  memset(G_asSimLeds, 0, sizeof(G_asSimLeds));
+  memset(&G_sSimTc1, 0, sizeof(G_sSimTc1));
+  Sim_bTimer1Running = FALSE;
+  Sim_pfTimer1Callback = NULL;
+
+  Sim_eSdState = (Sim_pfSdImage != NULL) ? SD_IDLE : SD_NO_CARD;
+  memset(Sim_abSdBufferInUse, 0, sizeof(Sim_abSdBufferInUse));
+
+  memset(&G_sSimPioB, 0, sizeof(G_sSimPioB));
+  memset(&G_sSimTwi, 0, sizeof(G_sSimTwi));
+  Sim_bTwiTransferOpen = FALSE;
+  Sim_bTwiFull = FALSE;
+  Sim_u32TwiFreeMs = 0;
+  Sim_u64TwiFreeUs = 0;
+  memset(Sim_asTwiStatus, 0, sizeof(Sim_asTwiStatus));
+  memset(Sim_aau8LcdRam, ' ', sizeof(Sim_aau8LcdRam));
+  Sim_u8LcdAddress = LINE1_START_ADDR;
+  Sim_bLcdControlNext = TRUE;
+  Sim_bLcdTable1 = FALSE;
+  memset(Sim_au8LcdCgram, 0, sizeof(Sim_au8LcdCgram));
+  Sim_bLcdCgram = FALSE;
+  Sim_u64LcdReadyUs = 0;
+  Sim_u32LcdBusyBytes = 0;
+
+} /* end SimBoardReset() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimSdInsert
+
+Description:
+Inserts an emulated SD card holding the given disk image.
+
+Requires:
+  - pcImage_ is a raw image of the card, starting at sector 0
+  - u32ReadMs_ is the time each sector read takes, at least 1
+
+Promises:
+  - Returns TRUE and the card is ready to be read if the image can be opened, else returns FALSE
+*/
+bool SimSdInsert(const char* pcImage_, u32 u32ReadMs_)
+{
+  Sim_pfSdImage = fopen(pcImage_, "rb");
+  if(Sim_pfSdImage == NULL)
+  {
+    perror(pcImage_);
+    return FALSE;
+  }
+
+  Sim_u32SdReadMs = (u32ReadMs_ == 0) ? 1 : u32ReadMs_;
+  Sim_u32SdReads = 0;
+  Sim_eSdState = SD_IDLE;
+  return TRUE;
+
+} /* end SimSdInsert() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimSdGetReads
+
+Description:
+Returns the number of sectors read from the emulated SD card, by every task, since it went in.
+
+Requires:
+  - None
+
+Promises:
+  - Returns Sim_u32SdReads
+*/
+u32 SimSdGetReads(void)
+{
+  return Sim_u32SdReads;
+
+} /* end SimSdGetReads() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLedUpdate
+
+Description:
+The part of LedUpdate() that changes what the LEDs show: every fading LED steps down a PWM level when its
+step time is up.  Called once per pass of the main loop, before the tasks as on the board.
+
+Requires:
+  - None
+
+Promises:
+  - Fading LEDs are one ms further into their fade, and stop fading once they are off
+  - Every LED is passed to SimLogLed()
+*/
+void SimLedUpdate(void)
+{
+  SimLedType* psLed;
+
+  for(u8 i = 0; i < SIM_NUM_LEDS; i++)
+  {
+    psLed = &G_asSimLeds[i];
+    if( psLed->bFading && (--psLed->u16FadeCount == 0) )
+    {
+      psLed->u16FadeCount = psLed->u16FadeStepMs;
+      psLed->eRate = (LedRateType)(psLed->eRate - 1);
+      psLed->bFading = (psLed->eRate != LED_PWM_0);
+    }
+
+    SimLogLed(i);
+  }
+
+} /* end SimLedUpdate() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimAdvance1ms
+
+Description:
+Runs the emulated hardware for one system tick, as the SysTick interrupt does between two passes of the
+main loop.
+
+Requires:
+  - None
+
+Promises:
+  - TC1 counts TIMER_TICKS_PER_MS ticks if it is running, calling its callback on every RC compare
+  - Audio is rendered up to each interrupt and then to the end of the ms
+  - G_u32SystemTime1ms (and G_u32SystemTime1s every second) is incremented
+*/
+void SimAdvance1ms(void)
+{
+  u32 u32TicksLeft = TIMER_TICKS_PER_MS;
+  u32 u32TicksToCompare;
+
+  G_u32SimTick = 0;
+
+  while(Sim_bTimer1Running)
+  {
+    /* The 16-bit counter compares against RC after counting up from CV, wrapping if it is already past it */
+    u32TicksToCompare = (G_sSimTc1.TC_RC - G_sSimTc1.TC_CV) & 0xFFFF;
+    if(u32TicksToCompare == 0)
+    {
+      u32TicksToCompare = 0x10000;
+    }
+
+    if(u32TicksToCompare > u32TicksLeft)
+    {
+      G_sSimTc1.TC_CV = (G_sSimTc1.TC_CV + u32TicksLeft) & 0xFFFF;
+      break;
+    }
+
+    /* RC compare: the counter resets and the interrupt runs */
+    G_u32SimTick += u32TicksToCompare;
+    u32TicksLeft -= u32TicksToCompare;
+    G_sSimTc1.TC_CV = 0;
+
+    if(Sim_pfTimer1Callback != NULL)
+    {
+      Sim_pfTimer1Callback();
+    }
+  }
+
+  G_u32SimTick = TIMER_TICKS_PER_MS;
+  SimRenderTo();
+
+  /* A sector read finishes a fixed time after it was requested; sectors past the end of the image read as 0 */
+  if( (Sim_eSdState == SD_READING) && ((G_u32SystemTime1ms - Sim_u32SdReadTimer) >= (Sim_u32SdReadMs - 1)) )
+  {
+    memset(Sim_aau8SdBuffers[Sim_u8SdBuffer], 0, SIM_SD_SECTOR_SIZE);
+    if(fseek(Sim_pfSdImage, (long)Sim_u32SdSector * SIM_SD_SECTOR_SIZE, SEEK_SET) == 0)
+    {
+      if(fread(Sim_aau8SdBuffers[Sim_u8SdBuffer], 1, SIM_SD_SECTOR_SIZE, Sim_pfSdImage) == 0)
+      {
+        clearerr(Sim_pfSdImage);
+      }
+    }
+
+    Sim_eSdState = SD_DATA_READY;
+  }
+
+  G_u32SimTick = 0;
+  G_u32SystemTime1ms++;
+  if( (G_u32SystemTime1ms % 1000) == 0 )
+  {
+    G_u32SystemTime1s++;
+  }
+
+} /* end SimAdvance1ms() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLcdGetLine
+
+Description:
+Returns what one line of the LCD shows, as text.
+
+Requires:
+  - u8Line_ is 0 (line 1) or 1 (line 2)
+
+Promises:
+  - Returns the LCD_MAX_LINE_DISPLAY_SIZE characters on the screen, not terminated.  Custom characters
+    (codes 0x00 - 0x0F) are shown as the character Sim_asLcdGlyphs gives their rows in CGRAM, or
+    SIM_LCD_UNKNOWN_GLYPH if it has none.
+*/
+const u8* SimLcdGetLine(u8 u8Line_)
+{
+  u8* pu8Text = Sim_aau8LcdText[u8Line_];
+  const u8* pu8Rows;
+  u8 u8Code;
+
+  for(u8 i = 0; i < LCD_MAX_LINE_DISPLAY_SIZE; i++)
+  {
+    u8Code = Sim_aau8LcdRam[u8Line_][i];
+    pu8Text[i] = u8Code;
+    if(u8Code >= (LCD_CGRAM_CHAR_CODE + LCD_CGRAM_CHARS))
+    {
+      continue;
+    }
+
+    /* Codes 0x00 - 0x07 and 0x08 - 0x0F both show the 8 custom characters */
+    pu8Rows = &Sim_au8LcdCgram[(u8Code % LCD_CGRAM_CHARS) * LCD_CGRAM_CHAR_SIZE];
+    pu8Text[i] = SIM_LCD_UNKNOWN_GLYPH;
+    for(u8 j = 0; j < (sizeof(Sim_asLcdGlyphs) / sizeof(Sim_asLcdGlyphs[0])); j++)
+    {
+      if(memcmp(pu8Rows, Sim_asLcdGlyphs[j].au8Rows, LCD_CGRAM_CHAR_SIZE) == 0)
+      {
+        pu8Text[i] = Sim_asLcdGlyphs[j].cText;
+        break;
+      }
+    }
+  }
+
+  return pu8Text;
+
+} /* end SimLcdGetLine() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTwiSetFull
+
+Description:
+Fills the TWI queue, or empties it again.
+
+Requires:
+  - None
+
+Promises:
+  - While bFull_ is TRUE, TWI0WriteData() returns 0 and sends nothing, as on the board when all TX_QUEUE_SIZE
+    messages are waiting
+*/
+void SimTwiSetFull(bool bFull_)
+{
+  Sim_bTwiFull = bFull_;
+
+} /* end SimTwiSetFull() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLcdPowerUp
+
+Description:
+Powers the LCD up now, as on the board when LcdInitialize() takes it out of reset.
+
+Requires:
+  - None
+
+Promises:
+  - Commands and data that reach the LCD in the next SIM_LCD_POWER_UP_US are counted as sent while it was busy
+*/
+void SimLcdPowerUp(void)
+{
+  Sim_bLcdTable1 = FALSE;
+  Sim_u64LcdReadyUs = ((uint64_t)G_u32SystemTime1ms * 1000) + SIM_LCD_POWER_UP_US;
+  Sim_u32LcdBusyBytes = 0;
+
+} /* end SimLcdPowerUp() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLcdGetBusyBytes
+
+Description:
+Returns how many commands and data bytes reached the LCD before it was done with the ones before them, or
+before it had powered up.  The LCD would have missed them.
+*/
+u32 SimLcdGetBusyBytes(void)
+{
+  return Sim_u32LcdBusyBytes;
+
+} /* end SimLcdGetBusyBytes() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLcdReceive
+
+Description:
+The LCD controller taking one byte of a TWI transfer.  Each transfer starts with a control byte: RS
+(LCD_CONTROL_DATA) selects data or commands, and with Co (bit 7) clear every byte after it is of that kind
+up to the STOP.  With Co set only the next byte is, and another control byte follows it.
+Only the commands that change what is shown are carried out: clear, home and setting the display RAM or
+CGRAM address (CGRAM only in instruction table 0, where data then goes to CGRAM).  Function
+set and the voltage follower are followed for how long the LCD is busy after each command and data byte,
+which u64TimeUs_ (when the byte has been clocked in) is checked against.
+*/
+static void SimLcdReceive(u8 u8Byte_, uint64_t u64TimeUs_)
+{
+  u8 u8Line;
+  u8 u8Column;
+  u32 u32ExecuteUs = SIM_LCD_EXECUTE_US;
+
+  if(Sim_bLcdControlNext)
+  {
+    Sim_bLcdData = (u8Byte_ & LCD_CONTROL_DATA) ? TRUE : FALSE;
+    Sim_bLcdContinuation = (u8Byte_ & LCD_CONTROL_CONTINUE) ? TRUE : FALSE;
+    Sim_bLcdControlNext = FALSE;
+    return;
+  }
+
+  Sim_bLcdControlNext = Sim_bLcdContinuation;
+
+  if(u64TimeUs_ < Sim_u64LcdReadyUs)
+  {
+    Sim_u32LcdBusyBytes++;
+  }
+
+  if(Sim_bLcdData && Sim_bLcdCgram)
+  {
+    Sim_au8LcdCgram[Sim_u8LcdCgramAddress] = u8Byte_ & 0x1F;
+    Sim_u8LcdCgramAddress = (Sim_u8LcdCgramAddress + 1) % SIM_LCD_CGRAM_SIZE;
+    if((Sim_u8LcdCgramAddress % LCD_CGRAM_CHAR_SIZE) == 0)
+    {
+      G_sSimTwi.u32CgramChars++;
+    }
+  }
+  else if(Sim_bLcdData)
+  {
+    /* Data goes into the RAM at the address counter, which moves on to the next line after the last column */
+    u8Line = (Sim_u8LcdAddress >= LINE2_START_ADDR) ? 1 : 0;
+    u8Column = Sim_u8LcdAddress & ~LINE2_START_ADDR;
+    if(u8Column < SIM_LCD_LINE_RAM)
+    {
+      Sim_aau8LcdRam[u8Line][u8Column] = u8Byte_;
+    }
+
+    Sim_u8LcdAddress++;
+    if(Sim_u8LcdAddress == LINE1_END_ABSOLUTE + 1)
+    {
+      Sim_u8LcdAddress = LINE2_START_ADDR;
+    }
+    else if(Sim_u8LcdAddress == LINE2_END_ABSOLUTE + 1)
+    {
+      Sim_u8LcdAddress = LINE1_START_ADDR;
+    }
+  }
+  else if(u8Byte_ & LCD_ADDRESS_CMD)
+  {
+    Sim_u8LcdAddress = u8Byte_ & ~LCD_ADDRESS_CMD;
+    Sim_bLcdCgram = FALSE;
+  }
+  else if( !Sim_bLcdTable1 && ((u8Byte_ & 0xC0) == LCD_CGRAM_CMD) )
+  {
+    Sim_u8LcdCgramAddress = u8Byte_ & (SIM_LCD_CGRAM_SIZE - 1);
+    Sim_bLcdCgram = TRUE;
+  }
+  else if(u8Byte_ == LCD_CLEAR_CMD)
+  {
+    memset(Sim_aau8LcdRam, ' ', sizeof(Sim_aau8LcdRam));
+    Sim_u8LcdAddress = LINE1_START_ADDR;
+    Sim_bLcdCgram = FALSE;
+    u32ExecuteUs = SIM_LCD_CLEAR_US;
+  }
+  else if( (u8Byte_ & ~0x01) == LCD_HOME_CMD )
+  {
+    Sim_u8LcdAddress = LINE1_START_ADDR;
+    Sim_bLcdCgram = FALSE;
+    u32ExecuteUs = SIM_LCD_CLEAR_US;
+  }
+  else if( (u8Byte_ & 0xE0) == 0x20 )
+  {
+    /* Function set: IS (bit 0) selects instruction table 1, where 0x6X is follower control */
+    Sim_bLcdTable1 = (u8Byte_ & 0x01) ? TRUE : FALSE;
+  }
+  else if( Sim_bLcdTable1 && ((u8Byte_ & 0xF0) == 0x60) )
+  {
+    u32ExecuteUs = SIM_LCD_FOLLOWER_US;
+  }
+
+  if(u64TimeUs_ > Sim_u64LcdReadyUs)
+  {
+    Sim_u64LcdReadyUs = u64TimeUs_;
+  }
+  Sim_u64LcdReadyUs += u32ExecuteUs;
+
+} /* end SimLcdReceive() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Stubbed Board Functions (firmware_ascii/bsp/eief1-pcb-01.c) */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimGetBuzzer
+
+Description:
+Returns the emulated channel for BUZZER1 or BUZZER2, or NULL for any other channel.
+*/
+static SimBuzzerType* SimGetBuzzer(u32 u32Channel_, u8* pu8Index_)
+{
+  if(u32Channel_ == BUZZER1)
+  {
+    *pu8Index_ = 0;
+  }
+  else if(u32Channel_ == BUZZER2)
+  {
+    *pu8Index_ = 1;
+  }
+  else
+  {
+    return NULL;
+  }
+
+  return &G_asSimBuzzers[*pu8Index_];
+
+} /* end SimGetBuzzer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PWMAudioSetFrequency
+
+Description:
+Same calculation as the board: the period for the frequency is passed to PWMAudioSetPeriod().
+*/
+void PWMAudioSetFrequency(u32 u32Channel_, u16 u16Frequency_)
+{
+  PWMAudioSetPeriod(u32Channel_, CPRE_CLCK / u16Frequency_);
+
+} /* end PWMAudioSetFrequency() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PWMAudioSetPeriod
+
+Description:
+Latches the new period until the end of the current period if the channel is running, or sets it
+directly if it is not, like the CPRDUPDR / CPRDR registers.  The board writes the period and the duty cycle.
+*/
+void PWMAudioSetPeriod(u32 u32Channel_, u32 u32Period_)
+{
+  u8 u8Index;
+  SimBuzzerType* psBuzzer = SimGetBuzzer(u32Channel_, &u8Index);
+
+  if(psBuzzer == NULL)
+  {
+    return;
+  }
+
+  G_u32SimPwmWrites += SIM_PWM_PERIOD_WRITES;
+  SimRenderTo();
+
+  psBuzzer->u32UpdatePeriod = u32Period_ & 0xFFFF;
+  if(!psBuzzer->bOn)
+  {
+    psBuzzer->u32Period = psBuzzer->u32UpdatePeriod;
+  }
+
+  SimLogBuzzer(u8Index);
+
+} /* end PWMAudioSetPeriod() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PWMAudioOn
+
+Description:
+Enables the emulated channel.  The board writes PWMC_ENA even if the channel is already on.
+*/
+void PWMAudioOn(u32 u32Channel_)
+{
+  u8 u8Index;
+  SimBuzzerType* psBuzzer = SimGetBuzzer(u32Channel_, &u8Index);
+
+  if(psBuzzer == NULL)
+  {
+    return;
+  }
+
+  G_u32SimPwmWrites++;
+  if(psBuzzer->bOn)
+  {
+    return;
+  }
+
+  SimRenderTo();
+  psBuzzer->bOn = TRUE;
+  SimLogBuzzer(u8Index);
+
+} /* end PWMAudioOn() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: PWMAudioOff
+
+Description:
+Disables the emulated channel.  The board writes PWMC_DIS even if the channel is already off.
+*/
+void PWMAudioOff(u32 u32Channel_)
+{
+  u8 u8Index;
+  SimBuzzerType* psBuzzer = SimGetBuzzer(u32Channel_, &u8Index);
+
+  if(psBuzzer == NULL)
+  {
+    return;
+  }
+
+  G_u32SimPwmWrites++;
+  if(!psBuzzer->bOn)
+  {
+    return;
+  }
+
+  SimRenderTo();
+  psBuzzer->bOn = FALSE;
+  psBuzzer->u32Period = psBuzzer->u32UpdatePeriod;
+  SimLogBuzzer(u8Index);
+
+} /* end PWMAudioOff() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Stubbed Driver Functions (firmware_common/drivers) */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* LEDs keep the duty cycle they are set to, the PWM itself is not emulated */
+void LedOn(LedNumberType eLED_)
+{
+  G_u32SimLedWrites++;
+  if(eLED_ < SIM_NUM_LEDS)
+  {
+    G_asSimLeds[eLED_].eRate = LED_PWM_100;
+    G_asSimLeds[eLED_].bFading = FALSE;
+  }
+} /* end LedOn() */
+
+void LedOff(LedNumberType eLED_)
+{
+  G_u32SimLedWrites++;
+  if(eLED_ < SIM_NUM_LEDS)
+  {
+    G_asSimLeds[eLED_].eRate = LED_PWM_0;
+    G_asSimLeds[eLED_].bFading = FALSE;
+  }
+} /* end LedOff() */
+
+void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)
+{
+  G_u32SimLedWrites++;
+  if(eLED_ < SIM_NUM_LEDS)
+  {
+    G_asSimLeds[eLED_].eRate = ePwmRate_;
+    G_asSimLeds[eLED_].bFading = FALSE;
+  }
+} /* end LedPWM() */
+
+void LedFade(LedNumberType eLED_, LedRateType eStartRate_, u16 u16StepMs_)
+{
+  G_u32SimLedWrites++;
+  if(eLED_ < SIM_NUM_LEDS)
+  {
+    G_asSimLeds[eLED_].eRate = eStartRate_;
+    G_asSimLeds[eLED_].bFading = (eStartRate_ != LED_PWM_0);
+    G_asSimLeds[eLED_].u16FadeStepMs = u16StepMs_;
+    G_asSimLeds[eLED_].u16FadeCount = u16StepMs_;
+  }
+} /* end LedFade() */
+
+
+/* While initializing, TWIManualMode() sends each message before TWI0WriteData() returns.  Otherwise the TWI
+task starts a message on its next pass once the one before it is done, and finds it sent on the first pass
+after its bus time (at least the next one).  The LCD gets each byte as it is clocked in.
+A message after one without a STOP continues its transfer, so it has no START and no slave address of its own. */
+u32 TWI0WriteByte(u8 u8SlaveAddress_, u8 u8Byte_, TWIStopType Send_)
+{
+  return TWI0WriteData(u8SlaveAddress_, 1, &u8Byte_, Send_);
+} /* end TWI0WriteByte() */
+
+u32 TWI0WriteData(u8 u8SlaveAddress_, u32 u32Size_, u8* u8Data_, TWIStopType Send_)
+{
+  SimTwiMessageType* psMessage = &Sim_asTwiStatus[Sim_u8TwiStatusNext];
+  u32 u32BusBits = u32Size_ * SIM_TWI_BYTE_BITS;
+  u32 u32BusMs;
+  uint64_t u64StartUs;
+
+  if(Sim_bTwiFull)
+  {
+    return 0;
+  }
+
+  if(!Sim_bTwiTransferOpen)
+  {
+    G_sSimTwi.u32Transfers++;
+    G_sSimTwi.u32Bytes++;
+    Sim_bLcdControlNext = TRUE;
+    u32BusBits += SIM_TWI_BYTE_BITS + SIM_TWI_FRAME_BITS;
+  }
+
+  G_sSimTwi.u32Messages++;
+  G_sSimTwi.u32Bytes += u32Size_;
+  Sim_bTwiTransferOpen = (Send_ != STOP);
+
+  psMessage->u32Token = ++Sim_u32TwiToken;
+  if(G_u32SystemFlags & _SYSTEM_INITIALIZING)
+  {
+    psMessage->u32StartMs = G_u32SystemTime1ms;
+    psMessage->u32DoneMs = G_u32SystemTime1ms;
+  }
+  else
+  {
+    psMessage->u32StartMs = (Sim_u32TwiFreeMs > G_u32SystemTime1ms) ? Sim_u32TwiFreeMs : G_u32SystemTime1ms + 1;
+    u32BusMs = ((u32BusBits * SIM_TWI_BIT_NS) + 999999) / 1000000;
+    psMessage->u32DoneMs = psMessage->u32StartMs + ((u32BusMs > 1) ? u32BusMs : 1);
+    Sim_u32TwiFreeMs = psMessage->u32DoneMs + 1;
+  }
+  Sim_u8TwiStatusNext = (Sim_u8TwiStatusNext + 1) % SIM_TWI_STATUS_SIZE;
+
+  /* Messages sent in the same ms follow each other on the bus */
+  u64StartUs = (uint64_t)psMessage->u32StartMs * 1000;
+  if(u64StartUs < Sim_u64TwiFreeUs)
+  {
+    u64StartUs = Sim_u64TwiFreeUs;
+  }
+  Sim_u64TwiFreeUs = u64StartUs + ((u32BusBits * SIM_TWI_BIT_NS) / 1000);
+
+  if(u8SlaveAddress_ == LCD_ADDRESS)
+  {
+    u32BusBits -= u32Size_ * SIM_TWI_BYTE_BITS;
+    for(u32 i = 0; i < u32Size_; i++)
+    {
+      u32BusBits += SIM_TWI_BYTE_BITS;
+      SimLcdReceive(u8Data_[i], u64StartUs + ((u32BusBits * SIM_TWI_BIT_NS) / 1000));
+    }
+  }
+
+  return psMessage->u32Token;
+} /* end TWI0WriteData() */
+
+
+/* Same as messaging.c: a message's status is forgotten once it has been reported COMPLETE */
+MessageStateType QueryMessageStatus(u32 u32Token_)
+{
+  for(u8 i = 0; i < SIM_TWI_STATUS_SIZE; i++)
+  {
+    if( (u32Token_ != 0) && (Sim_asTwiStatus[i].u32Token == u32Token_) )
+    {
+      if(G_u32SystemTime1ms >= Sim_asTwiStatus[i].u32DoneMs)
+      {
+        Sim_asTwiStatus[i].u32Token = 0;
+        return COMPLETE;
+      }
+
+      return (G_u32SystemTime1ms >= Sim_asTwiStatus[i].u32StartMs) ? SENDING : WAITING;
+    }
+  }
+
+  return NOT_FOUND;
+} /* end QueryMessageStatus() */
+
+
+/* Buttons are never pressed; the simulator drives the player through its public functions */
+bool IsButtonPressed(u32 u32Button_)
+{
+  return FALSE;
+} /* end IsButtonPressed() */
+
+bool WasButtonPressed(u32 u32Button_)
+{
+  return FALSE;
+} /* end WasButtonPressed() */
+
+void ButtonAcknowledge(u32 u32Button_)
+{
+} /* end ButtonAcknowledge() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+SD card functions: same interface as sdcard.c, for reading only.  Reads go into a ring of buffers that can be
+lent to the client like sdcard.c, so a client that forgets to give one back runs out of reads here too.
+*/
+SdCardStateType SdGetStatus(void)
+{
+  return Sim_eSdState;
+} /* end SdGetStatus() */
+
+bool SdReadBlock(u32 u32SectorAddress_)
+{
+  if(Sim_eSdState != SD_IDLE)
+  {
+    return FALSE;
+  }
+
+  for(u8 i = 0; i < SIM_SD_READ_BUFFERS; i++)
+  {
+    if(!Sim_abSdBufferInUse[i])
+    {
+      Sim_abSdBufferInUse[i] = TRUE;
+      Sim_u8SdBuffer = i;
+      Sim_u32SdSector = u32SectorAddress_;
+      Sim_u32SdReadTimer = G_u32SystemTime1ms;
+      Sim_u32SdReads++;
+      Sim_eSdState = SD_READING;
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+} /* end SdReadBlock() */
+
+bool SdGetReadData(u8* pu8Destination_)
+{
+  u8* pu8Data = SdBorrowReadData();
+
+  if(pu8Data != NULL)
+  {
+    memcpy(pu8Destination_, pu8Data, SIM_SD_SECTOR_SIZE);
+    SdReleaseReadData(pu8Data);
+    return TRUE;
+  }
+
+  return FALSE;
+} /* end SdGetReadData() */
+
+u8* SdBorrowReadData(void)
+{
+  if(Sim_eSdState == SD_DATA_READY)
+  {
+    Sim_eSdState = SD_IDLE;
+    return Sim_aau8SdBuffers[Sim_u8SdBuffer];
+  }
+
+  return NULL;
+} /* end SdBorrowReadData() */
+
+void SdReleaseReadData(u8* pu8Data_)
+{
+  for(u8 i = 0; i < SIM_SD_READ_BUFFERS; i++)
+  {
+    if(pu8Data_ == Sim_aau8SdBuffers[i])
+    {
+      Sim_abSdBufferInUse[i] = FALSE;
+    }
+  }
+} /* end SdReleaseReadData() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: IsTimeUp
+
+Description:
+Same as utilities.c.  While initializing, nothing but the code asking runs until the time is up, and the
+SysTick interrupt keeps counting: a ms passes each time the answer is no.
+*/
+bool IsTimeUp(u32 *pu32SavedTick_, u32 u32Period_)
+{
+  u32 u32TimeElapsed;
+
+  /* Check to see if the timer in question has rolled */
+  if(G_u32SystemTime1ms >= *pu32SavedTick_)
+  {
+    u32TimeElapsed = G_u32SystemTime1ms - *pu32SavedTick_;
+  }
+  else
+  {
+    u32TimeElapsed = (0xFFFFFFFF - *pu32SavedTick_) + G_u32SystemTime1ms;
+  }
+
+  /* Now determine if time is up */
+  if(u32TimeElapsed < u32Period_)
+  {
+    if(G_u32SystemFlags & _SYSTEM_INITIALIZING)
+    {
+      SimAdvance1ms();
+    }
+
+    return(FALSE);
+  }
+  else
+  {
+    return(TRUE);
+  }
+
+} /* end IsTimeUp() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Timer functions: same behaviour as timer.c for TIMER_CHANNEL1.  Other channels are ignored.
+*/
+void TimerSet(TimerChannelType eTimerChannel_, u16 u16TimerValue_)
+{
+  if(eTimerChannel_ == TIMER_CHANNEL1)
+  {
+    G_sSimTc1.TC_RC = u16TimerValue_;
+  }
+} /* end TimerSet() */
+
+void TimerStart(TimerChannelType eTimerChannel_)
+{
+  /* CLKEN | SWTRG: the counter restarts from 0 */
+  if(eTimerChannel_ == TIMER_CHANNEL1)
+  {
+    G_sSimTc1.TC_CV = 0;
+    Sim_bTimer1Running = TRUE;
+  }
+} /* end TimerStart() */
+
+void TimerStop(TimerChannelType eTimerChannel_)
+{
+  /* CLKDIS: the counter holds its value */
+  if(eTimerChannel_ == TIMER_CHANNEL1)
+  {
+    Sim_bTimer1Running = FALSE;
+  }
+} /* end TimerStop() */
+
+u16 TimerGetTime(TimerChannelType eTimerChannel_)
+{
+  if(eTimerChannel_ == TIMER_CHANNEL1)
+  {
+    return (u16)G_sSimTc1.TC_CV;
+  }
+
+  return 0;
+} /* end TimerGetTime() */
+
+void TimerAssignCallback(TimerChannelType eTimerChannel_, fnCode_type fpUserCallback_)
+{
+  if(eTimerChannel_ == TIMER_CHANNEL1)
+  {
+    Sim_pfTimer1Callback = fpUserCallback_;
+  }
+} /* end TimerAssignCallback() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Stubbed Application Functions (firmware_common/application/ant_channel.c) */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* No ANT radio is emulated, so the channel never opens */
+AntChannelConnectionType AntChannelGetConnection(void)
+{
+  return ANT_CHANNEL_CLOSED;
+} /* end AntChannelGetConnection() */
+
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,151 @@
+/***********************************************************************************************************************
+File: configuration.h (host simulator)
+
+Description:
+Stands in for firmware_common/configuration.h when the music player is built for the host.
+The simulator's include path puts this directory first, so music_player.c, song_stream.c, fat32.c, songs.h,
+lcd_control.c and the LCD driver compile unchanged against the types, board definitions and driver stubs
+declared here instead of the SAM3U headers.  Only what those files use is provided.
+***********************************************************************************************************************/
+
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************************************************
+Type definitions (same names as typedefs.h, but fixed to the target's sizes so u32 stays 32 bits on a 64-bit host)
+***********************************************************************************************************************/
+typedef int32_t  s32;
+typedef int16_t  s16;
+typedef int8_t   s8;
+
+typedef uint32_t u32;
+typedef uint16_t u16;
+typedef uint8_t  u8;
+
+typedef void(*fnCode_type)(void);
+
+typedef enum {FALSE = 0, TRUE = !FALSE} bool;
+
+#define _SYSTEM_INITIALIZING  (u32)0x80000000 /* Same as main.h */
+#define _APPLICATION_FLAGS_LCD 0x00000008
+
+
+/***********************************************************************************************************************
+Board definitions (same values as the EIE1 definitions in firmware_common/configuration.h)
+***********************************************************************************************************************/
+#define BUTTON0               (u32)0
+#define BUTTON1               (u32)1
+#define BUTTON2               (u32)2
+#define BUTTON3               (u32)3
+
+#define BUZZER1               (u32)0x1      /* AT91C_PWMC_CHID0, the right buzzer */
+#define BUZZER2               (u32)0x2      /* AT91C_PWMC_CHID1, the left buzzer */
+
+#define CPRE_CLCK             (u32)6000000  /* PWM channel clock: 48MHz / CPRE_CLCK_SCALE */
+
+typedef enum {WHITE = 0, PURPLE, BLUE, CYAN, GREEN, YELLOW, ORANGE, RED, LCD_RED, LCD_GREEN, LCD_BLUE} LedNumberType;
+
+typedef enum {LED_PWM_0 = 0, LED_PWM_5 = 1, LED_PWM_10 = 2, LED_PWM_15 = 3, LED_PWM_20 = 4,
+              LED_PWM_25 = 5, LED_PWM_30 = 6, LED_PWM_35 = 7, LED_PWM_40 = 8, LED_PWM_45 = 9,
+              LED_PWM_50 = 10, LED_PWM_55 = 11, LED_PWM_60 = 12, LED_PWM_65 = 13, LED_PWM_70 = 14,
+              LED_PWM_75 = 15, LED_PWM_80 = 16, LED_PWM_85 = 17, LED_PWM_90 = 18, LED_PWM_95 = 19,
+              LED_PWM_100 = 20
+             } LedRateType;
+
+/* Only TIMER_CHANNEL1 is emulated */
+typedef enum {TIMER_CHANNEL0 = 0, TIMER_CHANNEL1 = 0x40, TIMER_CHANNEL2 = 0x80} TimerChannelType;
+
+#define TIMER_TICKS_PER_MS    (u32)375      /* TC1 runs from TIMER_CLOCK4 (MCK/128) */
+
+/* The registers of the emulated TC1 that the music player reads directly */
+typedef struct
+{
+  u32 TC_CV;                                /* Counter value */
+  u32 TC_RC;                                /* Register C: the counter resets and interrupts when it reaches this */
+} SimTcType;
+
+extern SimTcType G_sSimTc1;
+
+#define AT91C_BASE_TC1        (&G_sSimTc1)
+
+/* Port B, where the LCD reset line is */
+typedef struct
+{
+  u32 PIO_SODR;                             /* Set output data register */
+  u32 PIO_CODR;                             /* Clear output data register */
+} SimPioType;
+
+extern SimPioType G_sSimPioB;
+
+#define AT91C_BASE_PIOB       (&G_sSimPioB)
+#define PB_09_LCD_RST         (u32)0x00000200
+
+/* Same as sam3u_i2c.h; TWI0 is emulated with the LCD as its only slave */
+typedef enum {STOP, NO_STOP, NA} TWIStopType;
+
+/* Same as messaging.h; only TWI0 messages have a status */
+typedef enum {EMPTY = 0, WAITING, SENDING, RECEIVING, COMPLETE, TIMEOUT, ABANDONED, NOT_FOUND = 0xff} MessageStateType;
+
+/* Same states as sdcard.h; the card is emulated from a disk image file */
+typedef enum {SD_NO_CARD, SD_CARD_ERROR, SD_IDLE, SD_READING, SD_DATA_READY, SD_WRITING} SdCardStateType;
+
+
+/***********************************************************************************************************************
+Stubbed driver functions (board_stubs.c)
+***********************************************************************************************************************/
+void PWMAudioSetFrequency(u32 u32Channel_, u16 u16Frequency_);
+void PWMAudioSetPeriod(u32 u32Channel_, u32 u32Period_);
+void PWMAudioOn(u32 u32Channel_);
+void PWMAudioOff(u32 u32Channel_);
+
+void LedOn(LedNumberType eLED_);
+void LedOff(LedNumberType eLED_);
+void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_);
+void LedFade(LedNumberType eLED_, LedRateType eStartRate_, u16 u16StepMs_);
+
+bool IsButtonPressed(u32 u32Button_);
+bool WasButtonPressed(u32 u32Button_);
+void ButtonAcknowledge(u32 u32Button_);
+
+bool IsTimeUp(u32 *pu32SavedTick_, u32 u32Period_);
+
+u32 TWI0WriteByte(u8 u8SlaveAddress_, u8 u8Byte_, TWIStopType Send_);
+u32 TWI0WriteData(u8 u8SlaveAddress_, u32 u32Size_, u8* u8Data_, TWIStopType Send_);
+MessageStateType QueryMessageStatus(u32 u32Token_);
+
+void TimerSet(TimerChannelType eTimerChannel_, u16 u16TimerValue_);
+void TimerStart(TimerChannelType eTimerChannel_);
+void TimerStop(TimerChannelType eTimerChannel_);
+u16 TimerGetTime(TimerChannelType eTimerChannel_);
+void TimerAssignCallback(TimerChannelType eTimerChannel_, fnCode_type fpUserCallback_);
+
+SdCardStateType SdGetStatus(void);
+bool SdReadBlock(u32 u32SectorAddress_);
+bool SdGetReadData(u8* pu8Destination_);
+u8* SdBorrowReadData(void);
+void SdReleaseReadData(u8* pu8Data_);
+
+
+/***********************************************************************************************************************
+Driver header files (fat32.c and the LCD driver are built from the firmware and use the emulated card and TWI
+through the stubs above)
+***********************************************************************************************************************/
+#include "fat32.h"
+#include "lcd_nhd-c0220biz.h"
+
+
+/***********************************************************************************************************************
+Application header files
+***********************************************************************************************************************/
+#include "version.h"
+#include "ant_channel.h"
+#include "lcd_control.h"
+#include "music_player.h"
+#include "song_stream.h"
+#include "music_sim.h"
+
+#endif /* __CONFIG_H */
@@ -0,0 +1,2499 @@
+/***********************************************************************************************************************
+File: music_sim.c
+
+Description:
+Host simulator for the music player.  Runs the unmodified music_player.c, song_stream.c, songs.h and
+lcd_control.c against the emulated board in board_stubs.c, as fast as the host allows, and for every song in
+song_list, then every song on the emulated SD card, writes:
+  - songN.wav: the two buzzers rendered as square waves (left channel = BUZZER2, right channel = BUZZER1)
+  - songN_timeline.txt: every note edge on each buzzer, to diff against a previous run
+  - songN_leds.txt: every change in the duty cycle of each LED, to diff the LED displays the same way
+  - songN_lcd.txt: every change to what each line of the LCD shows
+It prints how many bytes the LCD task sent over TWI for each song and per minute of music.
+
+Usage: music_sim [-o <output folder>] [-r <sample rate>] [-t <tempo>] [-n] [-v] [-d <card image> [-l <ms>]]
+       music_sim -w <card image>
+       music_sim -s
+       music_sim -b
+       music_sim -c
+       music_sim -p [-t <tempo>]
+       music_sim -j [-t <tempo>]
+       music_sim -f
+  -o  Folder for the output files (default: current folder)
+  -r  WAV sample rate in Hz (default: 22050)
+  -t  Tempo in percent, see MusicPlayerSetTempo() (default: 100)
+  -n  Only write the timelines and LED traces, no WAV files
+  -v  Show the spectrum display on the LEDs instead of the pitch display, see MusicPlayerSetLedDisplay()
+  -d  Insert an SD card with this disk image and play its songs after the ones in flash.  The image is either
+      the library written from sector 0 (-w, sd_image.py) or a FAT32 volume with SONGS.LIB (fat_image.py)
+  -l  Time in ms each SD card sector read takes (default: SIM_SD_DEFAULT_READ_MS)
+  -w  Write the songs in songs.h to an SD card disk image (see song_stream.h), then exit
+  -s  Check that seeking in every song in flash sounds the same as playing up to the position, time the
+      worst case seek in the longest song, then exit
+  -b  Boot the board from power-up with play pressed, print when the first note sounds and when the LCD
+      was ready, check that nothing reached the LCD while it was busy, then exit
+  -c  Time the LCD task setting up and scrolling the longest titles, check what it scrolls and that it
+      catches up after a full TWI queue, then exit
+  -p  Play every song in flash and print the PWM register writes the player makes against the polled player
+      and how long its passes take on this host, what loading a note costs and how long a tempo change takes,
+      then exit
+  -j  Play every song in flash on time, then again with the main loop running late now and then, and print
+      how far each note edge moved, then exit
+  -f  Check note_period_table against dividing CPRE_CLCK by note_freq_table for every MIDI note, and that
+      every note the songs in flash play has a period, time the division and the table on this host, then exit
+***********************************************************************************************************************/
+
+#include "configuration.h"
+#include "songs.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/***********************************************************************************************************************
+Constants / Definitions
+***********************************************************************************************************************/
+#define SIM_DEFAULT_SAMPLE_RATE   (u32)22050
+#define SIM_AMPLITUDE             (s16)8000     /* Level of one buzzer, so both together cannot clip */
+#define SIM_WAV_HEADER_SIZE       (u32)44
+#define SIM_WAV_BUFFER_FRAMES     (u32)4096     /* Stereo frames buffered before each write */
+#define SIM_MAX_PATH              (u32)512
+#define SIM_SEEK_CHECK_STEP_MS    (u32)997      /* Positions checked after seeking, prime so they land all over the notes */
+#define SIM_SEEK_CHECK_MS         (u32)1000     /* Song time compared with playing from the start after each seek */
+#define SIM_SEEK_TIMING_REPEATS   (u32)200      /* Seeks timed at each worst case position, to average out the host */
+#define SIM_BOOT_MS               (u32)3000     /* Time from power-up run by -b */
+#define SIM_TITLE_SONGS           (u8)3         /* Songs with the longest titles timed by -c */
+#define SIM_TITLE_REPEATS         (u32)2000     /* Title setups and scroll steps timed for each of them */
+#define SIM_TITLE_SCROLL_MS       (u32)200      /* Same as LCD_SCROLL_UPDATE_TIME_MS in lcd_control.c */
+#define SIM_TITLE_FREEZE_MS       (u32)1000     /* Same as LCD_NEW_TITLE_FREEZE_DELAY_MS in lcd_control.c */
+#define SIM_TITLE_GAP             "     "       /* Spaces lcd_control.c scrolls between the end and the start of a title */
+#define SIM_TITLE_SIZE            (u32)128      /* Longest "title - artist" checked, with the gap */
+#define SIM_POLLED_PWM_WRITES     (u32)6        /* The polled player's PWMAudioSetFrequency() and PWMAudioOn() for both buzzers every pass */
+#define SIM_TEMPO_TIMING_REPEATS  (u32)10000    /* Tempo changes timed by -p */
+#define SIM_PASS_MAX_NS           (u32)4000     /* -p leaves out player passes that took this long: the host interrupted them */
+#define SIM_JITTER_PERIOD_MS      (u32)97       /* -j runs a main loop pass late this often, prime so it lands all over the notes */
+#define SIM_JITTER_MAX_LATE_MS    (u32)4        /* How late: 1 ms, then 2 ms, up to this, then 1 ms again */
+#define SIM_JITTER_MAX_EDGES      (u32)65536    /* Note edges recorded for each song */
+#define SIM_PERIOD_TIMING_REPEATS (u32)100000   /* Times -f looks up and divides out the period of every MIDI note */
+#define SIM_POLLED_DIVISIONS      (u32)2        /* The polled player's PWMAudioSetFrequency() for both buzzers every pass */
+
+#if MUSIC_PLAYER_TIMER_SEQUENCER
+#define SIM_SEQUENCER_NAME        "TC1 sequencer"
+#else
+#define SIM_SEQUENCER_NAME        "main loop player"
+#endif
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+extern volatile u32 G_u32SystemFlags;                  /* From board_stubs.c */
+extern volatile u32 G_u32ApplicationFlags;             /* From board_stubs.c */
+extern volatile u32 G_u32SystemTime1ms;                /* From board_stubs.c */
+extern SimBuzzerType G_asSimBuzzers[SIM_NUM_BUZZERS];  /* From board_stubs.c */
+extern u32 G_u32SimTick;                               /* From board_stubs.c */
+extern u32 G_u32SimLedWrites;                          /* From board_stubs.c */
+extern u32 G_u32SimPwmWrites;                          /* From board_stubs.c */
+extern volatile u32 G_u32LcdFlags;                     /* From lcd_nhd-c0220biz.c */
+extern SimLedType G_asSimLeds[SIM_NUM_LEDS];           /* From board_stubs.c */
+extern SimTwiType G_sSimTwi;                           /* From board_stubs.c */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "Sim_" and be declared as static.
+***********************************************************************************************************************/
+static u32 Sim_u32SampleRate = SIM_DEFAULT_SAMPLE_RATE;
+static bool Sim_bWriteWav = TRUE;
+
+static FILE* Sim_pfWav = NULL;                         /* WAV file of the song being rendered */
+static FILE* Sim_pfTimeline = NULL;                    /* Timeline file of the song being rendered */
+static FILE* Sim_pfLeds = NULL;                        /* LED trace file of the song being rendered */
+static FILE* Sim_pfLcd = NULL;                         /* LCD trace file of the song being rendered */
+static u32 Sim_u32SongStartTime = 0;                   /* G_u32SystemTime1ms when the song started */
+static uint64_t Sim_u64SamplesRendered = 0;            /* Stereo frames written for the song so far */
+static u32 Sim_u32EdgeCount = 0;                       /* Note edges logged for the song so far */
+
+static uint64_t Sim_au64Phase[SIM_NUM_BUZZERS];        /* Position in each buzzer's period, in 1/sample rate CPRE_CLCK cycles */
+static bool Sim_abLoggedOn[SIM_NUM_BUZZERS];           /* Last buzzer state written to the timeline */
+static u32 Sim_au32LoggedPeriod[SIM_NUM_BUZZERS];
+static LedRateType Sim_aeLoggedLedRate[SIM_NUM_LEDS];  /* Last LED duty cycle written to the LED trace */
+static u8 Sim_aau8LoggedLcd[SIM_LCD_LINES][LCD_MAX_LINE_DISPLAY_SIZE]; /* Last LCD lines written to the LCD trace */
+
+static const char* const Sim_apcLedNames[SIM_NUM_LEDS] = {"white", "purple", "blue", "cyan", "green", "yellow", "orange", "red"};
+
+static s16 Sim_as16WavBuffer[SIM_WAV_BUFFER_FRAMES * 2];
+static u32 Sim_u32WavBufferFrames = 0;
+
+static u16 Sim_u16Tempo = 100;                         /* Tempo the songs are played at, in percent */
+static u32 Sim_u32TotalMs = 0;                         /* Music simulated so far */
+static SimTwiType Sim_sTwiTotal;                       /* TWI traffic of every song so far */
+static double Sim_dPlayerPassNs = 0;                   /* Time the player's last pass took on this host */
+static SimEdgeType* Sim_pasEdges = NULL;               /* Where SimLogBuzzer() records note edges for -j, or NULL */
+
+
+/***********************************************************************************************************************
+Function Declarations
+***********************************************************************************************************************/
+static bool SimPlaySong(const char* pcFolder_, u16 u16Song_, const char* pcTitle_, const char* pcArtist_,
+                        u32 u32LengthMs_, fnCode_type pfStart_);
+static void SimRunPlayer1ms(void);
+static double SimTimePlayerPassNs(void);
+static bool SimProfilePlayer(void);
+static bool SimCheckJitter(void);
+static bool SimRecordEdges(SimEdgeType* pasEdges_, u32 u32LengthMs_, bool bLate_, u32* pu32Edges_);
+static bool SimCompareEdges(const SimEdgeType* pasReference_, u32 u32Edges_, const SimEdgeType* pasLate_, u32 u32LateEdges_,
+                            u8 u8Buzzer_, u32* pu32Moved_, u32* pu32Dropped_, u32* pu32WorstError_);
+static u32 SimFindEdge(const SimEdgeType* pasEdges_, u32 u32Edges_, u32 u32From_, const SimEdgeType* psEdge_);
+static u32 SimGetEdgeError(const SimEdgeType* psEdge1_, const SimEdgeType* psEdge2_);
+static bool SimCheckPeriods(void);
+static void SimTimePeriods(void);
+static void SimLogLcd(void);
+static bool SimMeasureBoot(void);
+static bool SimTimeLcdTitles(void);
+static bool SimCheckLcdFullQueue(void);
+static double SimTimeLcdPassNs(void);
+static void SimSelectSong(u16 u16Song_);
+static u32 SimGetSongLengthMs(const SongInfoType* psSong_);
+static u32 SimGetNoteStarts(const SongInfoType* psSong_, u8 u8Voice_, u32** ppu32Starts_);
+static bool SimCheckSeeking(void);
+static bool SimCheckSeek(u8 u8Song_, const u32* pu32Reference_, u32 u32Position_);
+static u32 SimCountSeekNotes(const SongInfoType* psSong_, const u32* const* apu32Starts_, const u32* au32Notes_, u32 u32Position_);
+static double SimTimeSeekNs(u32 u32Position_, u32 u32Repeats_);
+static u32 SimGetStreamedSongLengthMs(FILE* pfImage_, u16 u16Song_);
+static FILE* SimOpenCardLibrary(const char* pcImage_);
+static char* SimReadCardTitles(u16 u16Songs_);
+static bool SimWriteCardImage(const char* pcImage_);
+static u32 SimWriteStringToImage(FILE* pfImage_, u32 u32StringsSector_, u32* pu32Offset_, const char* pcText_);
+static u32 SimWriteSongToImage(FILE* pfImage_, u32 u32Sector_, const SongInfoType* psSong_);
+static void SimPutU16(u8* pu8Bytes_, u16 u16Value_);
+static void SimPutU32(u8* pu8Bytes_, u32 u32Value_);
+static u32 SimReadU32(FILE* pfFile_, long lOffset_);
+static bool SimOpenSong(const char* pcFolder_, u16 u16Song_, const char* pcTitle_, const char* pcArtist_, u32 u32LengthMs_);
+static void SimCloseSong(void);
+static void SimFlushWav(void);
+static void SimWriteU16(FILE* pfFile_, u16 u16Value_);
+static void SimWriteU32(FILE* pfFile_, u32 u32Value_);
+static void SimWriteWavHeader(u32 u32DataSize_);
+
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+
+Description:
+Plays every song from start to end once, the same way the board's main loop runs the player: one pass
+of the state machine, then one ms of hardware time.
+*/
+int main(int argc, char* argv[])
+{
+  const char* pcFolder = ".";
+  const char* pcCardImage = NULL;
+  u32 u32SdReadMs = SIM_SD_DEFAULT_READ_MS;
+  FILE* pfCardImage;
+  u16 u16CardSongs;
+  u32 u32LengthMs;
+  u32 u32LoadMs;
+  u32 u32Underruns;
+  u32 u32CardReads;
+  u32 u32FatReads;
+  u32 u32TitleMs = 0;
+  bool bTitleReady;
+  const char* pcTitle = NULL;
+  const char* pcArtist = NULL;
+  char* pcCardTitles;
+  const char* pcIndexTitle;
+  bool bCheckSeeking = FALSE;
+  bool bSpectrum = FALSE;
+  bool bMeasureBoot = FALSE;
+  bool bTimeTitles = FALSE;
+  bool bProfile = FALSE;
+  bool bCheckJitter = FALSE;
+  bool bCheckPeriods = FALSE;
+  clock_t StartClock;
+  double dSeconds;
+  double dBusMs;
+
+  for(int i = 1; i < argc; i++)
+  {
+    if( (strcmp(argv[i], "-o") == 0) && (i + 1 < argc) )
+    {
+      pcFolder = argv[++i];
+    }
+    else if( (strcmp(argv[i], "-r") == 0) && (i + 1 < argc) )
+    {
+      Sim_u32SampleRate = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if( (strcmp(argv[i], "-t") == 0) && (i + 1 < argc) )
+    {
+      Sim_u16Tempo = (u16)strtoul(argv[++i], NULL, 10);
+    }
+    else if(strcmp(argv[i], "-n") == 0)
+    {
+      Sim_bWriteWav = FALSE;
+    }
+    else if(strcmp(argv[i], "-v") == 0)
+    {
+      bSpectrum = TRUE;
+    }
+    else if( (strcmp(argv[i], "-d") == 0) && (i + 1 < argc) )
+    {
+      pcCardImage = argv[++i];
+    }
+    else if( (strcmp(argv[i], "-l") == 0) && (i + 1 < argc) )
+    {
+      u32SdReadMs = (u32)strtoul(argv[++i], NULL, 10);
+    }
+    else if( (strcmp(argv[i], "-w") == 0) && (i + 1 < argc) )
+    {
+      return SimWriteCardImage(argv[++i]) ? 0 : 1;
+    }
+    else if(strcmp(argv[i], "-s") == 0)
+    {
+      bCheckSeeking = TRUE;
+    }
+    else if(strcmp(argv[i], "-b") == 0)
+    {
+      bMeasureBoot = TRUE;
+    }
+    else if(strcmp(argv[i], "-c") == 0)
+    {
+      bTimeTitles = TRUE;
+    }
+    else if(strcmp(argv[i], "-p") == 0)
+    {
+      bProfile = TRUE;
+    }
+    else if(strcmp(argv[i], "-j") == 0)
+    {
+      bCheckJitter = TRUE;
+    }
+    else if(strcmp(argv[i], "-f") == 0)
+    {
+      bCheckPeriods = TRUE;
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [-o <output folder>] [-r <sample rate>] [-t <tempo>] [-n] [-v] [-d <card image> [-l <ms>]]\n", argv[0]);
+      fprintf(stderr, "       %s -w <card image>\n", argv[0]);
+      fprintf(stderr, "       %s -s\n", argv[0]);
+      fprintf(stderr, "       %s -b\n", argv[0]);
+      fprintf(stderr, "       %s -c\n", argv[0]);
+      fprintf(stderr, "       %s -p [-t <tempo>]\n", argv[0]);
+      fprintf(stderr, "       %s -j [-t <tempo>]\n", argv[0]);
+      fprintf(stderr, "       %s -f\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if( (Sim_u32SampleRate == 0) || (Sim_u32SampleRate > 192000) )
+  {
+    fprintf(stderr, "Sample rate must be 1 - 192000 Hz\n");
+    return 1;
+  }
+
+  SimBoardReset();
+  if( (pcCardImage != NULL) && !SimSdInsert(pcCardImage, u32SdReadMs) )
+  {
+    return 1;
+  }
+
+  if(bMeasureBoot)
+  {
+    return SimMeasureBoot() ? 0 : 1;
+  }
+
+  if(bCheckPeriods)
+  {
+    return SimCheckPeriods() ? 0 : 1;
+  }
+
+  /* The songs start with the LCD up, as it is on the board once LcdRunActiveState() has brought it up: the
+  LCD task shows its banner before the first song */
+  G_u32LcdFlags |= _LCD_FLAGS_READY;
+  FatInitialize();
+  LcdControlInitialize();
+  SongStreamInitialize();
+  MusicPlayerInitialize();
+  LcdControlRunActiveState();
+  MusicPlayerSetTempo(Sim_u16Tempo);
+  Sim_u16Tempo = MusicPlayerGetTempo();
+  if(bSpectrum)
+  {
+    MusicPlayerSetLedDisplay(MUSIC_LED_SPECTRUM);
+  }
+
+  if(bCheckSeeking)
+  {
+    return SimCheckSeeking() ? 0 : 1;
+  }
+
+  if(bTimeTitles)
+  {
+    return (SimTimeLcdTitles() && SimCheckLcdFullQueue()) ? 0 : 1;
+  }
+
+  if(bProfile)
+  {
+    return SimProfilePlayer() ? 0 : 1;
+  }
+
+  if(bCheckJitter)
+  {
+    return SimCheckJitter() ? 0 : 1;
+  }
+
+  StartClock = clock();
+
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    /* The player starts paused on the first song; every other song is reached with "next" */
+    if(!SimPlaySong(pcFolder, u8Song, song_list[u8Song]->title, song_list[u8Song]->artist, SimGetSongLengthMs(song_list[u8Song]),
+                    (u8Song == 0) ? MusicPlayerTogglePlayPause : MusicPlayerNextSong))
+    {
+      return 1;
+    }
+  }
+
+  /* The card's library has been read while the flash songs played; its songs come next */
+  u16CardSongs = SongStreamGetSongCount();
+  if(pcCardImage != NULL)
+  {
+    pfCardImage = SimOpenCardLibrary(pcCardImage);
+    if(pfCardImage == NULL)
+    {
+      return 1;
+    }
+
+    if(FatGetStatus() == FAT_FILE_OPEN)
+    {
+      printf("SD card: FAT32, %s mounted and opened with %lu sector reads, %lu songs\n", SONG_LIBRARY_FILE,
+             (unsigned long)FatGetSectorReads(), (unsigned long)u16CardSongs);
+    }
+    else if(FatGetStatus() == FAT_IDLE)
+    {
+      printf("SD card: raw library, %lu songs\n", (unsigned long)u16CardSongs);
+    }
+    else
+    {
+      printf("SD card: no song library, %s\n", (FatGetStatus() == FAT_NOT_FOUND) ? "no " SONG_LIBRARY_FILE :
+             (FatGetStatus() == FAT_NO_VOLUME) ? "no FAT32 file system" : "file system error");
+    }
+
+    pcCardTitles = SimReadCardTitles(u16CardSongs);
+    if(pcCardTitles == NULL)
+    {
+      return 1;
+    }
+
+    for(u16 u16CardSong = 0; u16CardSong < u16CardSongs; u16CardSong++)
+    {
+      /* Run until the song's first sectors are in; it starts on the player's next pass.  Its title is asked
+      for every pass from the card's index, as the LCD task does before the song task runs. */
+      u32CardReads = SimSdGetReads();
+      u32FatReads = FatGetSectorReads();
+      MusicPlayerNextSong();
+      bTitleReady = FALSE;
+      for(u32LoadMs = 0; SongStreamGetStatus() == SONG_STREAM_OPENING; u32LoadMs++)
+      {
+        if( !bTitleReady && MusicPlayerGetSongInfo(MusicPlayerGetSelectedSongIndex(), &pcTitle, &pcArtist) )
+        {
+          bTitleReady = TRUE;
+          u32TitleMs = u32LoadMs;
+        }
+
+        SimRunPlayer1ms();
+      }
+
+      if(SongStreamGetStatus() != SONG_STREAM_OPEN)
+      {
+        fprintf(stderr, "Card song %u could not be opened\n", u16CardSong + 1);
+        return 1;
+      }
+
+      u32CardReads = SimSdGetReads() - u32CardReads;
+      u32FatReads = FatGetSectorReads() - u32FatReads;
+
+      /* The title shown while loading and the one in the index must both be the song's own */
+      pcIndexTitle = &pcCardTitles[u16CardSong * 2 * SONG_STREAM_TEXT_SIZE];
+      if( !bTitleReady || (strcmp(pcTitle, SongStreamGetTitle()) != 0) || (strcmp(pcArtist, SongStreamGetArtist()) != 0) ||
+          (strcmp(pcIndexTitle, SongStreamGetTitle()) != 0) ||
+          (strcmp(pcIndexTitle + SONG_STREAM_TEXT_SIZE, SongStreamGetArtist()) != 0) )
+      {
+        fprintf(stderr, "Card song %u: title and artist in the index do not match the song\n", u16CardSong + 1);
+        return 1;
+      }
+      u32LengthMs = SimGetStreamedSongLengthMs(pfCardImage, u16CardSong);
+      u32Underruns = SongStreamGetUnderruns();
+
+      if(!SimPlaySong(pcFolder, SONG_LIST_SIZE + u16CardSong, SongStreamGetTitle(), SongStreamGetArtist(), u32LengthMs, NULL))
+      {
+        return 1;
+      }
+
+      printf("  from the SD card: title in %lu ms, loaded in %lu ms with %lu sector reads (%lu of the file system), %lu underruns\n",
+             (unsigned long)u32TitleMs, (unsigned long)u32LoadMs, (unsigned long)u32CardReads, (unsigned long)u32FatReads,
+             (unsigned long)(SongStreamGetUnderruns() - u32Underruns));
+    }
+
+    free(pcCardTitles);
+    fclose(pfCardImage);
+  }
+
+  dSeconds = (double)(clock() - StartClock) / CLOCKS_PER_SEC;
+  dBusMs = ( ((double)Sim_sTwiTotal.u32Bytes * SIM_TWI_BYTE_BITS) + ((double)Sim_sTwiTotal.u32Transfers * SIM_TWI_FRAME_BITS) ) *
+           SIM_TWI_BIT_NS / 1000000.0;
+  printf("LCD: %.0f TWI bytes in %.1f messages and %.1f transfers per minute, %.1f ms of bus time, "
+         "%.1f custom characters uploaded\n",
+         (Sim_sTwiTotal.u32Bytes * 60000.0) / Sim_u32TotalMs, (Sim_sTwiTotal.u32Messages * 60000.0) / Sim_u32TotalMs,
+         (Sim_sTwiTotal.u32Transfers * 60000.0) / Sim_u32TotalMs, (dBusMs * 60000.0) / Sim_u32TotalMs,
+         (Sim_sTwiTotal.u32CgramChars * 60000.0) / Sim_u32TotalMs);
+  printf("%u songs, %.1f s of music simulated in %.2f s\n", (unsigned)(SONG_LIST_SIZE + ((pcCardImage != NULL) ? u16CardSongs : 0)),
+         Sim_u32TotalMs / 1000.0, dSeconds);
+
+  return 0;
+
+} /* end main() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimPlaySong
+
+Description:
+Plays one song for its whole length, stretched to the tempo, and writes its output files.
+pfStart_ is called once the files are open to start the song, or is NULL if the song has already been started.
+Returns FALSE if a file cannot be opened.
+*/
+static bool SimPlaySong(const char* pcFolder_, u16 u16Song_, const char* pcTitle_, const char* pcArtist_,
+                        u32 u32LengthMs_, fnCode_type pfStart_)
+{
+  clock_t SongClock;
+  double dSeconds;
+
+  /* Length as written, stretched to the tempo */
+  u32LengthMs_ = (u32)( ( ((uint64_t)u32LengthMs_ * 100) + (Sim_u16Tempo / 2) ) / Sim_u16Tempo );
+
+  if(!SimOpenSong(pcFolder_, u16Song_, pcTitle_, pcArtist_, u32LengthMs_))
+  {
+    return FALSE;
+  }
+
+  if(pfStart_ != NULL)
+  {
+    pfStart_();
+  }
+
+  SongClock = clock();
+  for(u32 u32Ms = 0; u32Ms < u32LengthMs_; u32Ms++)
+  {
+    SimRunPlayer1ms();
+  }
+
+  dSeconds = (double)(clock() - SongClock) / CLOCKS_PER_SEC;
+  printf("Song %u: %s - %s, %.1f s, %lu note edges, %lu LED writes, %lu LCD bytes, simulated in %.2f s",
+         u16Song_ + 1, pcTitle_, pcArtist_, u32LengthMs_ / 1000.0, (unsigned long)Sim_u32EdgeCount,
+         (unsigned long)G_u32SimLedWrites, (unsigned long)G_sSimTwi.u32Bytes, dSeconds);
+  if(dSeconds > 0)
+  {
+    printf(" (%.0fx real time)", (u32LengthMs_ / 1000.0) / dSeconds);
+  }
+  printf("\n");
+
+  SimCloseSong();
+  Sim_u32TotalMs += u32LengthMs_;
+  Sim_sTwiTotal.u32Messages += G_sSimTwi.u32Messages;
+  Sim_sTwiTotal.u32Transfers += G_sSimTwi.u32Transfers;
+  Sim_sTwiTotal.u32Bytes += G_sSimTwi.u32Bytes;
+  Sim_sTwiTotal.u32CgramChars += G_sSimTwi.u32CgramChars;
+
+  return TRUE;
+
+} /* end SimPlaySong() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimRunPlayer1ms
+
+Description:
+One pass of the board's main loop for the tasks that are simulated, then one ms of hardware time.
+*/
+static void SimRunPlayer1ms(void)
+{
+  SimLedUpdate();
+  FatRunActiveState();
+  LcdControlRunActiveState();
+  SongStreamRunActiveState();
+  Sim_dPlayerPassNs = SimTimePlayerPassNs();
+  SimLogLcd();
+  SimAdvance1ms();
+
+} /* end SimRunPlayer1ms() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTimePlayerPassNs
+
+Description:
+Runs one pass of the music player and returns how long it took in ns.
+*/
+static double SimTimePlayerPassNs(void)
+{
+  struct timespec sStart;
+  struct timespec sEnd;
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  MusicPlayerRunActiveState();
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+
+  return ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec));
+
+} /* end SimTimePlayerPassNs() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimProfilePlayer
+
+Description:
+Plays every song in flash for its whole length at the tempo set, without writing any files, and prints for
+each one how many of the player's passes write the PWM registers, how many writes they make against the
+SIM_POLLED_PWM_WRITES the polled player made every pass, and how long the passes take on this host.  With the
+TC1 sequencer, the writes are made from the timer callback and its time is not in the passes.
+Then, for all the songs, what each note loaded costs: what the passes that write the PWM take over the median
+pass, which has nothing to do, shared out between the notes in the songs, so it includes the tempo scaling of
+each note.  The TC1 sequencer loads its notes ahead, on passes that write nothing, so this is only printed for
+the main loop player.  Last, how long MusicPlayerSetTempo() takes, with its one division.  Passes that take
+SIM_PASS_MAX_NS or more were interrupted by the host and are left out.
+Returns FALSE if a song never writes the PWM.
+*/
+static bool SimProfilePlayer(void)
+{
+  const SongInfoType* psSong;
+  u32* pu32Starts;
+  u32* pu32PassesByNs;
+  u32 u32LengthMs;
+  u32 u32Writes;
+  u32 u32Passes;
+  u32 u32EdgePasses;
+  u32 u32TotalPasses = 0;
+  u32 u32TotalWrites = 0;
+  u32 u32TotalEdgePasses = 0;
+  u32 u32TotalMs = 0;
+  u32 u32TotalNotes = 0;
+  u32 u32MedianNs;
+  u32 u32Count = 0;
+  u16 u16OtherTempo;
+  double dNs;
+  double dSongNs;
+  double dEdgeNs;
+  double dTotalNs = 0;
+  double dTotalEdgeNs = 0;
+  double dTempoNs = 0;
+  struct timespec sStart;
+  struct timespec sEnd;
+
+  /* How many passes took each whole number of ns, for the median */
+  pu32PassesByNs = calloc(SIM_PASS_MAX_NS, sizeof(u32));
+  if(pu32PassesByNs == NULL)
+  {
+    perror("calloc");
+    return FALSE;
+  }
+
+  printf("Player passes at %u%% tempo, on this host, against the polled player's %lu PWM writes per pass:\n",
+         (unsigned)Sim_u16Tempo, (unsigned long)SIM_POLLED_PWM_WRITES);
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    psSong = song_list[u8Song];
+    u32LengthMs = (u32)( ( ((uint64_t)SimGetSongLengthMs(psSong) * 100) + (Sim_u16Tempo / 2) ) / Sim_u16Tempo );
+    (u8Song == 0) ? MusicPlayerTogglePlayPause() : MusicPlayerNextSong();
+
+    G_u32SimPwmWrites = 0;
+    u32Passes = 0;
+    u32EdgePasses = 0;
+    dSongNs = 0;
+    dEdgeNs = 0;
+    for(u32 u32Ms = 0; u32Ms < u32LengthMs; u32Ms++)
+    {
+      u32Writes = G_u32SimPwmWrites;
+      SimRunPlayer1ms();
+
+      dNs = Sim_dPlayerPassNs;
+      if(dNs >= SIM_PASS_MAX_NS)
+      {
+        continue;
+      }
+
+      pu32PassesByNs[(u32)dNs]++;
+      u32Passes++;
+      dSongNs += dNs;
+      if(G_u32SimPwmWrites != u32Writes)
+      {
+        u32EdgePasses++;
+        dEdgeNs += dNs;
+      }
+    }
+
+    if(u32EdgePasses == 0)
+    {
+      fprintf(stderr, "Song %u: no PWM writes\n", u8Song + 1);
+      free(pu32PassesByNs);
+      return FALSE;
+    }
+
+    printf("  Song %u: %s - %s: %lu of %lu passes write the PWM, %lu writes (polled %lu), "
+           "pass %.0f ns, %.0f ns with writes\n", u8Song + 1, psSong->title, psSong->artist,
+           (unsigned long)u32EdgePasses, (unsigned long)u32LengthMs, (unsigned long)G_u32SimPwmWrites,
+           (unsigned long)(u32LengthMs * SIM_POLLED_PWM_WRITES), dSongNs / u32Passes, dEdgeNs / u32EdgePasses);
+
+    u32TotalMs += u32LengthMs;
+    u32TotalPasses += u32Passes;
+    u32TotalWrites += G_u32SimPwmWrites;
+    u32TotalEdgePasses += u32EdgePasses;
+    dTotalNs += dSongNs;
+    dTotalEdgeNs += dEdgeNs;
+
+    /* Every note of every voice is loaded once as the song plays through */
+    for(u8 u8Voice = 0; u8Voice < psSong->num_voices; u8Voice++)
+    {
+      u32TotalNotes += SimGetNoteStarts(psSong, u8Voice, &pu32Starts);
+      if(pu32Starts == NULL)
+      {
+        perror("realloc");
+        free(pu32PassesByNs);
+        return FALSE;
+      }
+      free(pu32Starts);
+    }
+  }
+
+  printf("  All songs: %.1f%% of passes write the PWM, %.3f writes per pass (polled %lu), "
+         "pass %.0f ns, %.0f ns with writes, %lu passes interrupted by the host left out\n",
+         (u32TotalEdgePasses * 100.0) / u32TotalPasses, (double)u32TotalWrites / u32TotalMs,
+         (unsigned long)SIM_POLLED_PWM_WRITES, dTotalNs / u32TotalPasses, dTotalEdgeNs / u32TotalEdgePasses,
+         (unsigned long)(u32TotalMs - u32TotalPasses));
+
+  for(u32MedianNs = 0; (u32Count + pu32PassesByNs[u32MedianNs]) <= (u32TotalPasses / 2); u32MedianNs++)
+  {
+    u32Count += pu32PassesByNs[u32MedianNs];
+  }
+  free(pu32PassesByNs);
+
+  /* Back and forth by 1%, down from the fastest tempo */
+  MusicPlayerSetTempo(Sim_u16Tempo + 1);
+  u16OtherTempo = (MusicPlayerGetTempo() != Sim_u16Tempo) ? (Sim_u16Tempo + 1) : (Sim_u16Tempo - 1);
+  for(u32 i = 0; i < SIM_TEMPO_TIMING_REPEATS; i++)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &sStart);
+    MusicPlayerSetTempo((i & 1) ? Sim_u16Tempo : u16OtherTempo);
+    clock_gettime(CLOCK_MONOTONIC, &sEnd);
+    dTempoNs += ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec));
+  }
+
+#if !MUSIC_PLAYER_TIMER_SEQUENCER
+  printf("  %lu notes loaded, at most %.0f ns each over the median pass (%lu ns)\n", (unsigned long)u32TotalNotes,
+         (dTotalEdgeNs - ((double)u32TotalEdgePasses * u32MedianNs)) / u32TotalNotes, (unsigned long)u32MedianNs);
+#endif
+  printf("  Tempo change %.0f ns\n", dTempoNs / SIM_TEMPO_TIMING_REPEATS);
+
+  return TRUE;
+
+} /* end SimProfilePlayer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCheckJitter
+
+Description:
+Plays every song in flash from the start at the tempo set, on time, then again with a main loop pass running
+1 - SIM_JITTER_MAX_LATE_MS ms late every SIM_JITTER_PERIOD_MS ms, as when a task overruns SystemSleep().  The
+note edges of both are compared in TC1 ticks, and how many moved, how far the furthest one did, and how many
+were never played (a rest or note shorter than the time the loop was late) are printed.
+Returns FALSE if the buzzers play a note when the loop is late that they did not play on time.
+*/
+static bool SimCheckJitter(void)
+{
+  const SongInfoType* psSong;
+  SimEdgeType* pasReference;
+  SimEdgeType* pasLate;
+  u32 u32LengthMs;
+  u32 u32Edges;
+  u32 u32LateEdges;
+  u32 u32Moved;
+  u32 u32Dropped;
+  u32 u32WorstError;
+  u32 u32TotalEdges = 0;
+  u32 u32TotalMoved = 0;
+  u32 u32TotalDropped = 0;
+  u32 u32TotalWorstError = 0;
+  bool bPassed = TRUE;
+
+  pasReference = malloc(2 * SIM_JITTER_MAX_EDGES * sizeof(SimEdgeType));
+  if(pasReference == NULL)
+  {
+    perror("malloc");
+    return FALSE;
+  }
+  pasLate = &pasReference[SIM_JITTER_MAX_EDGES];
+
+  printf("Note edges with the " SIM_SEQUENCER_NAME " at %u%% tempo, a pass 1 - %lu ms late every %lu ms:\n",
+         (unsigned)Sim_u16Tempo, (unsigned long)SIM_JITTER_MAX_LATE_MS, (unsigned long)SIM_JITTER_PERIOD_MS);
+  for(u8 u8Song = 0; bPassed && (u8Song < SONG_LIST_SIZE); u8Song++)
+  {
+    psSong = song_list[u8Song];
+    u32LengthMs = (u32)( ( ((uint64_t)SimGetSongLengthMs(psSong) * 100) + (Sim_u16Tempo / 2) ) / Sim_u16Tempo );
+    (u8Song == 0) ? MusicPlayerTogglePlayPause() : MusicPlayerNextSong();
+    SimRunPlayer1ms();
+
+    bPassed = SimRecordEdges(pasReference, u32LengthMs, FALSE, &u32Edges) &&
+              SimRecordEdges(pasLate, u32LengthMs, TRUE, &u32LateEdges);
+
+    u32Moved = 0;
+    u32Dropped = 0;
+    u32WorstError = 0;
+    for(u8 i = 0; bPassed && (i < SIM_NUM_BUZZERS); i++)
+    {
+      bPassed = SimCompareEdges(pasReference, u32Edges, pasLate, u32LateEdges, i, &u32Moved, &u32Dropped, &u32WorstError);
+      if(!bPassed)
+      {
+        fprintf(stderr, "Song %u: the %s buzzer plays a note when the main loop is late that it does not on time\n",
+                u8Song + 1, (i == 0) ? "right" : "left");
+      }
+    }
+
+    if(bPassed)
+    {
+      printf("  Song %u: %s - %s: %lu of %lu edges moved, worst by %.0f us, %lu never played\n", u8Song + 1,
+             psSong->title, psSong->artist, (unsigned long)u32Moved, (unsigned long)u32Edges,
+             (u32WorstError * 1000.0) / TIMER_TICKS_PER_MS, (unsigned long)u32Dropped);
+    }
+
+    u32TotalEdges += u32Edges;
+    u32TotalMoved += u32Moved;
+    u32TotalDropped += u32Dropped;
+    if(u32WorstError > u32TotalWorstError)
+    {
+      u32TotalWorstError = u32WorstError;
+    }
+  }
+
+  if(bPassed)
+  {
+    printf("  All songs: %lu of %lu edges moved, worst by %.0f us, %lu never played\n", (unsigned long)u32TotalMoved,
+           (unsigned long)u32TotalEdges, (u32TotalWorstError * 1000.0) / TIMER_TICKS_PER_MS, (unsigned long)u32TotalDropped);
+  }
+
+  free(pasReference);
+  return bPassed;
+
+} /* end SimCheckJitter() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimRecordEdges
+
+Description:
+Plays the current song from the start for u32LengthMs_ ms and records its note edges into pasEdges_, up to the
+end of the song: the song starting over is left out, as it is only on time if the run gets there.  With
+bLate_, every SIM_JITTER_PERIOD_MS ms the main loop falls behind by 1 - SIM_JITTER_MAX_LATE_MS ms: that much
+hardware time goes by before the next pass.
+Returns FALSE if the song has more than SIM_JITTER_MAX_EDGES edges, or cannot be seeked to its start.
+*/
+static bool SimRecordEdges(SimEdgeType* pasEdges_, u32 u32LengthMs_, bool bLate_, u32* pu32Edges_)
+{
+  u32 u32Late = 0;
+
+  /* Both runs start the same way: paused and silent, seeked to the start, then played */
+  if(!MusicPlayerIsPaused())
+  {
+    MusicPlayerTogglePlayPause();
+  }
+
+  if(!MusicPlayerSeekMs(0))
+  {
+    fprintf(stderr, "Song %u: cannot seek to the start\n", MusicPlayerGetCurrentSongIndex() + 1);
+    return FALSE;
+  }
+
+  Sim_pasEdges = pasEdges_;
+  Sim_u32SongStartTime = G_u32SystemTime1ms;
+  Sim_u32EdgeCount = 0;
+  for(u8 i = 0; i < SIM_NUM_BUZZERS; i++)
+  {
+    Sim_abLoggedOn[i] = G_asSimBuzzers[i].bOn;
+    Sim_au32LoggedPeriod[i] = G_asSimBuzzers[i].u32UpdatePeriod;
+  }
+
+  MusicPlayerTogglePlayPause();
+  for(u32 u32Ms = 0; u32Ms < u32LengthMs_; u32Ms++)
+  {
+    SimRunPlayer1ms();
+
+    if( bLate_ && ((u32Ms % SIM_JITTER_PERIOD_MS) == (SIM_JITTER_PERIOD_MS - 1)) )
+    {
+      u32Late = (u32Late % SIM_JITTER_MAX_LATE_MS) + 1;
+      for(u32 i = 0; i < u32Late; i++)
+      {
+        SimAdvance1ms();
+      }
+      u32Ms += u32Late;
+    }
+  }
+
+  Sim_pasEdges = NULL;
+  if(Sim_u32EdgeCount > SIM_JITTER_MAX_EDGES)
+  {
+    fprintf(stderr, "Song %u: more than %lu note edges\n", MusicPlayerGetCurrentSongIndex() + 1,
+            (unsigned long)SIM_JITTER_MAX_EDGES);
+    return FALSE;
+  }
+
+  *pu32Edges_ = Sim_u32EdgeCount;
+  while( (*pu32Edges_ > 0) && (pasEdges_[*pu32Edges_ - 1].u32Tick >= (u32LengthMs_ * TIMER_TICKS_PER_MS)) )
+  {
+    (*pu32Edges_)--;
+  }
+
+  return TRUE;
+
+} /* end SimRecordEdges() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCompareEdges
+
+Description:
+Matches one buzzer's edges from the late run to the ones played on time, in order, each to the closest edge on
+time to the same period.  An edge played on time that is skipped over was never played: the loop was late
+past it, straight to what came next.
+
+Requires:
+  - Neither list has two edges in a row on the buzzer to the same period, as SimLogBuzzer() records them
+
+Promises:
+  - Adds the matched edges that moved to *pu32Moved_ and the ones never played to *pu32Dropped_
+  - Raises *pu32WorstError_ to the furthest a matched edge moved, in TC1 ticks
+  - Returns FALSE if an edge in the late run matches no edge left from the run on time
+*/
+static bool SimCompareEdges(const SimEdgeType* pasReference_, u32 u32Edges_, const SimEdgeType* pasLate_, u32 u32LateEdges_,
+                            u8 u8Buzzer_, u32* pu32Moved_, u32* pu32Dropped_, u32* pu32WorstError_)
+{
+  u32 u32Reference = 0;
+  u32 u32Match;
+  u32 u32Next;
+  u32 u32Error;
+
+  for(u32 u32Late = 0; u32Late < u32LateEdges_; u32Late++)
+  {
+    if(pasLate_[u32Late].u8Buzzer != u8Buzzer_)
+    {
+      continue;
+    }
+
+    /* A rest and the note after it that were never played leave the buzzer as it was, so the edge can match
+    a later one on time as well as the next */
+    u32Match = SimFindEdge(pasReference_, u32Edges_, u32Reference, &pasLate_[u32Late]);
+    if(u32Match == u32Edges_)
+    {
+      return FALSE;
+    }
+
+    u32Error = SimGetEdgeError(&pasReference_[u32Match], &pasLate_[u32Late]);
+    for(u32Next = SimFindEdge(pasReference_, u32Edges_, u32Match + 1, &pasLate_[u32Late]);
+        (u32Next < u32Edges_) && (SimGetEdgeError(&pasReference_[u32Next], &pasLate_[u32Late]) < u32Error);
+        u32Next = SimFindEdge(pasReference_, u32Edges_, u32Next + 1, &pasLate_[u32Late]))
+    {
+      u32Match = u32Next;
+      u32Error = SimGetEdgeError(&pasReference_[u32Match], &pasLate_[u32Late]);
+    }
+
+    for( ; u32Reference < u32Match; u32Reference++)
+    {
+      if(pasReference_[u32Reference].u8Buzzer == u8Buzzer_)
+      {
+        (*pu32Dropped_)++;
+      }
+    }
+
+    if(u32Error != 0)
+    {
+      (*pu32Moved_)++;
+    }
+    if(u32Error > *pu32WorstError_)
+    {
+      *pu32WorstError_ = u32Error;
+    }
+    u32Reference++;
+  }
+
+  for( ; u32Reference < u32Edges_; u32Reference++)
+  {
+    if(pasReference_[u32Reference].u8Buzzer == u8Buzzer_)
+    {
+      (*pu32Dropped_)++;
+    }
+  }
+
+  return TRUE;
+
+} /* end SimCompareEdges() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimFindEdge
+
+Description:
+Returns the index of the first edge from u32From_ on that is on the same buzzer and to the same period as
+psEdge_, or u32Edges_ if there is none.
+*/
+static u32 SimFindEdge(const SimEdgeType* pasEdges_, u32 u32Edges_, u32 u32From_, const SimEdgeType* psEdge_)
+{
+  while( (u32From_ < u32Edges_) && ( (pasEdges_[u32From_].u8Buzzer != psEdge_->u8Buzzer) ||
+         (pasEdges_[u32From_].u32Period != psEdge_->u32Period) ) )
+  {
+    u32From_++;
+  }
+
+  return u32From_;
+
+} /* end SimFindEdge() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimGetEdgeError
+
+Description:
+Returns how far apart two edges are in TC1 ticks.
+*/
+static u32 SimGetEdgeError(const SimEdgeType* psEdge1_, const SimEdgeType* psEdge2_)
+{
+  return (psEdge1_->u32Tick > psEdge2_->u32Tick) ? (psEdge1_->u32Tick - psEdge2_->u32Tick) :
+                                                   (psEdge2_->u32Tick - psEdge1_->u32Tick);
+
+} /* end SimGetEdgeError() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCheckPeriods
+
+Description:
+Checks that every entry of note_period_table is the period PWMAudioSetFrequency() would divide out of the note's
+entry in note_freq_table, or 0 where that does not fit the 16-bit period register, and that every note the songs
+in flash play has a period, so none of them is silent.  Then times the two ways on this host.
+Returns FALSE if a check fails.
+*/
+static bool SimCheckPeriods(void)
+{
+  const SongInfoType* psSong;
+  const VoiceType* psVoice;
+  const PhraseType* psPhrase;
+  u32 u32Expected;
+  u32 u32Offset;
+  u8 u8Note;
+  u8 u8Played = 0;
+  bool abPlayed[NUM_MIDI_NOTES];
+  bool bPassed = TRUE;
+
+  for(u8Note = 0; u8Note < NUM_MIDI_NOTES; u8Note++)
+  {
+    u32Expected = (note_freq_table[u8Note] == 0) ? 0 : (CPRE_CLCK / note_freq_table[u8Note]);
+    if(u32Expected > 0xFFFF)
+    {
+      u32Expected = 0;
+    }
+
+    if(note_period_table[u8Note] != u32Expected)
+    {
+      fprintf(stderr, "MIDI note %u: %u Hz, period %u in note_period_table, %lu divided out\n", u8Note,
+              note_freq_table[u8Note], note_period_table[u8Note], (unsigned long)u32Expected);
+      bPassed = FALSE;
+    }
+  }
+
+  /* Every note in every phrase a voice plays */
+  memset(abPlayed, 0, sizeof(abPlayed));
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    psSong = song_list[u8Song];
+    for(u8 u8Voice = 0; u8Voice < psSong->num_voices; u8Voice++)
+    {
+      psVoice = &psSong->voices[u8Voice];
+      for(u16 u16Entry = 0; u16Entry < psVoice->playlist_size; u16Entry++)
+      {
+        psPhrase = &psSong->phrases[psVoice->playlist[u16Entry].phrase];
+        for(u32Offset = psPhrase->offset; u32Offset < (u32)(psPhrase->offset + psPhrase->size); )
+        {
+          u8Note = psSong->phrase_events[u32Offset++];
+          while(psSong->phrase_events[u32Offset++] & 0x80);
+
+          if( (u8Note >= NUM_MIDI_NOTES) || ((u8Note != SILENT_NOTE) && (note_period_table[u8Note] == 0)) )
+          {
+            fprintf(stderr, "Song %u: voice %u plays MIDI note %u, which has no period\n", u8Song + 1, u8Voice, u8Note);
+            return FALSE;
+          }
+
+          if( (u8Note != SILENT_NOTE) && !abPlayed[u8Note] )
+          {
+            abPlayed[u8Note] = TRUE;
+            u8Played++;
+          }
+        }
+      }
+    }
+  }
+
+  if(!bPassed)
+  {
+    return FALSE;
+  }
+
+  printf("Periods: all %u MIDI notes match CPRE_CLCK / frequency, the %u notes the songs play all have one\n",
+         (unsigned)NUM_MIDI_NOTES, (unsigned)u8Played);
+  SimTimePeriods();
+
+  return TRUE;
+
+} /* end SimCheckPeriods() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTimePeriods
+
+Description:
+Times getting the period of every MIDI note that has one, SIM_PERIOD_TIMING_REPEATS times over, by dividing
+CPRE_CLCK by its frequency as PWMAudioSetFrequency() does and by looking it up in note_period_table, and prints
+what each takes on this host and what the lookups save on the polled player's SIM_POLLED_DIVISIONS per pass.
+*/
+static void SimTimePeriods(void)
+{
+  volatile u32 u32Sink = 0;
+  volatile u16 au16Frequencies[NUM_MIDI_NOTES];
+  volatile u8 au8Notes[NUM_MIDI_NOTES];
+  u8 u8Notes = 0;
+  u32 u32Periods;
+  double dDivideNs;
+  double dLookupNs;
+  struct timespec sStart;
+  struct timespec sEnd;
+
+  /* Read through volatiles so that neither loop is worked out at compile time */
+  for(u8 u8Note = 0; u8Note < NUM_MIDI_NOTES; u8Note++)
+  {
+    if(note_period_table[u8Note] != 0)
+    {
+      au16Frequencies[u8Notes] = note_freq_table[u8Note];
+      au8Notes[u8Notes] = u8Note;
+      u8Notes++;
+    }
+  }
+  u32Periods = SIM_PERIOD_TIMING_REPEATS * u8Notes;
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  for(u32 i = 0; i < SIM_PERIOD_TIMING_REPEATS; i++)
+  {
+    for(u8 j = 0; j < u8Notes; j++)
+    {
+      u32Sink = CPRE_CLCK / au16Frequencies[j];
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+  dDivideNs = ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec)) / u32Periods;
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  for(u32 i = 0; i < SIM_PERIOD_TIMING_REPEATS; i++)
+  {
+    for(u8 j = 0; j < u8Notes; j++)
+    {
+      u32Sink = note_period_table[au8Notes[j]];
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+  dLookupNs = ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec)) / u32Periods;
+
+  printf("  On this host: %.2f ns to divide out a period, %.2f ns to look it up, %.2f ns saved a pass on the "
+         "polled player's %lu divisions\n", dDivideNs, dLookupNs, (dDivideNs - dLookupNs) * SIM_POLLED_DIVISIONS,
+         (unsigned long)SIM_POLLED_DIVISIONS);
+  (void)u32Sink;
+
+} /* end SimTimePeriods() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLogLcd
+
+Description:
+Writes a line to the LCD trace for each line of the LCD that shows something new.
+
+Requires:
+  - None
+
+Promises:
+  - A line "<time ms> <LCD line> |<20 characters>|" is written for each line that changed since the last one
+*/
+static void SimLogLcd(void)
+{
+  const u8* pu8Line;
+
+  if(Sim_pfLcd == NULL)
+  {
+    return;
+  }
+
+  for(u8 i = 0; i < SIM_LCD_LINES; i++)
+  {
+    pu8Line = SimLcdGetLine(i);
+    if(memcmp(pu8Line, Sim_aau8LoggedLcd[i], LCD_MAX_LINE_DISPLAY_SIZE) != 0)
+    {
+      memcpy(Sim_aau8LoggedLcd[i], pu8Line, LCD_MAX_LINE_DISPLAY_SIZE);
+      fprintf(Sim_pfLcd, "%lu %u |%.*s|\n", (unsigned long)(G_u32SystemTime1ms - Sim_u32SongStartTime), i + 1,
+              (int)LCD_MAX_LINE_DISPLAY_SIZE, (const char*)pu8Line);
+    }
+  }
+
+} /* end SimLogLcd() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimMeasureBoot
+
+Description:
+Boots the board from power-up: runs the startup section of main() for the tasks that are simulated, with
+_SYSTEM_INITIALIZING set, then the main loop with the LCD task.  Play is pressed at power-up, so the first
+song starts on the player's first pass.  Prints how long initialization took, when the first note sounded
+and so when the song started (the first song starts with a rest), when the LCD was ready and what it shows
+SIM_BOOT_MS after power-up.  The LCD task must have set its flag in G_u32ApplicationFlags by the end of
+initialization, or SystemStatusReport() reports it as failed.
+Returns FALSE if it had not, if there was no note or the LCD was never ready, or if anything reached the LCD
+while it was busy.
+*/
+static bool SimMeasureBoot(void)
+{
+  u32 u32InitMs;
+  u32 u32FirstNoteMs = 0;
+  u32 u32SongStartMs = 0;
+  u32 u32LcdReadyMs = 0;
+  bool bPlaying = FALSE;
+  bool bLcdReady = FALSE;
+  bool bLcdStarted;
+
+  SimBoardReset();
+  SimLcdPowerUp();
+  G_u32ApplicationFlags = 0;
+
+  G_u32SystemFlags |= _SYSTEM_INITIALIZING;
+  LcdInitialize();
+  FatInitialize();
+  LcdControlInitialize();
+  SongStreamInitialize();
+  MusicPlayerInitialize();
+  G_u32SystemFlags &= ~_SYSTEM_INITIALIZING;
+  u32InitMs = G_u32SystemTime1ms;
+  bLcdStarted = ((G_u32ApplicationFlags & _APPLICATION_FLAGS_LCD) != 0);
+
+  MusicPlayerTogglePlayPause();
+
+  while(G_u32SystemTime1ms < SIM_BOOT_MS)
+  {
+    LcdRunActiveState();
+    SimRunPlayer1ms();
+
+    /* Times are those of the pass that just ran, before SimRunPlayer1ms() moved on to the next ms */
+    if(!bLcdReady && (G_u32LcdFlags & _LCD_FLAGS_READY))
+    {
+      bLcdReady = TRUE;
+      u32LcdReadyMs = G_u32SystemTime1ms - 1;
+    }
+
+    if(!bPlaying && (G_asSimBuzzers[0].bOn || G_asSimBuzzers[1].bOn))
+    {
+      bPlaying = TRUE;
+      u32FirstNoteMs = G_u32SystemTime1ms - 1;
+      u32SongStartMs = G_u32SystemTime1ms - MusicPlayerGetPositionMs();
+    }
+  }
+
+  printf("Boot: initialization took %lu ms%s, ", (unsigned long)u32InitMs,
+         bLcdStarted ? "" : " (LCD task reported as failed)");
+  printf(bPlaying ? "first note at %lu ms (song started at %lu ms), " : "no note, ", (unsigned long)u32FirstNoteMs,
+         (unsigned long)u32SongStartMs);
+  printf(bLcdReady ? "LCD ready at %lu ms\n" : "LCD never ready\n", (unsigned long)u32LcdReadyMs);
+  printf("LCD at %lu ms: |%.*s| |%.*s|, %lu commands and data bytes sent while it was busy\n", (unsigned long)SIM_BOOT_MS,
+         (int)LCD_MAX_LINE_DISPLAY_SIZE, (const char*)SimLcdGetLine(0), (int)LCD_MAX_LINE_DISPLAY_SIZE,
+         (const char*)SimLcdGetLine(1), (unsigned long)SimLcdGetBusyBytes());
+
+  return( bLcdStarted && bPlaying && bLcdReady && (SimLcdGetBusyBytes() == 0) );
+
+} /* end SimMeasureBoot() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTimeLcdTitles
+
+Description:
+Times the LCD task with the SIM_TITLE_SONGS longest "title - artist" strings in flash.  For each, the pass that
+sets up its title is timed by going to the song before it and back, and then the passes that scroll it, with
+the song paused so that the status line stays the same.  The status line is redrawn in the same pass as a new
+title, so the pass that redraws it alone is timed too, by pausing and playing.  Every scroll step must show the
+title one character on from the step before, wrapping around through SIM_TITLE_GAP.
+Returns FALSE if one does not.
+*/
+static bool SimTimeLcdTitles(void)
+{
+  u8 au8Songs[SIM_TITLE_SONGS];
+  u32 au32Sizes[SONG_LIST_SIZE];
+  char acExpected[(SIM_TITLE_SIZE * 2) + 1];
+  u32 u32Size;
+  u32 u32Window = 0;
+  double dSetupNs;
+  double dScrollNs;
+  double dStatusNs = 0;
+  const SongInfoType* psSong;
+
+  /* Songs with the longest titles first */
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    au32Sizes[u8Song] = strlen(song_list[u8Song]->title) + strlen(" - ") + strlen(song_list[u8Song]->artist);
+  }
+
+  for(u8 i = 0; i < SIM_TITLE_SONGS; i++)
+  {
+    au8Songs[i] = 0;
+    for(u8 u8Song = 1; u8Song < SONG_LIST_SIZE; u8Song++)
+    {
+      if(au32Sizes[u8Song] > au32Sizes[au8Songs[i]])
+      {
+        au8Songs[i] = u8Song;
+      }
+    }
+    au32Sizes[au8Songs[i]] = 0;
+  }
+
+  printf("LCD task pass on this host, for the longest titles:\n");
+  for(u8 i = 0; i < SIM_TITLE_SONGS; i++)
+  {
+    psSong = song_list[au8Songs[i]];
+
+    /* What scrolls past: the title and artist, then the gap, twice over so that every window is a slice */
+    u32Size = (u32)snprintf(acExpected, SIM_TITLE_SIZE + 1, "%s - %s" SIM_TITLE_GAP, psSong->title, psSong->artist);
+    if(u32Size > SIM_TITLE_SIZE)
+    {
+      fprintf(stderr, "Song %u: title longer than %lu characters\n", au8Songs[i] + 1, (unsigned long)SIM_TITLE_SIZE);
+      return FALSE;
+    }
+    memcpy(&acExpected[u32Size], acExpected, u32Size);
+
+    /* Setting the title up, each time from the song before it */
+    SimSelectSong(au8Songs[i]);
+    dSetupNs = 0;
+    for(u32 j = 0; j < SIM_TITLE_REPEATS; j++)
+    {
+      MusicPlayerPreviousSong();
+      LcdControlRunActiveState();
+      MusicPlayerNextSong();
+      dSetupNs += SimTimeLcdPassNs();
+    }
+
+    /* The status line on its own */
+    for(u32 j = 0; j < SIM_TITLE_REPEATS; j++)
+    {
+      MusicPlayerTogglePlayPause();
+      dStatusNs += SimTimeLcdPassNs();
+    }
+
+    /* Scrolling, paused, once the title has been shown long enough to start */
+    if(!MusicPlayerIsPaused())
+    {
+      MusicPlayerTogglePlayPause();
+    }
+
+    G_u32SystemTime1ms += SIM_TITLE_FREEZE_MS;
+    LcdControlRunActiveState();
+
+    dScrollNs = 0;
+    for(u32 j = 0; j < SIM_TITLE_REPEATS; j++)
+    {
+      G_u32SystemTime1ms += SIM_TITLE_SCROLL_MS;
+      dScrollNs += SimTimeLcdPassNs();
+
+      /* The first step finds where the title has got to, every one after it must be one character on */
+      if(j == 0)
+      {
+        for(u32Window = 0; u32Window < (u32Size - 1); u32Window++)
+        {
+          if(memcmp(SimLcdGetLine(0), &acExpected[u32Window], LCD_MAX_LINE_DISPLAY_SIZE) == 0)
+          {
+            break;
+          }
+        }
+      }
+      else
+      {
+        u32Window = (u32Window + 1) % u32Size;
+      }
+
+      if(memcmp(SimLcdGetLine(0), &acExpected[u32Window], LCD_MAX_LINE_DISPLAY_SIZE) != 0)
+      {
+        fprintf(stderr, "Song %u: scroll step %lu shows |%.*s|\n", au8Songs[i] + 1, (unsigned long)j,
+                (int)LCD_MAX_LINE_DISPLAY_SIZE, (const char*)SimLcdGetLine(0));
+        return FALSE;
+      }
+    }
+
+    printf("  Song %u: %s - %s (%lu characters): new title %.0f ns, scroll step %.0f ns\n", au8Songs[i] + 1,
+           psSong->title, psSong->artist, (unsigned long)(u32Size - strlen(SIM_TITLE_GAP)),
+           dSetupNs / SIM_TITLE_REPEATS, dScrollNs / SIM_TITLE_REPEATS);
+  }
+
+  printf("  A new title's pass also redraws the status line, which on its own takes %.0f ns\n",
+         dStatusNs / (SIM_TITLE_SONGS * SIM_TITLE_REPEATS));
+
+  return TRUE;
+
+} /* end SimTimeLcdTitles() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCheckLcdFullQueue
+
+Description:
+Checks that the LCD task sends the status line again when the TWI queue was full as it changed.  The song is
+played while the queue is full, then the queue is emptied and the task runs once more in the same ms, so
+nothing on the status line changes again.  It must then show what it shows when played with room in the queue.
+Returns FALSE if it does not.
+*/
+static bool SimCheckLcdFullQueue(void)
+{
+  u8 au8Playing[LCD_MAX_LINE_DISPLAY_SIZE];
+  bool bPassed;
+
+  /* What the status line shows playing and paused at this time */
+  if(!MusicPlayerIsPaused())
+  {
+    MusicPlayerTogglePlayPause();
+    LcdControlRunActiveState();
+  }
+
+  MusicPlayerTogglePlayPause();
+  LcdControlRunActiveState();
+  memcpy(au8Playing, SimLcdGetLine(1), LCD_MAX_LINE_DISPLAY_SIZE);
+  MusicPlayerTogglePlayPause();
+  LcdControlRunActiveState();
+
+  /* Play with the queue full, then once with room in it */
+  SimTwiSetFull(TRUE);
+  MusicPlayerTogglePlayPause();
+  LcdControlRunActiveState();
+  SimTwiSetFull(FALSE);
+  LcdControlRunActiveState();
+
+  bPassed = (memcmp(SimLcdGetLine(1), au8Playing, LCD_MAX_LINE_DISPLAY_SIZE) == 0);
+  printf("  Status line after a full TWI queue: |%.*s|, expected |%.*s|: %s\n", (int)LCD_MAX_LINE_DISPLAY_SIZE,
+         (const char*)SimLcdGetLine(1), (int)LCD_MAX_LINE_DISPLAY_SIZE, (const char*)au8Playing,
+         bPassed ? "passed" : "failed");
+
+  return bPassed;
+
+} /* end SimCheckLcdFullQueue() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTimeLcdPassNs
+
+Description:
+Runs one pass of the LCD task and returns how long it took in ns.
+*/
+static double SimTimeLcdPassNs(void)
+{
+  struct timespec sStart;
+  struct timespec sEnd;
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  LcdControlRunActiveState();
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+
+  return ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec));
+
+} /* end SimTimeLcdPassNs() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimSelectSong
+
+Description:
+Steps the player on with "next" until u16Song_ is the song chosen, and lets the LCD task show its title.
+*/
+static void SimSelectSong(u16 u16Song_)
+{
+  while(MusicPlayerGetSelectedSongIndex() != u16Song_)
+  {
+    MusicPlayerNextSong();
+  }
+
+  LcdControlRunActiveState();
+
+} /* end SimSelectSong() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimRenderTo
+
+Description:
+Renders the buzzers as they are now from the last rendered sample up to the current time
+(G_u32SystemTime1ms plus G_u32SimTick).  Called by the emulated hardware before every change to a
+buzzer and at the end of every ms.
+
+Requires:
+  - G_u32SimTick is the time within the current ms in TC1 ticks (0 - TIMER_TICKS_PER_MS)
+
+Promises:
+  - Every sample before that time is written to the WAV file
+  - A period latched on a running buzzer takes over when its current period ends
+*/
+void SimRenderTo(void)
+{
+  uint64_t u64Tick;
+  uint64_t u64PeriodLength;
+  SimBuzzerType* psBuzzer;
+  s32 s32Level;
+
+  if( !Sim_bWriteWav || (Sim_pfWav == NULL) )
+  {
+    return;
+  }
+
+  /* Sample n is due at n / sample rate seconds, which is n * 375000 / sample rate ticks */
+  u64Tick = (uint64_t)(G_u32SystemTime1ms - Sim_u32SongStartTime) * TIMER_TICKS_PER_MS + G_u32SimTick;
+
+  while( (Sim_u64SamplesRendered * TIMER_TICKS_PER_MS * 1000) < (u64Tick * Sim_u32SampleRate) )
+  {
+    for(u8 i = 0; i < SIM_NUM_BUZZERS; i++)
+    {
+      psBuzzer = &G_asSimBuzzers[i];
+      s32Level = 0;
+
+      if( psBuzzer->bOn && (psBuzzer->u32Period != 0) )
+      {
+        /* 50% duty square wave */
+        u64PeriodLength = (uint64_t)psBuzzer->u32Period * Sim_u32SampleRate;
+        s32Level = ( Sim_au64Phase[i] < (u64PeriodLength >> 1) ) ? SIM_AMPLITUDE : -SIM_AMPLITUDE;
+
+        Sim_au64Phase[i] += CPRE_CLCK;
+        if(Sim_au64Phase[i] >= u64PeriodLength)
+        {
+          Sim_au64Phase[i] -= u64PeriodLength;
+          psBuzzer->u32Period = psBuzzer->u32UpdatePeriod;
+        }
+      }
+      else
+      {
+        Sim_au64Phase[i] = 0;
+      }
+
+      /* WAV frames are left then right: BUZZER2 then BUZZER1 */
+      Sim_as16WavBuffer[(Sim_u32WavBufferFrames * 2) + (1 - i)] = (s16)s32Level;
+    }
+
+    Sim_u64SamplesRendered++;
+    if(++Sim_u32WavBufferFrames == SIM_WAV_BUFFER_FRAMES)
+    {
+      SimFlushWav();
+    }
+  }
+
+} /* end SimRenderTo() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLogBuzzer
+
+Description:
+Writes a line to the timeline if what a buzzer plays has changed, and records the edge while -j has asked for them.
+
+Requires:
+  - u8Buzzer_ is 0 for BUZZER1 or 1 for BUZZER2
+
+Promises:
+  - A line "<time ms> <right|left> <period> <frequency Hz>" or "<time ms> <right|left> off" is written
+    when the buzzer turns on or off, or changes period while on
+  - The same edge is added to Sim_pasEdges if it is set, up to SIM_JITTER_MAX_EDGES of them
+*/
+void SimLogBuzzer(u8 u8Buzzer_)
+{
+  SimBuzzerType* psBuzzer = &G_asSimBuzzers[u8Buzzer_];
+  u32 u32Period = psBuzzer->u32UpdatePeriod;
+  SimEdgeType* psEdge;
+
+  if( (Sim_pfTimeline == NULL) && (Sim_pasEdges == NULL) )
+  {
+    return;
+  }
+
+  if( (psBuzzer->bOn == Sim_abLoggedOn[u8Buzzer_]) &&
+      ( !psBuzzer->bOn || (u32Period == Sim_au32LoggedPeriod[u8Buzzer_]) ) )
+  {
+    return;
+  }
+
+  Sim_abLoggedOn[u8Buzzer_] = psBuzzer->bOn;
+  Sim_au32LoggedPeriod[u8Buzzer_] = u32Period;
+  Sim_u32EdgeCount++;
+
+  if( (Sim_pasEdges != NULL) && (Sim_u32EdgeCount <= SIM_JITTER_MAX_EDGES) )
+  {
+    psEdge = &Sim_pasEdges[Sim_u32EdgeCount - 1];
+    psEdge->u32Tick = ((G_u32SystemTime1ms - Sim_u32SongStartTime) * TIMER_TICKS_PER_MS) + G_u32SimTick;
+    psEdge->u32Period = (psBuzzer->bOn && (u32Period != 0)) ? u32Period : 0;
+    psEdge->u8Buzzer = u8Buzzer_;
+  }
+
+  if(Sim_pfTimeline == NULL)
+  {
+    return;
+  }
+
+  fprintf(Sim_pfTimeline, "%.3f %s ", (G_u32SystemTime1ms - Sim_u32SongStartTime) + (double)G_u32SimTick / TIMER_TICKS_PER_MS,
+          (u8Buzzer_ == 0) ? "right" : "left");
+
+  if( psBuzzer->bOn && (u32Period != 0) )
+  {
+    fprintf(Sim_pfTimeline, "%lu %.1f\n", (unsigned long)u32Period, (double)CPRE_CLCK / u32Period);
+  }
+  else
+  {
+    fprintf(Sim_pfTimeline, "off\n");
+  }
+
+} /* end SimLogBuzzer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimLogLed
+
+Description:
+Writes a line to the LED trace if an LED's duty cycle has changed.
+
+Requires:
+  - u8Led_ is an LedNumberType below SIM_NUM_LEDS
+
+Promises:
+  - A line "<time ms> <led> <duty %>" is written when the LED's duty cycle changes, 0 when it goes off
+*/
+void SimLogLed(u8 u8Led_)
+{
+  LedRateType eRate = G_asSimLeds[u8Led_].eRate;
+
+  if( (Sim_pfLeds == NULL) || (eRate == Sim_aeLoggedLedRate[u8Led_]) )
+  {
+    return;
+  }
+
+  Sim_aeLoggedLedRate[u8Led_] = eRate;
+  fprintf(Sim_pfLeds, "%lu %s %u\n", (unsigned long)(G_u32SystemTime1ms - Sim_u32SongStartTime), Sim_apcLedNames[u8Led_],
+          (unsigned)( (eRate * 100) / LED_PWM_100 ));
+
+} /* end SimLogLed() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimGetSongLengthMs
+
+Description:
+Adds up the note durations of a song's first voice.  Every voice is padded to the same length by
+midi_code_gen.py, so this is the length of the whole song before it starts over.
+*/
+static u32 SimGetSongLengthMs(const SongInfoType* psSong_)
+{
+  const VoiceType* psVoice = &psSong_->voices[0];
+  const PhraseType* psPhrase;
+  u32 u32Offset;
+  u32 u32PhraseMs;
+  u32 u32Duration;
+  u32 u32LengthMs = 0;
+  u8 u8Byte;
+
+  for(u16 u16Entry = 0; u16Entry < psVoice->playlist_size; u16Entry++)
+  {
+    psPhrase = &psSong_->phrases[psVoice->playlist[u16Entry].phrase];
+    u32PhraseMs = 0;
+
+    /* Skip each note byte, then read its variable-length duration (see songs.h) */
+    for(u32Offset = psPhrase->offset; u32Offset < (u32)(psPhrase->offset + psPhrase->size); )
+    {
+      u32Offset++;
+      u32Duration = 0;
+      do
+      {
+        u8Byte = psSong_->phrase_events[u32Offset++];
+        u32Duration = (u32Duration << 7) | (u8Byte & 0x7F);
+      } while(u8Byte & 0x80);
+
+      u32PhraseMs += u32Duration;
+    }
+
+    u32LengthMs += u32PhraseMs * psVoice->playlist[u16Entry].repeat;
+  }
+
+  return u32LengthMs;
+
+} /* end SimGetSongLengthMs() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimGetNoteStarts
+
+Description:
+Lists the song position of every note of one voice, in order.  *ppu32Starts_ is set to a buffer the caller
+frees, or NULL if it could not be allocated.  Returns the number of notes.
+*/
+static u32 SimGetNoteStarts(const SongInfoType* psSong_, u8 u8Voice_, u32** ppu32Starts_)
+{
+  const VoiceType* psVoice = &psSong_->voices[u8Voice_];
+  const PhraseType* psPhrase;
+  u32* pu32Starts = NULL;
+  u32 u32Notes = 0;
+  u32 u32Size = 0;
+  u32 u32Position = 0;
+  u32 u32Offset;
+  u32 u32Duration;
+  u8 u8Byte;
+
+  for(u16 u16Entry = 0; u16Entry < psVoice->playlist_size; u16Entry++)
+  {
+    psPhrase = &psSong_->phrases[psVoice->playlist[u16Entry].phrase];
+
+    for(u16 u16Repeat = 0; u16Repeat < psVoice->playlist[u16Entry].repeat; u16Repeat++)
+    {
+      for(u32Offset = psPhrase->offset; u32Offset < (u32)(psPhrase->offset + psPhrase->size); )
+      {
+        if(u32Notes == u32Size)
+        {
+          u32Size = (u32Size == 0) ? 1024 : (u32Size * 2);
+          pu32Starts = realloc(pu32Starts, u32Size * sizeof(u32));
+          if(pu32Starts == NULL)
+          {
+            *ppu32Starts_ = NULL;
+            return 0;
+          }
+        }
+
+        pu32Starts[u32Notes++] = u32Position;
+
+        u32Offset++;
+        u32Duration = 0;
+        do
+        {
+          u8Byte = psSong_->phrase_events[u32Offset++];
+          u32Duration = (u32Duration << 7) | (u8Byte & 0x7F);
+        } while(u8Byte & 0x80);
+
+        u32Position += u32Duration;
+      }
+    }
+  }
+
+  *ppu32Starts_ = pu32Starts;
+  return u32Notes;
+
+} /* end SimGetNoteStarts() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCheckSeeking
+
+Description:
+Plays every song in flash from the start, keeping what both buzzers play every ms, then seeks to positions all
+over the song and to the worst case positions (just before a seek point, with the most notes to decode), and
+checks that the buzzers play the same as they did when the song got there on its own.  Then times seeking to
+every position of the longest song and, more closely, to its worst case positions.
+Runs at the song's own tempo, where positions and ms are the same.  Returns FALSE if a check fails.
+*/
+static bool SimCheckSeeking(void)
+{
+  const SongInfoType* psSong;
+  const VoiceType* psVoice;
+  u32* pu32Reference = NULL;
+  u32* apu32Starts[MAX_VOICES];
+  u32 au32Notes[MAX_VOICES];
+  u32 u32Position;
+  u32 u32Checked = 0;
+  u32 u32SeekPoints = 0;
+  u32 u32Decoded;
+  u32 u32WorstDecoded = 0;
+  u32 u32WorstPosition = 0;
+  u32 u32SlowestPosition = 0;
+  u32 u32TotalNotes = 0;
+  u8 u8Longest = 0;
+  double dNs;
+  double dMeanNs;
+  double dWorstNs = 0;
+  struct timespec sStart;
+  struct timespec sEnd;
+  bool bPassed = TRUE;
+
+  MusicPlayerSetTempo(100);
+
+  for(u8 u8Song = 0; bPassed && (u8Song < SONG_LIST_SIZE); u8Song++)
+  {
+    psSong = song_list[u8Song];
+    if(psSong->length != SimGetSongLengthMs(psSong))
+    {
+      fprintf(stderr, "Song %u: length %lu ms in songs.h, its notes add up to %lu ms\n", u8Song + 1,
+              (unsigned long)psSong->length, (unsigned long)SimGetSongLengthMs(psSong));
+      return FALSE;
+    }
+
+    if(psSong->length > song_list[u8Longest]->length)
+    {
+      u8Longest = u8Song;
+    }
+
+    /* What the buzzers play at every position, from the start: periods, or 0 while off */
+    pu32Reference = malloc(psSong->length * SIM_NUM_BUZZERS * sizeof(u32));
+    if(pu32Reference == NULL)
+    {
+      perror("malloc");
+      return FALSE;
+    }
+
+    (u8Song == 0) ? MusicPlayerTogglePlayPause() : MusicPlayerNextSong();
+    for(u32Position = 0; u32Position < psSong->length; u32Position++)
+    {
+      SimRunPlayer1ms();
+      for(u8 i = 0; i < SIM_NUM_BUZZERS; i++)
+      {
+        pu32Reference[(u32Position * SIM_NUM_BUZZERS) + i] = G_asSimBuzzers[i].bOn ? G_asSimBuzzers[i].u32UpdatePeriod : 0;
+      }
+    }
+
+    for(u32Position = 0; bPassed && (u32Position < psSong->length); u32Position += SIM_SEEK_CHECK_STEP_MS)
+    {
+      bPassed = SimCheckSeek(u8Song, pu32Reference, u32Position);
+      u32Checked++;
+    }
+
+    /* The last ms before each seek point decodes the most notes */
+    for(u8 u8Voice = 0; bPassed && (u8Voice < psSong->num_voices); u8Voice++)
+    {
+      psVoice = &psSong->voices[u8Voice];
+      u32SeekPoints += psVoice->num_seek_points;
+
+      for(u16 u16Point = 1; bPassed && (u16Point < psVoice->num_seek_points); u16Point++)
+      {
+        bPassed = SimCheckSeek(u8Song, pu32Reference, psVoice->seek_points[u16Point].position - 1);
+        u32Checked++;
+      }
+    }
+
+    free(pu32Reference);
+  }
+
+  if(!bPassed)
+  {
+    return FALSE;
+  }
+
+  printf("Seeking: %lu positions in %u songs with %lu seek points sound the same as playing up to them\n",
+         (unsigned long)u32Checked, (unsigned)SONG_LIST_SIZE, (unsigned long)u32SeekPoints);
+
+  /* Longest song: notes each seek decodes, against decoding every note from the start */
+  psSong = song_list[u8Longest];
+  for(u8 u8Voice = 0; u8Voice < psSong->num_voices; u8Voice++)
+  {
+    au32Notes[u8Voice] = SimGetNoteStarts(psSong, u8Voice, &apu32Starts[u8Voice]);
+    if(apu32Starts[u8Voice] == NULL)
+    {
+      perror("realloc");
+      return FALSE;
+    }
+    u32TotalNotes += au32Notes[u8Voice];
+  }
+
+  if(u8Longest == 0)
+  {
+    MusicPlayerPreviousSong();
+    MusicPlayerNextSong();
+  }
+  while(MusicPlayerGetCurrentSongIndex() != u8Longest)
+  {
+    MusicPlayerNextSong();
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  for(u32Position = 0; u32Position < psSong->length; u32Position++)
+  {
+    MusicPlayerSeekMs(u32Position);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+  dMeanNs = ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec)) / psSong->length;
+
+  /* Every seek in a voice decodes most just before its next seek point, or the end of the song */
+  for(u8 u8Voice = 0; u8Voice < psSong->num_voices; u8Voice++)
+  {
+    psVoice = &psSong->voices[u8Voice];
+
+    for(u16 u16Point = 1; u16Point <= psVoice->num_seek_points; u16Point++)
+    {
+      u32Position = ((u16Point < psVoice->num_seek_points) ? psVoice->seek_points[u16Point].position : psSong->length) - 1;
+      u32Decoded = SimCountSeekNotes(psSong, (const u32* const*)apu32Starts, au32Notes, u32Position);
+      dNs = SimTimeSeekNs(u32Position, SIM_SEEK_TIMING_REPEATS);
+
+      if(u32Decoded > u32WorstDecoded)
+      {
+        u32WorstDecoded = u32Decoded;
+        u32WorstPosition = u32Position;
+      }
+
+      if(dNs > dWorstNs)
+      {
+        dWorstNs = dNs;
+        u32SlowestPosition = u32Position;
+      }
+    }
+  }
+
+  for(u8 u8Voice = 0; u8Voice < psSong->num_voices; u8Voice++)
+  {
+    free(apu32Starts[u8Voice]);
+  }
+
+  printf("Longest song %u: %s, %.1f s, %lu notes\n", u8Longest + 1, psSong->title, psSong->length / 1000.0,
+         (unsigned long)u32TotalNotes);
+  printf("  seeking to every ms: %.0f ns per seek on this host\n", dMeanNs);
+  printf("  worst case: %lu notes decoded (at %lu ms), slowest seek %.0f ns (at %lu ms)\n",
+         (unsigned long)u32WorstDecoded, (unsigned long)u32WorstPosition, dWorstNs, (unsigned long)u32SlowestPosition);
+
+  return TRUE;
+
+} /* end SimCheckSeeking() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCheckSeek
+
+Description:
+Seeks the song playing to a position, then plays on and checks that the buzzers play what they played at the
+same positions when the song got there from the start (pu32Reference_, a period or 0 per buzzer per ms).
+Returns FALSE and says where if they differ.
+*/
+static bool SimCheckSeek(u8 u8Song_, const u32* pu32Reference_, u32 u32Position_)
+{
+  const SongInfoType* psSong = song_list[u8Song_];
+  u32 u32Period;
+
+  if(!MusicPlayerSeekMs(u32Position_))
+  {
+    fprintf(stderr, "Song %u: seeking to %lu ms failed\n", u8Song_ + 1, (unsigned long)u32Position_);
+    return FALSE;
+  }
+
+  for(u32 u32Ms = u32Position_; (u32Ms < psSong->length) && (u32Ms < u32Position_ + SIM_SEEK_CHECK_MS); u32Ms++)
+  {
+    SimRunPlayer1ms();
+    for(u8 i = 0; i < SIM_NUM_BUZZERS; i++)
+    {
+      u32Period = G_asSimBuzzers[i].bOn ? G_asSimBuzzers[i].u32UpdatePeriod : 0;
+      if(u32Period != pu32Reference_[(u32Ms * SIM_NUM_BUZZERS) + i])
+      {
+        fprintf(stderr, "Song %u: after seeking to %lu ms, the %s buzzer plays %lu at %lu ms instead of %lu\n",
+                u8Song_ + 1, (unsigned long)u32Position_, (i == 0) ? "right" : "left", (unsigned long)u32Period,
+                (unsigned long)u32Ms, (unsigned long)pu32Reference_[(u32Ms * SIM_NUM_BUZZERS) + i]);
+        return FALSE;
+      }
+    }
+  }
+
+  return TRUE;
+
+} /* end SimCheckSeek() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCountSeekNotes
+
+Description:
+Returns how many notes seeking to a position decodes, over all voices: each voice starts from its last seek
+point at or before the position and decodes up to the note playing at the position.
+apu32Starts_ and au32Notes_ are every voice's note positions and note counts from SimGetNoteStarts().
+*/
+static u32 SimCountSeekNotes(const SongInfoType* psSong_, const u32* const* apu32Starts_, const u32* au32Notes_, u32 u32Position_)
+{
+  const VoiceType* psVoice;
+  u32 u32SeekPosition;
+  u32 u32Decoded = 0;
+
+  for(u8 u8Voice = 0; u8Voice < psSong_->num_voices; u8Voice++)
+  {
+    psVoice = &psSong_->voices[u8Voice];
+    u32SeekPosition = 0;
+    for(u16 u16Point = 0; (u16Point < psVoice->num_seek_points) && (psVoice->seek_points[u16Point].position <= u32Position_); u16Point++)
+    {
+      u32SeekPosition = psVoice->seek_points[u16Point].position;
+    }
+
+    for(u32 u32Note = 0; u32Note < au32Notes_[u8Voice]; u32Note++)
+    {
+      if( (apu32Starts_[u8Voice][u32Note] >= u32SeekPosition) && (apu32Starts_[u8Voice][u32Note] <= u32Position_) )
+      {
+        u32Decoded++;
+      }
+    }
+  }
+
+  return u32Decoded;
+
+} /* end SimCountSeekNotes() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimTimeSeekNs
+
+Description:
+Returns the average host time in ns of seeking the song playing to a position, over u32Repeats_ seeks.
+*/
+static double SimTimeSeekNs(u32 u32Position_, u32 u32Repeats_)
+{
+  struct timespec sStart;
+  struct timespec sEnd;
+
+  clock_gettime(CLOCK_MONOTONIC, &sStart);
+  for(u32 i = 0; i < u32Repeats_; i++)
+  {
+    MusicPlayerSeekMs(u32Position_);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &sEnd);
+
+  return ((sEnd.tv_sec - sStart.tv_sec) * 1e9 + (sEnd.tv_nsec - sStart.tv_nsec)) / u32Repeats_;
+
+} /* end SimTimeSeekNs() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimGetStreamedSongLengthMs
+
+Description:
+Same as SimGetSongLengthMs() for a song in the card's library: adds up the durations of its first voice.
+pfImage_ holds the library from its first byte (see SimOpenCardLibrary()).
+*/
+static u32 SimGetStreamedSongLengthMs(FILE* pfImage_, u16 u16Song_)
+{
+  long lRecords = (long)SimReadU32(pfImage_, SONG_LIBRARY_RECORDS_INDEX) * SIM_SD_SECTOR_SIZE;
+  long lSongOffset = (long)SimReadU32(pfImage_, lRecords + ((long)u16Song_ * SONG_RECORD_SIZE) + SONG_RECORD_SECTOR_INDEX) *
+                     SIM_SD_SECTOR_SIZE;
+  u32 u32FirstSector = SimReadU32(pfImage_, lSongOffset + SONG_HEADER_VOICE_INDEX);
+  u32 u32Size = SimReadU32(pfImage_, lSongOffset + SONG_HEADER_VOICE_INDEX + 4);
+  u32 u32Duration;
+  u32 u32LengthMs = 0;
+  int iByte;
+
+  fseek(pfImage_, lSongOffset + ((long)u32FirstSector * SIM_SD_SECTOR_SIZE), SEEK_SET);
+
+  /* Skip each note byte, then read its variable-length duration (see songs.h) */
+  while( (u32Size != 0) && (fgetc(pfImage_) != EOF) )
+  {
+    u32Size--;
+    u32Duration = 0;
+    do
+    {
+      iByte = fgetc(pfImage_);
+      u32Size--;
+      u32Duration = (u32Duration << 7) | ((u32)iByte & 0x7F);
+    } while( (iByte != EOF) && (iByte & 0x80) && (u32Size != 0) );
+
+    u32LengthMs += u32Duration;
+  }
+
+  return u32LengthMs;
+
+} /* end SimGetStreamedSongLengthMs() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimOpenCardLibrary
+
+Description:
+Opens the song library of the card image for SimGetStreamedSongLengthMs().  A library written straight onto
+the card is the image itself; SONGS.LIB on a FAT32 card is copied out to a temporary file sector by sector,
+following the cluster chain fat32.c found when it opened the file.
+Returns NULL if a file cannot be opened.
+*/
+static FILE* SimOpenCardLibrary(const char* pcImage_)
+{
+  FILE* pfImage = fopen(pcImage_, "rb");
+  FILE* pfLibrary;
+  u8 au8Sector[SIM_SD_SECTOR_SIZE];
+  u32 u32CardSector;
+
+  if(pfImage == NULL)
+  {
+    perror(pcImage_);
+    return NULL;
+  }
+
+  if(FatGetStatus() != FAT_FILE_OPEN)
+  {
+    return pfImage;
+  }
+
+  pfLibrary = tmpfile();
+  if(pfLibrary == NULL)
+  {
+    perror("tmpfile");
+    fclose(pfImage);
+    return NULL;
+  }
+
+  for(u32 u32Sector = 0; FatGetCardSector(u32Sector, &u32CardSector); u32Sector++)
+  {
+    memset(au8Sector, 0, sizeof(au8Sector));
+    fseek(pfImage, (long)u32CardSector * SIM_SD_SECTOR_SIZE, SEEK_SET);
+    if(fread(au8Sector, 1, sizeof(au8Sector), pfImage) != sizeof(au8Sector))
+    {
+      clearerr(pfImage);
+    }
+    fwrite(au8Sector, 1, sizeof(au8Sector), pfLibrary);
+  }
+
+  fclose(pfImage);
+  return pfLibrary;
+
+} /* end SimOpenCardLibrary() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimReadCardTitles
+
+Description:
+Reads the title and artist of every song on the card from the library's index, one after the other as a song
+list on the LCD would, while the player carries on.  Prints how many sector reads and ms that took.
+Returns a buffer with each song's title and artist in SONG_STREAM_TEXT_SIZE bytes each, to be freed, or NULL
+if one could not be read.
+*/
+static char* SimReadCardTitles(u16 u16Songs_)
+{
+  char* pcTitles = calloc((size_t)u16Songs_ * 2 + 1, SONG_STREAM_TEXT_SIZE);
+  u32 u32Reads = SimSdGetReads();
+  u32 u32StartMs = G_u32SystemTime1ms;
+  u32 u32WaitMs;
+
+  if(pcTitles == NULL)
+  {
+    perror("calloc");
+    return NULL;
+  }
+
+  for(u16 u16Song = 0; u16Song < u16Songs_; u16Song++)
+  {
+    SongStreamRequestInfo(u16Song);
+    for(u32WaitMs = 0; !SongStreamIsInfoReady(u16Song); u32WaitMs++)
+    {
+      if(u32WaitMs == 1000)
+      {
+        fprintf(stderr, "Card song %u: title could not be read from the index\n", u16Song + 1);
+        free(pcTitles);
+        return NULL;
+      }
+
+      SimRunPlayer1ms();
+    }
+
+    strcpy(&pcTitles[u16Song * 2 * SONG_STREAM_TEXT_SIZE], SongStreamGetInfoTitle());
+    strcpy(&pcTitles[(u16Song * 2 + 1) * SONG_STREAM_TEXT_SIZE], SongStreamGetInfoArtist());
+  }
+
+  if(u16Songs_ != 0)
+  {
+    printf("SD card: titles of %u songs read from the index in %lu ms with %lu sector reads\n", u16Songs_,
+           (unsigned long)(G_u32SystemTime1ms - u32StartMs), (unsigned long)(SimSdGetReads() - u32Reads));
+  }
+  return pcTitles;
+
+} /* end SimReadCardTitles() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimWriteCardImage
+
+Description:
+Writes every song in song_list to an SD card disk image in the layout song_stream.c reads (see song_stream.h),
+so the same songs can be played from the card with -d and checked against the flash ones.
+Returns FALSE if the image cannot be written.
+*/
+static bool SimWriteCardImage(const char* pcImage_)
+{
+  FILE* pfImage = fopen(pcImage_, "wb");
+  u8 au8Library[SIM_SD_SECTOR_SIZE];
+  u8 au8Record[SONG_RECORD_SIZE];
+  u32 u32RecordsSector = 1;
+  u32 u32StringsSector = u32RecordsSector + ((SONG_LIST_SIZE + SONG_RECORDS_PER_SECTOR - 1) / SONG_RECORDS_PER_SECTOR);
+  u32 u32StringsSize = 0;
+  u32 u32Sector;
+
+  if(pfImage == NULL)
+  {
+    perror(pcImage_);
+    return FALSE;
+  }
+
+  /* Size the strings first: the songs follow them */
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    SimWriteStringToImage(NULL, 0, &u32StringsSize, song_list[u8Song]->title);
+    SimWriteStringToImage(NULL, 0, &u32StringsSize, song_list[u8Song]->artist);
+  }
+  u32Sector = u32StringsSector + ((u32StringsSize + SIM_SD_SECTOR_SIZE - 1) / SIM_SD_SECTOR_SIZE);
+
+  /* Library header, then the index and strings, with the songs following them in order */
+  memset(au8Library, 0, sizeof(au8Library));
+  memcpy(au8Library, SONG_LIBRARY_MAGIC, SONG_STREAM_MAGIC_SIZE);
+  SimPutU16(&au8Library[SONG_LIBRARY_COUNT_INDEX], SONG_LIST_SIZE);
+  SimPutU32(&au8Library[SONG_LIBRARY_RECORDS_INDEX], u32RecordsSector);
+  SimPutU32(&au8Library[SONG_LIBRARY_STRINGS_INDEX], u32StringsSector);
+
+  u32StringsSize = 0;
+  for(u8 u8Song = 0; u8Song < SONG_LIST_SIZE; u8Song++)
+  {
+    memset(au8Record, 0, sizeof(au8Record));
+    SimPutU32(&au8Record[SONG_RECORD_SECTOR_INDEX], u32Sector);
+    SimPutU32(&au8Record[SONG_RECORD_TITLE_INDEX],
+              SimWriteStringToImage(pfImage, u32StringsSector, &u32StringsSize, song_list[u8Song]->title));
+    SimPutU32(&au8Record[SONG_RECORD_ARTIST_INDEX],
+              SimWriteStringToImage(pfImage, u32StringsSector, &u32StringsSize, song_list[u8Song]->artist));
+
+    fseek(pfImage, ((long)u32RecordsSector * SIM_SD_SECTOR_SIZE) + ((long)u8Song * SONG_RECORD_SIZE), SEEK_SET);
+    fwrite(au8Record, 1, sizeof(au8Record), pfImage);
+
+    u32Sector += SimWriteSongToImage(pfImage, u32Sector, song_list[u8Song]);
+  }
+
+  fseek(pfImage, 0, SEEK_SET);
+  fwrite(au8Library, 1, sizeof(au8Library), pfImage);
+
+  if(fclose(pfImage) != 0)
+  {
+    perror(pcImage_);
+    return FALSE;
+  }
+
+  printf("%u songs written to %s, %lu sectors\n", (unsigned)SONG_LIST_SIZE, pcImage_, (unsigned long)u32Sector);
+  return TRUE;
+
+} /* end SimWriteCardImage() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimWriteStringToImage
+
+Description:
+Places a title or artist in the library's strings, which start at sector u32StringsSector_: at *pu32Offset_, or
+at the next sector if it would cross a sector boundary.  Writes it if pfImage_ is not NULL, moves *pu32Offset_
+past it and returns the offset it was placed at.
+*/
+static u32 SimWriteStringToImage(FILE* pfImage_, u32 u32StringsSector_, u32* pu32Offset_, const char* pcText_)
+{
+  u32 u32Length = strlen(pcText_);
+  u32 u32Offset;
+
+  if(u32Length > (SONG_STREAM_TEXT_SIZE - 1))
+  {
+    u32Length = SONG_STREAM_TEXT_SIZE - 1;
+  }
+
+  if( ((*pu32Offset_ % SIM_SD_SECTOR_SIZE) + u32Length + 1) > SIM_SD_SECTOR_SIZE )
+  {
+    *pu32Offset_ += SIM_SD_SECTOR_SIZE - (*pu32Offset_ % SIM_SD_SECTOR_SIZE);
+  }
+
+  u32Offset = *pu32Offset_;
+  if(pfImage_ != NULL)
+  {
+    fseek(pfImage_, ((long)u32StringsSector_ * SIM_SD_SECTOR_SIZE) + (long)u32Offset, SEEK_SET);
+    fwrite(pcText_, 1, u32Length, pfImage_);
+    fputc('\0', pfImage_);
+  }
+
+  *pu32Offset_ += u32Length + 1;
+  return u32Offset;
+
+} /* end SimWriteStringToImage() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimWriteSongToImage
+
+Description:
+Writes one song at sector u32Sector_ of the image: its header, then each voice's playlist written out in full
+starting on a new sector.  Returns the number of sectors used.
+*/
+static u32 SimWriteSongToImage(FILE* pfImage_, u32 u32Sector_, const SongInfoType* psSong_)
+{
+  u8 au8Header[SIM_SD_SECTOR_SIZE];
+  const VoiceType* psVoice;
+  const PhraseType* psPhrase;
+  long lSongOffset = (long)u32Sector_ * SIM_SD_SECTOR_SIZE;
+  u32 u32VoiceSector = 1;
+  u32 u32Size;
+  u8 u8NumVoices = (psSong_->num_voices > SONG_STREAM_MAX_VOICES) ? SONG_STREAM_MAX_VOICES : psSong_->num_voices;
+
+  memset(au8Header, 0, sizeof(au8Header));
+  memcpy(au8Header, SONG_HEADER_MAGIC, SONG_STREAM_MAGIC_SIZE);
+  au8Header[SONG_HEADER_VOICES_INDEX] = u8NumVoices;
+  strncpy((char*)&au8Header[SONG_HEADER_TITLE_INDEX], psSong_->title, SONG_STREAM_TEXT_SIZE - 1);
+  strncpy((char*)&au8Header[SONG_HEADER_ARTIST_INDEX], psSong_->artist, SONG_STREAM_TEXT_SIZE - 1);
+
+  for(u8 u8Voice = 0; u8Voice < u8NumVoices; u8Voice++)
+  {
+    psVoice = &psSong_->voices[u8Voice];
+    fseek(pfImage_, lSongOffset + ((long)u32VoiceSector * SIM_SD_SECTOR_SIZE), SEEK_SET);
+    u32Size = 0;
+
+    for(u16 u16Entry = 0; u16Entry < psVoice->playlist_size; u16Entry++)
+    {
+      psPhrase = &psSong_->phrases[psVoice->playlist[u16Entry].phrase];
+
+      for(u16 u16Repeat = 0; u16Repeat < psVoice->playlist[u16Entry].repeat; u16Repeat++)
+      {
+        fwrite(&psSong_->phrase_events[psPhrase->offset], 1, psPhrase->size, pfImage_);
+        u32Size += psPhrase->size;
+      }
+    }
+
+    SimPutU32(&au8Header[SONG_HEADER_VOICE_INDEX + (u8Voice * 8)], u32VoiceSector);
+    SimPutU32(&au8Header[SONG_HEADER_VOICE_INDEX + (u8Voice * 8) + 4], u32Size);
+
+    u32VoiceSector += (u32Size + SIM_SD_SECTOR_SIZE - 1) / SIM_SD_SECTOR_SIZE;
+  }
+
+  /* Pad the last sector so the next song starts on a sector boundary */
+  fseek(pfImage_, lSongOffset + ((long)u32VoiceSector * SIM_SD_SECTOR_SIZE) - 1, SEEK_SET);
+  fputc(0, pfImage_);
+
+  fseek(pfImage_, lSongOffset, SEEK_SET);
+  fwrite(au8Header, 1, sizeof(au8Header), pfImage_);
+
+  return u32VoiceSector;
+
+} /* end SimWriteSongToImage() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimReadU32
+
+Description:
+Reads a little-endian u32 at lOffset_ in the file.
+*/
+static u32 SimReadU32(FILE* pfFile_, long lOffset_)
+{
+  u8 au8Bytes[4] = {0, 0, 0, 0};
+
+  fseek(pfFile_, lOffset_, SEEK_SET);
+  if(fread(au8Bytes, 1, sizeof(au8Bytes), pfFile_) != sizeof(au8Bytes))
+  {
+    clearerr(pfFile_);
+  }
+
+  return (u32)au8Bytes[0] | ((u32)au8Bytes[1] << 8) | ((u32)au8Bytes[2] << 16) | ((u32)au8Bytes[3] << 24);
+
+} /* end SimReadU32() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimPutU16 / SimPutU32
+
+Description:
+Store little-endian numbers in a sector being built.
+*/
+static void SimPutU16(u8* pu8Bytes_, u16 u16Value_)
+{
+  pu8Bytes_[0] = (u8)u16Value_;
+  pu8Bytes_[1] = (u8)(u16Value_ >> 8);
+
+} /* end SimPutU16() */
+
+static void SimPutU32(u8* pu8Bytes_, u32 u32Value_)
+{
+  for(u8 i = 0; i < 4; i++)
+  {
+    pu8Bytes_[i] = (u8)(u32Value_ >> (8 * i));
+  }
+
+} /* end SimPutU32() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimOpenSong
+
+Description:
+Opens the output files for a song and starts its timeline and audio at the current time.
+Returns FALSE if a file cannot be opened.
+*/
+static bool SimOpenSong(const char* pcFolder_, u16 u16Song_, const char* pcTitle_, const char* pcArtist_, u32 u32LengthMs_)
+{
+  char acPath[SIM_MAX_PATH];
+
+  snprintf(acPath, sizeof(acPath), "%s/song%u_timeline.txt", pcFolder_, u16Song_ + 1);
+  Sim_pfTimeline = fopen(acPath, "w");
+  if(Sim_pfTimeline == NULL)
+  {
+    perror(acPath);
+    return FALSE;
+  }
+
+  fprintf(Sim_pfTimeline, "# Song %u: %s - %s\n", u16Song_ + 1, pcTitle_, pcArtist_);
+  fprintf(Sim_pfTimeline, "# Length: %lu ms\n", (unsigned long)u32LengthMs_);
+  fprintf(Sim_pfTimeline, "# time_ms buzzer period frequency_hz\n");
+
+  snprintf(acPath, sizeof(acPath), "%s/song%u_leds.txt", pcFolder_, u16Song_ + 1);
+  Sim_pfLeds = fopen(acPath, "w");
+  if(Sim_pfLeds == NULL)
+  {
+    perror(acPath);
+    return FALSE;
+  }
+
+  fprintf(Sim_pfLeds, "# Song %u: %s - %s\n", u16Song_ + 1, pcTitle_, pcArtist_);
+  fprintf(Sim_pfLeds, "# Length: %lu ms\n", (unsigned long)u32LengthMs_);
+  fprintf(Sim_pfLeds, "# time_ms led duty_percent\n");
+
+  snprintf(acPath, sizeof(acPath), "%s/song%u_lcd.txt", pcFolder_, u16Song_ + 1);
+  Sim_pfLcd = fopen(acPath, "w");
+  if(Sim_pfLcd == NULL)
+  {
+    perror(acPath);
+    return FALSE;
+  }
+
+  fprintf(Sim_pfLcd, "# Song %u: %s - %s\n", u16Song_ + 1, pcTitle_, pcArtist_);
+  fprintf(Sim_pfLcd, "# Length: %lu ms\n", (unsigned long)u32LengthMs_);
+  fprintf(Sim_pfLcd, "# time_ms line |text|\n");
+
+  if(Sim_bWriteWav)
+  {
+    snprintf(acPath, sizeof(acPath), "%s/song%u.wav", pcFolder_, u16Song_ + 1);
+    Sim_pfWav = fopen(acPath, "wb");
+    if(Sim_pfWav == NULL)
+    {
+      perror(acPath);
+      return FALSE;
+    }
+
+    /* Sizes are filled in once the song is done */
+    SimWriteWavHeader(0);
+  }
+
+  Sim_u32SongStartTime = G_u32SystemTime1ms;
+  Sim_u64SamplesRendered = 0;
+  Sim_u32EdgeCount = 0;
+  G_u32SimLedWrites = 0;
+  memset(&G_sSimTwi, 0, sizeof(G_sSimTwi));
+
+  /* Start the timeline from the buzzers' current state so the first line of each song is a real edge */
+  for(u8 i = 0; i < SIM_NUM_BUZZERS; i++)
+  {
+    Sim_abLoggedOn[i] = G_asSimBuzzers[i].bOn;
+    Sim_au32LoggedPeriod[i] = G_asSimBuzzers[i].u32UpdatePeriod;
+  }
+
+  for(u8 i = 0; i < SIM_NUM_LEDS; i++)
+  {
+    Sim_aeLoggedLedRate[i] = G_asSimLeds[i].eRate;
+  }
+
+  /* The LCD trace starts with what the LCD shows */
+  memset(Sim_aau8LoggedLcd, 0, sizeof(Sim_aau8LoggedLcd));
+
+  return TRUE;
+
+} /* end SimOpenSong() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimCloseSong
+
+Description:
+Finishes the WAV file with its final sizes and closes the output files.
+*/
+static void SimCloseSong(void)
+{
+  if(Sim_pfWav != NULL)
+  {
+    SimFlushWav();
+    fseek(Sim_pfWav, 0, SEEK_SET);
+    SimWriteWavHeader((u32)(Sim_u64SamplesRendered * 4));
+    fclose(Sim_pfWav);
+    Sim_pfWav = NULL;
+  }
+
+  fclose(Sim_pfTimeline);
+  Sim_pfTimeline = NULL;
+  fclose(Sim_pfLeds);
+  Sim_pfLeds = NULL;
+  fclose(Sim_pfLcd);
+  Sim_pfLcd = NULL;
+
+} /* end SimCloseSong() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimFlushWav
+
+Description:
+Writes the buffered frames to the WAV file as little-endian 16-bit samples.
+*/
+static void SimFlushWav(void)
+{
+  for(u32 i = 0; i < (Sim_u32WavBufferFrames * 2); i++)
+  {
+    SimWriteU16(Sim_pfWav, (u16)Sim_as16WavBuffer[i]);
+  }
+
+  Sim_u32WavBufferFrames = 0;
+
+} /* end SimFlushWav() */
+
+
+/* Little-endian writes, since WAV files are little-endian whatever the host is */
+static void SimWriteU16(FILE* pfFile_, u16 u16Value_)
+{
+  fputc(u16Value_ & 0xFF, pfFile_);
+  fputc(u16Value_ >> 8, pfFile_);
+} /* end SimWriteU16() */
+
+static void SimWriteU32(FILE* pfFile_, u32 u32Value_)
+{
+  SimWriteU16(pfFile_, (u16)(u32Value_ & 0xFFFF));
+  SimWriteU16(pfFile_, (u16)(u32Value_ >> 16));
+} /* end SimWriteU32() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SimWriteWavHeader
+
+Description:
+Writes the header of a 16-bit stereo PCM WAV file with u32DataSize_ bytes of samples.
+*/
+static void SimWriteWavHeader(u32 u32DataSize_)
+{
+  fwrite("RIFF", 1, 4, Sim_pfWav);
+  SimWriteU32(Sim_pfWav, SIM_WAV_HEADER_SIZE - 8 + u32DataSize_);
+  fwrite("WAVEfmt ", 1, 8, Sim_pfWav);
+  SimWriteU32(Sim_pfWav, 16);                          /* fmt chunk size */
+  SimWriteU16(Sim_pfWav, 1);                           /* PCM */
+  SimWriteU16(Sim_pfWav, 2);                           /* Channels */
+  SimWriteU32(Sim_pfWav, Sim_u32SampleRate);
+  SimWriteU32(Sim_pfWav, Sim_u32SampleRate * 4);       /* Bytes per second */
+  SimWriteU16(Sim_pfWav, 4);                           /* Bytes per frame */
+  SimWriteU16(Sim_pfWav, 16);                          /* Bits per sample */
+  fwrite("data", 1, 4, Sim_pfWav);
+  SimWriteU32(Sim_pfWav, u32DataSize_);
+
+} /* end SimWriteWavHeader() */
+
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
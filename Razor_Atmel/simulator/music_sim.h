@@ -0,0 +1,106 @@
+/***********************************************************************************************************************
+File: music_sim.h
+
+Description:
+Header file for music_sim.c and board_stubs.c, the host simulator that renders the music player to WAV.
+***********************************************************************************************************************/
+
+#ifndef __MUSIC_SIM_H
+#define __MUSIC_SIM_H
+
+/***********************************************************************************************************************
+Type Definitions
+***********************************************************************************************************************/
+/* State of one emulated PWM audio channel */
+typedef struct
+{
+  bool bOn;                                 /* Channel enabled */
+  u32 u32Period;                            /* Period in CPRE_CLCK cycles currently being played */
+  u32 u32UpdatePeriod;                      /* Period latched while running, takes effect at the end of the current period */
+} SimBuzzerType;
+
+/* Traffic on the emulated TWI bus */
+typedef struct
+{
+  u32 u32Messages;                          /* Messages queued with TWI0WriteByte() and TWI0WriteData() */
+  u32 u32Transfers;                         /* START conditions: messages after a STOP start a new transfer */
+  u32 u32Bytes;                             /* Bytes on the bus, including the slave address of each transfer */
+  u32 u32CgramChars;                        /* Custom characters written to the LCD's CGRAM */
+} SimTwiType;
+
+/* A message queued on the emulated TWI bus, for QueryMessageStatus() */
+typedef struct
+{
+  u32 u32Token;                             /* 0 when the entry is free */
+  u32 u32StartMs;                           /* Pass the TWI task starts sending it on */
+  u32 u32DoneMs;                            /* Pass the TWI task finds it sent on, and marks it COMPLETE */
+} SimTwiMessageType;
+
+/* A custom character the LCD trace knows, and the character it is written as */
+typedef struct
+{
+  u8 au8Rows[LCD_CGRAM_CHAR_SIZE];          /* Same as lcd_control.c's glyph_patterns */
+  char cText;
+} SimLcdGlyphType;
+
+/* State of one emulated LED, as LedUpdate() keeps it */
+typedef struct
+{
+  LedRateType eRate;                        /* Duty cycle, LED_PWM_0 when off */
+  bool bFading;                             /* Set by LedFade() until the LED has faded out */
+  u16 u16FadeStepMs;                        /* Time at each PWM level while fading */
+  u16 u16FadeCount;                         /* ms left at the current level */
+} SimLedType;
+
+/* A note edge on one buzzer, as the timeline logs it */
+typedef struct
+{
+  u32 u32Tick;                              /* TC1 ticks since the song started */
+  u32 u32Period;                            /* Period the buzzer plays from here, 0 when it goes off */
+  u8 u8Buzzer;
+} SimEdgeType;
+
+
+/***********************************************************************************************************************
+Constants / Definitions
+***********************************************************************************************************************/
+#define SIM_NUM_BUZZERS       (u8)2         /* Index 0 is BUZZER1 (right), index 1 is BUZZER2 (left) */
+#define SIM_NUM_LEDS          (u8)8         /* WHITE - RED, the LEDs the applications light */
+#define SIM_PWM_PERIOD_WRITES (u32)2        /* PWMAudioSetPeriod(): the period and duty cycle registers */
+#define SIM_SD_SECTOR_SIZE    (u32)512
+#define SIM_SD_READ_BUFFERS   (u8)8         /* Same as SD_READ_BUFFERS in sdcard.h */
+#define SIM_SD_DEFAULT_READ_MS (u32)8       /* Time sdcard.c takes to read a sector: about one state machine pass per step */
+#define SIM_LCD_LINES         (u8)2
+#define SIM_LCD_LINE_RAM      (u8)40        /* Characters of display RAM per line, 20 of them on the screen */
+#define SIM_LCD_CGRAM_SIZE    (u8)64        /* LCD_CGRAM_CHARS custom characters of LCD_CGRAM_CHAR_SIZE rows */
+#define SIM_LCD_UNKNOWN_GLYPH '?'           /* Trace character of a custom character not in Sim_asLcdGlyphs */
+#define SIM_TWI_BIT_NS        (u32)5000     /* TWI0_CWGR_INIT: 200 kHz from MCK */
+#define SIM_TWI_BYTE_BITS     (u32)9        /* 8 data bits and the slave's acknowledge */
+#define SIM_TWI_FRAME_BITS    (u32)2        /* START and STOP conditions of a transfer */
+#define SIM_TWI_STATUS_SIZE   (u8)16        /* Messages whose status is kept, as STATUS_QUEUE_SIZE in messaging.h */
+#define SIM_LCD_POWER_UP_US   (u32)40000    /* Time after power-up before the LCD takes anything */
+#define SIM_LCD_EXECUTE_US    (u32)27       /* Time the LCD takes for a data write and most commands */
+#define SIM_LCD_CLEAR_US      (u32)1080     /* Time the LCD takes to clear the screen or go home */
+#define SIM_LCD_FOLLOWER_US   (u32)200000   /* Time the LCD's voltage follower takes to settle after it is set */
+
+
+/***********************************************************************************************************************
+Function Declarations
+***********************************************************************************************************************/
+/* board_stubs.c */
+void SimBoardReset(void);
+void SimAdvance1ms(void);
+bool SimSdInsert(const char* pcImage_, u32 u32ReadMs_);
+u32 SimSdGetReads(void);
+void SimLedUpdate(void);
+const u8* SimLcdGetLine(u8 u8Line_);
+void SimTwiSetFull(bool bFull_);
+void SimLcdPowerUp(void);
+u32 SimLcdGetBusyBytes(void);
+
+/* music_sim.c */
+void SimRenderTo(void);
+void SimLogBuzzer(u8 u8Buzzer_);
+void SimLogLed(u8 u8Led_);
+
+#endif /* __MUSIC_SIM_H */